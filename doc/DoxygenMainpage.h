@@ -85,6 +85,18 @@ The falcon provides a grip connection mechanism that allows the user to attach m
 The falcon has firmware that is loaded on first connection to the host computer. For most needs, firmware is important because it defines the communications format for the falcon.
 */
 
+/**
+@defgroup EstimatorClasses Velocity Estimator Classes
+
+Velocity estimator classes turn the quantized encoder values received from the falcon into joint velocity and acceleration estimates on the I/O thread, for rendering damping, friction and inertia without differentiating positions at application rate.
+*/
+
+/**
+@defgroup HapticClasses Haptic Rendering Classes
+
+Haptic rendering classes compute contact forces against scenes too large or detailed for libnifalcon::FalconForceField (triangle meshes and the like). They are handed to libnifalcon::FalconDevice::setHapticRenderer and run on the I/O thread, with scene updates passed in from the application thread without locking.
+*/
+
 /**
 @defgroup UtilityClasses Utility Classes
 
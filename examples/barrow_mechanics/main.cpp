@@ -14,7 +14,7 @@
 #include "falcon/core/FalconDevice.h"
 #include "falcon/firmware/FalconFirmwareNovintSDK.h"
 #include "falcon/util/FalconCLIBase.h"
-#include "falcon/util/FalconFirmwareBinaryNvent.h"
+#include "falcon/firmware/FalconFirmwareImages.h"
 #include "falcon/kinematic/stamper/StamperUtils.h"
 #include "falcon/core/FalconGeometry.h"
 #include "falcon/gmtl/gmtl.h"
@@ -63,17 +63,10 @@ bool initialise()
 	if(!firmware_loaded)
 	{
 		std::cout << "Loading firmware" << std::endl;
-		uint8_t* firmware_block;
-		long firmware_size;
 		{
-
-			firmware_block = const_cast<uint8_t*>(NOVINT_FALCON_NVENT_FIRMWARE);
-			firmware_size = NOVINT_FALCON_NVENT_FIRMWARE_SIZE;
-
-
 			for(int i = 0; i < 10; ++i)
 			{
-				if(!falcon.getFalconFirmware()->loadFirmware(skip_checksum, NOVINT_FALCON_NVENT_FIRMWARE_SIZE, const_cast<uint8_t*>(NOVINT_FALCON_NVENT_FIRMWARE)))
+				if(!falcon.getFalconFirmware()->loadFirmwareImage(skip_checksum, FalconFirmwareImages::DEFAULT_IMAGE))
 
 				{
 					cout << "Firmware loading try failed";
@@ -451,9 +444,9 @@ int main(int argc, char* argv[])
 		////////////////////////////////////////////
 		//Dynamics
 
-		//Convert force to motor torque values:
-		J.setTranspose(J.getData());
-		gmtl::Vec3d torque = J * force;
+		//Convert force to motor torque values, torque = J' * force. setTranspose can't transpose
+		//in place, so multiply by the transpose directly.
+		gmtl::Vec3d torque = gmtl::xformTransposeExpr(J, force);
 
 
 		//Now, we must scale the torques to avoid saturation of a motor
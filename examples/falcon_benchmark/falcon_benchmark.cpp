@@ -0,0 +1,974 @@
+/***
+ * @file falcon_benchmark.cpp
+ * @brief Timing and accuracy benchmarks for the per-loop parts of the libnifalcon pipeline
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <chrono>
+#include <type_traits>
+#include "falcon/core/FalconDevice.h"
+#include "falcon/core/BasicFalconDevice.h"
+#include "falcon/core/FalconClock.h"
+#include "falcon/core/FalconForceField.h"
+#include "falcon/comm/FalconCommSimulated.h"
+#include "falcon/firmware/FalconFirmwareNovintSDK.h"
+#include "falcon/kinematic/FalconKinematicStamper.h"
+#include "falcon/grip/FalconGripFourButton.h"
+#include "falcon/estimator/FalconVelocityEstimatorFOAW.h"
+#include "falcon/estimator/FalconVelocityEstimatorSavitzkyGolay.h"
+#include "falcon/estimator/FalconVelocityEstimatorKalman.h"
+#include "falcon/haptic/FalconHapticMesh.h"
+#include "falcon/haptic/FalconHapticPointCloud.h"
+#include "falcon/core/FalconPointFit.h"
+#include "falcon/gmtl/Numerics/Eigen.h"
+#include "falcon/gmtl/Numerics/SymmetricEigen3.h"
+#include "falcon/cpp-optparse/OptionParser.h"
+
+using namespace libnifalcon;
+
+/**
+ * Finite difference of consecutive samples, as applications do on getPosition(). Only here as a baseline.
+ */
+class FalconVelocityEstimatorDifference : public FalconVelocityEstimator
+{
+protected:
+	virtual void update(const std::array<double, 3>& angles, double time)
+	{
+		if(m_hasLast && time > m_lastTime)
+		{
+			double dt = time - m_lastTime;
+			for(int i = 0; i < 3; ++i)
+			{
+				double v = (angles[i] - m_lastAngles[i]) / dt;
+				m_acceleration[i] = (v - m_velocity[i]) / dt;
+				m_velocity[i] = v;
+			}
+		}
+		m_lastAngles = angles;
+		m_lastTime = time;
+		m_hasLast = true;
+	}
+	virtual void resetHistory() { m_hasLast = false; }
+	std::array<double, 3> m_lastAngles;
+	double m_lastTime = 0.0;
+	bool m_hasLast = false;
+};
+
+std::shared_ptr<FalconVelocityEstimator> createEstimator(int index, std::string& name)
+{
+	switch(index)
+	{
+	case 0: name = "difference"; return std::make_shared<FalconVelocityEstimatorDifference>();
+	case 1: name = "foaw"; return std::make_shared<FalconVelocityEstimatorFOAW>();
+	case 2: name = "savitzky-golay"; return std::make_shared<FalconVelocityEstimatorSavitzkyGolay>();
+	case 3: name = "kalman"; return std::make_shared<FalconVelocityEstimatorKalman>();
+	}
+	return std::shared_ptr<FalconVelocityEstimator>();
+}
+
+/**
+ * Feeds a quantized, jittered joint space sinusoid straight to each estimator, timing the update and
+ * comparing the estimates against the analytic derivatives.
+ */
+void benchmarkEstimators(optparse::Values& options)
+{
+	const unsigned int samples = (unsigned int)options.get("samples");
+	const double frequency = (double)options.get("frequency");
+	const double amplitude = (double)options.get("amplitude");
+	const double jitter = (double)options.get("jitter") * 1e-6;
+	const double resolution = FalconVelocityEstimator::getEncoderResolution();
+	const double w = 2.0 * PI * frequency;
+
+	//Pregenerate the input, so only the estimator is timed
+	std::vector<uint64_t> times(samples);
+	std::vector<std::array<int, 3> > encoders(samples);
+	srand(1);
+	for(unsigned int k = 0; k < samples; ++k)
+	{
+		double t = k * 0.001 + jitter * ((double)rand() / RAND_MAX - 0.5);
+		times[k] = (uint64_t)(t * 1e9) + 1000000000ULL;
+		for(int i = 0; i < 3; ++i)
+		{
+			encoders[k][i] = (int)std::floor(amplitude * std::sin(w * t + i) / resolution + 0.5);
+		}
+	}
+
+	printf("Joint space estimators: %u samples at 1kHz, %.1fHz sinusoid, %.2frad amplitude, %.0fus jitter\n",
+		   samples, frequency, amplitude, jitter * 1e6);
+	printf("%-16s %10s %14s %14s\n", "estimator", "ns/sample", "vel rms rad/s", "acc rms rad/s2");
+	for(int e = 0; e < 4; ++e)
+	{
+		std::string name;
+		std::shared_ptr<FalconVelocityEstimator> estimator = createEstimator(e, name);
+		double vel_error = 0.0, acc_error = 0.0;
+		unsigned int count = 0;
+		uint64_t elapsed = 0;
+		for(unsigned int k = 0; k < samples; ++k)
+		{
+			uint64_t start = getFalconTimestamp();
+			estimator->addSample(encoders[k], times[k]);
+			elapsed += getFalconTimestamp() - start;
+			//Give every estimator time to fill its history before scoring
+			if(k < 100)
+			{
+				continue;
+			}
+			double t = (double)(times[k] - 1000000000ULL) / 1e9;
+			for(int i = 0; i < 3; ++i)
+			{
+				double dv = estimator->getJointVelocity()[i] - amplitude * w * std::cos(w * t + i);
+				double da = estimator->getJointAcceleration()[i] + amplitude * w * w * std::sin(w * t + i);
+				vel_error += dv * dv;
+				acc_error += da * da;
+			}
+			count += 3;
+		}
+		printf("%-16s %10.1f %14.4f %14.2f\n", name.c_str(), (double)elapsed / samples,
+			   std::sqrt(vel_error / count), std::sqrt(acc_error / count));
+	}
+}
+
+/**
+ * Runs a simulated falcon through a cartesian circle at ~1kHz and compares FalconDevice::getVelocity
+ * against the analytic velocity, exercising the whole I/O loop and the jacobian mapping.
+ */
+void benchmarkPipeline(optparse::Values& options)
+{
+	const double duration = (double)options.get("duration");
+	const double radius = 0.02;
+	const double w = 2.0 * PI * 0.5;
+	printf("\nDevice pipeline: simulated falcon, %.0fmm radius circle at 0.5Hz, %.1fs per estimator\n", radius * 1000.0, duration);
+	printf("%-16s %10s %14s %14s\n", "estimator", "ns/loop", "vel rms m/s", "speed m/s");
+	for(int e = 0; e < 4; ++e)
+	{
+		std::string name;
+		FalconDevice dev;
+		dev.setFalconComm<FalconCommSimulated>();
+		dev.setFalconFirmware<FalconFirmwareNovintSDK>();
+		dev.setFalconKinematic<FalconKinematicStamper>();
+		dev.open(0);
+		dev.getFalconFirmware()->setHomingMode(true);
+		switch(e)
+		{
+		case 0: name = "difference"; dev.setFalconVelocityEstimator<FalconVelocityEstimatorDifference>(); break;
+		case 1: name = "foaw"; dev.setFalconVelocityEstimator<FalconVelocityEstimatorFOAW>(); break;
+		case 2: name = "savitzky-golay"; dev.setFalconVelocityEstimator<FalconVelocityEstimatorSavitzkyGolay>(); break;
+		case 3: name = "kalman"; dev.setFalconVelocityEstimator<FalconVelocityEstimatorKalman>(); break;
+		}
+		std::shared_ptr<FalconCommSimulated> comm = std::static_pointer_cast<FalconCommSimulated>(dev.getFalconComm());
+		std::array<double, 3> origin;
+		dev.getFalconKinematic()->getWorkspaceOrigin(origin);
+		origin[2] = 0.11;
+
+		uint64_t start = getFalconTimestamp();
+		uint64_t elapsed = 0;
+		unsigned int loops = 0, count = 0;
+		double error = 0.0;
+		while(true)
+		{
+			double t = (double)(getFalconTimestamp() - start) / 1e9;
+			if(t > duration)
+			{
+				break;
+			}
+			std::array<double, 3> pos = {{origin[0] + radius * std::cos(w * t), origin[1] + radius * std::sin(w * t), origin[2]}}, angles;
+			dev.getFalconKinematic()->getAngles(pos, angles);
+			comm->setAngles(angles, dev.getFalconKinematic()->getGeometry());
+
+			uint64_t loop_start = getFalconTimestamp();
+			dev.runIOLoop();
+			elapsed += getFalconTimestamp() - loop_start;
+			++loops;
+			if(t > 0.5)
+			{
+				std::array<double, 3> v = dev.getVelocity();
+				double dx = v[0] + radius * w * std::sin(w * t);
+				double dy = v[1] - radius * w * std::cos(w * t);
+				error += dx * dx + dy * dy + v[2] * v[2];
+				++count;
+			}
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		printf("%-16s %10.1f %14.4f %14.4f\n", name.c_str(), (double)elapsed / loops, std::sqrt(error / count), radius * w);
+		dev.close();
+	}
+}
+
+/**
+ * Times the kinematic half of an I/O loop (FK for the new encoder values, then mapping a force at the
+ * resulting position), with and without the FK jacobian cache
+ */
+void benchmarkKinematics(optparse::Values& options)
+{
+	const unsigned int samples = (unsigned int)options.get("samples") / 10;
+	FalconKinematicStamper kinematic;
+	std::array<double, 3> origin, force = {{1.0, -2.0, 0.5}};
+	kinematic.getWorkspaceOrigin(origin);
+	origin[2] = 0.11;
+
+	//Encoder values along a circle, so FK has to do real work every loop
+	std::vector<std::array<int, 3> > encoders(samples);
+	for(unsigned int k = 0; k < samples; ++k)
+	{
+		std::array<double, 3> pos = {{origin[0] + 0.02 * std::cos(k * 0.003), origin[1] + 0.02 * std::sin(k * 0.003), origin[2]}}, angles;
+		kinematic.getAngles(pos, angles);
+		for(int i = 0; i < 3; ++i)
+		{
+			encoders[k][i] = (int)std::floor(((angles[i] * (180.0 / PI) - kinematic.getGeometry().theta_offset[i]) * ((PI*SMALL_ARM_DIAMETER) / 360.0)) / ((SHAFT_DIAMETER*PI) / (WHEEL_SLOTS_NUMBER*4)) + 0.5);
+		}
+	}
+
+	printf("\nKinematics: getPosition + getForces, %u loops\n", samples);
+	printf("%-16s %10s\n", "jacobian", "ns/loop");
+	for(int cached = 1; cached >= 0; --cached)
+	{
+		std::array<double, 3> position;
+		std::array<int, 3> enc_force;
+		uint64_t start = getFalconTimestamp();
+		for(unsigned int k = 0; k < samples; ++k)
+		{
+			kinematic.getPosition(encoders[k], position);
+			if(!cached)
+			{
+				kinematic.clearCache();
+			}
+			kinematic.getForces(position, force, enc_force);
+		}
+		uint64_t elapsed = getFalconTimestamp() - start;
+		printf("%-16s %10.1f\n", cached ? "cached" : "recomputed", (double)elapsed / samples);
+	}
+}
+
+/**
+ * Largest difference between the elements of two arrays, relative to the largest element of the second
+ */
+template<typename T>
+double maxDifference(const T* a, const T* b, unsigned int count)
+{
+	double difference = 0.0, scale = 0.0;
+	for(unsigned int i = 0; i < count; ++i)
+	{
+		difference = std::max(difference, (double)std::fabs(a[i] - b[i]));
+		scale = std::max(scale, (double)std::fabs(b[i]));
+	}
+	return scale > 0.0 ? difference / scale : difference;
+}
+
+/**
+ * Sums an array, so that benchmarks use every element they compute
+ */
+template<typename T>
+T sum(const T* a, unsigned int count)
+{
+	T total = 0;
+	for(unsigned int i = 0; i < count; ++i)
+	{
+		total += a[i];
+	}
+	return total;
+}
+
+/**
+ * Checks the 3x3 matrix operations the kinematics use against the generic gmtl templates
+ * (reached by spelling out their template arguments), and times both. Without SIMD overloads, both
+ * columns time the same code.
+ */
+template<typename T>
+void benchmarkMatrixOps(const char* type, unsigned int samples)
+{
+	//Few enough operands to stay in L1, so this times the arithmetic rather than memory
+	const unsigned int count = 256;
+	srand(3);
+	std::vector<gmtl::Matrix<T, 3, 3> > matrices(count);
+	std::vector<gmtl::Vec<T, 3> > vectors(count);
+	for(unsigned int k = 0; k < count; ++k)
+	{
+		//Well conditioned, like the falcon's jacobian inside its workspace
+		for(int i = 0; i < 3; ++i)
+		{
+			for(int j = 0; j < 3; ++j)
+			{
+				matrices[k](i, j) = (T)((i == j ? 2.0 : 0.0) + (double)rand() / RAND_MAX - 0.5);
+			}
+			vectors[k][i] = (T)((double)rand() / RAND_MAX - 0.5);
+		}
+		matrices[k].setState(gmtl::Matrix<T, 3, 3>::FULL);
+	}
+
+	double error[3] = {0.0, 0.0, 0.0};
+	double elapsed[3][2];
+	T total = 0;
+	for(int generic = 1; generic >= 0; --generic)
+	{
+		uint64_t start = getFalconTimestamp();
+		for(unsigned int k = 0; k < samples; ++k)
+		{
+			const unsigned int i = k % count, j = (k + 1) % count;
+			gmtl::Matrix<T, 3, 3> r;
+			if(generic)
+			{
+				gmtl::mult<T, 3, 3, 3>(r, matrices[i], matrices[j]);
+			}
+			else
+			{
+				gmtl::mult(r, matrices[i], matrices[j]);
+			}
+			total += sum(r.getData(), 9);
+		}
+		elapsed[0][generic] = (double)(getFalconTimestamp() - start) / samples;
+		start = getFalconTimestamp();
+		for(unsigned int k = 0; k < samples; ++k)
+		{
+			const unsigned int i = k % count, j = (k + 1) % count;
+			gmtl::Vec<T, 3> r;
+			if(generic)
+			{
+				gmtl::xform<T, 3, 3>(r, matrices[i], vectors[j]);
+			}
+			else
+			{
+				gmtl::xform(r, matrices[i], vectors[j]);
+			}
+			total += sum(r.getData(), 3);
+		}
+		elapsed[1][generic] = (double)(getFalconTimestamp() - start) / samples;
+		start = getFalconTimestamp();
+		for(unsigned int k = 0; k < samples; ++k)
+		{
+			const unsigned int i = k % count;
+			gmtl::Matrix<T, 3, 3> r;
+			if(generic)
+			{
+				gmtl::invertFull_orig<T, 3>(r, matrices[i]);
+			}
+			else
+			{
+				gmtl::invertFull(r, matrices[i]);
+			}
+			total += sum(r.getData(), 9);
+		}
+		elapsed[2][generic] = (double)(getFalconTimestamp() - start) / samples;
+	}
+
+	for(unsigned int i = 0; i < count; ++i)
+	{
+		const unsigned int j = (i + 1) % count;
+		gmtl::Matrix<T, 3, 3> m, m_generic;
+		gmtl::mult(m, matrices[i], matrices[j]);
+		gmtl::mult<T, 3, 3, 3>(m_generic, matrices[i], matrices[j]);
+		error[0] = std::max(error[0], maxDifference(m.getData(), m_generic.getData(), 9));
+		gmtl::Vec<T, 3> v, v_generic;
+		gmtl::xform(v, matrices[i], vectors[i]);
+		gmtl::xform<T, 3, 3>(v_generic, matrices[i], vectors[i]);
+		error[1] = std::max(error[1], maxDifference(v.getData(), v_generic.getData(), 3));
+		gmtl::invertFull(m, matrices[i]);
+		gmtl::invertFull_orig<T, 3>(m_generic, matrices[i]);
+		error[2] = std::max(error[2], maxDifference(m.getData(), m_generic.getData(), 9));
+	}
+
+	const char* names[3] = {"mult", "xform", "invert"};
+	printf("\nMatrix ops: 3x3 %s, %u operations each (checksum %g)\n", type, samples, (double)total);
+	printf("%-16s %10s %10s %12s\n", "op", "ns", "generic ns", "rel error");
+	for(int i = 0; i < 3; ++i)
+	{
+		printf("%-16s %10.2f %10.2f %12.3g\n", names[i], elapsed[i][0], elapsed[i][1], error[i]);
+	}
+}
+
+#ifndef GMTL_NO_METAPROG
+//The fused chains must stay expressions all the way to the assignment: no Vec in the type means no
+//temporary, and an expression holding only references means nothing is copied to build it
+typedef gmtl::meta::MatVecXformExpr<gmtl::Matrix33d, gmtl::VecBase<double, 3>, false> XformExprType;
+typedef gmtl::meta::MatVecXformExpr<gmtl::Matrix33d, gmtl::VecBase<double, 3>, true> XformTransposeExprType;
+static_assert(std::is_same<decltype(gmtl::xformExpr(std::declval<gmtl::Matrix33d>(), std::declval<gmtl::Vec3d>()) + std::declval<gmtl::Vec3d>()),
+			  gmtl::VecBase<double, 3, gmtl::meta::VecBinaryExpr<gmtl::VecBase<double, 3, XformExprType>, gmtl::VecBase<double, 3>, gmtl::meta::VecPlusBinary> > >::value,
+			  "matrix * vector + vector should fuse into one expression");
+static_assert(std::is_same<decltype(gmtl::xformTransposeExpr(std::declval<gmtl::Matrix33d>(), std::declval<gmtl::Vec3d>())),
+			  gmtl::VecBase<double, 3, XformTransposeExprType> >::value,
+			  "transpose(matrix) * vector should be an expression");
+static_assert(sizeof(XformExprType) == 2 * sizeof(void*) && sizeof(XformTransposeExprType) == 2 * sizeof(void*),
+			  "matrix-vector expressions should only hold references");
+#endif
+
+/**
+ * Checks the fused matrix-vector chains (m * v + w, as in inverse kinematics, and J' * f, as in force
+ * to torque) against the same chains built from eager operations, and times both
+ */
+template<typename T>
+void benchmarkMatrixChains(const char* type, unsigned int samples)
+{
+	const unsigned int count = 256;
+	srand(4);
+	std::vector<gmtl::Matrix<T, 3, 3> > matrices(count);
+	std::vector<gmtl::Vec<T, 3> > vectors(count);
+	for(unsigned int k = 0; k < count; ++k)
+	{
+		for(int i = 0; i < 3; ++i)
+		{
+			for(int j = 0; j < 3; ++j)
+			{
+				matrices[k](i, j) = (T)((double)rand() / RAND_MAX - 0.5);
+			}
+			vectors[k][i] = (T)((double)rand() / RAND_MAX - 0.5);
+		}
+	}
+
+	//Each variant times n chains and returns ns per chain. The variants take turns, in rotating order,
+	//after one warm up pass each, so neither form gets the cold cache or the clock ramp to itself.
+	T total = 0;
+	auto time_variant = [&](unsigned int variant, unsigned int n) -> double
+	{
+		uint64_t start = getFalconTimestamp();
+		for(unsigned int k = 0; k < n; ++k)
+		{
+			const unsigned int i = k % count, j = (k + 1) % count;
+			gmtl::Vec<T, 3> r;
+			switch(variant)
+			{
+			case 0:
+				r = gmtl::xformExpr(matrices[i], vectors[j]) + vectors[i];
+				break;
+			case 1:
+				r = matrices[i] * vectors[j] + vectors[i];
+				break;
+			case 2:
+				r = gmtl::xformTransposeExpr(matrices[i], vectors[j]);
+				break;
+			default:
+			{
+				gmtl::Matrix<T, 3, 3> transposed;
+				gmtl::transpose(transposed, matrices[i]);
+				r = transposed * vectors[j];
+				break;
+			}
+			}
+			total += sum(r.getData(), 3);
+		}
+		return (double)(getFalconTimestamp() - start) / n;
+	};
+
+	const unsigned int ROUNDS = 9;
+	const unsigned int n = std::max(samples / ROUNDS, 1u);
+	std::vector<double> times[4];
+	for(unsigned int v = 0; v < 4; ++v)
+	{
+		time_variant(v, n);
+	}
+	for(unsigned int r = 0; r < ROUNDS; ++r)
+	{
+		for(unsigned int i = 0; i < 4; ++i)
+		{
+			const unsigned int v = (r + i) % 4;
+			times[v].push_back(time_variant(v, n));
+		}
+	}
+	for(unsigned int v = 0; v < 4; ++v)
+	{
+		std::sort(times[v].begin(), times[v].end());
+	}
+
+	double error[2] = {0.0, 0.0};
+	for(unsigned int i = 0; i < count; ++i)
+	{
+		const unsigned int j = (i + 1) % count;
+		gmtl::Vec<T, 3> v = gmtl::xformExpr(matrices[i], vectors[j]) + vectors[i];
+		gmtl::Vec<T, 3> v_eager = matrices[i] * vectors[j] + vectors[i];
+		error[0] = std::max(error[0], maxDifference(v.getData(), v_eager.getData(), 3));
+		gmtl::Matrix<T, 3, 3> transposed;
+		gmtl::transpose(transposed, matrices[i]);
+		v = gmtl::xformTransposeExpr(matrices[i], vectors[j]);
+		v_eager = transposed * vectors[j];
+		error[1] = std::max(error[1], maxDifference(v.getData(), v_eager.getData(), 3));
+	}
+
+	const char* names[2] = {"m * v + w", "m' * v"};
+	printf("\nMatrix chains: 3x3 %s, %u rounds of %u chains each (checksum %g)\n", type, ROUNDS, n, (double)total);
+	printf("%-16s %10s %10s %10s %10s %12s\n", "chain", "fused ns", "median", "eager ns", "median", "rel error");
+	for(int i = 0; i < 2; ++i)
+	{
+		const std::vector<double>& fused = times[2 * i];
+		const std::vector<double>& eager = times[2 * i + 1];
+		printf("%-16s %10.2f %10.2f %10.2f %10.2f %12.3g\n", names[i], fused.front(), fused[ROUNDS / 2], eager.front(), eager[ROUNDS / 2], error[i]);
+	}
+}
+
+/**
+ * Times evaluation of a force field with every primitive slot filled
+ */
+void benchmarkForceField(optparse::Values& options)
+{
+	const unsigned int samples = (unsigned int)options.get("samples");
+	FalconForceField field;
+	srand(2);
+	for(unsigned int i = 0; i < FalconForceField::MAX_PRIMITIVES; ++i)
+	{
+		std::array<double, 3> p = {{0.05 * ((double)rand() / RAND_MAX - 0.5), 0.05 * ((double)rand() / RAND_MAX - 0.5), 0.11 + 0.05 * ((double)rand() / RAND_MAX - 0.5)}};
+		std::array<double, 3> n = {{(double)rand() / RAND_MAX - 0.5, (double)rand() / RAND_MAX - 0.5, (double)rand() / RAND_MAX - 0.5}};
+		std::array<double, 3> h = {{0.01, 0.01, 0.01}};
+		field.addPlane(p, n, 1000.0, 2.0);
+		field.addBox(p, h, 1000.0, 2.0);
+		field.addSphere(p, 0.01, 1000.0, 2.0);
+		field.addDampedSpring(p, 10.0, 0.1);
+		field.addViscousZone(p, 0.01, 5.0);
+		field.addDetent(p, 0.005, 200.0);
+	}
+	std::array<double, 3> position = {{0.0, 0.0, 0.11}}, velocity = {{0.01, -0.02, 0.005}}, force, total = {{0.0, 0.0, 0.0}};
+	uint64_t start = getFalconTimestamp();
+	for(unsigned int k = 0; k < samples; ++k)
+	{
+		position[0] = 0.02 * std::sin(k * 0.001);
+		field.evaluate(position, velocity, force);
+		total[0] += force[0];
+	}
+	uint64_t elapsed = getFalconTimestamp() - start;
+	printf("\nForce field: %u primitives\n", FalconForceField::MAX_PRIMITIVES * 6);
+	printf("%-16s %10.1f (checksum %g)\n", "ns/evaluate", (double)elapsed / samples, total[0]);
+}
+
+/**
+ * Times building a hierarchy over a ~100k triangle sphere, serially and on every core, then times the
+ * god-object renderer pressing into it and sliding over its surface
+ */
+void benchmarkMesh(optparse::Values& options)
+{
+	const unsigned int samples = (unsigned int)options.get("samples");
+	const unsigned int rings = 200, segments = 250;
+	const double radius = 0.03, cz = 0.11;
+	std::vector<std::array<double, 3> > vertices;
+	std::vector<unsigned int> indices;
+	for(unsigned int i = 0; i <= rings; ++i)
+	{
+		double theta = PI * i / rings;
+		for(unsigned int j = 0; j < segments; ++j)
+		{
+			double phi = 2.0 * PI * j / segments;
+			std::array<double, 3> v = {{radius * std::sin(theta) * std::cos(phi), radius * std::sin(theta) * std::sin(phi), cz + radius * std::cos(theta)}};
+			vertices.push_back(v);
+		}
+	}
+	for(unsigned int i = 0; i < rings; ++i)
+	{
+		for(unsigned int j = 0; j < segments; ++j)
+		{
+			unsigned int a = i * segments + j, b = i * segments + (j + 1) % segments;
+			unsigned int c = a + segments, d = b + segments;
+			unsigned int quad[6] = {a, c, b, b, c, d};
+			indices.insert(indices.end(), quad, quad + 6);
+		}
+	}
+
+	std::shared_ptr<FalconMeshBVH> mesh = std::make_shared<FalconMeshBVH>();
+	uint64_t start = getFalconTimestamp();
+	mesh->build(vertices, indices, 1);
+	double serial = (getFalconTimestamp() - start) / 1e6;
+	start = getFalconTimestamp();
+	mesh->build(vertices, indices);
+	double parallel = (getFalconTimestamp() - start) / 1e6;
+	printf("\nMesh: %u triangles, %u nodes\n", mesh->getTriangleCount(), mesh->getNodeCount());
+	printf("%-16s %10.1f\n", "build ms, 1", serial);
+	printf("%-16s %10.1f (%u threads)\n", "build ms, all", parallel, std::max(std::thread::hardware_concurrency(), 1u));
+
+	FalconHapticMesh renderer;
+	renderer.setMesh(mesh);
+	std::array<double, 3> position = {{0.0, 0.0, 0.2}}, velocity = {{0.0, 0.0, 0.0}}, force;
+	renderer.render(position, velocity, force);
+	uint64_t worst = 0;
+	double total = 0.0;
+	start = getFalconTimestamp();
+	for(unsigned int k = 0; k < samples; ++k)
+	{
+		//Circle over the top of the sphere, 5mm deep
+		double a = k * 0.002;
+		position[0] = 0.02 * std::cos(a);
+		position[1] = 0.02 * std::sin(a);
+		position[2] = cz + std::sqrt(radius * radius - 0.02 * 0.02) - 0.005 + 0.01 * std::sin(a * 0.1);
+		uint64_t t = getFalconTimestamp();
+		renderer.render(position, velocity, force);
+		worst = std::max(worst, getFalconTimestamp() - t);
+		total += force[2];
+	}
+	uint64_t elapsed = getFalconTimestamp() - start;
+	printf("%-16s %10.1f (checksum %g)\n", "ns/render", (double)elapsed / samples, total);
+	printf("%-16s %10.1f\n", "worst ns", (double)worst);
+}
+
+/**
+ * Indexes a 2 million point scan of the same sphere, streams more points in, and times the proxy on it
+ */
+void benchmarkPointCloud(optparse::Values& options)
+{
+	const unsigned int samples = (unsigned int)options.get("samples");
+	const double radius = 0.03, cz = 0.11;
+	std::vector<std::array<double, 3> > points(2000000);
+	srand(1);
+	for(size_t i = 0; i < points.size(); ++i)
+	{
+		//Uniform over the sphere: uniform z, uniform angle
+		double z = 2.0 * rand() / RAND_MAX - 1.0;
+		double phi = 2.0 * PI * rand() / RAND_MAX;
+		double r = std::sqrt(1.0 - z * z);
+		std::array<double, 3> p = {{radius * r * std::cos(phi), radius * r * std::sin(phi), cz + radius * z}};
+		points[i] = p;
+	}
+	std::vector<std::array<double, 3> > added(points.end() - 20000, points.end());
+	points.resize(points.size() - added.size());
+
+	FalconHapticPointCloud renderer;
+	uint64_t start = getFalconTimestamp();
+	renderer.setPoints(points);
+	renderer.waitForIndex();
+	double indexed = (getFalconTimestamp() - start) / 1e6;
+	start = getFalconTimestamp();
+	renderer.addPoints(added);
+	renderer.waitForIndex();
+	double increment = (getFalconTimestamp() - start) / 1e6;
+	printf("\nPoint cloud: %u points\n", (unsigned int)(points.size() + added.size()));
+	printf("%-16s %10.1f\n", "index ms", indexed);
+	printf("%-16s %10.1f (%u points)\n", "add ms", increment, (unsigned int)added.size());
+
+	std::array<double, 3> position = {{0.0, 0.0, 0.2}}, velocity = {{0.0, 0.0, 0.0}}, force;
+	renderer.render(position, velocity, force);
+	uint64_t worst = 0;
+	double total = 0.0;
+	start = getFalconTimestamp();
+	for(unsigned int k = 0; k < samples; ++k)
+	{
+		//Same path as the mesh benchmark
+		double a = k * 0.002;
+		position[0] = 0.02 * std::cos(a);
+		position[1] = 0.02 * std::sin(a);
+		position[2] = cz + std::sqrt(radius * radius - 0.02 * 0.02) - 0.005 + 0.01 * std::sin(a * 0.1);
+		uint64_t t = getFalconTimestamp();
+		renderer.render(position, velocity, force);
+		worst = std::max(worst, getFalconTimestamp() - t);
+		total += force[2];
+	}
+	uint64_t elapsed = getFalconTimestamp() - start;
+	printf("%-16s %10.1f (checksum %g)\n", "ns/render", (double)elapsed / samples, total);
+	printf("%-16s %10.1f\n", "worst ns", (double)worst);
+}
+
+/**
+ * Largest element of m - vectors * diag(values) * transpose(vectors), relative to the largest of m
+ */
+double eigenResidual(const gmtl::Matrix33d& m, const gmtl::Vec3d& values, const gmtl::Matrix33d& vectors)
+{
+	double residual = 0.0, scale = 0.0;
+	for(int i = 0; i < 3; ++i)
+	{
+		for(int j = 0; j < 3; ++j)
+		{
+			double r = m(i, j);
+			for(int k = 0; k < 3; ++k)
+			{
+				r -= vectors(i, k) * values[k] * vectors(j, k);
+			}
+			residual = std::max(residual, std::fabs(r));
+			scale = std::max(scale, std::fabs(m(i, j)));
+		}
+	}
+	return residual / scale;
+}
+
+/**
+ * Times the iterative eigen solver of gmtl/Numerics/Eigen.h, in float or double, on the given matrices,
+ * and finds its worst residual on them
+ */
+template<typename T>
+double benchmarkQL(const std::vector<gmtl::Matrix33d>& matrices, unsigned int samples, double& total, double& error)
+{
+	gmtl::EigenSolver<T> iterative(3);
+	const size_t count = matrices.size();
+	uint64_t start = getFalconTimestamp();
+	for(unsigned int k = 0; k < samples; ++k)
+	{
+		const gmtl::Matrix33d& m = matrices[k % count];
+		for(int i = 0; i < 3; ++i)
+		{
+			for(int j = 0; j < 3; ++j)
+			{
+				iterative.Matrix(i, j) = (T)m(i, j);
+			}
+		}
+		iterative.IncrSortEigenStuff3();
+		total += iterative.GetEigenvalue(0) + iterative.GetEigenvector(0, 0);
+	}
+	const double elapsed = (double)(getFalconTimestamp() - start) / samples;
+
+	gmtl::Vec3d values;
+	gmtl::Matrix33d vectors;
+	error = 0.0;
+	for(size_t k = 0; k < count; ++k)
+	{
+		for(int i = 0; i < 3; ++i)
+		{
+			for(int j = 0; j < 3; ++j)
+			{
+				iterative.Matrix(i, j) = (T)matrices[k](i, j);
+			}
+		}
+		iterative.IncrSortEigenStuff3();
+		for(int i = 0; i < 3; ++i)
+		{
+			values[i] = iterative.GetEigenvalue(i);
+			for(int j = 0; j < 3; ++j)
+			{
+				vectors(i, j) = iterative.GetEigenvector(i, j);
+			}
+		}
+		error = std::max(error, eigenResidual(matrices[k], values, vectors));
+	}
+	return elapsed;
+}
+
+/**
+ * Checks the closed form symmetric eigen solver against the iterative one in gmtl/Numerics/Eigen.h on
+ * random covariance matrices and times both, then times plane fits to a 2 million point probe of a
+ * tilted plane on one thread and on --threads
+ */
+void benchmarkPointFit(optparse::Values& options)
+{
+	const unsigned int samples = (unsigned int)options.get("samples");
+	const unsigned int count = 256;
+	srand(5);
+	std::vector<gmtl::Matrix33d> matrices(count);
+	for(unsigned int k = 0; k < count; ++k)
+	{
+		gmtl::Matrix33d spread;
+		for(int i = 0; i < 9; ++i)
+		{
+			spread.mData[i] = (double)rand() / RAND_MAX - 0.5;
+		}
+		gmtl::Matrix33d transposed;
+		gmtl::transpose(transposed, spread);
+		matrices[k] = spread * transposed;
+	}
+
+	gmtl::Vec3d values;
+	gmtl::Matrix33d vectors;
+	double total = 0.0, elapsed[3], error[3] = {0.0, 0.0, 0.0};
+	uint64_t start = getFalconTimestamp();
+	for(unsigned int k = 0; k < samples; ++k)
+	{
+		gmtl::eigenSymmetric(values, vectors, matrices[k % count]);
+		total += values[0] + vectors(0, 0);
+	}
+	elapsed[0] = (double)(getFalconTimestamp() - start) / samples;
+	for(unsigned int k = 0; k < count; ++k)
+	{
+		gmtl::eigenSymmetric(values, vectors, matrices[k]);
+		error[0] = std::max(error[0], eigenResidual(matrices[k], values, vectors));
+	}
+	elapsed[1] = benchmarkQL<double>(matrices, samples, total, error[1]);
+	elapsed[2] = benchmarkQL<float>(matrices, samples, total, error[2]);
+	printf("\nSymmetric 3x3 eigen decomposition, %u solves (checksum %g)\n", samples, total);
+	printf("%-16s %10s %12s\n", "solver", "ns", "rel error");
+	printf("%-16s %10.1f %12.3g\n", "closed form", elapsed[0], error[0]);
+	printf("%-16s %10.1f %12.3g\n", "QL, double", elapsed[1], error[1]);
+	printf("%-16s %10.1f %12.3g\n", "QL, float", elapsed[2], error[2]);
+
+	//50 x 30mm patch of a tilted plane, probed with 0.1mm of noise
+	gmtl::Vec3d normal(0.2, 0.3, 0.9), u(0.9, 0.0, -0.2), v;
+	gmtl::normalize(normal);
+	gmtl::normalize(u);
+	gmtl::cross(v, normal, u);
+	std::vector<std::array<double, 3> > points(2000000);
+	for(size_t k = 0; k < points.size(); ++k)
+	{
+		double a = 0.05 * ((double)rand() / RAND_MAX - 0.5), b = 0.03 * ((double)rand() / RAND_MAX - 0.5), c = 0.0001 * ((double)rand() / RAND_MAX - 0.5);
+		for(int i = 0; i < 3; ++i)
+		{
+			points[k][i] = (i == 2 ? 0.11 : 0.0) + a * u[i] + b * v[i] + c * normal[i];
+		}
+	}
+	printf("\nPlane fit: %u points\n", (unsigned int)points.size());
+	printf("%-16s %10s %12s %12s\n", "threads", "ms", "normal error", "vs 1 thread");
+	//0 is one thread per core. On a single core machine, pass --threads to exercise the split anyway.
+	unsigned int threads = (unsigned int)options.get("threads");
+	if(threads == 0)
+	{
+		threads = std::max(std::thread::hardware_concurrency(), 1u);
+	}
+	const unsigned int thread_counts[2] = {1, threads};
+	std::array<double, 3> single_center, single_normal;
+	for(int t = 0; t < 2; ++t)
+	{
+		FalconPointFit fit;
+		std::array<double, 3> center, fitted;
+		double rms;
+		start = getFalconTimestamp();
+		fit.addPoints(points, thread_counts[t]);
+		fit.fitPlane(center, fitted, rms);
+		double ms = (getFalconTimestamp() - start) / 1e6;
+		double cosine = std::fabs(fitted[0] * normal[0] + fitted[1] * normal[1] + fitted[2] * normal[2]);
+		if(t == 0)
+		{
+			single_center = center;
+			single_normal = fitted;
+		}
+		//Largest difference in center (meters) or normal from the single thread fit
+		double difference = 0.0;
+		for(int i = 0; i < 3; ++i)
+		{
+			difference = std::max(difference, std::fabs(center[i] - single_center[i]));
+			difference = std::max(difference, std::fabs(std::fabs(fitted[i]) - std::fabs(single_normal[i])));
+		}
+		printf("%-16u %10.2f %12.3g %12.3g\n", thread_counts[t], ms, std::acos(std::min(cosine, 1.0)), difference);
+	}
+}
+
+typedef BasicFalconDevice<FalconCommSimulated, FalconFirmwareNovintSDK, FalconKinematicStamper, FalconGripFourButton> SimulatedFalconDevice;
+
+/**
+ * Runs back to back I/O loops with a fixed force, the way an application's servo loop would
+ */
+template<class Device, class Loop>
+double timeLoops(Device& dev, unsigned int loops, Loop loop)
+{
+	std::array<double, 3> force = {{0.5, -0.5, 1.0}}, total = {{0.0, 0.0, 0.0}};
+	uint64_t start = getFalconTimestamp();
+	for(unsigned int k = 0; k < loops; ++k)
+	{
+		loop(dev, force, total);
+	}
+	uint64_t elapsed = getFalconTimestamp() - start;
+	if(total[0] == 42.0)
+	{
+		printf("(never)\n");
+	}
+	return (double)elapsed / loops;
+}
+
+/**
+ * Compares the cost of an I/O loop through FalconDevice (virtual behaviors, shared pointer accessors),
+ * BasicFalconDevice (statically dispatched) and FalconDeviceAdapter (BasicFalconDevice behind a virtual
+ * interface), on a simulated falcon with no delay.
+ *
+ * Every device gets a warm up pass first, then the devices take turns over several rounds, so caches,
+ * branch predictors and clock ramp up affect them alike. The fastest and median round are reported.
+ */
+void benchmarkDispatch(optparse::Values& options)
+{
+	const unsigned int ROUNDS = 9;
+	const unsigned int loops = std::max((unsigned int)options.get("samples") / ROUNDS, 1u);
+	printf("\nDevice dispatch: %u rounds of %u I/O loops on a simulated falcon, homing mode and LED set every loop\n", ROUNDS, loops);
+	printf("%-18s %10s %10s\n", "device", "ns/loop", "median");
+
+	FalconDevice dynamic_dev;
+	dynamic_dev.setFalconComm<FalconCommSimulated>();
+	dynamic_dev.setFalconFirmware<FalconFirmwareNovintSDK>();
+	dynamic_dev.setFalconKinematic<FalconKinematicStamper>();
+	dynamic_dev.setFalconGrip<FalconGripFourButton>();
+	dynamic_dev.open(0);
+	SimulatedFalconDevice static_dev;
+	static_dev.open(0);
+	FalconDeviceAdapter<SimulatedFalconDevice> adapter;
+	FalconDeviceInterface& interface_dev = adapter;
+	interface_dev.open(0);
+
+	//Written the way most existing code is, fetching the behavior every time it's needed
+	auto run_dynamic = [&](unsigned int n)
+	{
+		return timeLoops(dynamic_dev, n,
+			[](FalconDevice& dev, const std::array<double, 3>& force, std::array<double, 3>& total)
+			{
+				dev.getFalconFirmware()->setHomingMode(true);
+				dev.getFalconFirmware()->setLEDStatus(FalconFirmware::GREEN_LED);
+				dev.setForce(force);
+				dev.runIOLoop();
+				total[0] += dev.getPosition()[0];
+			});
+	};
+	auto run_static = [&](unsigned int n)
+	{
+		return timeLoops(static_dev, n,
+			[](SimulatedFalconDevice& dev, const std::array<double, 3>& force, std::array<double, 3>& total)
+			{
+				dev.getFalconFirmware().setHomingMode(true);
+				dev.getFalconFirmware().setLEDStatus(FalconFirmware::GREEN_LED);
+				dev.setForce(force);
+				dev.runIOLoop();
+				total[0] += dev.getPosition()[0];
+			});
+	};
+	auto run_adapter = [&](unsigned int n)
+	{
+		return timeLoops(interface_dev, n,
+			[](FalconDeviceInterface& dev, const std::array<double, 3>& force, std::array<double, 3>& total)
+			{
+				dev.getFalconFirmware().setHomingMode(true);
+				dev.getFalconFirmware().setLEDStatus(FalconFirmware::GREEN_LED);
+				dev.setForce(force);
+				dev.runIOLoop();
+				total[0] += dev.getPosition()[0];
+			});
+	};
+
+	run_dynamic(loops);
+	run_static(loops);
+	run_adapter(loops);
+	std::vector<double> times[3];
+	for(unsigned int r = 0; r < ROUNDS; ++r)
+	{
+		//Rotate the order every round, so no device always runs first
+		for(unsigned int i = 0; i < 3; ++i)
+		{
+			unsigned int d = (r + i) % 3;
+			times[d].push_back(d == 0 ? run_dynamic(loops) : (d == 1 ? run_static(loops) : run_adapter(loops)));
+		}
+	}
+	const char* names[3] = {"FalconDevice", "BasicFalconDevice", "adapter"};
+	for(unsigned int d = 0; d < 3; ++d)
+	{
+		std::sort(times[d].begin(), times[d].end());
+		printf("%-18s %10.1f %10.1f\n", names[d], times[d].front(), times[d][ROUNDS / 2]);
+	}
+
+	dynamic_dev.close();
+	static_dev.close();
+	interface_dev.close();
+}
+
+int main(int argc, char** argv)
+{
+	optparse::OptionParser parser = optparse::OptionParser().description("Benchmarks for the libnifalcon per-loop pipeline");
+	parser.add_option("--samples").help("Number of samples to feed each estimator").set_default(100000);
+	parser.add_option("--frequency").help("Frequency of the joint space test signal, Hz").set_default(2.0);
+	parser.add_option("--amplitude").help("Amplitude of the joint space test signal, radians").set_default(0.2);
+	parser.add_option("--jitter").help("Peak to peak sample period jitter, us").set_default(100.0);
+	parser.add_option("--duration").help("Seconds to run each estimator through the device pipeline").set_default(2.0);
+	parser.add_option("--threads").help("Threads for the multithreaded plane fit, 0 for one per core").set_default(0);
+	parser.add_option("--skip_pipeline").help("Don't run the device pipeline benchmark").action("store_true");
+	optparse::Values options = parser.parse_args(argc, argv);
+
+	benchmarkEstimators(options);
+	benchmarkMatrixOps<double>("double", (unsigned int)options.get("samples"));
+	benchmarkMatrixOps<float>("float", (unsigned int)options.get("samples"));
+	benchmarkMatrixChains<double>("double", (unsigned int)options.get("samples"));
+	benchmarkMatrixChains<float>("float", (unsigned int)options.get("samples"));
+	benchmarkKinematics(options);
+	benchmarkForceField(options);
+	benchmarkMesh(options);
+	benchmarkPointCloud(options);
+	benchmarkPointFit(options);
+	benchmarkDispatch(options);
+	if(!options.get("skip_pipeline"))
+	{
+		benchmarkPipeline(options);
+	}
+	return 0;
+}
@@ -0,0 +1,236 @@
+/***
+ * @file falcon_geometry_calibrate.cpp
+ * @brief Fits the geometry of a single falcon to fixture probing data, and stores it for the device
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ * Samples come from a text file, one per line:
+ *
+ *   point ENC1 ENC2 ENC3 X Y Z          end effector was at (X, Y, Z)
+ *   plane ENC1 ENC2 ENC3 NX NY NZ D     end effector was on the plane NX*x + NY*y + NZ*z = D
+ *
+ * and/or from a session recording (see FalconSessionRecorder) made while sliding the end effector over
+ * a fixture face given with --plane. Positions are in meters.
+ */
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include "falcon/cpp-optparse/OptionParser.h"
+#include "falcon/core/FalconClock.h"
+#include "falcon/core/FalconGeometryStore.h"
+#include "falcon/kinematic/FalconGeometryCalibration.h"
+#include "falcon/util/FalconSessionRecorder.h"
+
+using namespace libnifalcon;
+
+//Parameter names for --parameters, in FalconGeometryCalibration::Parameter order for the first eight
+static const char* PARAMETER_NAMES[] = {"a", "b", "c", "d", "e", "f", "r", "s", "phy", "theta_offset"};
+
+bool readSamples(FalconGeometryCalibration& calibration, const std::string& filename)
+{
+	std::ifstream in(filename.c_str());
+	if(!in.is_open())
+	{
+		std::cout << "Cannot open sample file " << filename << std::endl;
+		return false;
+	}
+	std::string line;
+	unsigned int line_number = 0;
+	while(std::getline(in, line))
+	{
+		++line_number;
+		std::istringstream values(line);
+		std::string type;
+		if(!(values >> type) || type[0] == '#')
+		{
+			continue;
+		}
+		std::array<int, 3> encoders;
+		std::array<double, 3> target;
+		double offset = 0.0;
+		bool valid = (bool)(values >> encoders[0] >> encoders[1] >> encoders[2] >> target[0] >> target[1] >> target[2]);
+		if(valid && type == "point")
+		{
+			calibration.addPoint(encoders, target);
+		}
+		else if(valid && type == "plane" && (values >> offset))
+		{
+			calibration.addPlane(encoders, target, offset);
+		}
+		else
+		{
+			std::cout << filename << ":" << line_number << ": cannot read sample" << std::endl;
+			return false;
+		}
+	}
+	return true;
+}
+
+bool readSession(FalconGeometryCalibration& calibration, const std::string& filename, const std::string& plane, unsigned int stride)
+{
+	std::array<double, 3> normal;
+	double offset;
+	std::istringstream values(plane);
+	char comma;
+	if(!(values >> normal[0] >> comma >> normal[1] >> comma >> normal[2] >> comma >> offset))
+	{
+		std::cout << "Cannot read plane " << plane << ", expected NX,NY,NZ,D" << std::endl;
+		return false;
+	}
+	FalconSessionReader reader;
+	if(!reader.open(filename))
+	{
+		std::cout << "Cannot open session file " << filename << " - Error Code: " << reader.getErrorCode() << std::endl;
+		return false;
+	}
+	for(uint64_t i = 0; i < reader.getRecordCount(); i += stride)
+	{
+		const FalconSessionRecord& r = reader.getRecord(i);
+		std::array<int, 3> encoders = {{r.encoders[0], r.encoders[1], r.encoders[2]}};
+		calibration.addPlane(encoders, normal, offset);
+	}
+	return true;
+}
+
+void printGeometry(const FalconGeometryParameters& initial, const FalconGeometryParameters& fitted)
+{
+	FalconGeometryParameters before_geometry(initial), after_geometry(fitted);
+	for(int i = 0; i < FalconGeometryCalibration::PARAMETER_COUNT; ++i)
+	{
+		FalconGeometryCalibration::Parameter p = (FalconGeometryCalibration::Parameter)i;
+		double before = FalconGeometryCalibration::getParameter(before_geometry, p);
+		double after = FalconGeometryCalibration::getParameter(after_geometry, p);
+		std::string name = (i < FalconGeometryCalibration::PARAMETER_PHY_1) ? PARAMETER_NAMES[i] :
+			(i < FalconGeometryCalibration::PARAMETER_THETA_OFFSET_1) ? "phy" + std::to_string(i - FalconGeometryCalibration::PARAMETER_PHY_1 + 1) :
+			"theta_offset" + std::to_string(i - FalconGeometryCalibration::PARAMETER_THETA_OFFSET_1 + 1);
+		std::cout << "  " << name << ": " << before << " -> " << after << std::endl;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	optparse::OptionParser parser = optparse::OptionParser().description("Fit falcon geometry to fixture probing data");
+	parser.add_option("--samples").help("Read point and plane samples from FILE").metavar("FILE");
+	parser.add_option("--session").help("Read plane samples from session recording FILE, taken on the plane given with --plane").metavar("FILE");
+	parser.add_option("--plane").help("Fixture plane for --session, as NX,NY,NZ,D").metavar("PLANE");
+	parser.add_option("--stride").help("Use every Nth session record (Default: 1)").metavar("N").type("int").set_default(1);
+	parser.add_option("--parameters").help("Comma separated parameters to fit (a, b, c, d, e, f, r, s, phy, theta_offset) (Default: a,b,c,d,f,phy,theta_offset)").metavar("LIST");
+	parser.add_option("--initial").help("Start from the geometry in FILE instead of the nominal geometry").metavar("FILE");
+	parser.add_option("--threads").help("Threads to fit with (Default: one per core)").metavar("N").type("int").set_default(0);
+	parser.add_option("--output").help("Write the fitted geometry to FILE").metavar("FILE");
+	parser.add_option("--store").help("Store the fitted geometry in geometry store DIR, under the serial given with --serial").metavar("DIR");
+	parser.add_option("--serial").help("Serial number of the calibrated falcon, as printed by --device_list").metavar("SERIAL");
+	optparse::Values options = parser.parse_args(argc, argv);
+
+	if(!options.is_set("samples") && !options.is_set("session"))
+	{
+		parser.print_help();
+		return 1;
+	}
+	if(options.is_set("session") != options.is_set("plane"))
+	{
+		std::cout << "--session and --plane have to be given together" << std::endl;
+		return 1;
+	}
+	if(options.is_set("store") != options.is_set("serial"))
+	{
+		std::cout << "--store and --serial have to be given together" << std::endl;
+		return 1;
+	}
+
+	FalconGeometryCalibration calibration;
+	calibration.setThreadCount((int)options.get("threads"));
+	if(options.is_set("parameters"))
+	{
+		uint32_t mask = 0;
+		std::istringstream names((std::string)options.get("parameters"));
+		std::string name;
+		while(std::getline(names, name, ','))
+		{
+			int i = 0;
+			while(i < 10 && name != PARAMETER_NAMES[i])
+			{
+				++i;
+			}
+			if(i == 10)
+			{
+				std::cout << "Unknown parameter " << name << std::endl;
+				return 1;
+			}
+			if(i == 8)
+			{
+				mask |= (1 << FalconGeometryCalibration::PARAMETER_PHY_1) | (1 << FalconGeometryCalibration::PARAMETER_PHY_2) | (1 << FalconGeometryCalibration::PARAMETER_PHY_3);
+			}
+			else if(i == 9)
+			{
+				mask |= (1 << FalconGeometryCalibration::PARAMETER_THETA_OFFSET_1) | (1 << FalconGeometryCalibration::PARAMETER_THETA_OFFSET_2) | (1 << FalconGeometryCalibration::PARAMETER_THETA_OFFSET_3);
+			}
+			else
+			{
+				mask |= 1 << i;
+			}
+		}
+		calibration.setParameterMask(mask);
+	}
+
+	FalconGeometryStore files;
+	FalconGeometryParameters initial;
+	if(options.is_set("initial") && !files.readFile((std::string)options.get("initial"), initial))
+	{
+		std::cout << "Cannot read geometry file " << (std::string)options.get("initial") << " - Error Code: " << files.getErrorCode() << std::endl;
+		return 1;
+	}
+	if(options.is_set("samples") && !readSamples(calibration, (std::string)options.get("samples")))
+	{
+		return 1;
+	}
+	if(options.is_set("session") && !readSession(calibration, (std::string)options.get("session"), (std::string)options.get("plane"), std::max((int)options.get("stride"), 1)))
+	{
+		return 1;
+	}
+
+	double initial_rms, fitted_rms;
+	calibration.getError(initial, initial_rms);
+	std::cout << "Samples: " << calibration.getSamples().size() << std::endl;
+	std::cout << "Initial RMS error: " << initial_rms * 1000.0 << "mm" << std::endl;
+
+	FalconGeometryParameters fitted;
+	uint64_t start = getFalconTimestamp();
+	if(!calibration.fit(initial, fitted))
+	{
+		std::cout << "Cannot fit geometry - Error Code: " << calibration.getErrorCode() << std::endl;
+		return 1;
+	}
+	double elapsed = (getFalconTimestamp() - start) / 1000000.0;
+	calibration.getError(fitted, fitted_rms);
+	std::cout << "Fitted RMS error: " << fitted_rms * 1000.0 << "mm (" << calibration.getIterationCount() << " iterations, " << elapsed << "ms";
+	if(calibration.getSkippedCount() > 0)
+	{
+		std::cout << ", " << calibration.getSkippedCount() << " samples out of range";
+	}
+	std::cout << ")" << std::endl;
+	std::cout.precision(8);
+	printGeometry(initial, fitted);
+
+	if(options.is_set("output") && !files.writeFile((std::string)options.get("output"), fitted))
+	{
+		std::cout << "Cannot write geometry file " << (std::string)options.get("output") << std::endl;
+		return 1;
+	}
+	if(options.is_set("store"))
+	{
+		FalconGeometryStore store((std::string)options.get("store"));
+		if(!store.save((std::string)options.get("serial"), fitted))
+		{
+			std::cout << "Cannot store geometry in " << store.getFilename((std::string)options.get("serial")) << std::endl;
+			return 1;
+		}
+		std::cout << "Stored geometry in " << store.getFilename((std::string)options.get("serial")) << std::endl;
+	}
+	return 0;
+}
@@ -0,0 +1,270 @@
+/***
+ * @file falcon_sdf_build.cpp
+ * @brief Builds signed distance grids for FalconHapticSDF from triangle meshes
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <array>
+#include <atomic>
+#include <thread>
+#include <algorithm>
+#include <limits>
+#include <stdint.h>
+#include "falcon/core/FalconClock.h"
+#include "falcon/haptic/FalconMeshBVH.h"
+#include "falcon/haptic/FalconSDFGrid.h"
+#include "falcon/gmtl/VecOps.h"
+#include "falcon/cpp-optparse/OptionParser.h"
+
+using namespace libnifalcon;
+
+/**
+ * Reads vertices and faces out of a Wavefront OBJ file. Polygons are split into fans.
+ */
+bool loadOBJ(const std::string& filename, std::vector<std::array<double, 3> >& vertices, std::vector<unsigned int>& indices)
+{
+	std::ifstream in(filename.c_str());
+	if(!in)
+	{
+		return false;
+	}
+	std::string line;
+	while(std::getline(in, line))
+	{
+		std::istringstream s(line);
+		std::string type;
+		s >> type;
+		if(type == "v")
+		{
+			std::array<double, 3> v;
+			s >> v[0] >> v[1] >> v[2];
+			vertices.push_back(v);
+		}
+		else if(type == "f")
+		{
+			//Corners are "v", "v/vt", "v//vn" or "v/vt/vn". Only v matters, and may count back from the end.
+			std::vector<unsigned int> face;
+			std::string corner;
+			while(s >> corner)
+			{
+				long index = std::strtol(corner.c_str(), NULL, 10);
+				if(index < 0)
+				{
+					index += (long)vertices.size();
+				}
+				else
+				{
+					index -= 1;
+				}
+				if(index < 0)
+				{
+					return false;
+				}
+				face.push_back((unsigned int)index);
+			}
+			for(size_t i = 2; i < face.size(); ++i)
+			{
+				indices.push_back(face[0]);
+				indices.push_back(face[i - 1]);
+				indices.push_back(face[i]);
+			}
+		}
+	}
+	return true;
+}
+
+/**
+ * Reads an STL file, binary or ASCII. Every triangle gets its own vertices.
+ */
+bool loadSTL(const std::string& filename, std::vector<std::array<double, 3> >& vertices, std::vector<unsigned int>& indices)
+{
+	std::ifstream in(filename.c_str(), std::ios::binary);
+	if(!in)
+	{
+		return false;
+	}
+	std::string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+	//ASCII files start with "solid", but so do some binary ones, so go by the size binary files must have
+	if(data.size() >= 84)
+	{
+		uint32_t count;
+		memcpy(&count, data.data() + 80, 4);
+		if(data.size() == 84 + (size_t)count * 50)
+		{
+			for(uint32_t i = 0; i < count; ++i)
+			{
+				const char* t = data.data() + 84 + (size_t)i * 50;
+				for(int j = 0; j < 3; ++j)
+				{
+					float v[3];
+					memcpy(v, t + 12 + j * 12, 12);
+					std::array<double, 3> vertex = {{v[0], v[1], v[2]}};
+					indices.push_back((unsigned int)vertices.size());
+					vertices.push_back(vertex);
+				}
+			}
+			return true;
+		}
+	}
+
+	std::istringstream s(data);
+	std::string word;
+	while(s >> word)
+	{
+		if(word == "vertex")
+		{
+			std::array<double, 3> v;
+			s >> v[0] >> v[1] >> v[2];
+			indices.push_back((unsigned int)vertices.size());
+			vertices.push_back(v);
+		}
+	}
+	return indices.size() % 3 == 0;
+}
+
+/**
+ * Fills in the bricks handed out by a shared counter, one closest point query per sample
+ */
+void fillBricks(const FalconMeshBVH& mesh, FalconSDFGrid& grid, std::atomic<unsigned int>& next)
+{
+	const unsigned int S = FalconSDFGrid::BRICK_SIZE + 1;
+	const std::array<unsigned int, 3> bricks = grid.getBricks();
+	const std::array<double, 3> origin = grid.getOrigin();
+	const double spacing = grid.getSpacing();
+	const unsigned int total = bricks[0] * bricks[1] * bricks[2];
+	unsigned int b;
+	while((b = next++) < total)
+	{
+		unsigned int bx = b % bricks[0], by = (b / bricks[0]) % bricks[1], bz = b / (bricks[0] * bricks[1]);
+		float* samples = grid.getBrick(bx, by, bz);
+		for(unsigned int k = 0; k < S; ++k)
+		{
+			for(unsigned int j = 0; j < S; ++j)
+			{
+				for(unsigned int i = 0; i < S; ++i)
+				{
+					gmtl::Point3d p(origin[0] + (bx * FalconSDFGrid::BRICK_SIZE + i) * spacing,
+									origin[1] + (by * FalconSDFGrid::BRICK_SIZE + j) * spacing,
+									origin[2] + (bz * FalconSDFGrid::BRICK_SIZE + k) * spacing);
+					gmtl::Point3d closest;
+					unsigned int triangle;
+					float d = std::numeric_limits<float>::max();
+					if(mesh.findClosest(p, std::numeric_limits<double>::max(), closest, triangle))
+					{
+						gmtl::Vec3d offset = p - closest;
+						d = (float)gmtl::length(offset);
+						if(gmtl::dot(offset, mesh.getNormal(triangle)) < 0.0)
+						{
+							d = -d;
+						}
+					}
+					samples[(k * S + j) * S + i] = d;
+				}
+			}
+		}
+	}
+}
+
+int main(int argc, char** argv)
+{
+	optparse::OptionParser parser = optparse::OptionParser().description("Build signed distance grids from triangle meshes");
+	parser.add_option("--input").help("Mesh to read (.obj or .stl)").metavar("FILE");
+	parser.add_option("--output").help("Grid file to write").metavar("FILE");
+	parser.add_option("--scale").help("Factor taking mesh units to meters").set_default(1.0);
+	parser.add_option("--spacing").help("Distance between grid samples, meters").set_default(0.001);
+	parser.add_option("--padding").help("Space left around the mesh, meters").set_default(0.01);
+	parser.add_option("--threads").help("Number of threads to build with, 0 for one per core").set_default(0);
+	optparse::Values options = parser.parse_args(argc, argv);
+
+	if(!options.is_set("input") || !options.is_set("output"))
+	{
+		parser.print_help();
+		return 1;
+	}
+
+	const std::string input = (std::string)options.get("input");
+	std::vector<std::array<double, 3> > vertices;
+	std::vector<unsigned int> indices;
+	std::string extension = input.substr(input.find_last_of('.') + 1);
+	std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+	bool loaded = (extension == "stl") ? loadSTL(input, vertices, indices) : loadOBJ(input, vertices, indices);
+	if(!loaded)
+	{
+		std::cout << "Cannot read mesh " << input << std::endl;
+		return 1;
+	}
+	const double scale = (double)options.get("scale");
+	for(size_t i = 0; i < vertices.size(); ++i)
+	{
+		for(int j = 0; j < 3; ++j)
+		{
+			vertices[i][j] *= scale;
+		}
+	}
+
+	unsigned int threads = (unsigned int)options.get("threads");
+	if(threads == 0)
+	{
+		threads = std::max(std::thread::hardware_concurrency(), 1u);
+	}
+
+	uint64_t start = getFalconTimestamp();
+	FalconMeshBVH mesh;
+	if(!mesh.build(vertices, indices, threads))
+	{
+		std::cout << "Cannot build mesh hierarchy - Error Code: " << mesh.getErrorCode() << std::endl;
+		return 1;
+	}
+	std::cout << "Mesh: " << mesh.getTriangleCount() << " triangles, " << mesh.getNodeCount() << " nodes, " << (getFalconTimestamp() - start) / 1e6 << "ms" << std::endl;
+
+	const double spacing = (double)options.get("spacing");
+	const double padding = (double)options.get("padding");
+	const gmtl::AABox<double>& bounds = mesh.getBounds();
+	std::array<double, 3> origin;
+	std::array<unsigned int, 3> cells;
+	for(int i = 0; i < 3; ++i)
+	{
+		origin[i] = bounds.getMin()[i] - padding;
+		cells[i] = std::max((unsigned int)std::ceil((bounds.getMax()[i] + padding - origin[i]) / spacing), 1u);
+	}
+
+	FalconSDFGrid grid;
+	if(!grid.create((std::string)options.get("output"), origin, spacing, cells))
+	{
+		std::cout << "Cannot create grid " << (std::string)options.get("output") << " - Error Code: " << grid.getErrorCode() << std::endl;
+		return 1;
+	}
+	const std::array<unsigned int, 3> bricks = grid.getBricks();
+	std::cout << "Grid: " << cells[0] << "x" << cells[1] << "x" << cells[2] << " cells, " << bricks[0] * bricks[1] * bricks[2] << " bricks" << std::endl;
+
+	start = getFalconTimestamp();
+	std::atomic<unsigned int> next(0);
+	std::vector<std::thread> workers;
+	for(unsigned int i = 1; i < threads; ++i)
+	{
+		workers.push_back(std::thread(fillBricks, std::cref(mesh), std::ref(grid), std::ref(next)));
+	}
+	fillBricks(mesh, grid, next);
+	for(size_t i = 0; i < workers.size(); ++i)
+	{
+		workers[i].join();
+	}
+	grid.close();
+	std::cout << "Sampled with " << threads << " threads in " << (getFalconTimestamp() - start) / 1e6 << "ms" << std::endl;
+	return 0;
+}
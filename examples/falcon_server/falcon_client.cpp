@@ -0,0 +1,88 @@
+/***
+ * @file falcon_client.cpp
+ * @brief Reads falcon state from, and sends spring fields to, a running falcon_server
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#include <iostream>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <chrono>
+#include <csignal>
+#include "falcon/util/FalconSharedMemory.h"
+#include "falcon/cpp-optparse/OptionParser.h"
+
+using namespace libnifalcon;
+
+static volatile sig_atomic_t running = 1;
+
+void sigproc(int)
+{
+	running = 0;
+}
+
+int main(int argc, char** argv)
+{
+	optparse::OptionParser parser = optparse::OptionParser().description("Prints falcon state published by falcon_server");
+	parser.add_option("--name").help("Name of the shared memory object").set_default("/libnifalcon");
+	parser.add_option("--device").help("Index of the device to watch").set_default(0);
+	parser.add_option("--spring").help("Hold the device where it is with a spring of STIFFNESS N/m").metavar("STIFFNESS");
+	optparse::Values options = parser.parse_args(argc, argv);
+
+	signal(SIGINT, sigproc);
+
+	FalconSharedMemoryClient client;
+	std::string name = (std::string)options.get("name");
+	if(!client.open(name))
+	{
+		std::cout << "Cannot attach to " << name << " (is falcon_server running?) - Error: " << client.getErrorCode() << std::endl;
+		return 1;
+	}
+	unsigned int index = (unsigned int)options.get("device");
+	std::cout << "Attached to " << name << " as client " << client.getClientId() << ", " << client.getDeviceCount() << " device(s)" << std::endl;
+
+	FalconSharedState state;
+	if(!client.getState(index, state))
+	{
+		std::cout << "Cannot read device " << index << " - Error: " << client.getErrorCode() << std::endl;
+		return 1;
+	}
+	if(options.is_set("spring"))
+	{
+		std::array<double, 3> anchor = {{state.position[0], state.position[1], state.position[2]}};
+		client.setSpring(index, anchor, (double)options.get("spring"), 0.0);
+	}
+
+	uint64_t last_heartbeat = client.getHeartbeat();
+	while(running)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+		uint64_t heartbeat = client.getHeartbeat();
+		if(heartbeat == last_heartbeat)
+		{
+			std::cout << "Server stopped responding" << std::endl;
+			break;
+		}
+		last_heartbeat = heartbeat;
+		if(!client.getState(index, state))
+		{
+			continue;
+		}
+		printf("Loop: %10llu | Pos: %8.5f %8.5f %8.5f | Force: %7.3f %7.3f %7.3f | Buttons: %x\n",
+			   (unsigned long long)state.loopCount,
+			   state.position[0], state.position[1], state.position[2],
+			   state.force[0], state.force[1], state.force[2],
+			   state.buttons);
+	}
+	if(options.is_set("spring"))
+	{
+		client.clearSpring(index);
+	}
+	return 0;
+}
@@ -0,0 +1,259 @@
+/***
+ * @file falcon_server.cpp
+ * @brief Daemon that owns all falcons and the servo loop, and shares them with other processes through shared memory
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <chrono>
+#include <csignal>
+#include <cmath>
+#include <cstdlib>
+#include "falcon/core/FalconDevice.h"
+#include "falcon/core/FalconClock.h"
+#include "falcon/comm/FalconCommSimulated.h"
+#include "falcon/firmware/FalconFirmwareNovintSDK.h"
+#include "falcon/kinematic/FalconKinematicStamper.h"
+#include "falcon/grip/FalconGripFourButton.h"
+#include "falcon/firmware/FalconFirmwareImages.h"
+#include "falcon/util/FalconSharedMemory.h"
+#include "falcon/cpp-optparse/OptionParser.h"
+
+using namespace libnifalcon;
+
+static volatile sig_atomic_t running = 1;
+
+void sigproc(int)
+{
+	running = 0;
+}
+
+/**
+ * Everything clients have asked a single device to render
+ */
+struct DeviceControl
+{
+	std::array<double, 3> force; /**< Last force command */
+	uint64_t forceTime; /**< When the last force command arrived */
+	bool hasSpring; /**< True if a spring field is active */
+	std::array<double, 3> anchor; /**< Spring anchor */
+	double stiffness; /**< Spring stiffness */
+	double damping; /**< Spring damping */
+	std::array<double, 3> lastPosition; /**< Position on the previous loop, for velocity */
+	uint64_t lastTime; /**< Time of the previous loop */
+	std::array<double, 3> simPosition; /**< End effector position, for simulated devices */
+};
+
+bool openDevice(FalconDevice& dev, unsigned int index, bool simulate)
+{
+	if(simulate)
+	{
+		dev.setFalconComm<FalconCommSimulated>();
+	}
+	dev.setFalconFirmware<FalconFirmwareNovintSDK>();
+	dev.setFalconKinematic<FalconKinematicStamper>();
+	dev.setFalconGrip<FalconGripFourButton>();
+	if(!dev.open(index))
+	{
+		std::cout << "Cannot open falcon " << index << " - Error: " << dev.getErrorCode() << std::endl;
+		return false;
+	}
+	if(!dev.isFirmwareLoaded())
+	{
+		std::cout << "Loading firmware on falcon " << index << std::endl;
+		if(!dev.getFalconFirmware()->loadFirmwareImage(true, FalconFirmwareImages::DEFAULT_IMAGE) || !dev.isFirmwareLoaded())
+		{
+			std::cout << "Could not load firmware on falcon " << index << std::endl;
+			return false;
+		}
+	}
+	dev.getFalconFirmware()->setHomingMode(true);
+	return true;
+}
+
+void applyCommand(FalconDevice& dev, DeviceControl& control, const FalconSharedCommand& c, uint64_t now)
+{
+	switch(c.type)
+	{
+	case FALCON_SHARED_SET_FORCE:
+		control.force[0] = c.values[0];
+		control.force[1] = c.values[1];
+		control.force[2] = c.values[2];
+		control.forceTime = now;
+		break;
+	case FALCON_SHARED_SET_SPRING:
+		control.hasSpring = true;
+		control.anchor[0] = c.values[0];
+		control.anchor[1] = c.values[1];
+		control.anchor[2] = c.values[2];
+		control.stiffness = c.values[3];
+		control.damping = c.values[4];
+		break;
+	case FALCON_SHARED_CLEAR_SPRING:
+		control.hasSpring = false;
+		break;
+	case FALCON_SHARED_SET_LEDS:
+		dev.getFalconFirmware()->setLEDStatus((unsigned int)c.values[0]);
+		break;
+	default:
+		break;
+	}
+}
+
+std::array<double, 3> computeForce(DeviceControl& control, const std::array<double, 3>& pos, uint64_t now, uint64_t force_timeout, double max_force)
+{
+	std::array<double, 3> f = {{0.0, 0.0, 0.0}};
+	//Force commands are only honored while the client keeps refreshing them,
+	//so a client that dies mid-command doesn't leave the device pushing
+	if(now - control.forceTime < force_timeout)
+	{
+		f = control.force;
+	}
+	double dt = (double)(now - control.lastTime) / 1e9;
+	for(int i = 0; i < 3; ++i)
+	{
+		if(control.hasSpring)
+		{
+			double vel = (control.lastTime != 0 && dt > 0) ? (pos[i] - control.lastPosition[i]) / dt : 0.0;
+			f[i] += -control.stiffness * (pos[i] - control.anchor[i]) - control.damping * vel;
+		}
+		if(f[i] > max_force) f[i] = max_force;
+		if(f[i] < -max_force) f[i] = -max_force;
+	}
+	control.lastPosition = pos;
+	control.lastTime = now;
+	return f;
+}
+
+int main(int argc, char** argv)
+{
+	optparse::OptionParser parser = optparse::OptionParser().description("Shares falcons with other processes through POSIX shared memory");
+	parser.add_option("--name").help("Name of the shared memory object").set_default("/libnifalcon");
+	parser.add_option("--simulate").help("Serve COUNT simulated falcons instead of hardware").metavar("COUNT");
+	parser.add_option("--force_timeout").help("Milliseconds a force command stays active without being refreshed").set_default(100);
+	parser.add_option("--max_force").help("Clamp for each force axis, in newtons").set_default(10.0);
+	parser.add_option("--mode").help("Permissions of the shared memory object, in octal. Anyone who can write it can command forces. (Default: 600)").set_default("600");
+	optparse::Values options = parser.parse_args(argc, argv);
+
+	signal(SIGINT, sigproc);
+	signal(SIGTERM, sigproc);
+
+	bool simulate = options.is_set("simulate");
+	unsigned int count = 0;
+	if(simulate)
+	{
+		FalconCommSimulated::setDeviceCount((unsigned int)options.get("simulate"));
+	}
+	{
+		FalconDevice probe;
+		if(simulate)
+		{
+			probe.setFalconComm<FalconCommSimulated>();
+		}
+		if(!probe.getDeviceCount(count))
+		{
+			std::cout << "Cannot get device count" << std::endl;
+			return 1;
+		}
+	}
+	if(count == 0)
+	{
+		std::cout << "No falcons found, exiting..." << std::endl;
+		return 1;
+	}
+	if(count > FALCON_SHARED_MAX_DEVICES)
+	{
+		std::cout << "Only serving the first " << FALCON_SHARED_MAX_DEVICES << " of " << count << " falcons" << std::endl;
+		count = FALCON_SHARED_MAX_DEVICES;
+	}
+
+	std::vector<std::unique_ptr<FalconDevice> > devices;
+	std::vector<DeviceControl> controls(count);
+	for(unsigned int i = 0; i < count; ++i)
+	{
+		devices.push_back(std::unique_ptr<FalconDevice>(new FalconDevice()));
+		if(!openDevice(*devices[i], i, simulate))
+		{
+			return 1;
+		}
+		DeviceControl& c = controls[i];
+		c.force[0] = c.force[1] = c.force[2] = 0.0;
+		c.forceTime = 0;
+		c.hasSpring = false;
+		c.lastTime = 0;
+		devices[i]->getFalconKinematic()->getWorkspaceOrigin(c.simPosition);
+	}
+
+	FalconSharedMemoryServer server;
+	std::string name = (std::string)options.get("name");
+	unsigned int mode = (unsigned int)std::strtoul(((std::string)options.get("mode")).c_str(), NULL, 8);
+	if(!server.create(name, count, mode))
+	{
+		std::cout << "Cannot create shared memory region " << name << " - Error: " << server.getErrorCode() << std::endl;
+		return 1;
+	}
+	std::cout << "Serving " << count << " falcon(s) on " << name << (simulate ? " (simulated)" : "") << std::endl;
+
+	const uint64_t force_timeout = (uint64_t)(unsigned int)options.get("force_timeout") * 1000000;
+	const double max_force = (double)options.get("max_force");
+	//Viscosity of the simulated end effector, so spring commands visibly do something
+	const double sim_viscosity = 20.0;
+
+	while(running)
+	{
+		uint64_t now = getFalconTimestamp();
+		for(unsigned int i = 0; i < count; ++i)
+		{
+			FalconDevice& dev = *devices[i];
+			DeviceControl& control = controls[i];
+			FalconSharedCommand command;
+			while(server.popCommand(i, command))
+			{
+				applyCommand(dev, control, command, now);
+			}
+			if(simulate)
+			{
+				double dt = (control.lastTime != 0) ? (double)(now - control.lastTime) / 1e9 : 0.0;
+				std::array<double, 3> angles;
+				for(int j = 0; j < 3; ++j)
+				{
+					control.simPosition[j] += dev.getForce()[j] / sim_viscosity * dt;
+				}
+				if(dev.getFalconKinematic()->getAngles(control.simPosition, angles))
+				{
+					std::static_pointer_cast<FalconCommSimulated>(dev.getFalconComm())->setAngles(angles, dev.getFalconKinematic()->getGeometry());
+				}
+			}
+			dev.setForce(computeForce(control, dev.getPosition(), now, force_timeout, max_force));
+			if(dev.runIOLoop())
+			{
+				server.publish(i, dev);
+			}
+		}
+		server.heartbeat();
+		if(simulate)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+	}
+
+	std::cout << "Shutting down" << std::endl;
+	server.destroy();
+	for(unsigned int i = 0; i < count; ++i)
+	{
+		devices[i]->setForce(std::array<double, 3>());
+		devices[i]->getFalconFirmware()->setLEDStatus(0);
+		devices[i]->runIOLoop();
+		devices[i]->close();
+	}
+	return 0;
+}
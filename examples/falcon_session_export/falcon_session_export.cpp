@@ -0,0 +1,117 @@
+/***
+ * @file falcon_session_export.cpp
+ * @brief Converts session recordings from FalconSessionRecorder into CSV or NumPy (.npy) files
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <cstring>
+#include "falcon/cpp-optparse/OptionParser.h"
+#include "falcon/util/FalconSessionRecorder.h"
+
+using namespace libnifalcon;
+
+bool exportCSV(const FalconSessionReader& reader, const std::string& filename)
+{
+	std::ofstream out(filename.c_str());
+	if(!out.is_open())
+	{
+		std::cout << "Cannot open " << filename << " for writing" << std::endl;
+		return false;
+	}
+	uint64_t start = reader.getHeader()->startTimestamp;
+	out << "time_s,loop_count,pos_x,pos_y,pos_z,force_x,force_y,force_z,enc_1,enc_2,enc_3,buttons" << std::endl;
+	out.precision(9);
+	for(uint64_t i = 0; i < reader.getRecordCount(); ++i)
+	{
+		const FalconSessionRecord& r = reader.getRecord(i);
+		out << (double)(int64_t)(r.timestamp - start) / 1e9 << ","
+			<< r.loopCount << ","
+			<< r.position[0] << "," << r.position[1] << "," << r.position[2] << ","
+			<< r.force[0] << "," << r.force[1] << "," << r.force[2] << ","
+			<< r.encoders[0] << "," << r.encoders[1] << "," << r.encoders[2] << ","
+			<< r.buttons << "\n";
+	}
+	return true;
+}
+
+//Writes a version 1.0 .npy file with a structured dtype matching FalconSessionRecord,
+//so numpy.load() gives back named columns without any conversion
+bool exportNPY(const FalconSessionReader& reader, const std::string& filename)
+{
+	std::ofstream out(filename.c_str(), std::ofstream::binary);
+	if(!out.is_open())
+	{
+		std::cout << "Cannot open " << filename << " for writing" << std::endl;
+		return false;
+	}
+	std::ostringstream header;
+	header << "{'descr': [('timestamp', '<u8'), ('loop_count', '<u8'), ('position', '<f8', (3,)), ('force', '<f8', (3,)), ('encoders', '<i4', (3,)), ('buttons', '<u4')], "
+		   << "'fortran_order': False, 'shape': (" << reader.getRecordCount() << ",), }";
+	std::string h = header.str();
+	//Magic (6) + version (2) + header length (2) + header + newline must be 64 byte aligned
+	size_t total = 10 + h.size() + 1;
+	h.append((64 - (total % 64)) % 64, ' ');
+	h.push_back('\n');
+	uint16_t len = (uint16_t)h.size();
+	out.write("\x93NUMPY\x01\x00", 8);
+	out.put((char)(len & 0xff));
+	out.put((char)(len >> 8));
+	out.write(h.data(), h.size());
+	for(uint64_t i = 0; i < reader.getRecordCount(); ++i)
+	{
+		out.write(reinterpret_cast<const char*>(&reader.getRecord(i)), sizeof(FalconSessionRecord));
+	}
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	optparse::OptionParser parser = optparse::OptionParser().description("Export libnifalcon session recordings");
+	parser.add_option("--input").help("Session file to read").metavar("FILE");
+	parser.add_option("--csv").help("Write records as CSV to FILE").metavar("FILE");
+	parser.add_option("--npy").help("Write records as a NumPy structured array to FILE").metavar("FILE");
+	parser.add_option("--info").help("Print session information and exit").action("store_true");
+	optparse::Values options = parser.parse_args(argc, argv);
+
+	if(!options.is_set("input"))
+	{
+		parser.print_help();
+		return 1;
+	}
+
+	FalconSessionReader reader;
+	if(!reader.open((std::string)options.get("input")))
+	{
+		std::cout << "Cannot open session file " << (std::string)options.get("input") << " - Error Code: " << reader.getErrorCode() << std::endl;
+		return 1;
+	}
+
+	std::cout << "Records: " << reader.getRecordCount() << " (capacity " << reader.getHeader()->capacity << ", " << reader.getDroppedCount() << " rolled over)" << std::endl;
+	if(reader.getRecordCount() > 1)
+	{
+		double duration = (double)(reader.getRecord(reader.getRecordCount() - 1).timestamp - reader.getRecord(0).timestamp) / 1e9;
+		std::cout << "Duration: " << duration << "s (" << (reader.getRecordCount() - 1) / duration << " Hz)" << std::endl;
+	}
+	if(options.get("info"))
+	{
+		return 0;
+	}
+	if(options.is_set("csv") && !exportCSV(reader, (std::string)options.get("csv")))
+	{
+		return 1;
+	}
+	if(options.is_set("npy") && !exportNPY(reader, (std::string)options.get("npy")))
+	{
+		return 1;
+	}
+	return 0;
+}
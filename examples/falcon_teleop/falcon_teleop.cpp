@@ -0,0 +1,256 @@
+/***
+ * @file falcon_teleop.cpp
+ * @brief Master/slave teleoperation of falcons over UDP, with a localhost loopback test mode
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#include <iostream>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <chrono>
+#include <csignal>
+#include <cmath>
+#include "falcon/core/FalconDevice.h"
+#include "falcon/core/FalconClock.h"
+#include "falcon/comm/FalconCommSimulated.h"
+#include "falcon/firmware/FalconFirmwareNovintSDK.h"
+#include "falcon/kinematic/FalconKinematicStamper.h"
+#include "falcon/grip/FalconGripFourButton.h"
+#include "falcon/firmware/FalconFirmwareImages.h"
+#include "falcon/util/FalconTeleop.h"
+#include "falcon/cpp-optparse/OptionParser.h"
+
+using namespace libnifalcon;
+
+static volatile sig_atomic_t running = 1;
+
+void sigproc(int)
+{
+	running = 0;
+}
+
+bool openDevice(FalconDevice& dev, unsigned int index, bool simulate)
+{
+	if(simulate)
+	{
+		dev.setFalconComm<FalconCommSimulated>();
+	}
+	dev.setFalconFirmware<FalconFirmwareNovintSDK>();
+	dev.setFalconKinematic<FalconKinematicStamper>();
+	dev.setFalconGrip<FalconGripFourButton>();
+	if(!dev.open(index))
+	{
+		std::cout << "Cannot open falcon " << index << " - Error: " << dev.getErrorCode() << std::endl;
+		return false;
+	}
+	if(!dev.isFirmwareLoaded())
+	{
+		if(!dev.getFalconFirmware()->loadFirmwareImage(true, FalconFirmwareImages::DEFAULT_IMAGE) || !dev.isFirmwareLoaded())
+		{
+			std::cout << "Could not load firmware on falcon " << index << std::endl;
+			return false;
+		}
+	}
+	dev.getFalconFirmware()->setHomingMode(true);
+	return true;
+}
+
+/**
+ * Moves a simulated device's end effector to a position
+ */
+void setSimulatedPosition(FalconDevice& dev, std::array<double, 3> pos)
+{
+	std::array<double, 3> angles;
+	if(dev.getFalconKinematic()->getAngles(pos, angles))
+	{
+		std::static_pointer_cast<FalconCommSimulated>(dev.getFalconComm())->setAngles(angles, dev.getFalconKinematic()->getGeometry());
+	}
+}
+
+void configureLink(FalconTeleop& link, optparse::Values& options)
+{
+	if((std::string)options.get("mode") == "wave")
+	{
+		link.setMode(FalconTeleop::FALCON_TELEOP_WAVE);
+	}
+	link.setCouplingGains((double)options.get("stiffness"), (double)options.get("damping"));
+	link.setSlaveVelocityGain((double)options.get("slave_gain"));
+	link.setWaveImpedance((double)options.get("impedance"));
+	link.setPlayoutDelay((uint64_t)((double)options.get("playout") * 1e6));
+}
+
+/**
+ * Runs a simulated master and a simulated slave against each other over localhost. The master is moved
+ * along a circle by a scripted "operator"; the slave is a viscous mass with a stiff wall at x = wall.
+ */
+int runLoopback(optparse::Values& options)
+{
+	FalconCommSimulated::setDeviceCount(1);
+	FalconDevice master, slave;
+	if(!openDevice(master, 0, true) || !openDevice(slave, 0, true))
+	{
+		return 1;
+	}
+	FalconTeleop master_link, slave_link;
+	unsigned short port = (unsigned short)(unsigned int)options.get("local_port");
+	if(!master_link.open(FalconTeleop::FALCON_TELEOP_MASTER, port, "127.0.0.1", port + 1) ||
+	   !slave_link.open(FalconTeleop::FALCON_TELEOP_SLAVE, port + 1, "127.0.0.1", port))
+	{
+		std::cout << "Cannot open loopback links on ports " << port << "/" << port + 1 << std::endl;
+		return 1;
+	}
+	configureLink(master_link, options);
+	configureLink(slave_link, options);
+
+	const double wall = 0.015;
+	const double wall_stiffness = 2000.0;
+	const double slave_viscosity = 10.0;
+	const double duration = (double)options.get("duration");
+	std::array<double, 3> origin;
+	master.getFalconKinematic()->getWorkspaceOrigin(origin);
+	origin[2] = 0.11;
+	std::array<double, 3> slave_pos = origin;
+	setSimulatedPosition(slave, slave_pos);
+
+	uint64_t start = getFalconTimestamp();
+	uint64_t last = start;
+	uint64_t next_print = start;
+	double error_sum = 0.0;
+	unsigned int error_count = 0;
+	while(running)
+	{
+		uint64_t now = getFalconTimestamp();
+		double t = (double)(now - start) / 1e9;
+		double dt = (double)(now - last) / 1e9;
+		last = now;
+		if(t > duration)
+		{
+			break;
+		}
+		std::array<double, 3> master_pos = {{origin[0] + 0.025 * std::sin(t * 3.0), origin[1] + 0.025 * std::cos(t * 3.0), origin[2]}};
+		setSimulatedPosition(master, master_pos);
+
+		std::array<double, 3> slave_force = slave.getForce();
+		if(slave_pos[0] > wall)
+		{
+			slave_force[0] -= wall_stiffness * (slave_pos[0] - wall);
+		}
+		for(int i = 0; i < 3; ++i)
+		{
+			slave_pos[i] += slave_force[i] / slave_viscosity * dt;
+		}
+		setSimulatedPosition(slave, slave_pos);
+
+		if(master.runIOLoop())
+		{
+			master_link.update(master);
+		}
+		if(slave.runIOLoop())
+		{
+			slave_link.update(slave);
+		}
+
+		if(t > 1.0)
+		{
+			std::array<double, 3> m = master.getPosition(), s = slave.getPosition();
+			//Tracking error only means something away from the wall
+			if(m[0] < wall)
+			{
+				error_sum += std::sqrt((m[0]-s[0])*(m[0]-s[0]) + (m[1]-s[1])*(m[1]-s[1]) + (m[2]-s[2])*(m[2]-s[2]));
+				++error_count;
+			}
+		}
+		if(now >= next_print)
+		{
+			std::array<double, 3> m = master.getPosition(), s = slave.getPosition(), f = master.getForce();
+			printf("Master: %7.4f %7.4f %7.4f | Slave: %7.4f %7.4f %7.4f | Master force: %6.2f %6.2f %6.2f | RTT: %5.0fus\n",
+				   m[0], m[1], m[2], s[0], s[1], s[2], f[0], f[1], f[2], master_link.getRoundTripTime() / 1e3);
+			next_print = now + 250000000;
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	std::cout << "Master sent " << master_link.getPacketsSent() << ", received " << master_link.getPacketsReceived()
+			  << ", lost " << master_link.getJitterBuffer().getLostCount() << ", late " << master_link.getJitterBuffer().getLateCount() << std::endl;
+	std::cout << "Slave sent " << slave_link.getPacketsSent() << ", received " << slave_link.getPacketsReceived()
+			  << ", lost " << slave_link.getJitterBuffer().getLostCount() << ", late " << slave_link.getJitterBuffer().getLateCount() << std::endl;
+	if(error_count > 0)
+	{
+		std::cout << "Mean free space tracking error: " << (error_sum / error_count) * 1000.0 << "mm" << std::endl;
+	}
+	return 0;
+}
+
+int main(int argc, char** argv)
+{
+	optparse::OptionParser parser = optparse::OptionParser().description("Teleoperate one falcon with another over UDP");
+	parser.add_option("--role").help("master or slave").set_default("master");
+	parser.add_option("--device").help("Index of the local falcon").set_default(0);
+	parser.add_option("--local_port").help("UDP port to receive on").set_default(12000);
+	parser.add_option("--remote_host").help("Host running the other end").set_default("127.0.0.1");
+	parser.add_option("--remote_port").help("UDP port of the other end").set_default(12001);
+	parser.add_option("--mode").help("coupling or wave").set_default("coupling");
+	parser.add_option("--stiffness").help("Coupling stiffness, N/m").set_default(500.0);
+	parser.add_option("--damping").help("Coupling damping, Ns/m").set_default(4.0);
+	parser.add_option("--slave_gain").help("Slave velocity gain in wave mode, Ns/m").set_default(50.0);
+	parser.add_option("--impedance").help("Wave impedance, Ns/m").set_default(5.0);
+	parser.add_option("--playout").help("Jitter buffer playout delay, ms").set_default(5.0);
+	parser.add_option("--simulate").help("Use a simulated falcon").action("store_true");
+	parser.add_option("--loopback").help("Run a simulated master and slave against each other over localhost").action("store_true");
+	parser.add_option("--duration").help("Seconds to run the loopback test for").set_default(5.0);
+	optparse::Values options = parser.parse_args(argc, argv);
+
+	signal(SIGINT, sigproc);
+
+	if(options.get("loopback"))
+	{
+		return runLoopback(options);
+	}
+
+	FalconDevice dev;
+	bool simulate = options.get("simulate");
+	if(!openDevice(dev, (unsigned int)options.get("device"), simulate))
+	{
+		return 1;
+	}
+	FalconTeleop link;
+	FalconTeleop::FalconTeleopRole role = ((std::string)options.get("role") == "slave") ? FalconTeleop::FALCON_TELEOP_SLAVE : FalconTeleop::FALCON_TELEOP_MASTER;
+	if(!link.open(role, (unsigned short)(unsigned int)options.get("local_port"), (std::string)options.get("remote_host"), (unsigned short)(unsigned int)options.get("remote_port")))
+	{
+		std::cout << "Cannot open link - Error: " << link.getErrorCode() << std::endl;
+		return 1;
+	}
+	configureLink(link, options);
+
+	uint64_t next_print = 0;
+	while(running)
+	{
+		if(dev.runIOLoop())
+		{
+			link.update(dev);
+		}
+		uint64_t now = getFalconTimestamp();
+		if(now >= next_print)
+		{
+			std::array<double, 3> p = dev.getPosition(), r = link.getRemotePosition();
+			printf("Local: %7.4f %7.4f %7.4f | Remote: %7.4f %7.4f %7.4f | RTT: %5.0fus | Lost: %llu\n",
+				   p[0], p[1], p[2], r[0], r[1], r[2], link.getRoundTripTime() / 1e3,
+				   (unsigned long long)link.getJitterBuffer().getLostCount());
+			next_print = now + 500000000;
+		}
+		if(simulate)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+	}
+	dev.setForce(std::array<double, 3>());
+	dev.runIOLoop();
+	dev.close();
+	return 0;
+}
@@ -0,0 +1,101 @@
+#include "FalconCouplingTest.h"
+
+#include <algorithm>
+
+#include "falcon/core/FalconDevice.h"
+#include "falcon/grip/FalconGripFourButton.h"
+#include "falcon/kinematic/FalconKinematicStamper.h"
+#include "falcon/estimator/FalconVelocityEstimatorKalman.h"
+
+//Simulation runs every this many I/O loops, ~60Hz
+static const unsigned int SIMULATION_DIVIDER = 16;
+static const double FLOOR_HEIGHT = -0.02;
+static const double FLOOR_STIFFNESS = 1000.0;
+
+FalconCouplingTest::FalconCouplingTest(std::shared_ptr<libnifalcon::FalconDevice> d) :
+	FalconTestBase(d),
+	m_coupling(std::make_shared<libnifalcon::FalconVirtualCoupling>()),
+	m_loopsSinceStep(0),
+	m_isNaive(false),
+	m_isInitializing(true),
+	m_hasPrintedInitMsg(false)
+{
+	setPrintOnCount(1000);
+	m_falconDevice->setFalconKinematic<libnifalcon::FalconKinematicStamper>();
+	m_falconDevice->setFalconGrip<libnifalcon::FalconGripFourButton>();
+	m_falconDevice->setFalconVelocityEstimator<libnifalcon::FalconVelocityEstimatorKalman>();
+	m_coupling->setCouplingStiffness(300.0);
+	m_coupling->setBlendTime(SIMULATION_DIVIDER * 0.001);
+	m_coupling->setMaxForce(10.0);
+}
+
+void FalconCouplingTest::stepSimulation()
+{
+	std::array<double, 3> pos = m_falconDevice->getPosition();
+	std::array<double, 3> vel = m_falconDevice->getVelocity();
+
+	bool naive = (m_falconDevice->getFalconGrip()->getDigitalInputs() & libnifalcon::FalconGripFourButton::CENTER_BUTTON) != 0;
+	if(naive != m_isNaive)
+	{
+		m_isNaive = naive;
+		std::cout << (naive ? "Setting the floor force at simulation rate" : "Coupling the simulation to the I/O loop") << std::endl;
+		m_falconDevice->setHapticRenderer(naive ? std::shared_ptr<libnifalcon::FalconHapticRenderer>() : m_coupling);
+		m_falconDevice->setForce({{0.0, 0.0, 0.0}});
+	}
+
+	if(m_isNaive)
+	{
+		//What an application without the coupling does: one force per simulation step, held until the next
+		std::array<double, 3> force = {{0.0, std::max(FLOOR_HEIGHT - pos[1], 0.0) * FLOOR_STIFFNESS, 0.0}};
+		m_falconDevice->setForce(force);
+		return;
+	}
+
+	//The simulated tool can't go through the floor
+	std::array<double, 3> proxy = pos;
+	std::array<double, 3> proxy_velocity = vel;
+	if(proxy[1] < FLOOR_HEIGHT)
+	{
+		proxy[1] = FLOOR_HEIGHT;
+		proxy_velocity[1] = std::max(proxy_velocity[1], 0.0);
+	}
+	//Linearized contact, good until the next step as long as the tool stays near the floor
+	libnifalcon::FalconForceField contact;
+	if(pos[1] < FLOOR_HEIGHT + 0.01)
+	{
+		std::array<double, 3> point = {{0.0, FLOOR_HEIGHT, 0.0}};
+		std::array<double, 3> normal = {{0.0, 1.0, 0.0}};
+		contact.addPlane(point, normal, FLOOR_STIFFNESS, 2.0);
+	}
+	m_coupling->publish(proxy, proxy_velocity, contact);
+}
+
+void FalconCouplingTest::runFunction()
+{
+	if(!m_falconDevice->runIOLoop())
+		return;
+
+	if(m_isInitializing)
+	{
+		if(!m_hasPrintedInitMsg)
+		{
+			std::cout << "Move the end effector above the floor" << std::endl;
+			m_hasPrintedInitMsg = true;
+		}
+		if(m_falconDevice->getPosition()[1] > FLOOR_HEIGHT + 0.01)
+		{
+			std::cout << "Starting coupling simulation... Hold the center button to feel the floor without the coupling" << std::endl;
+			m_falconDevice->setHapticRenderer(m_coupling);
+			m_isInitializing = false;
+			tstart();
+		}
+		m_lastLoopCount = m_falconDevice->getFalconFirmware()->getLoopCount();
+		return;
+	}
+
+	if(++m_loopsSinceStep >= SIMULATION_DIVIDER)
+	{
+		m_loopsSinceStep = 0;
+		stepSimulation();
+	}
+}
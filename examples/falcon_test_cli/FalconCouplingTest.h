@@ -0,0 +1,22 @@
+#ifndef FALCON_COUPLING_TEST_H
+#define FALCON_COUPLING_TEST_H
+
+#include "FalconTestBase.h"
+#include "falcon/haptic/FalconVirtualCoupling.h"
+
+class FalconCouplingTest : public FalconTestBase
+{
+public:
+	FalconCouplingTest(std::shared_ptr<libnifalcon::FalconDevice> d);
+protected:
+	void runFunction();
+	void stepSimulation();
+
+	std::shared_ptr<libnifalcon::FalconVirtualCoupling> m_coupling;
+	unsigned int m_loopsSinceStep;
+	bool m_isNaive;
+	bool m_isInitializing;
+	bool m_hasPrintedInitMsg;
+};
+
+#endif
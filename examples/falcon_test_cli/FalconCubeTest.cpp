@@ -2,6 +2,7 @@
 
 #include "falcon/core/FalconDevice.h"
 #include "falcon/kinematic/FalconKinematicStamper.h"
+#include "falcon/estimator/FalconVelocityEstimatorKalman.h"
 
 FalconCubeTest::FalconCubeTest(std::shared_ptr<libnifalcon::FalconDevice> d) :
 	FalconTestBase(d),
@@ -13,6 +14,15 @@ FalconCubeTest::FalconCubeTest(std::shared_ptr<libnifalcon::FalconDevice> d) :
 {
 	setPrintOnCount(1000);
 	m_falconDevice->setFalconKinematic<libnifalcon::FalconKinematicStamper>();
+	m_falconDevice->setFalconVelocityEstimator<libnifalcon::FalconVelocityEstimatorKalman>();
+
+	std::array<double, 3> center, half_extents;
+	for(int axis = 0; axis < 3; ++axis)
+	{
+		center[axis] = (m_cornerA[axis] + m_cornerB[axis]) / 2.0;
+		half_extents[axis] = (m_cornerB[axis] - m_cornerA[axis]) / 2.0;
+	}
+	m_field.addBox(center, half_extents, m_stiffness, 2.0);
 }
 
 void FalconCubeTest::runFunction()
@@ -33,38 +43,10 @@ void FalconCubeTest::runFunction()
 		{
 			std::cout << "Starting cube simulation..." << std::endl;
 			m_isInitializing = false;
+			//The cube is rendered by the I/O loop from here on
+			m_falconDevice->setForceField(m_field);
 			tstart();
 		}
 		m_lastLoopCount = m_falconDevice->getFalconFirmware()->getLoopCount();
-		return;
 	}
-
-	std::array<double, 3> force;
-
-	double dist = 10000;
-	int closest = -1, outside=3, axis;
-
-	// For each axis, check if the end effector is inside
-	// the cube.  Record the distance to the closest wall.
-
-	for (axis=0; axis<3; axis++)
-	{
-		force[axis] = 0;
-		if (pos[axis] > m_cornerA[axis] && pos[axis] < m_cornerB[axis])
-		{
-			double dA = pos[axis]-m_cornerA[axis];
-			double dB = pos[axis]-m_cornerB[axis];
-			if (fabs(dA) < fabs(dist)) { dist = dA; closest = axis; }
-			if (fabs(dB) < fabs(dist)) { dist = dB; closest = axis; }
-			outside--;
-		}
-	}
-
-	// If so, add a proportional force to kick it back
-	// outside from the nearest wall.
-
-	if (closest > -1 && !outside)
-		force[closest] = -m_stiffness*dist;
-	m_falconDevice->setForce(force);
 }
-
@@ -3,6 +3,7 @@
 
 #include "FalconTestBase.h"
 #include "falcon/gmtl/Vec.h"
+#include "falcon/core/FalconForceField.h"
 
 class FalconCubeTest : public FalconTestBase
 {
@@ -12,6 +13,7 @@ protected:
 	gmtl::Vec3f m_cornerA;
 	gmtl::Vec3f m_cornerB;
 	double m_stiffness;
+	libnifalcon::FalconForceField m_field;
 	void runFunction();
 	bool m_isInitializing;
 	bool m_hasPrintedInitMsg;
@@ -0,0 +1,65 @@
+#include "FalconSDFTest.h"
+
+#include "falcon/core/FalconDevice.h"
+#include "falcon/grip/FalconGripFourButton.h"
+#include "falcon/kinematic/FalconKinematicStamper.h"
+#include "falcon/estimator/FalconVelocityEstimatorKalman.h"
+
+FalconSDFTest::FalconSDFTest(std::shared_ptr<libnifalcon::FalconDevice> d, const std::string& filename) :
+	FalconTestBase(d),
+	m_renderer(std::make_shared<libnifalcon::FalconHapticSDF>()),
+	m_isInitializing(true),
+	m_hasPrintedInitMsg(false),
+	m_wasInside(false)
+{
+	setPrintOnCount(1000);
+	m_falconDevice->setFalconKinematic<libnifalcon::FalconKinematicStamper>();
+	m_falconDevice->setFalconGrip<libnifalcon::FalconGripFourButton>();
+	m_falconDevice->setFalconVelocityEstimator<libnifalcon::FalconVelocityEstimatorKalman>();
+
+	std::shared_ptr<libnifalcon::FalconSDFGrid> grid = std::make_shared<libnifalcon::FalconSDFGrid>();
+	if(!grid->open(filename))
+	{
+		std::cout << "Cannot open grid " << filename << " - Error Code: " << grid->getErrorCode() << std::endl;
+		return;
+	}
+	std::array<double, 3> origin = grid->getOrigin();
+	std::array<unsigned int, 3> cells = grid->getCells();
+	std::cout << "Grid: " << cells[0] << "x" << cells[1] << "x" << cells[2] << " cells from ("
+			  << origin[0] << ", " << origin[1] << ", " << origin[2] << "), spacing " << grid->getSpacing() << std::endl;
+	m_renderer->setStiffness(1000.0);
+	m_renderer->setMaxForce(10.0);
+	m_renderer->setGrid(grid);
+}
+
+void FalconSDFTest::runFunction()
+{
+	if(!m_falconDevice->runIOLoop())
+		return;
+
+	if(m_isInitializing)
+	{
+		if(!m_hasPrintedInitMsg)
+		{
+			std::cout << "Move the end effector all the way out" << std::endl;
+			m_hasPrintedInitMsg = true;
+		}
+		//Hook the renderer up only once the end effector is clear of the shape
+		if(m_falconDevice->getPosition()[2] > .170)
+		{
+			std::cout << "Starting SDF simulation..." << std::endl;
+			m_falconDevice->setHapticRenderer(m_renderer);
+			m_isInitializing = false;
+			tstart();
+		}
+		m_lastLoopCount = m_falconDevice->getFalconFirmware()->getLoopCount();
+		return;
+	}
+
+	bool inside = m_renderer->getDistance() < 0.0;
+	if(inside != m_wasInside)
+	{
+		m_wasInside = inside;
+		std::cout << (inside ? "Contact" : "Free") << std::endl;
+	}
+}
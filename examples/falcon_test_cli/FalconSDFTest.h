@@ -0,0 +1,22 @@
+#ifndef FALCON_SDF_TEST_H
+#define FALCON_SDF_TEST_H
+
+#include <string>
+
+#include "FalconTestBase.h"
+#include "falcon/haptic/FalconHapticSDF.h"
+
+class FalconSDFTest : public FalconTestBase
+{
+public:
+	FalconSDFTest(std::shared_ptr<libnifalcon::FalconDevice> d, const std::string& filename);
+protected:
+	void runFunction();
+
+	std::shared_ptr<libnifalcon::FalconHapticSDF> m_renderer;
+	bool m_isInitializing;
+	bool m_hasPrintedInitMsg;
+	bool m_wasInside;
+};
+
+#endif
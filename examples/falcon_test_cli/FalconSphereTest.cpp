@@ -3,11 +3,16 @@
 #include "falcon/core/FalconDevice.h"
 #include "falcon/grip/FalconGripFourButton.h"
 #include "falcon/kinematic/FalconKinematicStamper.h"
+#include "falcon/estimator/FalconVelocityEstimatorKalman.h"
+#include "falcon/core/FalconForceField.h"
 
 FalconSphereTest::FalconSphereTest(std::shared_ptr<libnifalcon::FalconDevice> d) :
 	FalconTestBase(d),
 	m_radius(0.028),
 	m_stiffness(1000.0),
+	m_fieldStiffness(0.0),
+	m_fieldRadius(0.0),
+	m_fieldIsViscous(false),
 	m_isInitializing(true),
 	m_hasPrintedInitMsg(false),
 	m_plusButtonDown(false),
@@ -18,7 +23,33 @@ FalconSphereTest::FalconSphereTest(std::shared_ptr<libnifalcon::FalconDevice> d)
 	setPrintOnCount(1000);
 	m_falconDevice->setFalconKinematic<libnifalcon::FalconKinematicStamper>();
 	m_falconDevice->setFalconGrip<libnifalcon::FalconGripFourButton>();
-	m_oldpos[0] = m_oldpos[1] = m_oldpos[2] = 0.0;
+	m_falconDevice->setFalconVelocityEstimator<libnifalcon::FalconVelocityEstimatorKalman>();
+}
+
+void FalconSphereTest::updateField()
+{
+	//Only hand the I/O loop a new field when something actually changed
+	if(m_stiffness == m_fieldStiffness && m_radius == m_fieldRadius && m_forwardButtonDown == m_fieldIsViscous)
+	{
+		return;
+	}
+	m_fieldStiffness = m_stiffness;
+	m_fieldRadius = m_radius;
+	m_fieldIsViscous = m_forwardButtonDown;
+
+	libnifalcon::FalconForceField field;
+	std::array<double, 3> center = {{0.0, 0.0, 0.11}};
+	if(m_forwardButtonDown)
+	{
+		//Sticky (or slippery, with negative stiffness) sphere. The stiffness scaling matches the
+		//position difference filter this test used to run at app rate.
+		field.addViscousZone(center, m_radius, m_stiffness * 0.0067);
+	}
+	else
+	{
+		field.addSphere(center, m_radius, m_stiffness, 1.0);
+	}
+	m_falconDevice->setForceField(field);
 }
 
 void FalconSphereTest::runFunction()
@@ -40,8 +71,6 @@ void FalconSphereTest::runFunction()
 			std::cout << "Starting sphere simulation..." << std::endl;
 			m_isInitializing = false;
 			tstart();
-		} else {
-			m_oldpos = pos;
 		}
 		m_lastLoopCount = m_falconDevice->getFalconFirmware()->getLoopCount();
 		return;
@@ -107,31 +136,5 @@ void FalconSphereTest::runFunction()
 	}
 
 
-	std::array<double, 3> force;
-	force[0] = 0.0;
-	force[1] = 0.0;
-	force[2] = 0.0;
-	
-	// offset z 
-	pos[2] -= 0.11;
-	
-	double dist = sqrt(pos[0]*pos[0]+pos[1]*pos[1]+pos[2]*pos[2]);
-
-	if (dist < m_radius) {
-		if (m_forwardButtonDown) {
-			force[0] = (m_oldpos[0] - pos[0]) * m_stiffness * 10.0;
-			force[1] = (m_oldpos[1] - pos[1]) * m_stiffness * 10.0;
-			force[2] = (m_oldpos[2] - pos[2]) * m_stiffness * 10.0;
-		} else {
-			force[0] = (pos[0] / dist) * (m_radius - dist) * m_stiffness;
-			force[1] = (pos[1] / dist) * (m_radius - dist) * m_stiffness;
-			force[2] = (pos[2] / dist) * (m_radius - dist) * m_stiffness;
-		} 
-	}
-        // dampen position update to remove noise.
-	m_oldpos[0] = 0.4*m_oldpos[0]+ 0.6*pos[0];
-	m_oldpos[1] = 0.4*m_oldpos[1]+ 0.6*pos[1];
-	m_oldpos[2] = 0.4*m_oldpos[2]+ 0.6*pos[2];
-	m_falconDevice->setForce(force);
+	updateField();
 }
-
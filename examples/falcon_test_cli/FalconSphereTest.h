@@ -11,7 +11,9 @@ public:
 protected:
 	double m_stiffness;
     double m_radius;
-	std::array<double, 3> m_oldpos;
+	double m_fieldStiffness;
+	double m_fieldRadius;
+	bool m_fieldIsViscous;
     bool m_plusButtonDown;
     bool m_minusButtonDown;
     bool m_centerButtonDown;
@@ -19,6 +21,7 @@ protected:
     
 
 	void runFunction();
+	void updateField();
 	bool m_isInitializing;
 	bool m_hasPrintedInitMsg;
 
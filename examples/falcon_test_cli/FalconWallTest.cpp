@@ -3,6 +3,7 @@
 #include "falcon/core/FalconDevice.h"
 #include "falcon/grip/FalconGripFourButton.h"
 #include "falcon/kinematic/FalconKinematicStamper.h"
+#include "falcon/estimator/FalconVelocityEstimatorKalman.h"
 
 FalconWallTest::FalconWallTest(std::shared_ptr<libnifalcon::FalconDevice> d, unsigned int axis) :
 	FalconTestBase(d),
@@ -17,6 +18,7 @@ FalconWallTest::FalconWallTest(std::shared_ptr<libnifalcon::FalconDevice> d, uns
 {
 	m_falconDevice->setFalconKinematic<libnifalcon::FalconKinematicStamper>();
 	m_falconDevice->setFalconGrip<libnifalcon::FalconGripFourButton>();
+	m_falconDevice->setFalconVelocityEstimator<libnifalcon::FalconVelocityEstimatorKalman>();
 }
 
 void FalconWallTest::runFunction()
@@ -37,6 +39,13 @@ void FalconWallTest::runFunction()
 		{
 			std::cout << "Starting wall simulation... Press center button (circle button) to change direction of force..." << std::endl;
 			m_isInitializing = false;
+			//The wall is rendered by the I/O loop from here on
+			std::array<double, 3> point = {{m_axisBounds[0], m_axisBounds[1], m_axisBounds[2]}};
+			std::array<double, 3> normal = {{0.0, 0.0, 0.0}};
+			normal[m_axis] = m_positiveForce ? 1.0 : -1.0;
+			libnifalcon::FalconForceField field;
+			field.addPlane(point, normal, m_stiffness, 2.0);
+			m_falconDevice->setForceField(field);
 			tstart();
 		}
 		return;
@@ -55,31 +64,6 @@ void FalconWallTest::runFunction()
 		m_positiveForce = !m_positiveForce;
 		m_hasPrintedInitMsg = false;
 		m_isInitializing = true;
-		return;
+		m_falconDevice->setForceField(libnifalcon::FalconForceField());
 	}
-
-	std::array<double, 3> force = {0,0,0};
-
-	double dist = 10000;
-	int closest = -1, outside=3;
-
-	// For each axis, check if the end effector is inside
-	// the cube.  Record the distance to the closest wall.
-
-	force[m_axis] = 0;
-	if(((pos[m_axis] < m_axisBounds[m_axis]) && m_positiveForce) || ((pos[m_axis] > m_axisBounds[m_axis]) && !m_positiveForce))
-	{
-		double dA = pos[m_axis]-m_axisBounds[m_axis];
-		dist = dA;
-		closest = m_axis;
-	}
-
-	// If so, add a proportional force to kick it back
-	// outside from the nearest wall.
-
-	if (closest > -1)
-		force[closest] = -m_stiffness*dist;
-	m_falconDevice->setForce(force);
-
 }
-
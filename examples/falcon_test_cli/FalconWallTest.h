@@ -3,6 +3,7 @@
 
 #include "FalconTestBase.h"
 #include "falcon/gmtl/Vec.h"
+#include "falcon/core/FalconForceField.h"
 
 class FalconWallTest : public FalconTestBase
 {
@@ -25,6 +25,8 @@
 #include "FalconSphereTest.h"
 #include "FalconWallTest.h"
 #include "FalconColorTest.h"
+#include "FalconSDFTest.h"
+#include "FalconCouplingTest.h"
 
 using namespace libnifalcon;
 
@@ -60,6 +62,10 @@ public:
 					.action("store_true");
 			m_parser.add_option("--sphere_test").help("Presents a sphere-shaped surface to touch")
 					.action("store_true");
+			m_parser.add_option("--sdf_test").help("Presents the shape stored in a signed distance grid (see falcon_sdf_build) to touch")
+					.metavar("FILE");
+			m_parser.add_option("--coupling_test").help("Presents a floor simulated at 60Hz, coupled to the I/O loop")
+					.action("store_true");
 			m_parser.add_option("--color_test").help("Fades LEDs based on the position of the end effector")
 					.action("store_true");
 			m_parser.add_option("--x_wall_test").help("Presents a wall surface to touch (force along x axis)")
@@ -93,6 +99,18 @@ public:
 			std::cout << "Running sphere test" << std::endl;
 			t.reset(new FalconSphereTest(std::move(m_falconDevice)));
 		}
+		else if(options.is_set("sdf_test"))
+		{
+			while(!calibrateDevice() && !stop);
+			std::cout << "Running SDF test" << std::endl;
+			t.reset(new FalconSDFTest(std::move(m_falconDevice), (std::string)options.get("sdf_test")));
+		}
+		else if(options.get("coupling_test"))
+		{
+			while(!calibrateDevice() && !stop);
+			std::cout << "Running coupling test" << std::endl;
+			t.reset(new FalconCouplingTest(std::move(m_falconDevice)));
+		}
 		else if(options.get("color_test"))
 		{
 			while(!calibrateDevice() && !stop);
@@ -15,7 +15,7 @@
 #include "falcon/core/FalconLogger.h"
 #include "falcon/core/FalconDevice.h"
 #include "falcon/firmware/FalconFirmwareNovintSDK.h"
-#include "falcon/util/FalconFirmwareBinaryNvent.h"
+#include "falcon/firmware/FalconFirmwareImages.h"
 #include <iostream>
 #include <cstdio>
 #include <cstdlib>
@@ -99,14 +99,15 @@ void runFalconTest()
 			std::cout << "Loading firmware" << std::endl;
 			for(int i = 0; i < 10; ++i)
 			{
-				if(!dev.getFalconFirmware()->loadFirmware(true, NOVINT_FALCON_NVENT_FIRMWARE_SIZE, const_cast<uint8_t*>(NOVINT_FALCON_NVENT_FIRMWARE)))
+				if(!dev.getFalconFirmware()->loadFirmwareImage(true, FalconFirmwareImages::DEFAULT_IMAGE))
 				{
 					std::cout << "Could not load firmware" << std::endl;
 					return;
 				}
 				else
 				{
-					std::cout <<"Firmware loaded" << std::endl;
+					const FalconFirmwareLoadStats& stats = dev.getFalconFirmware()->getLastLoadStats();
+					std::cout <<"Firmware loaded (" << stats.size << " bytes in " << stats.uploadTime / 1000000 << "ms, " << (int)(stats.throughput / 1024) << "kB/s)" << std::endl;
 					break;
 				}
 			}
@@ -15,7 +15,7 @@
 #include "falcon/core/FalconLogger.h"
 #include "falcon/core/FalconDevice.h"
 #include "falcon/firmware/FalconFirmwareNovintSDK.h"
-#include "falcon/util/FalconFirmwareBinaryNvent.h"
+#include "falcon/firmware/FalconFirmwareImages.h"
 #include <iostream>
 #include <cstdio>
 #include <cstdlib>
@@ -107,7 +107,7 @@ void runFalconTest()
 			std::cout << "Loading firmware" << std::endl;
 			for(int z = 0; z < 10; ++z)
 			{
-				if(!dev[i].getFalconFirmware()->loadFirmware(true, NOVINT_FALCON_NVENT_FIRMWARE_SIZE, const_cast<uint8_t*>(NOVINT_FALCON_NVENT_FIRMWARE)))
+				if(!dev[i].getFalconFirmware()->loadFirmwareImage(true, FalconFirmwareImages::DEFAULT_IMAGE))
 				{
 					std::cout << "Could not load firmware" << std::endl;
 					return;
@@ -28,6 +28,11 @@ namespace libnifalcon
  * by default by the FalconDevice constructor, so it is usually not needed.
  * However, it is left here for code compatibility for code that already used comm behavior setting, which
  * was required before libnifalcon v1.0
+ *
+ * Reads are event driven, the same way the libusb core's reads are asynchronous. The driver signals an
+ * event (FT_SetEventNotification) when bytes arrive. poll() sleeps on that event for up to the poll timeout
+ * (see setPollTimeout), and when it fires, moves everything the driver has queued into a ring buffer and
+ * timestamps it. read() only ever copies out of the ring, so there's no driver call on a tick with no data.
  */
 	class FalconCommFTD2XX : public FalconComm
 	{
@@ -37,7 +42,15 @@ namespace libnifalcon
 		 *
 		 *
 		 */
-		FalconCommFTD2XX() { }
+		FalconCommFTD2XX() :
+			m_falconDevice(NULL),
+			m_event(NULL),
+			m_ringHead(0),
+			m_ringTail(0),
+			m_isDriverPending(false),
+			m_pollTimeout(1000)
+		{
+		}
 
 		/**
 		 * Destructor
@@ -70,6 +83,7 @@ namespace libnifalcon
 		 * @return True if device is opened successfully, false otherwise. Error code set if false.
 		 */
 		virtual bool open(unsigned int index);
+		using FalconComm::open;
 
 		/**
 		 * Closes the device, if open
@@ -134,6 +148,21 @@ namespace libnifalcon
 		 * @return True if device is successfully set to normal operation, false otherwise. Error code set if false.
 		 */
 		virtual bool setNormalMode();
+
+		/**
+		 * Clears any data waiting in the receive ring
+		 */
+		virtual void reset();
+
+		/**
+		 * Sets the longest time poll() will wait for data before returning. poll() returns as soon as
+		 * data arrives, so this only costs time when nothing is coming back.
+		 *
+		 * @param[in] usec Timeout, in microseconds. Windows rounds this up to whole milliseconds.
+		 */
+		void setPollTimeout(unsigned int usec) { m_pollTimeout = usec; }
+
+		static const unsigned int RING_SIZE = 4096; /**< Size of the receive ring, in bytes. Must be a power of 2. */
 	protected:
 		/**
 		 * String describing the falcon (used for identification)
@@ -148,6 +177,37 @@ namespace libnifalcon
 		 * @return If should_open is true, non-zero if device opened. If should_open is false, device count or -1 if can't get count.
 		 */
 		int8_t openDeviceFTD2XX(unsigned int index, bool should_open);
+
+		/**
+		 * Waits for the driver to signal that bytes have arrived
+		 *
+		 * @param[in] usec Longest time to wait, in microseconds
+		 *
+		 * @return True if the event fired, false if the wait timed out
+		 */
+		bool waitForEvent(unsigned int usec);
+
+		/**
+		 * Moves bytes queued in the driver into the receive ring
+		 *
+		 * @return True if the driver could be read, false otherwise. Device error code set if false.
+		 */
+		bool fillRing();
+
+		/**
+		 * Copies bytes out of the receive ring
+		 *
+		 * @param[out] str Buffer to copy into
+		 * @param[in] size Largest number of bytes to copy
+		 *
+		 * @return Number of bytes copied
+		 */
+		unsigned int drainRing(uint8_t* str, unsigned int size);
+
+		/**
+		 * Returns the number of bytes waiting in the receive ring
+		 */
+		unsigned int getRingCount() { return m_ringHead - m_ringTail; }
 		/**
 		 * Internal pointer to ftdi device struct
 		 *
@@ -156,6 +216,16 @@ namespace libnifalcon
 		 * with the include at this level.
 		 */
 		void* m_falconDevice;
+		/**
+		 * Event the driver signals when bytes arrive. A HANDLE on windows, an EVENT_HANDLE* everywhere
+		 * else. Kept opaque for the same reason as m_falconDevice.
+		 */
+		void* m_event;
+		uint8_t m_ring[RING_SIZE]; /**< Receive ring */
+		unsigned int m_ringHead; /**< Count of bytes ever written to the ring. Index is m_ringHead & (RING_SIZE - 1). */
+		unsigned int m_ringTail; /**< Count of bytes ever read from the ring */
+		bool m_isDriverPending; /**< True if the ring filled up before the driver queue was emptied */
+		unsigned int m_pollTimeout; /**< Longest time poll() waits for data, in microseconds */
 	};
 };
 
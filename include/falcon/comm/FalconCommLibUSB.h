@@ -12,12 +12,14 @@
 #ifndef FALCONCOMMLIBUSB_H
 #define FALCONCOMMLIBUSB_H
 
+#include <vector>
 #include "falcon/core/FalconComm.h"
 
 struct timeval;
 struct libusb_device_handle;
 struct libusb_transfer;
 struct libusb_context;
+struct libusb_device;
 
 namespace libnifalcon
 {
@@ -58,7 +60,8 @@ namespace libnifalcon
 		~FalconCommLibUSB();
 
 		/**
-		 * Returns the number of devices connected to the system
+		 * Returns the number of devices connected to the system. Uses the cached device list when hotplug
+		 * is available, and rescans otherwise.
 		 *
 		 * @param[out] count The number of devices available
 		 *
@@ -67,13 +70,25 @@ namespace libnifalcon
 		virtual bool getDeviceCount(unsigned int& count);
 
 		/**
-		 * Opens the device at the specified index
+		 * Describes the devices connected to the system, with serial numbers and bus/port locations.
+		 * Uses the cached device list when hotplug is available, and rescans otherwise.
+		 *
+		 * @param[out] devices One entry per device, in index order
+		 *
+		 * @return True if the list was retreived correctly, false otherwise. Error code set if false.
+		 */
+		virtual bool getDeviceInfo(std::vector<FalconDeviceInfo>& devices);
+
+		/**
+		 * Opens the device at the specified index. Indexes are ordered by bus and port, so they stay the
+		 * same as long as the falcons stay plugged into the same ports.
 		 *
 		 * @param[in] index Index of the device to open
 		 *
 		 * @return True if device is opened successfully, false otherwise. Error code set if false.
 		 */
 		virtual bool open(unsigned int index);
+		using FalconComm::open;
 
 		/**
 		 * Closes the device, if open
@@ -83,6 +98,14 @@ namespace libnifalcon
 		 */
 		virtual bool close();
 
+		/**
+		 * Reopens the device after it was unplugged or its USB link reset, by finding it again at the bus
+		 * and port path it was opened from, and puts it back into normal mode.
+		 *
+		 * @return True if the device was reopened, false otherwise. Error code set if false.
+		 */
+		virtual bool reconnect();
+
 				/**
 		 * Read a specified number of bytes from the device
 		 *
@@ -94,12 +117,15 @@ namespace libnifalcon
 		virtual bool read(uint8_t* str, unsigned int size);
 		
 		/**
-		 * Write a specified number of bytes to the device
+		 * Write a specified number of bytes to the device. The data is copied, so the buffer can be reused as
+		 * soon as this returns. If a write is still in flight, the data is staged and sent when that write
+		 * completes; a staged write that hasn't gone out yet is replaced by newer data (latest wins), so stale
+		 * force commands are never queued up behind each other.
 		 *
 		 * @param[in] str Buffer to write data from
 		 * @param[in] size Amount of bytes to write
 		 *
-		 * @return True if (size) amount of bytes is written successfully, false otherwise. Error code set if false.
+		 * @return True if (size) amount of bytes is written or staged successfully, false otherwise. Error code set if false.
 		 */
 		virtual bool write(uint8_t* str, unsigned int size);
 		
@@ -123,6 +149,29 @@ namespace libnifalcon
 		 */
 		virtual bool writeBlocking(uint8_t* str, unsigned int size);
 
+		/**
+		 * Writes a buffer to the falcon bootloader, checking the echo as it comes back. Keeps up to
+		 * the upload window (see setUploadWindow) of chunks in flight, with reads always queued for the
+		 * echo, so the line stays busy instead of idling for a USB round trip after every chunk.
+		 *
+		 * @param[in] str Buffer to write data from
+		 * @param[in] size Amount of bytes to write
+		 * @param[in] verify True to compare the echo against the buffer
+		 *
+		 * @return True if (size) amount of bytes is written and echoed successfully, false otherwise. Error code set if false.
+		 */
+		virtual bool writeBlockingWithEcho(uint8_t* str, unsigned int size, bool verify);
+
+		/**
+		 * Sets how many chunks writeBlockingWithEcho may have written ahead of the echo (4 by default).
+		 * 1 gives the old write, wait for echo, repeat behavior.
+		 *
+		 * @param[in] chunks Number of chunks, clamped to [1, MAX_UPLOAD_WINDOW]
+		 */
+		void setUploadWindow(unsigned int chunks);
+
+		static const unsigned int MAX_UPLOAD_WINDOW = 8; /**< Largest upload window */
+
 		/**
 		 * Sets the communications mode and initializes the device to load firmware
 		 *
@@ -162,15 +211,33 @@ namespace libnifalcon
 		void setHasBytesAvailable(bool v);
 
 		/**
-		 * Mutator function needed by static callbacks for class updates
+		 * Mutator function needed by static callbacks for class updates. Marks the open device as lost.
 		 */
-		void setSent() { m_isWriteAllocated = false; }
+		void setDeviceLost();
+
+		/**
+		 * Mutator function needed by the hotplug callback for class updates
+		 *
+		 * @param[in] device Device that arrived or left
+		 * @param[in] arrived True if the device arrived, false if it left
+		 */
+		void onHotplug(struct libusb_device* device, bool arrived);
+
+		/**
+		 * Mutator function needed by static callbacks for class updates. Submits the staged write, if any.
+		 */
+		void setSent();
 
 		/**
 		 * Mutator function needed by static callbacks for class updates
 		 */
 		void setReceived()  { m_isReadAllocated = false; }
 
+		/**
+		 * Mutator function needed by static callbacks for class updates
+		 */
+		void setLastReadTimestamp(uint64_t t) { m_lastReadTimestamp = t; }
+
 		/**
 		 * Initializes libusb core
 		 *
@@ -188,11 +255,89 @@ namespace libnifalcon
 		 */		
 		void reset();
 
+		/**
+		 * Cancels the queued read and write, and handles libusb events until their callbacks have run.
+		 * Has to be called before the device handle is closed, as the callbacks use it.
+		 */
+		void drainTransfers();
+
 		/**
 		 * Causes a read to be queued
 		 */
 		void issueRead();
+
+		/**
+		 * Returns the number of writes actually submitted to the device
+		 *
+		 * @return Number of write transfers submitted since construction
+		 */
+		uint64_t getWritesSent() const { return m_writesSent; }
+
+		/**
+		 * Returns the number of writes that were replaced by newer data before they could be sent
+		 *
+		 * @return Number of staged writes dropped in favor of newer ones since construction
+		 */
+		uint64_t getWritesCoalesced() const { return m_writesCoalesced; }
 	protected:
+		/**
+		 * Submits the contents of the write buffer to the device
+		 *
+		 * @param[in] size Amount of bytes to write
+		 *
+		 * @return True if the transfer was submitted, false otherwise. Error code set if false.
+		 */
+		bool submitWrite(unsigned int size);
+
+		/**
+		 * Opens, claims and purges a device found in the device list, and remembers where it's plugged in
+		 *
+		 * @param[in] device Device to open
+		 *
+		 * @return True if device is opened successfully, false otherwise. Error code set if false.
+		 */
+		bool openDevice(struct libusb_device* device);
+
+		/**
+		 * Checks whether a device is plugged in at the bus and port path of the device last opened
+		 *
+		 * @param[in] device Device to check
+		 *
+		 * @return True if the device is at the same place
+		 */
+		bool isAtOpenedLocation(struct libusb_device* device);
+
+		/**
+		 * Looks through a device list for a falcon at the location of the device last opened. Used by
+		 * reconnect(), and to notice the device coming back when hotplug isn't available on the platform.
+		 *
+		 * @param[in] devs Device list, as returned by libusb_get_device_list
+		 *
+		 * @return The device if present, NULL otherwise. Only valid while the list is held.
+		 */
+		struct libusb_device* findOpenedLocation(struct libusb_device** devs);
+
+		/**
+		 * Rebuilds the device cache from the libusb device list, reading each falcon's serial number
+		 *
+		 * @return True if the device list was retrieved, false otherwise. Error code set if false.
+		 */
+		bool refreshDeviceCache();
+
+		/**
+		 * Handles pending hotplug events, then rescans if the device cache is stale
+		 *
+		 * @param[in] always_rescan_without_hotplug Rescan even if the cache is valid, when hotplug isn't available to invalidate it
+		 *
+		 * @return True if the device cache is usable, false otherwise. Error code set if false.
+		 */
+		bool updateDeviceCache(bool always_rescan_without_hotplug);
+
+		/**
+		 * Drops the device cache, releasing the cached libusb devices
+		 */
+		void clearDeviceCache();
+
 		/**
 		 * True if we currently have a write queued
 		 */ 
@@ -203,6 +348,11 @@ namespace libnifalcon
 		 */ 
 		bool m_isReadAllocated;
 
+		/**
+		 * Number of reads and writes submitted whose callbacks haven't run yet, cancelled ones included
+		 */
+		unsigned int m_transfersInFlight;
+
 		/**
 		 * Used for setting timeouts
 		 */ 
@@ -214,10 +364,30 @@ namespace libnifalcon
 		libusb_device_handle* m_falconDevice;
 
 		/**
-		 * Buffers for I/O
+		 * Buffers for I/O. input holds the write currently in flight, output receives reads.
 		 */ 
 		unsigned char input[128], output[128];
 
+		/**
+		 * Write waiting for the in flight write to complete
+		 */
+		unsigned char m_stagedWrite[128];
+
+		/**
+		 * Size of the staged write, 0 if nothing is staged
+		 */
+		unsigned int m_stagedWriteSize;
+
+		/**
+		 * Number of write transfers submitted
+		 */
+		uint64_t m_writesSent;
+
+		/**
+		 * Number of staged writes replaced before being sent
+		 */
+		uint64_t m_writesCoalesced;
+
 		/**
 		 * Transfer for reading
 		 */ 
@@ -232,6 +402,56 @@ namespace libnifalcon
 		 * Transfer for control messages
 		 */ 
 		struct libusb_context* m_usbContext;
+
+		/**
+		 * Hotplug callback registration, valid if m_hasHotplug is true
+		 */
+		int m_hotplugHandle;
+
+		/**
+		 * True if libusb hotplug notification is available and registered
+		 */
+		bool m_hasHotplug;
+
+		/**
+		 * Bus number of the device last opened
+		 */
+		uint8_t m_busNumber;
+
+		/**
+		 * Port path of the device last opened, from the root hub down
+		 */
+		uint8_t m_portNumbers[7];
+
+		/**
+		 * Depth of m_portNumbers, 0 if no device has been opened
+		 */
+		int m_portDepth;
+
+		/**
+		 * Time of the last device list scan for a lost device, when hotplug isn't available
+		 */
+		uint64_t m_lastScanTimestamp;
+
+		/**
+		 * Number of chunks writeBlockingWithEcho may have in flight
+		 */
+		unsigned int m_uploadWindow;
+
+		/**
+		 * Referenced libusb devices for all falcons found in the last scan, in index order
+		 */
+		std::vector<struct libusb_device*> m_deviceCache;
+
+		/**
+		 * Descriptions of the devices in m_deviceCache
+		 */
+		std::vector<FalconDeviceInfo> m_deviceInfoCache;
+
+		/**
+		 * True if the device cache reflects the devices attached. Cleared by hotplug events.
+		 */
+		bool m_isDeviceCacheValid;
 	private:
 		DECLARE_LOGGER();
 	};
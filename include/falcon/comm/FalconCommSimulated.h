@@ -0,0 +1,255 @@
+/***
+ * @file FalconCommSimulated.h
+ * @brief Hardware-free communications core that behaves like a falcon running the Novint SDK firmware
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#ifndef FALCONCOMMSIMULATED_H
+#define FALCONCOMMSIMULATED_H
+
+#include <array>
+#include <atomic>
+#include "falcon/core/FalconComm.h"
+#include "falcon/core/FalconGeometry.h"
+
+namespace libnifalcon
+{
+/**
+ * @class FalconCommSimulated
+ * @ingroup CommClasses
+ *
+ * FalconCommSimulated is a communications core that doesn't talk to any hardware. It answers every
+ * 16 byte packet written to it the way a falcon running the Novint SDK firmware (FalconFirmwareNovintSDK)
+ * would, using encoder values, grip buttons and homing state that are set through this class. Blocking
+ * reads echo back whatever was last written blocking, so firmware loading "succeeds" as well.
+ *
+ * This allows servers, clients and control code to be run and tested without a falcon attached:
+ *
+ * @code
+ * FalconDevice dev;
+ * dev.setFalconComm<FalconCommSimulated>();
+ * dev.setFalconFirmware<FalconFirmwareNovintSDK>();
+ * @endcode
+ *
+ * Encoder, grip and homing values can be changed from any thread while the device is running.
+ */
+	class FalconCommSimulated : public FalconComm
+	{
+	public:
+		/**
+		 * Constructor
+		 */
+		FalconCommSimulated();
+
+		/**
+		 * Destructor
+		 */
+		~FalconCommSimulated();
+
+		/**
+		 * Returns the number of simulated devices (see setDeviceCount)
+		 *
+		 * @param[out] count The number of devices available
+		 *
+		 * @return Always true
+		 */
+		virtual bool getDeviceCount(unsigned int& count);
+
+		/**
+		 * Describes the simulated devices. Device i has serial "SIMULATED<i>" and location "0-<i+1>".
+		 *
+		 * @param[out] devices One entry per device, in index order
+		 *
+		 * @return Always true
+		 */
+		virtual bool getDeviceInfo(std::vector<FalconDeviceInfo>& devices);
+
+		/**
+		 * Opens the simulated device at the specified index
+		 *
+		 * @param[in] index Index of the device to open
+		 *
+		 * @return True if index is in range, false otherwise. Error code set if false.
+		 */
+		virtual bool open(unsigned int index);
+		using FalconComm::open;
+
+		/**
+		 * Closes the device, if open
+		 *
+		 * @return True if device is closed successfully, false otherwise. Error code set if false.
+		 */
+		virtual bool close();
+
+		/**
+		 * Read a specified number of bytes of the last simulated reply
+		 *
+		 * @param[out] str Buffer to read data into
+		 * @param[in] size Amount of bytes to read
+		 *
+		 * @return True if device is open, false otherwise. Error code set if false.
+		 */
+		virtual bool read(uint8_t* str, unsigned int size);
+
+		/**
+		 * Writes a packet to the simulated firmware, which queues a reply for the next read
+		 *
+		 * @param[in] str Buffer to write data from
+		 * @param[in] size Amount of bytes to write
+		 *
+		 * @return True if device is open, false otherwise. Error code set if false.
+		 */
+		virtual bool write(uint8_t* str, unsigned int size);
+
+		/**
+		 * Reads back the data from the last blocking write
+		 *
+		 * @param[out] str Buffer to read data into
+		 * @param[in] size Amount of bytes to read
+		 *
+		 * @return True if device is open, false otherwise. Error code set if false.
+		 */
+		virtual bool readBlocking(uint8_t* str, unsigned int size);
+
+		/**
+		 * Stores data to be echoed back by readBlocking, like the falcon bootloader does
+		 *
+		 * @param[in] str Buffer to write data from
+		 * @param[in] size Amount of bytes to write
+		 *
+		 * @return True if device is open, false otherwise. Error code set if false.
+		 */
+		virtual bool writeBlocking(uint8_t* str, unsigned int size);
+
+		/**
+		 * Puts the simulated device into firmware loading mode
+		 *
+		 * @return True if device is open, false otherwise. Error code set if false.
+		 */
+		virtual bool setFirmwareMode();
+
+		/**
+		 * Puts the simulated device into normal operation mode
+		 *
+		 * @return True if device is open, false otherwise. Error code set if false.
+		 */
+		virtual bool setNormalMode();
+
+		/**
+		 * Reopens the simulated device after setConnected(true) brought it back
+		 *
+		 * @return True if the device has returned, false otherwise. Error code set if false.
+		 */
+		virtual bool reconnect();
+
+		/**
+		 * Reset the internal state of the communications object (bytes read/written, etc...)
+		 */
+		void reset();
+
+		/**
+		 * Simulates unplugging (false) and plugging back in (true) the device. Unplugging also loses the
+		 * homing state, like a power cycle does.
+		 *
+		 * @param connected True to plug in, false to unplug
+		 */
+		void setConnected(bool connected);
+
+		/**
+		 * Sets whether the simulated device is running firmware (true by default). Without firmware, packets
+		 * go unanswered. Entering firmware mode clears this, and returning to normal mode after firmware
+		 * data has been written sets it again.
+		 *
+		 * @param loaded True if firmware is running
+		 */
+		void setFirmwareLoaded(bool loaded) { m_firmwareLoaded = loaded; }
+
+		/**
+		 * Sets the number of devices reported by getDeviceCount, for all simulated comm objects
+		 *
+		 * @param count Number of simulated devices
+		 */
+		static void setDeviceCount(unsigned int count) { s_deviceCount = count; }
+
+		/**
+		 * Sets the raw encoder values reported to the firmware
+		 *
+		 * @param encoders Encoder values for motors 1-3
+		 */
+		void setEncoderValues(const std::array<int, 3>& encoders);
+
+		/**
+		 * Sets the encoder values that correspond to a set of leg angles (in radians), as
+		 * returned by FalconKinematic::getAngles. This is the inverse of FalconKinematic::getTheta.
+		 *
+		 * @param angles Leg angles for motors 1-3, in radians
+		 * @param geometry Geometry of the kinematics reading the device, for the encoder offset of each
+		 * leg. Defaults to the nominal geometry.
+		 */
+		void setAngles(const std::array<double, 3>& angles, const FalconGeometryParameters& geometry = FalconGeometryParameters());
+
+		/**
+		 * Sets the grip button bitfield reported to the firmware
+		 *
+		 * @param buttons Bitfield of pressed buttons (lower 4 bits)
+		 */
+		void setGripInfo(uint8_t buttons) { m_gripInfo = buttons & 0xf; }
+
+		/**
+		 * Sets whether homing completes as soon as the firmware asks for it (true by default).
+		 * If false, encoders stay unhomed until setHomed(true) is called.
+		 *
+		 * @param autohome True to home on request
+		 */
+		void setAutoHome(bool autohome) { m_autoHome = autohome; }
+
+		/**
+		 * Sets the homing status bits reported to the firmware
+		 *
+		 * @param homed True to report all encoders as homed
+		 */
+		void setHomed(bool homed) { m_homingStatus = homed ? 0x7 : 0x0; }
+
+		/**
+		 * Returns the last motor values commanded by the firmware
+		 *
+		 * @return Motor values for motors 1-3, as sent over the wire
+		 */
+		std::array<int, 3> getMotorValues();
+
+		/**
+		 * Returns the LED bitfield last commanded by the firmware
+		 *
+		 * @return LED bitfield (see FalconFirmware::FalconFirmwareLEDValues)
+		 */
+		uint8_t getLEDStatus() { return m_ledStatus; }
+	protected:
+		/**
+		 * Builds a reply packet from the current simulated state
+		 */
+		void buildReply();
+
+		static unsigned int s_deviceCount; /**< Number of devices reported by getDeviceCount */
+		bool m_firmwareMode; /**< True if in firmware loading mode */
+		std::atomic<bool> m_firmwareLoaded; /**< True if packets get answered */
+		unsigned int m_firmwareBytes; /**< Bytes written since entering firmware mode */
+		std::atomic<int> m_encoderValues[3]; /**< Encoder values to report */
+		std::atomic<int> m_motorValues[3]; /**< Motor values last commanded */
+		std::atomic<uint8_t> m_gripInfo; /**< Grip buttons to report */
+		std::atomic<uint8_t> m_homingStatus; /**< Homing bits to report */
+		std::atomic<uint8_t> m_ledStatus; /**< LED bits last commanded */
+		std::atomic<bool> m_autoHome; /**< True if homing requests complete immediately */
+		uint8_t m_reply[16]; /**< Reply to the last packet written */
+		uint8_t m_echo[128]; /**< Data from the last blocking write */
+		unsigned int m_echoSize; /**< Amount of data in m_echo */
+	private:
+		DECLARE_LOGGER();
+	};
+};
+
+#endif
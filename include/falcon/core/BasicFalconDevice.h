@@ -0,0 +1,431 @@
+/***
+ * @file BasicFalconDevice.h
+ * @brief Statically dispatched version of FalconDevice, plus a runtime polymorphic adapter
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#ifndef BASIC_FALCON_DEVICE_H
+#define BASIC_FALCON_DEVICE_H
+
+#include <array>
+#include <memory>
+#include <string>
+#include "falcon/core/FalconCore.h"
+#include "falcon/core/FalconComm.h"
+#include "falcon/core/FalconFirmware.h"
+#include "falcon/core/FalconKinematic.h"
+#include "falcon/core/FalconGrip.h"
+#include "falcon/core/FalconDevice.h"
+#include "falcon/core/FalconClock.h"
+
+namespace libnifalcon
+{
+/**
+ * @class BasicFalconDevice
+ * @ingroup CoreClasses
+ *
+ * BasicFalconDevice does the same job as FalconDevice, but takes its behaviors as template parameters
+ * and holds them by value, instead of holding shared pointers to whatever was set at runtime:
+ *
+ * @code
+ * BasicFalconDevice<FalconCommLibUSB, FalconFirmwareNovintSDK, FalconKinematicStamper, FalconGripFourButton> dev;
+ * dev.open(0);
+ * dev.getFalconFirmware().setHomingMode(true);
+ * while(dev.runIOLoop()) { ... }
+ * @endcode
+ *
+ * Since the exact type of every behavior is known, calls from the I/O loop into them are direct
+ * (no virtual dispatch), anything defined in a header can be inlined, and accessors return references,
+ * so there's no reference count traffic in application loops. The cost is that behaviors can't be
+ * swapped after construction.
+ *
+ * The static path stops at the firmware. Firmware implementations are shared with FalconDevice, and
+ * reach the comm through a (non-owning) shared_ptr<FalconComm>, so the firmware's calls into the comm
+ * (poll, read, write and the byte count accessors, a handful per loop) are still virtual. Those calls
+ * mostly end in a system call or a libusb transfer, so the dispatch is a small part of their cost.
+ * Templating the firmware on the comm type as well would remove them, at the cost of a second copy of
+ * every firmware implementation.
+ *
+ * Velocity estimation and force fields are not part of the static servo path; use FalconDevice when
+ * they're needed. Code that needs to work with either kind of device can go through
+ * FalconDeviceInterface, using FalconDeviceAdapter.
+ *
+ * Behaviors are members, and the firmware holds a pointer to the comm member, so devices can't be copied.
+ */
+	template<class Comm, class Firmware, class Kinematic, class Grip>
+	class BasicFalconDevice : public FalconCore
+	{
+	public:
+		typedef Comm comm_type; /**< Communications behavior */
+		typedef Firmware firmware_type; /**< Firmware behavior */
+		typedef Kinematic kinematic_type; /**< Kinematic behavior */
+		typedef Grip grip_type; /**< Grip behavior */
+
+		/**
+		 * Constructor
+		 */
+		BasicFalconDevice() :
+			m_errorCount(0),
+			m_autoReconnect(true),
+			m_reconnectCount(0)
+		{
+			//Firmware only ever talks to the comm through a shared pointer. The comm is owned
+			//by this object, so hand it one that doesn't own anything.
+			m_falconFirmware.setFalconComm(std::shared_ptr<FalconComm>(std::shared_ptr<FalconComm>(), &m_falconComm));
+			m_position.fill(0.0);
+			m_forceVec.fill(0.0);
+		}
+
+		/**
+		 * Destructor
+		 */
+		~BasicFalconDevice()
+		{
+			close();
+		}
+
+		/**
+		 * Returns the number of falcons currectly connected to the system
+		 *
+		 * @param count Reference to return to
+		 *
+		 * @return true if count is successfully returned, false otherwise
+		 */
+		bool getDeviceCount(unsigned int& count)
+		{
+			if(!m_falconComm.getDeviceCount(count))
+			{
+				m_errorCode = m_falconComm.getErrorCode();
+				return false;
+			}
+			return true;
+		}
+
+		/**
+		 * Opens the falcon at the specified index
+		 *
+		 * @param index Index of falcon to open (starts at 0)
+		 *
+		 * @return true if falcon opened successfully, false otherwise
+		 */
+		bool open(unsigned int index)
+		{
+			if(!m_falconComm.open(index))
+			{
+				m_errorCode = m_falconComm.getErrorCode();
+				return false;
+			}
+			m_falconFirmware.resetFirmwareState();
+			return true;
+		}
+
+		/**
+		 * Opens the falcon with a certain serial number or bus/port location (see FalconDeviceInfo)
+		 *
+		 * @param id Serial number or location of falcon to open
+		 *
+		 * @return true if falcon opened successfully, false otherwise
+		 */
+		bool open(const std::string& id)
+		{
+			unsigned int index;
+			if(!m_falconComm.findDevice(id, index))
+			{
+				m_errorCode = m_falconComm.getErrorCode();
+				return false;
+			}
+			return open(index);
+		}
+
+		/**
+		 * Closes the falcon, if open
+		 */
+		void close()
+		{
+			if(m_falconComm.isCommOpen())
+			{
+				m_falconComm.close();
+			}
+			m_falconFirmware.resetFirmwareState();
+		}
+
+		/**
+		 * Checks whether the falcon communications are open
+		 *
+		 * @return True if open, false otherwise
+		 */
+		bool isOpen() { return m_falconComm.isCommOpen(); }
+
+		/**
+		 * Checks to see if firmware is loaded, by probing the device (see FalconFirmware::probeFirmware)
+		 *
+		 * @return true if firmware is loaded, false otherwise
+		 */
+		bool isFirmwareLoaded() { return m_falconFirmware.isFirmwareLoaded(); }
+
+		/**
+		 * Loads one of the firmware images built into the library (see FalconFirmwareImages)
+		 *
+		 * @param skip_checksum Whether or not to skip checksum tests when loading firmware
+		 * @param name Name of the image to load ("nvent", "test", etc...)
+		 *
+		 * @return true if firmware is loaded successfully, false otherwise
+		 */
+		bool loadFirmwareImage(bool skip_checksum, const std::string& name)
+		{
+			if(!m_falconFirmware.loadFirmwareImage(skip_checksum, name))
+			{
+				m_errorCode = m_falconFirmware.getErrorCode();
+				return false;
+			}
+			return true;
+		}
+
+		/**
+		 * Reopens the device after it was unplugged, reloading firmware if it was lost. See
+		 * FalconDevice::reconnect.
+		 *
+		 * @return true if the device is back in normal operation, false otherwise
+		 */
+		bool reconnect()
+		{
+			if(!m_falconComm.reconnect())
+			{
+				m_errorCode = m_falconComm.getErrorCode();
+				return false;
+			}
+			if(!m_falconFirmware.isFirmwareLoaded() && !m_falconFirmware.reloadFirmware(10))
+			{
+				m_errorCode = m_falconFirmware.getErrorCode();
+				return false;
+			}
+			m_falconFirmware.resetFirmwareState();
+			++m_reconnectCount;
+			return true;
+		}
+
+		/**
+		 * Sets whether runIOLoop reconnects the device by itself when it returns after being unplugged
+		 * (on by default)
+		 *
+		 * @param auto_reconnect True to reconnect automatically
+		 */
+		void setAutoReconnect(bool auto_reconnect) { m_autoReconnect = auto_reconnect; }
+
+		/**
+		 * Returns the number of successful reconnects since the device was created
+		 *
+		 * @return Number of reconnects
+		 */
+		unsigned int getReconnectCount() { return m_reconnectCount; }
+
+		/**
+		 * Runs one iteration of the IO Loop. Same logic as FalconDevice::runIOLoop, minus velocity
+		 * estimation and force fields.
+		 *
+		 * @param exe_flags Parts of the loop to run (FalconDevice::FALCON_LOOP_*)
+		 *
+		 * @return true on success, false otherwise
+		 */
+		bool runIOLoop(unsigned int exe_flags = (FalconDevice::FALCON_LOOP_FIRMWARE | FalconDevice::FALCON_LOOP_KINEMATIC | FalconDevice::FALCON_LOOP_GRIP))
+		{
+			if(!m_falconComm.isDeviceConnected())
+			{
+				m_errorCode = FalconDevice::FALCON_DEVICE_DISCONNECTED;
+				m_falconComm.poll();
+				if(m_autoReconnect && m_falconComm.hasDeviceReturned())
+				{
+					return reconnect();
+				}
+				return false;
+			}
+			if(exe_flags & FalconDevice::FALCON_LOOP_KINEMATIC)
+			{
+				std::array<int, 3> enc_vec;
+				m_falconKinematic.getForces(m_position, m_forceVec, enc_vec);
+				m_falconFirmware.setForces(enc_vec);
+			}
+			if(!m_falconFirmware.runIOLoop() && (exe_flags & FalconDevice::FALCON_LOOP_FIRMWARE))
+			{
+				++m_errorCount;
+				m_errorCode = m_falconFirmware.getErrorCode();
+				return false;
+			}
+			if(exe_flags & FalconDevice::FALCON_LOOP_GRIP)
+			{
+				if(!m_falconGrip.runGripLoop(m_falconFirmware.getGripInfoSize(), m_falconFirmware.getGripInfo()))
+				{
+					m_errorCode = m_falconGrip.getErrorCode();
+					return false;
+				}
+			}
+			if(exe_flags & FalconDevice::FALCON_LOOP_KINEMATIC)
+			{
+				std::array<int, 3> p = m_falconFirmware.getEncoderValues();
+				if(!m_falconKinematic.getPosition(p, m_position))
+				{
+					++m_errorCount;
+					m_errorCode = m_falconKinematic.getErrorCode();
+					return false;
+				}
+			}
+			if(exe_flags & FalconDevice::FALCON_LOOP_GRIP)
+			{
+				uint64_t timestamp = m_falconFirmware.getLastPacketTimestamp();
+				m_falconGrip.queueEdges(timestamp != 0 ? timestamp : getFalconTimestamp(), m_position);
+			}
+			return true;
+		}
+
+		/**
+		 * Return the position given by the kinematic behavior.
+		 *
+		 * @return Array of 3 doubles, representing 3D cartesian coordinate
+		 */
+		const std::array<double, 3>& getPosition() const { return m_position; }
+
+		/**
+		 * Set the instantanious force for the next I/O loop
+		 *
+		 * @param force Force vector, in cartesian coordinates (x,y,z)
+		 */
+		void setForce(const std::array<double, 3>& force) { m_forceVec = force; }
+
+		/**
+		 * Return the force that will be sent on the next I/O loop
+		 *
+		 * @return Force vector, in cartesian coordinates (x,y,z)
+		 */
+		const std::array<double, 3>& getForce() const { return m_forceVec; }
+
+		/**
+		 * Get communication behavior object
+		 *
+		 * @return Reference to internal falcon communications object
+		 */
+		Comm& getFalconComm() { return m_falconComm; }
+
+		/**
+		 * Get firmware behavior object
+		 *
+		 * @return Reference to internal falcon firmware object
+		 */
+		Firmware& getFalconFirmware() { return m_falconFirmware; }
+
+		/**
+		 * Get kinematic behavior object
+		 *
+		 * @return Reference to internal falcon kinematic object
+		 */
+		Kinematic& getFalconKinematic() { return m_falconKinematic; }
+
+		/**
+		 * Get grip behavior object
+		 *
+		 * @return Reference to internal falcon grip object
+		 */
+		Grip& getFalconGrip() { return m_falconGrip; }
+
+		/**
+		 * Get the number of total errors generated by the I/O loop
+		 *
+		 * @return Number of errors generated by the I/O loop since device creation
+		 */
+		unsigned int getErrorCount() { return m_errorCount; }
+	protected:
+		Comm m_falconComm; /**< Falcon communication object. Declared first, so it outlives the firmware's pointer to it. */
+		Firmware m_falconFirmware; /**< Falcon firmware object */
+		Kinematic m_falconKinematic; /**< Falcon kinematics object */
+		Grip m_falconGrip; /**< Falcon grip object */
+		unsigned int m_errorCount; /**< Number of errors in I/O loops */
+		bool m_autoReconnect; /**< True if runIOLoop should reconnect a returning device */
+		unsigned int m_reconnectCount; /**< Number of successful reconnects */
+		std::array<double, 3> m_position; /**< Current position in 3D cartesian coordinates */
+		std::array<double, 3> m_forceVec; /**< Current force in 3D cartesian coordinates */
+	private:
+		BasicFalconDevice(const BasicFalconDevice&);
+		BasicFalconDevice& operator=(const BasicFalconDevice&);
+	};
+
+/**
+ * @class FalconDeviceInterface
+ * @ingroup CoreClasses
+ *
+ * Runtime polymorphic view of a device, for code that has to work with devices whose behaviors aren't
+ * known at compile time (language bindings, tools that take a device from somewhere else). Wrap either
+ * a FalconDevice or a BasicFalconDevice in a FalconDeviceAdapter to get one.
+ *
+ * Every call through this interface is a virtual call, so it gives up what BasicFalconDevice gains.
+ * Keep it out of the servo loop where possible.
+ */
+	class FalconDeviceInterface
+	{
+	public:
+		virtual ~FalconDeviceInterface() {}
+		virtual bool open(unsigned int index) = 0; /**< See FalconDevice::open */
+		virtual void close() = 0; /**< See FalconDevice::close */
+		virtual bool isOpen() = 0; /**< See FalconDevice::isOpen */
+		virtual bool isFirmwareLoaded() = 0; /**< See FalconDevice::isFirmwareLoaded */
+		virtual bool loadFirmwareImage(bool skip_checksum, const std::string& name) = 0; /**< See FalconDevice::loadFirmwareImage */
+		virtual bool runIOLoop(unsigned int exe_flags = (FalconDevice::FALCON_LOOP_FIRMWARE | FalconDevice::FALCON_LOOP_KINEMATIC | FalconDevice::FALCON_LOOP_GRIP)) = 0; /**< See FalconDevice::runIOLoop */
+		virtual std::array<double, 3> getPosition() = 0; /**< See FalconDevice::getPosition */
+		virtual void setForce(const std::array<double, 3>& force) = 0; /**< See FalconDevice::setForce */
+		virtual std::array<double, 3> getForce() = 0; /**< See FalconDevice::getForce */
+		virtual FalconComm& getFalconComm() = 0; /**< Communications behavior */
+		virtual FalconFirmware& getFalconFirmware() = 0; /**< Firmware behavior */
+		virtual FalconKinematic& getFalconKinematic() = 0; /**< Kinematic behavior */
+		virtual FalconGrip& getFalconGrip() = 0; /**< Grip behavior */
+		virtual int getErrorCode() = 0; /**< See FalconCore::getErrorCode */
+		virtual unsigned int getErrorCount() = 0; /**< See FalconDevice::getErrorCount */
+	};
+
+/**
+ * @class FalconDeviceAdapter
+ * @ingroup CoreClasses
+ *
+ * Implements FalconDeviceInterface on top of a device it owns. Device can be FalconDevice (all four
+ * behaviors need to be set before the behavior accessors are used) or any BasicFalconDevice.
+ */
+	template<class Device>
+	class FalconDeviceAdapter : public FalconDeviceInterface
+	{
+	public:
+		/**
+		 * Returns the wrapped device, for setting it up or for statically dispatched access
+		 *
+		 * @return Reference to the device
+		 */
+		Device& getDevice() { return m_device; }
+
+		virtual bool open(unsigned int index) { return m_device.open(index); }
+		virtual void close() { m_device.close(); }
+		virtual bool isOpen() { return m_device.isOpen(); }
+		virtual bool isFirmwareLoaded() { return m_device.isFirmwareLoaded(); }
+		virtual bool loadFirmwareImage(bool skip_checksum, const std::string& name) { return m_device.loadFirmwareImage(skip_checksum, name); }
+		virtual bool runIOLoop(unsigned int exe_flags = (FalconDevice::FALCON_LOOP_FIRMWARE | FalconDevice::FALCON_LOOP_KINEMATIC | FalconDevice::FALCON_LOOP_GRIP)) { return m_device.runIOLoop(exe_flags); }
+		virtual std::array<double, 3> getPosition() { return m_device.getPosition(); }
+		virtual void setForce(const std::array<double, 3>& force) { m_device.setForce(force); }
+		virtual std::array<double, 3> getForce() { return m_device.getForce(); }
+		virtual FalconComm& getFalconComm() { return deref(m_device.getFalconComm()); }
+		virtual FalconFirmware& getFalconFirmware() { return deref(m_device.getFalconFirmware()); }
+		virtual FalconKinematic& getFalconKinematic() { return deref(m_device.getFalconKinematic()); }
+		virtual FalconGrip& getFalconGrip() { return deref(m_device.getFalconGrip()); }
+		virtual int getErrorCode() { return m_device.getErrorCode(); }
+		virtual unsigned int getErrorCount() { return m_device.getErrorCount(); }
+	protected:
+		//FalconDevice hands out shared pointers, BasicFalconDevice references
+		template<class T>
+		static T& deref(T& behavior) { return behavior; }
+		template<class T>
+		static T& deref(const std::shared_ptr<T>& behavior) { return *behavior; }
+
+		Device m_device; /**< Wrapped device */
+	};
+}
+
+#endif
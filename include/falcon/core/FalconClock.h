@@ -0,0 +1,35 @@
+/***
+ * @file FalconClock.h
+ * @brief Monotonic timestamp source shared by the communications, firmware and utility classes
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#ifndef FALCONCLOCK_H
+#define FALCONCLOCK_H
+
+#include <stdint.h>
+#include <chrono>
+
+namespace libnifalcon
+{
+	/**
+	 * Returns the current time of the monotonic (steady) clock, in nanoseconds.
+	 *
+	 * All timestamps handed out by libnifalcon (packet receive times, recorded sessions, etc...)
+	 * come from this clock, so they can be compared with each other directly. On the platforms we
+	 * support this is a vDSO/QPC read, not a system call, so it is safe to use on the I/O thread.
+	 *
+	 * @return Nanoseconds since an arbitrary, fixed epoch
+	 */
+	inline uint64_t getFalconTimestamp()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+}
+
+#endif
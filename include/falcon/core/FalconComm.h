@@ -13,10 +13,29 @@
 #define FALCONCOMMBASE_H
 
 #include <stdint.h>
+#include <string>
+#include <vector>
 #include "falcon/core/FalconCore.h"
 
 namespace libnifalcon
 {
+/**
+ * @struct FalconDeviceInfo
+ * @ingroup CommClasses
+ *
+ * Description of a falcon attached to the system, as returned by FalconComm::getDeviceInfo. Serial
+ * numbers and locations stay the same across reboots, unlike device indexes, so they should be used to
+ * tell falcons apart when more than one is connected.
+ */
+	struct FalconDeviceInfo
+	{
+		unsigned int index; /**< Index to pass to FalconComm::open */
+		std::string serial; /**< USB serial number, empty if it couldn't be read */
+		std::string location; /**< Bus and port path, as "bus-port.port...", empty if unknown */
+		int bus; /**< USB bus number, -1 if unknown */
+		std::vector<uint8_t> ports; /**< Port numbers from the root hub down to the device */
+	};
+
 
 /**
  * @class FalconComm
@@ -91,7 +110,9 @@ namespace libnifalcon
 			FALCON_COMM_DEVICE_INDEX_OUT_OF_RANGE_ERROR, /*!< Device index for opening out of range of available devices */
 			FALCON_COMM_FIRMWARE_NOT_FOUND_ERROR, /*!< Firmware file not found */
 			FALCON_COMM_WRITE_ERROR, /*!< Write timeout hit, underflow, etc... */
-			FALCON_COMM_READ_ERROR /*!< Read timeout hit, underflow, etc... */
+			FALCON_COMM_READ_ERROR, /*!< Read timeout hit, underflow, etc... */
+			FALCON_COMM_DEVICE_DISCONNECTED_ERROR, /*!< Device was unplugged or lost its USB link while open */
+			FALCON_COMM_ECHO_MISMATCH_ERROR /*!< Data echoed back by the device didn't match what was written */
 		};
 
 		/**
@@ -101,8 +122,11 @@ namespace libnifalcon
 		 */
 		FalconComm() :
 			m_isCommOpen(false),
+			m_isDeviceConnected(true),
+			m_hasDeviceReturned(false),
 			m_hasBytesAvailable(false),
-			m_bytesAvailable(0)
+			m_bytesAvailable(0),
+			m_lastReadTimestamp(0)
 		{}
 		
 		/**
@@ -120,6 +144,72 @@ namespace libnifalcon
 		 * @return True if count was retreived correctly, false otherwise. Error code set if false.
 		 */
 		virtual bool getDeviceCount(unsigned int& count) = 0;
+
+		/**
+		 * Describes the devices connected to the system. The default implementation only fills in
+		 * indexes; comm classes that can see the USB topology also fill in serials and locations.
+		 *
+		 * @param[out] devices One entry per device, in index order
+		 *
+		 * @return True if the list was retreived correctly, false otherwise. Error code set if false.
+		 */
+		virtual bool getDeviceInfo(std::vector<FalconDeviceInfo>& devices)
+		{
+			unsigned int count;
+			devices.clear();
+			if(!getDeviceCount(count))
+			{
+				return false;
+			}
+			for(unsigned int i = 0; i < count; ++i)
+			{
+				FalconDeviceInfo info;
+				info.index = i;
+				info.bus = -1;
+				devices.push_back(info);
+			}
+			return true;
+		}
+
+		/**
+		 * Finds the index of the device with a certain serial number or location
+		 *
+		 * @param[in] id Serial number or location (see FalconDeviceInfo) of the device
+		 * @param[out] index Index of the device, for open()
+		 *
+		 * @return True if the device was found, false otherwise. Error code set if false.
+		 */
+		bool findDevice(const std::string& id, unsigned int& index)
+		{
+			std::vector<FalconDeviceInfo> devices;
+			if(!getDeviceInfo(devices))
+			{
+				return false;
+			}
+			for(std::vector<FalconDeviceInfo>::const_iterator i = devices.begin(); i != devices.end(); ++i)
+			{
+				if(!id.empty() && (i->serial == id || i->location == id))
+				{
+					index = i->index;
+					return true;
+				}
+			}
+			m_errorCode = FALCON_COMM_DEVICE_NOT_FOUND_ERROR;
+			return false;
+		}
+
+		/**
+		 * Opens the device with a certain serial number or location
+		 *
+		 * @param[in] id Serial number or location (see FalconDeviceInfo) of the device
+		 *
+		 * @return True if device is opened successfully, false otherwise. Error code set if false.
+		 */
+		bool open(const std::string& id)
+		{
+			unsigned int index;
+			return findDevice(id, index) && open(index);
+		}
 		
 		/**
 		 * Opens the device at the specified index
@@ -178,6 +268,22 @@ namespace libnifalcon
 		 */
 		virtual bool writeBlocking(uint8_t* str, unsigned int size) = 0;
 
+		/**
+		 * Writes a buffer to a device that echoes everything it receives (the falcon bootloader, in
+		 * firmware mode), reading back and optionally checking the echo as it arrives. Returns as soon as
+		 * a mismatch is seen. Blocks until the whole buffer has been echoed or something fails.
+		 *
+		 * The default implementation writes one chunk at a time with writeBlocking, and waits for its echo
+		 * before writing the next. Comm classes that can keep several transfers in flight override this.
+		 *
+		 * @param[in] str Buffer to write data from
+		 * @param[in] size Amount of bytes to write
+		 * @param[in] verify True to compare the echo against the buffer
+		 *
+		 * @return True if (size) amount of bytes is written and echoed successfully, false otherwise. Error code set if false.
+		 */
+		virtual bool writeBlockingWithEcho(uint8_t* str, unsigned int size, bool verify);
+
 		/**
 		 * Sets the communications mode and initializes the device to load firmware
 		 *
@@ -256,17 +362,56 @@ namespace libnifalcon
 		 * Polls the object for confirmation of write/read return
 		 */
 		virtual void poll() {}
+
+		/**
+		 * Returns the time at which the data currently available for reading arrived from the device
+		 *
+		 * @return Timestamp (see getFalconTimestamp()) of the last completed read, 0 if nothing has been read yet
+		 */
+		uint64_t getLastReadTimestamp() { return m_lastReadTimestamp; }
+
+		/**
+		 * Checks whether the device is still attached. Becomes false when the open device is unplugged or
+		 * its USB link resets, and stays false until reconnect() succeeds. Updated during poll().
+		 *
+		 * @return True if the device is attached (or nothing is open), false if it was lost while open
+		 */
+		bool isDeviceConnected() { return m_isDeviceConnected; }
+
+		/**
+		 * Checks whether a device that was lost while open has been plugged back in, at the same place it
+		 * was opened from. Updated during poll().
+		 *
+		 * @return True if reconnect() should be able to reopen the device
+		 */
+		bool hasDeviceReturned() { return m_hasDeviceReturned; }
+
+		/**
+		 * Reopens the device after it was lost while open, without changing the index or any other state
+		 * held by the comm object, and puts it back into normal mode. Firmware is not reloaded here.
+		 *
+		 * @return True if the device was reopened, false otherwise. Error code set if false.
+		 */
+		virtual bool reconnect()
+		{
+			m_errorCode = FALCON_COMM_DEVICE_NOT_FOUND_ERROR;
+			return false;
+		}
 		
 	protected:
 		const static unsigned int MAX_DEVICES = 128; /**< Maximum number of devices to store in count buffers */
 		const static unsigned int FALCON_VENDOR_ID = 0x0403; /**< USB Vendor ID for the Falcon */
 		const static unsigned int FALCON_PRODUCT_ID = 0xCB48; /**< USB Product ID from the Falcon */
+		const static unsigned int ECHO_CHUNK_SIZE = 62; /**< Largest write for writeBlockingWithEcho, so each echo fits a 64 byte FTDI packet with its 2 status bytes */
 		int m_deviceErrorCode;	/**< Communications policy specific error code */
 		int m_lastBytesRead;	/**< Number of bytes read in last read operation */
 		int m_lastBytesWritten; /**< Number of bytes written in the last write operation */
 		bool m_isCommOpen; 	/**< Whether or not the communications are open */
+		bool m_isDeviceConnected; /**< False once the open device has been unplugged, until reconnected */
+		bool m_hasDeviceReturned; /**< True when a lost device has been plugged back in */
 		bool m_hasBytesAvailable; /**< Whether or not the object has bytes available to read */
 		int m_bytesAvailable; /**< Number of bytes object has available to read */
+		uint64_t m_lastReadTimestamp; /**< Time the last read completed, from getFalconTimestamp() */
 	};
 
 };
@@ -16,11 +16,18 @@
 #include <string>
 #include <array>
 #include "falcon/core/FalconLogger.h"
+#include "falcon/core/FalconClock.h"
 #include "falcon/core/FalconCore.h"
 #include "falcon/core/FalconComm.h"
 #include "falcon/core/FalconFirmware.h"
 #include "falcon/core/FalconKinematic.h"
+#include "falcon/core/FalconGeometryStore.h"
 #include "falcon/core/FalconGrip.h"
+#include "falcon/core/FalconVelocityEstimator.h"
+#include "falcon/core/FalconForceField.h"
+#include "falcon/core/FalconForceInterpolator.h"
+#include "falcon/core/FalconHapticRenderer.h"
+#include "falcon/core/FalconTripleBuffer.h"
 
 namespace libnifalcon
 {
@@ -36,6 +43,7 @@ namespace libnifalcon
  * - Firmware
  * - Grip
  * - Kinematics
+ * - Velocity estimation (optional)
  *
  * Once these behaviors are established, FalconDevice can be used to get/set common parameters (end
  * effector position, force generation, LED status, button/grip status, etc...) without have to refer
@@ -62,7 +70,8 @@ namespace libnifalcon
 			FALCON_DEVICE_NO_GRIP_SET, /**< Error for no grip policy set */
 			FALCON_DEVICE_NO_FIRMWARE_LOADED, /**< Error for no firmware loaded */
 			FALCON_DEVICE_FIRMWARE_NOT_VALID, /**< Error for firmware file missing */
-			FALCON_DEVICE_FIRMWARE_CHECKSUM_MISMATCH /**< Error for checksum mismatch during firmware loading */
+			FALCON_DEVICE_FIRMWARE_CHECKSUM_MISMATCH, /**< Error for checksum mismatch during firmware loading */
+			FALCON_DEVICE_DISCONNECTED /**< Error for device unplugged while open, waiting for it to return */
 		};
 
 		enum {
@@ -85,7 +94,7 @@ namespace libnifalcon
 		~FalconDevice();
 
 		/**
-		 * Checks to see if firmware is loaded by running IO loop 10 times, returning true on first success
+		 * Checks to see if firmware is loaded, by probing the device (see FalconFirmware::probeFirmware)
 		 * Will automatically return false is setFalconFirmware() has not been called.
 		 *
 		 * @return true if firmware is loaded, false otherwise
@@ -122,6 +131,16 @@ namespace libnifalcon
 		 */
 		bool loadFirmware(bool skip_checksum);
 
+		/**
+		 * Loads one of the firmware images built into the library (see FalconFirmwareImages)
+		 *
+		 * @param skip_checksum Whether or not to skip checksum tests when loading firmware (useful with ftd2xx on non-windows platforms)
+		 * @param name Name of the image to load ("nvent", "test", etc...)
+		 *
+		 * @return true if firmware is loaded successfully, false otherwise
+		 */
+		bool loadFirmwareImage(bool skip_checksum, const std::string& name);
+
 		/**
 		 * Returns the number of falcons currectly connected to the system
 		 *
@@ -132,7 +151,8 @@ namespace libnifalcon
 		bool getDeviceCount(unsigned int& count);
 
 		/**
-		 * Opens the falcon at the specified index
+		 * Opens the falcon at the specified index. If a geometry store is set, the kinematics are given
+		 * the geometry stored for the falcon's serial number, or the nominal geometry if it has none.
 		 *
 		 * @param index Index of falcon to open (starts at 0)
 		 *
@@ -140,18 +160,76 @@ namespace libnifalcon
 		 */
 		bool open(unsigned int index);
 
+		/**
+		 * Describes the falcons currently connected to the system
+		 *
+		 * @param devices Reference to return to, one entry per falcon in index order
+		 *
+		 * @return true if the list is successfully returned, false otherwise
+		 */
+		bool getDeviceInfo(std::vector<FalconDeviceInfo>& devices);
+
+		/**
+		 * Opens the falcon with a certain serial number or bus/port location (see FalconDeviceInfo). Unlike
+		 * indexes, these don't change between boots.
+		 *
+		 * @param id Serial number or location of falcon to open
+		 *
+		 * @return true if falcon opened successfully, false otherwise
+		 */
+		bool open(const std::string& id);
+
 		/**
 		 * Closes the falcon, if open
 		 *
 		 */
 		void close();
 
+		/**
+		 * Reopens the device after it was unplugged or its USB link reset, and restores it to the state it
+		 * was in: firmware is reloaded from memory if the device lost it, and the LED and homing mode
+		 * settings are sent again with the next I/O loop. The velocity estimator is reset. Called by
+		 * runIOLoop when auto reconnect is on and the device comes back.
+		 *
+		 * Reconnection runs on the calling thread. It is quick if the device kept its firmware (a link
+		 * reset), but takes a few seconds if firmware has to be reloaded, so devices that shouldn't stall
+		 * each other need their own I/O threads.
+		 *
+		 * @return true if the device is back in normal operation, false otherwise
+		 */
+		bool reconnect();
+
+		/**
+		 * Sets whether runIOLoop reconnects the device by itself when it returns after being unplugged
+		 * (on by default)
+		 *
+		 * @param auto_reconnect True to reconnect automatically
+		 */
+		void setAutoReconnect(bool auto_reconnect) { m_autoReconnect = auto_reconnect; }
+
+		/**
+		 * Returns the number of successful reconnects since the device was created
+		 *
+		 * @return Number of reconnects
+		 */
+		unsigned int getReconnectCount() { return m_reconnectCount; }
+
+		/**
+		 * Returns how long the last successful reconnect took, from reopening to firmware being ready
+		 *
+		 * @return Reconnect time in nanoseconds, 0 if the device never reconnected
+		 */
+		uint64_t getLastReconnectTime() { return m_lastReconnectTime; }
+
 		/**
 		 * Runs one iteration of the IO Loop, with the following logic
+		 * - If the device was unplugged, poll for its return (reconnecting if auto reconnect is on) and return false
 		 * - If firmware not set, return false
+		 * - If kinematic behavior is set, evaluate the force field and haptic renderer and send forces to the firmware
 		 * - Run firmware IO Loop, return false if fails
 		 * - If falcon is homed and kinematic behavior is set, Run kinematic update, return false if fails
 		 * - If grip behavior is set, run grip update, return false if fails
+		 * - If grip behavior is set, queue button press/release events (see FalconGrip::popEvent)
 		 *
 		 * @return true on success, false otherwise
 		 */
@@ -184,13 +262,23 @@ namespace libnifalcon
 		void setFalconGrip();
 
 		/**
-		 * Set communications behavior, and create a new internal object from it.
+		 * Set kinematic behavior, and create a new internal object from it. The device's geometry is
+		 * passed to it.
 		 *
 		 * Template should be a subclass of FalconKinematic
 		 */
 		template<class T>
 		void setFalconKinematic();
 
+		/**
+		 * Set velocity estimation behavior, and create a new internal object from it. Once set, velocity
+		 * and acceleration are estimated in every I/O loop that receives a new packet.
+		 *
+		 * Template should be a subclass of FalconVelocityEstimator
+		 */
+		template<class T>
+		void setFalconVelocityEstimator();
+
 		/**
 		 * Return the position given by the kinematic behavior.
 		 *
@@ -199,7 +287,25 @@ namespace libnifalcon
 		std::array<double, 3> getPosition() { return m_position; }
 
 		/**
-		 * Set the instantanious force for the next I/O loop
+		 * Return the end effector velocity, as estimated by the velocity estimation behavior and mapped
+		 * through the kinematic jacobian. Always zero if no estimator is set.
+		 *
+		 * @return Array of 3 doubles, representing 3D cartesian velocity (meters/s)
+		 */
+		std::array<double, 3> getVelocity() { return m_velocity; }
+
+		/**
+		 * Return the end effector acceleration, as estimated by the velocity estimation behavior and mapped
+		 * through the kinematic jacobian. The jacobian's own rate of change is ignored, which is negligible
+		 * at the speeds the falcon moves at. Always zero if no estimator is set.
+		 *
+		 * @return Array of 3 doubles, representing 3D cartesian acceleration (meters/s^2)
+		 */
+		std::array<double, 3> getAcceleration() { return m_acceleration; }
+
+		/**
+		 * Set the instantanious force for the next I/O loop. If a force interpolator is set, the force is
+		 * stamped with the current time and queued to it instead.
 		 *
 		 * @param force Force vector, in cartesian coordinates (x,y,z)
 		 */
@@ -208,8 +314,142 @@ namespace libnifalcon
 			m_forceVec[0] = force[0];
 			m_forceVec[1] = force[1];
 			m_forceVec[2] = force[2];
+			if(m_forceInterpolator != nullptr)
+			{
+				m_forceInterpolator->pushForce(force, getFalconTimestamp());
+			}
+		}
+
+		/**
+		 * Set the force for a given time, for a force interpolator to work from. Without an interpolator,
+		 * the same as setForce(force).
+		 *
+		 * @param force Force vector, in cartesian coordinates (x,y,z)
+		 * @param timestamp Time the force applies at, from getFalconTimestamp()
+		 */
+		void setForce(std::array<double, 3> force, uint64_t timestamp)
+		{
+			m_forceVec[0] = force[0];
+			m_forceVec[1] = force[1];
+			m_forceVec[2] = force[2];
+			if(m_forceInterpolator != nullptr)
+			{
+				m_forceInterpolator->pushForce(force, timestamp);
+			}
+		}
+
+		/**
+		 * Return the force that will be sent on the next I/O loop
+		 *
+		 * @return Force vector, in cartesian coordinates (x,y,z)
+		 */
+		std::array<double, 3> getForce() { return m_forceVec; }
+
+		/**
+		 * Sets the interpolator that turns forces set at the application's rate into a smooth force for
+		 * every I/O loop. The interpolated force replaces the force set by setForce. Not thread safe: set
+		 * the interpolator before starting the thread that runs runIOLoop. Pass nullptr to send forces
+		 * as set.
+		 *
+		 * @param interpolator Interpolator to use
+		 */
+		void setForceInterpolator(std::shared_ptr<FalconForceInterpolator> interpolator) { m_forceInterpolator = interpolator; }
+
+		/**
+		 * Get force interpolator object pointer
+		 *
+		 * @return Smart pointer to the interpolator set by setForceInterpolator, or nullptr
+		 */
+		std::shared_ptr<FalconForceInterpolator> getForceInterpolator() { return m_forceInterpolator; }
+
+		/**
+		 * Sets the force field to evaluate in every I/O loop. The field's force is added to the force set
+		 * by setForce. The field is copied and handed to the I/O loop without locking, so this can be
+		 * called from the application thread while another thread runs runIOLoop, as long as only one
+		 * thread sets fields.
+		 *
+		 * @param field Field to render. Pass an empty field to stop rendering.
+		 */
+		void setForceField(const FalconForceField& field)
+		{
+			m_forceFields.getWriteBuffer() = field;
+			m_forceFields.publish();
+		}
+
+		/**
+		 * Return the force generated by the force field in the last I/O loop. Only meaningful on the
+		 * thread running runIOLoop.
+		 *
+		 * @return Force vector, in cartesian coordinates (x,y,z)
+		 */
+		std::array<double, 3> getForceFieldForce() { return m_forceFieldVec; }
+
+		/**
+		 * Sets the haptic renderer to run in every I/O loop, after the force field. The renderer's force
+		 * is added to the force set by setForce. Not thread safe: set the renderer before starting the
+		 * thread that runs runIOLoop, and update its scene through the renderer itself. Pass nullptr to
+		 * stop rendering.
+		 *
+		 * @param renderer Renderer to run
+		 */
+		void setHapticRenderer(std::shared_ptr<FalconHapticRenderer> renderer)
+		{
+			m_hapticRenderer = renderer;
+			m_hapticForceVec.fill(0.0);
 		}
 
+		/**
+		 * Get haptic renderer object pointer
+		 *
+		 * @return Smart pointer to the renderer set by setHapticRenderer, or nullptr
+		 */
+		std::shared_ptr<FalconHapticRenderer> getHapticRenderer() { return m_hapticRenderer; }
+
+		/**
+		 * Return the force generated by the haptic renderer in the last I/O loop. Only meaningful on the
+		 * thread running runIOLoop.
+		 *
+		 * @return Force vector, in cartesian coordinates (x,y,z)
+		 */
+		std::array<double, 3> getHapticRendererForce() { return m_hapticForceVec; }
+
+		/**
+		 * Sets the store to look up each device's calibrated geometry in when it is opened. Pass nullptr
+		 * to stop looking, leaving the geometry as it is.
+		 *
+		 * @param store Geometry store to use
+		 */
+		void setGeometryStore(std::shared_ptr<FalconGeometryStore> store) { m_geometryStore = store; }
+
+		/**
+		 * Get geometry store object pointer
+		 *
+		 * @return Smart pointer to the store set by setGeometryStore, or nullptr
+		 */
+		std::shared_ptr<FalconGeometryStore> getGeometryStore() { return m_geometryStore; }
+
+		/**
+		 * Sets the geometry of the device, and passes it to the kinematic behavior, if it exists. Not
+		 * thread safe: set the geometry before starting the thread that runs runIOLoop.
+		 *
+		 * @param geometry Mechanical measurements of the device
+		 */
+		void setGeometry(const FalconGeometryParameters& geometry)
+		{
+			m_geometry = geometry;
+			if(m_falconKinematic != nullptr)
+			{
+				m_falconKinematic->setGeometry(m_geometry);
+			}
+		}
+
+		/**
+		 * Returns the geometry of the device, as set by setGeometry or loaded on open
+		 *
+		 * @return Mechanical measurements of the device
+		 */
+		const FalconGeometryParameters& getGeometry() const { return m_geometry; }
+
 		/**
 		 * Get communication behavior object pointer
 		 *
@@ -238,6 +478,13 @@ namespace libnifalcon
 		 */
 		std::shared_ptr<FalconKinematic> getFalconKinematic() { return m_falconKinematic; }
 
+		/**
+		 * Get velocity estimation behavior object pointer
+		 *
+		 * @return Non-smart pointer to internal falcon velocity estimator object
+		 */
+		std::shared_ptr<FalconVelocityEstimator> getFalconVelocityEstimator() { return m_falconVelocityEstimator; }
+
 		/**
 		 * Checks whether the falcon communications are open
 		 *
@@ -259,13 +506,41 @@ namespace libnifalcon
 		 */
 		unsigned int getErrorCount() { return m_errorCount; }
 	protected:
+		/**
+		 * Feeds the latest encoder values to the velocity estimator and maps its output to cartesian space
+		 *
+		 * @param encoders Encoder values received in this loop
+		 */
+		void updateVelocity(const std::array<int, 3>& encoders);
+
+		/**
+		 * Sets the geometry stored for a device, or the nominal geometry if there is none
+		 *
+		 * @param index Index of the device that was opened
+		 */
+		void loadGeometry(unsigned int index);
+
 		unsigned int m_errorCount;	/**< Number of errors in I/O loops */
+		bool m_autoReconnect; /**< True if runIOLoop should reconnect a returning device */
+		unsigned int m_reconnectCount; /**< Number of successful reconnects */
+		uint64_t m_lastReconnectTime; /**< Duration of the last reconnect, in nanoseconds */
 		std::shared_ptr<FalconComm> m_falconComm; /**< Falcon communication object */
 		std::shared_ptr<FalconKinematic> m_falconKinematic; /**<  Falcon kinematics object */
 		std::shared_ptr<FalconFirmware> m_falconFirmware; /**<  Falcon firmware object */
 		std::shared_ptr<FalconGrip> m_falconGrip; /**< Falcon grip object */
+		std::shared_ptr<FalconVelocityEstimator> m_falconVelocityEstimator; /**< Falcon velocity estimator object */
 		std::array<double, 3> m_position;	/**< Current position in 3D cartesian coordinates */
 		std::array<double, 3> m_forceVec;	/**< Current force in 3D cartesian coordinates */
+		std::array<double, 3> m_velocity;	/**< Current velocity in 3D cartesian coordinates */
+		std::array<double, 3> m_acceleration;	/**< Current acceleration in 3D cartesian coordinates */
+		uint64_t m_lastEstimatorTimestamp; /**< Packet timestamp last fed to the velocity estimator */
+		FalconTripleBuffer<FalconForceField> m_forceFields; /**< Force fields handed from setForceField to the I/O loop */
+		std::array<double, 3> m_forceFieldVec; /**< Force generated by the force field in the last I/O loop */
+		std::shared_ptr<FalconForceInterpolator> m_forceInterpolator; /**< Interpolator for forces set by setForce, if set */
+		std::shared_ptr<FalconHapticRenderer> m_hapticRenderer; /**< Renderer run in every I/O loop, if set */
+		std::array<double, 3> m_hapticForceVec; /**< Force generated by the haptic renderer in the last I/O loop */
+		std::shared_ptr<FalconGeometryStore> m_geometryStore; /**< Store to load device geometry from on open, if set */
+		FalconGeometryParameters m_geometry; /**< Geometry handed to the kinematic behavior */
 	private:
 		DECLARE_LOGGER();
 	};
@@ -300,6 +575,15 @@ namespace libnifalcon
 	void FalconDevice::setFalconKinematic()
 	{
 		m_falconKinematic = std::make_shared<T>();
+		m_falconKinematic->setGeometry(m_geometry);
+	}
+
+	template<class T>
+	void FalconDevice::setFalconVelocityEstimator()
+	{
+		m_falconVelocityEstimator = std::make_shared<T>();
+		m_velocity.fill(0.0);
+		m_acceleration.fill(0.0);
 	}
 
 }
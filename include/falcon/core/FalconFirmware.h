@@ -18,12 +18,29 @@
 #include <cstdlib>
 #include <deque>
 #include <array>
+#include <vector>
 #include <memory>
 #include "falcon/core/FalconComm.h"
 #include "falcon/core/FalconLogger.h"
 
 namespace libnifalcon
 {
+/**
+ * @struct FalconFirmwareLoadStats
+ * @ingroup CoreClasses
+ *
+ * Timing of a firmware load, as returned by FalconFirmware::getLastLoadStats
+ */
+	struct FalconFirmwareLoadStats
+	{
+		unsigned int size; /**< Size of the firmware image, in bytes */
+		uint64_t setupTime; /**< Time taken to put the device into firmware mode, in nanoseconds */
+		uint64_t uploadTime; /**< Time taken to upload and verify the image, in nanoseconds */
+		double throughput; /**< Upload rate, in bytes/s. The 140000 baud firmware line tops out at 14000 bytes/s. */
+		bool verified; /**< True if the echo was checked against the image */
+		bool success; /**< True if the load succeeded */
+	};
+
 /**
  * @class FalconFirmware
  * @ingroup CoreClasses
@@ -82,9 +99,19 @@ namespace libnifalcon
 			FALCON_FIRMWARE_NO_FIRMWARE_SET, /**< Error for no firmware policy set */
 			FALCON_FIRMWARE_NO_FIRMWARE_LOADED, /**< Error for no firmware loaded */
 			FALCON_FIRMWARE_FILE_NOT_VALID, /**< Error for firmware file missing */
-			FALCON_FIRMWARE_CHECKSUM_MISMATCH /**< Error for checksum mismatch during firmware loading */
+			FALCON_FIRMWARE_CHECKSUM_MISMATCH, /**< Error for checksum mismatch during firmware loading */
+			FALCON_FIRMWARE_IMAGE_NOT_VALID /**< Error for a built in firmware image that doesn't exist or doesn't decode */
 		} FalconFirmwareErrorValues;
 
+		typedef enum
+		{
+			FIRMWARE_PROBE_LOADED = 0, /**< Device answered the probe packet, firmware is running */
+			FIRMWARE_PROBE_NOT_LOADED, /**< Probe packet went out, but no valid answer came back before the deadline */
+			FIRMWARE_PROBE_UNKNOWN /**< Probe packet couldn't be sent (device not open, comm error, etc...) */
+		} FalconFirmwareProbeResult;
+
+		static const unsigned int DEFAULT_PROBE_DEADLINE = 5000; /**< Default probeFirmware deadline, in microseconds */
+
 
 		/**
 		 * Constructor
@@ -196,13 +223,41 @@ namespace libnifalcon
 		void setFalconComm(std::shared_ptr<FalconComm> f) { m_falconComm = f; }
 
 		/**
-		 * Checks to see if firmware is loaded by running IO loop 10 times, returning true on first success
-		 * Will automatically return false is setFalconFirmware() has not been called.
+		 * Checks to see if firmware is loaded, by running probeFirmware up to 3 times with the default
+		 * deadline (a lost first packet after opening is common) and returning true on first success.
+		 * Takes at most a few tens of milliseconds.
 		 *
 		 * @return true if firmware is loaded, false otherwise
 		 */
 		bool isFirmwareLoaded();
 
+		/**
+		 * Sends a single packet and waits up to a deadline for a valid answer, to find out whether firmware
+		 * is running on the device. The falcon answers within a couple of milliseconds when firmware is
+		 * loaded (the FTDI latency timer is 1ms in normal mode), and not at all when it isn't, so a deadline
+		 * much shorter than that will report NOT_LOADED for loaded devices.
+		 *
+		 * @param deadline Longest time to wait for the answer, in microseconds
+		 *
+		 * @return Probe result. m_isFirmwareLoaded is updated unless the result is FIRMWARE_PROBE_UNKNOWN.
+		 */
+		FalconFirmwareProbeResult probeFirmware(unsigned int deadline = DEFAULT_PROBE_DEADLINE);
+
+		/**
+		 * Returns the duration of the last probeFirmware call. For a loaded device, this is the round trip
+		 * time of one packet.
+		 *
+		 * @return Probe latency in nanoseconds
+		 */
+		uint64_t getLastProbeLatency() { return m_lastProbeLatency; }
+
+		/**
+		 * Returns timing information for the last firmware load attempt
+		 *
+		 * @return Statistics for the last load
+		 */
+		const FalconFirmwareLoadStats& getLastLoadStats() { return m_lastLoadStats; }
+
 		/**
 		 * Sets the firmware file to load to the falcon
 		 *
@@ -243,6 +298,27 @@ namespace libnifalcon
 		 */
 		bool loadFirmware(bool skip_checksum, const unsigned int& firmware_size, uint8_t* buffer);
 
+		/**
+		 * Loads one of the firmware images built into the library (see FalconFirmwareImages). The
+		 * image is decoded into a buffer kept by this object, so repeated loads don't allocate.
+		 *
+		 * @param skip_checksum Whether or not to skip checksum tests when loading firmware (useful with ftd2xx on non-windows platforms)
+		 * @param name Name of the image to load ("nvent", "test", etc...)
+		 *
+		 * @return true if firmware is loaded successfully, false otherwise
+		 */
+		bool loadFirmwareImage(bool skip_checksum, const std::string& name);
+
+		/**
+		 * Loads the firmware image that was last loaded successfully again, from memory. Used to restore
+		 * a device that lost power or was swapped while open, without going back to the file.
+		 *
+		 * @param retries Number of times to retry loading firmware before quitting
+		 *
+		 * @return true if firmware is loaded successfully, false otherwise (including if no firmware was ever loaded)
+		 */
+		bool reloadFirmware(unsigned int retries);
+
 		/**
 		 * Used to reset the state of the communications if reloading firmware more than once in the same session
 		 *
@@ -265,10 +341,20 @@ namespace libnifalcon
 		 * @return number of successful I/O loops
 		 */		
 		uint64_t getLoopCount() { return m_loopCount; }
+
+		/**
+		 * Get the time at which the last full packet was received from the falcon
+		 *
+		 * @return Timestamp (see getFalconTimestamp()) of the last parsed packet, 0 if none received yet
+		 */
+		uint64_t getLastPacketTimestamp() { return m_lastPacketTimestamp; }
 	protected:
 		std::shared_ptr<FalconComm> m_falconComm; /**< Communications object for I/O */
 		std::string m_firmwareFilename; /**< Filename of the firmware to load */
 		bool m_isFirmwareLoaded; /**< True if firmware has been loaded, false otherwise */
+		std::vector<uint8_t> m_lastFirmware; /**< Copy of the last firmware image loaded successfully */
+		bool m_lastSkipChecksum; /**< Whether checksums were skipped when loading m_lastFirmware */
+		std::vector<uint8_t> m_imageBuffer; /**< Buffer built in firmware images are decoded into */
 
 		//Values sent to falcon
 		bool m_homingMode;		/**< True if homing mode is on, false for homing mode off */
@@ -281,6 +367,9 @@ namespace libnifalcon
 
 		uint64_t m_loopCount; /**< Number of successful loops that have been run by this firmware instance */
 		uint64_t m_outputCount; /**< Number of successful loops that have been run by this firmware instance */
+		uint64_t m_lastPacketTimestamp; /**< Receive time of the last full packet parsed */
+		uint64_t m_lastProbeLatency; /**< Duration of the last probeFirmware call, in nanoseconds */
+		FalconFirmwareLoadStats m_lastLoadStats; /**< Timing of the last firmware load attempt */
 		bool m_hasWritten; /**< True if we're waiting for a read return */
 	private:
 		DECLARE_LOGGER();
@@ -0,0 +1,221 @@
+/***
+ * @file FalconForceField.h
+ * @brief Composable haptic primitives (planes, boxes, spheres, springs, viscous zones, detents) evaluated in the I/O loop
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#ifndef FALCONFORCEFIELD_H
+#define FALCONFORCEFIELD_H
+
+#include <array>
+
+#include "falcon/core/FalconCore.h"
+
+namespace libnifalcon
+{
+/**
+ * @class FalconForceField
+ * @ingroup CoreClasses
+ *
+ * A force field is a sum of simple haptic primitives, evaluated from the end effector position and
+ * velocity. Handing a field to FalconDevice::setForceField has it evaluated in every I/O loop, on
+ * whatever thread runs the loop, so contact forces are updated at servo rate instead of application rate.
+ *
+ * Available primitives:
+ *
+ * - Plane: one sided wall, pushes out along its normal when the end effector is behind it
+ * - Box: solid axis aligned box, pushes out through the nearest face
+ * - Sphere: solid sphere, pushes out along the radius
+ * - Spring: pulls towards an anchor point, with optional damping
+ * - Viscous zone: sphere inside which motion is resisted
+ * - Detent: snaps the end effector to a point once within a capture radius
+ *
+ * Contact primitives (planes, boxes, spheres) take a damping coefficient that only acts while in
+ * contact and never pulls the end effector into the surface, which is what keeps stiff walls from
+ * buzzing. Damping uses FalconDevice::getVelocity(), so a velocity estimator
+ * (see FalconDevice::setFalconVelocityEstimator) should be set when using it.
+ *
+ * Fields are plain fixed size objects, with no allocation after construction. Primitives of each kind
+ * are stored as structures of arrays and evaluated without branches, so the compiler can vectorize
+ * the evaluation.
+ *
+ * All positions are in meters, in the kinematic's coordinate frame; stiffness is in N/m and damping in Ns/m.
+ */
+	class FalconForceField : public FalconCore
+	{
+	public:
+		enum {
+			FALCON_FORCE_FIELD_FULL = 9000 /**< Returned if there's no room left for another primitive of a kind */
+		};
+
+		static const unsigned int MAX_PRIMITIVES = 16; /**< Maximum number of primitives of each kind */
+
+		/**
+		 * Constructor. Creates an empty field.
+		 */
+		FalconForceField();
+
+		/**
+		 * Destructor
+		 */
+		virtual ~FalconForceField() {}
+
+		/**
+		 * Removes all primitives from the field
+		 */
+		void clear();
+
+		/**
+		 * Checks whether the field has any primitives
+		 *
+		 * @return True if the field is empty
+		 */
+		bool isEmpty() const;
+
+		/**
+		 * Adds a one sided wall
+		 *
+		 * @param point Any point on the plane
+		 * @param normal Direction the wall pushes in (free space side). Does not need to be normalized.
+		 * @param stiffness Wall stiffness
+		 * @param damping Contact damping
+		 *
+		 * @return True if added, false if there's no room. Error code set if false.
+		 */
+		bool addPlane(const std::array<double, 3>& point, const std::array<double, 3>& normal, double stiffness, double damping = 0.0);
+
+		/**
+		 * Adds a solid axis aligned box
+		 *
+		 * @param center Center of the box
+		 * @param half_extents Half of the box size along each axis
+		 * @param stiffness Wall stiffness
+		 * @param damping Contact damping
+		 *
+		 * @return True if added, false if there's no room. Error code set if false.
+		 */
+		bool addBox(const std::array<double, 3>& center, const std::array<double, 3>& half_extents, double stiffness, double damping = 0.0);
+
+		/**
+		 * Adds a solid sphere
+		 *
+		 * @param center Center of the sphere
+		 * @param radius Radius of the sphere
+		 * @param stiffness Surface stiffness
+		 * @param damping Contact damping
+		 *
+		 * @return True if added, false if there's no room. Error code set if false.
+		 */
+		bool addSphere(const std::array<double, 3>& center, double radius, double stiffness, double damping = 0.0);
+
+		/**
+		 * Adds a spring pulling towards an anchor point
+		 *
+		 * @param anchor Rest position of the spring
+		 * @param stiffness Spring constant
+		 *
+		 * @return True if added, false if there's no room. Error code set if false.
+		 */
+		bool addSpring(const std::array<double, 3>& anchor, double stiffness);
+
+		/**
+		 * Adds a damped spring pulling towards an anchor point
+		 *
+		 * @param anchor Rest position of the spring
+		 * @param stiffness Spring constant
+		 * @param damping Damping coefficient
+		 *
+		 * @return True if added, false if there's no room. Error code set if false.
+		 */
+		bool addDampedSpring(const std::array<double, 3>& anchor, double stiffness, double damping);
+
+		/**
+		 * Adds a spherical zone inside which motion is resisted
+		 *
+		 * @param center Center of the zone
+		 * @param radius Radius of the zone
+		 * @param damping Damping coefficient inside the zone
+		 *
+		 * @return True if added, false if there's no room. Error code set if false.
+		 */
+		bool addViscousZone(const std::array<double, 3>& center, double radius, double damping);
+
+		/**
+		 * Adds a detent. Inside the capture radius the end effector is pulled towards the center, with a
+		 * force that rises linearly to the middle of the radius and falls back to zero at its edge.
+		 *
+		 * @param center Point the detent snaps to
+		 * @param radius Capture radius
+		 * @param stiffness Spring constant near the center
+		 *
+		 * @return True if added, false if there's no room. Error code set if false.
+		 */
+		bool addDetent(const std::array<double, 3>& center, double radius, double stiffness);
+
+		/**
+		 * Adds all primitives of another field to this one
+		 *
+		 * @param field Field to add
+		 *
+		 * @return True if all primitives were added, false if there wasn't room. Error code set if false.
+		 */
+		bool add(const FalconForceField& field);
+
+		/**
+		 * Sets the largest force magnitude the field will output. 0 (the default) means no limit.
+		 *
+		 * @param max_force Force limit, in newtons
+		 */
+		void setMaxForce(double max_force) { m_maxForce = max_force; }
+
+		/**
+		 * Returns the force limit
+		 *
+		 * @return Force limit, in newtons. 0 if unlimited.
+		 */
+		double getMaxForce() const { return m_maxForce; }
+
+		/**
+		 * Evaluates the field
+		 *
+		 * @param position End effector position
+		 * @param velocity End effector velocity
+		 * @param force Array to write the summed force into
+		 */
+		void evaluate(const std::array<double, 3>& position, const std::array<double, 3>& velocity, std::array<double, 3>& force) const;
+	protected:
+		/**
+		 * Structure of arrays storage for one kind of primitive. Meaning of the fields depends on the kind.
+		 */
+		struct Block
+		{
+			std::array<double, MAX_PRIMITIVES> x, y, z; /**< Position (point, center or anchor) */
+			std::array<double, MAX_PRIMITIVES> u, v, w; /**< Shape (normal, half extents or radius) */
+			std::array<double, MAX_PRIMITIVES> stiffness; /**< Stiffness */
+			std::array<double, MAX_PRIMITIVES> damping; /**< Damping */
+			unsigned int count; /**< Number of primitives stored */
+		};
+
+		/**
+		 * Appends a primitive to a block
+		 *
+		 * @return True if added, false if the block is full. Error code set if false.
+		 */
+		bool append(Block& block, const std::array<double, 3>& position, const std::array<double, 3>& shape, double stiffness, double damping);
+
+		Block m_planes; /**< Planes. Shape is the unit normal. */
+		Block m_boxes; /**< Boxes. Shape is the half extents. */
+		Block m_spheres; /**< Spheres. Shape[0] is the radius. */
+		Block m_springs; /**< Springs and damped springs. */
+		Block m_viscousZones; /**< Viscous zones. Shape[0] is the radius. */
+		Block m_detents; /**< Detents. Shape[0] is the capture radius. */
+		double m_maxForce; /**< Force limit, 0 for none */
+	};
+}
+
+#endif
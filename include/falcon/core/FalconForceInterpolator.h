@@ -0,0 +1,211 @@
+/***
+ * @file FalconForceInterpolator.h
+ * @brief Upsamples timestamped force commands to the I/O loop rate
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#ifndef FALCONFORCEINTERPOLATOR_H
+#define FALCONFORCEINTERPOLATOR_H
+
+#include <array>
+#include <stdint.h>
+
+#include "falcon/core/FalconCore.h"
+#include "falcon/core/FalconSPSCQueue.h"
+
+namespace libnifalcon
+{
+/**
+ * @class FalconForceInterpolator
+ * @ingroup CoreClasses
+ *
+ * Turns force commands set at the application's rate into a smooth force for every I/O loop. Without it,
+ * a force set through FalconDevice::setForce at 100Hz is sent unchanged for ten loops, then jumps, and
+ * the steps are felt as buzz.
+ *
+ * Commands are timestamped and queued to the I/O loop without locking. Each loop then works out the
+ * force for the current time in one of three ways:
+ *
+ * - INTERPOLATE_LINEAR: straight line between the two commands around (now - delay)
+ * - INTERPOLATE_CUBIC: Catmull-Rom spline through the commands around (now - delay), smooth in slope
+ *   as well as in value. Uses the commands on either side, so needs a delay of about two command periods
+ *   to be fully smooth.
+ * - EXTRAPOLATE_LINEAR: continues the trend of the last two commands past the newest one, for up to
+ *   the extrapolation limit. No delay, but overshoots when commands change direction, so it is best used
+ *   with a slew rate limit.
+ *
+ * Interpolation delays the force by the delay time, which has to cover at least one command period or
+ * the output holds the newest command until the next one comes in. The slew rate limit applies to any
+ * mode and caps how fast the output may change.
+ *
+ * Hand an interpolator to FalconDevice::setForceInterpolator, and FalconDevice::setForce stamps and queues
+ * every force it is given. Commands with their own timestamps (from a simulation clock, on the
+ * getFalconTimestamp() timeline) go through FalconDevice::setForce(force, timestamp).
+ *
+ * Forces are in newtons, times in nanoseconds from getFalconTimestamp().
+ */
+	class FalconForceInterpolator : public FalconCore
+	{
+	public:
+		enum {
+			FALCON_FORCE_QUEUE_FULL = 13000 /**< Returned if commands are pushed faster than the I/O loop takes them */
+		};
+
+		/**
+		 * How the force between commands is worked out
+		 */
+		enum Mode {
+			INTERPOLATE_LINEAR, /**< Linear interpolation, delayed */
+			INTERPOLATE_CUBIC, /**< Catmull-Rom interpolation, delayed */
+			EXTRAPOLATE_LINEAR /**< First order extrapolation from the newest commands */
+		};
+
+		static const unsigned int QUEUE_SIZE = 64; /**< Commands that can wait for the I/O loop */
+		static const unsigned int HISTORY_SIZE = 8; /**< Commands kept to interpolate between */
+
+		/**
+		 * Constructor
+		 *
+		 * @param mode Interpolation mode
+		 * @param delay Interpolation delay, in seconds. Ignored when extrapolating.
+		 */
+		FalconForceInterpolator(Mode mode = INTERPOLATE_LINEAR, double delay = 0.01);
+
+		/**
+		 * Destructor
+		 */
+		virtual ~FalconForceInterpolator() {}
+
+		/**
+		 * Sets the interpolation mode. Set before rendering starts.
+		 *
+		 * @param mode Interpolation mode
+		 */
+		void setMode(Mode mode) { m_mode = mode; }
+
+		/**
+		 * Returns the interpolation mode
+		 *
+		 * @return Interpolation mode
+		 */
+		Mode getMode() const { return m_mode; }
+
+		/**
+		 * Sets how far behind the newest command interpolation runs. Set before rendering starts.
+		 *
+		 * @param delay Delay, in seconds
+		 */
+		void setDelay(double delay) { m_delay = delay; }
+
+		/**
+		 * Returns the interpolation delay
+		 *
+		 * @return Delay, in seconds
+		 */
+		double getDelay() const { return m_delay; }
+
+		/**
+		 * Sets how far past the newest command extrapolation goes before holding. Set before rendering starts.
+		 *
+		 * @param seconds Longest extrapolation, in seconds
+		 */
+		void setMaxExtrapolation(double seconds) { m_maxExtrapolation = seconds; }
+
+		/**
+		 * Returns the longest extrapolation
+		 *
+		 * @return Longest extrapolation, in seconds
+		 */
+		double getMaxExtrapolation() const { return m_maxExtrapolation; }
+
+		/**
+		 * Sets the fastest the output force may change. Set before rendering starts.
+		 *
+		 * @param rate Slew rate limit, in N/s. 0 (the default) means no limit.
+		 */
+		void setMaxSlewRate(double rate) { m_maxSlewRate = rate; }
+
+		/**
+		 * Returns the slew rate limit
+		 *
+		 * @return Slew rate limit, in N/s. 0 if unlimited.
+		 */
+		double getMaxSlewRate() const { return m_maxSlewRate; }
+
+		/**
+		 * Queues a force command. Only one thread may push commands, and timestamps must increase.
+		 *
+		 * @param force Force, in newtons
+		 * @param timestamp Time the force applies at, from getFalconTimestamp()
+		 *
+		 * @return True if queued, false if the queue is full. Error code set if false.
+		 */
+		bool pushForce(const std::array<double, 3>& force, uint64_t timestamp);
+
+		/**
+		 * Works out the force for the current loop. Only the thread running the I/O loop may call this.
+		 *
+		 * @param now Current time, from getFalconTimestamp()
+		 * @param force Set to the force to send. Zero until the first command comes in.
+		 */
+		void getForce(uint64_t now, std::array<double, 3>& force);
+
+		/**
+		 * Drops every command, queued or kept, and starts over from zero force. Only the thread running
+		 * the I/O loop may call this.
+		 */
+		void reset();
+	protected:
+		/**
+		 * Timestamped force command
+		 */
+		struct Command
+		{
+			std::array<double, 3> force; /**< Force, in newtons */
+			uint64_t timestamp; /**< Time the force applies at */
+		};
+
+		/**
+		 * Returns a kept command, oldest first
+		 *
+		 * @param index Index of the command, in [0, m_historyCount)
+		 *
+		 * @return Command
+		 */
+		const Command& getHistory(unsigned int index) const { return m_history[(m_historyStart + index) % HISTORY_SIZE]; }
+
+		/**
+		 * Interpolates the kept commands at a given time
+		 *
+		 * @param time Time to interpolate at
+		 * @param force Set to the interpolated force
+		 */
+		void interpolate(uint64_t time, std::array<double, 3>& force) const;
+
+		/**
+		 * Extrapolates the newest kept commands to a given time
+		 *
+		 * @param time Time to extrapolate to
+		 * @param force Set to the extrapolated force
+		 */
+		void extrapolate(uint64_t time, std::array<double, 3>& force) const;
+
+		FalconSPSCQueue<Command, QUEUE_SIZE> m_queue; /**< Commands waiting for the I/O loop */
+		std::array<Command, HISTORY_SIZE> m_history; /**< Newest commands, as a ring */
+		unsigned int m_historyStart; /**< Ring index of the oldest kept command */
+		unsigned int m_historyCount; /**< Number of kept commands */
+		std::array<double, 3> m_lastForce; /**< Output of the last loop, for slew limiting */
+		uint64_t m_lastTime; /**< Time of the last loop, 0 before the first */
+		Mode m_mode; /**< Interpolation mode */
+		double m_delay; /**< Interpolation delay, in seconds */
+		double m_maxExtrapolation; /**< Longest extrapolation, in seconds */
+		double m_maxSlewRate; /**< Slew rate limit, N/s, 0 for none */
+	};
+}
+
+#endif
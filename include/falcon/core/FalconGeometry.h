@@ -15,6 +15,8 @@
 #ifndef FALCONGEOMETRY_H_
 #define FALCONGEOMETRY_H_
 
+#include <array>
+
 namespace libnifalcon
 {
 	const static double WHEEL_SLOTS_NUMBER = 320; /*!< Number of transparent slot on the internal encoder wheel */
@@ -34,6 +36,40 @@ namespace libnifalcon
 	const static double PI = 3.14159265; /*!< PI constant, to save having to include one */
 	const static double OFFSET_ANGLE = (PI/12); /*!< Offset of each axis from the desk plane (15 degrees) */
 	const static double phy[] = { PI/2 + OFFSET_ANGLE, -PI/6 + OFFSET_ANGLE, -5*PI/6  + OFFSET_ANGLE}; /*!< Angles of each of the three legs, in radians */
+
+	/**
+	 * Mechanical measurements of a single falcon, for kinematics that work from runtime geometry
+	 * (see FalconKinematic::setGeometry). Defaults to the nominal values above. Units vary between
+	 * falcons, so a calibrated set (see FalconGeometryCalibration) can be kept per device serial in a
+	 * FalconGeometryStore.
+	 */
+	struct FalconGeometryParameters
+	{
+		double a; /**< Distance from leg base to start of knee, in meters */
+		double b; /**< Length of shin parallelogram side, in meters */
+		double c; /**< Length from shin connection point to end effector center, u component, in meters */
+		double d; /**< Length of shin to end effector connection joint, in meters */
+		double e; /**< Length of knee to shin connection joint, in meters */
+		double f; /**< Length from shin connection point to end effector center, v component, in meters */
+		double r; /**< Distance from fixed frame origin to leg base, u component, in meters */
+		double s; /**< Distance from fixed frame origin to leg base, v component, in meters */
+		std::array<double, 3> phy; /**< Angles of each of the three legs, in radians */
+		std::array<double, 3> theta_offset; /**< Leg angle when the leg's encoder value is 0, in degrees */
+
+		/**
+		 * Constructor. Sets the nominal geometry.
+		 */
+		FalconGeometryParameters() :
+			a(libnifalcon::a), b(libnifalcon::b), c(libnifalcon::c), d(libnifalcon::d),
+			e(libnifalcon::e), f(libnifalcon::f), r(libnifalcon::r), s(libnifalcon::s)
+		{
+			for(int i = 0; i < 3; ++i)
+			{
+				phy[i] = libnifalcon::phy[i];
+				theta_offset[i] = THETA_OFFSET_ANGLE;
+			}
+		}
+	};
 }
 
 #endif /*FALCONGEOMETRY_H_*/
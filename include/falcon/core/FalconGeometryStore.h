@@ -0,0 +1,132 @@
+/***
+ * @file FalconGeometryStore.h
+ * @brief Per device storage of calibrated falcon geometry
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#ifndef FALCONGEOMETRYSTORE_H
+#define FALCONGEOMETRYSTORE_H
+
+#include <string>
+
+#include "falcon/core/FalconCore.h"
+#include "falcon/core/FalconGeometry.h"
+
+namespace libnifalcon
+{
+/**
+ * @class FalconGeometryStore
+ * @ingroup CoreClasses
+ *
+ * Keeps the calibrated geometry of each falcon (see FalconGeometryCalibration) in a directory, one file
+ * per USB serial number. Hand a store to FalconDevice::setGeometryStore and devices opened afterwards
+ * pick up their own geometry.
+ *
+ * Files are plain text, one parameter per line, a name followed by its value(s) in the units of
+ * FalconGeometryParameters:
+ *
+ * @code
+ * a 0.0601
+ * phy 1.8326 -0.2618 -2.3562
+ * theta_offset 35.2 34.9 35.1
+ * @endcode
+ *
+ * Lines starting with '#' are comments. Parameters missing from a file keep their nominal values, so
+ * a file can hold only what was calibrated.
+ */
+	class FalconGeometryStore : public FalconCore
+	{
+	public:
+		enum {
+			FALCON_GEOMETRY_NO_SERIAL = 15000, /**< Returned if the device has no serial number to store under */
+			FALCON_GEOMETRY_NOT_FOUND, /**< Returned if there is no geometry stored for the serial */
+			FALCON_GEOMETRY_FILE_INVALID, /**< Returned if a stored file has a line that can't be read */
+			FALCON_GEOMETRY_FILE_ERROR /**< Returned if the file can't be written */
+		};
+
+		/**
+		 * Constructor
+		 *
+		 * @param directory Directory the geometry files are kept in
+		 */
+		FalconGeometryStore(const std::string& directory = ".");
+
+		/**
+		 * Destructor
+		 */
+		virtual ~FalconGeometryStore() {}
+
+		/**
+		 * Sets the directory the geometry files are kept in. It has to exist.
+		 *
+		 * @param directory Directory path
+		 */
+		void setDirectory(const std::string& directory) { m_directory = directory; }
+
+		/**
+		 * Returns the directory the geometry files are kept in
+		 *
+		 * @return Directory path
+		 */
+		const std::string& getDirectory() const { return m_directory; }
+
+		/**
+		 * Returns the name of the file the geometry of a device is kept in. Characters other than letters,
+		 * digits, '-' and '_' are replaced, so any serial makes a file name in the store's directory.
+		 *
+		 * @param serial USB serial number of the device
+		 *
+		 * @return Path of the geometry file
+		 */
+		std::string getFilename(const std::string& serial) const;
+
+		/**
+		 * Loads the geometry stored for a device
+		 *
+		 * @param serial USB serial number of the device
+		 * @param geometry Set to the stored geometry if found
+		 *
+		 * @return true if loaded, false otherwise. Error code set if false.
+		 */
+		bool load(const std::string& serial, FalconGeometryParameters& geometry);
+
+		/**
+		 * Stores the geometry of a device, replacing what was stored for it before
+		 *
+		 * @param serial USB serial number of the device
+		 * @param geometry Geometry to store
+		 *
+		 * @return true if stored, false otherwise. Error code set if false.
+		 */
+		bool save(const std::string& serial, const FalconGeometryParameters& geometry);
+
+		/**
+		 * Reads a geometry file
+		 *
+		 * @param filename Path of the file
+		 * @param geometry Set to the geometry in the file, nominal values for parameters it doesn't set
+		 *
+		 * @return true if read, false otherwise. Error code set if false.
+		 */
+		bool readFile(const std::string& filename, FalconGeometryParameters& geometry);
+
+		/**
+		 * Writes a geometry file
+		 *
+		 * @param filename Path of the file
+		 * @param geometry Geometry to write
+		 *
+		 * @return true if written, false otherwise. Error code set if false.
+		 */
+		bool writeFile(const std::string& filename, const FalconGeometryParameters& geometry);
+	protected:
+		std::string m_directory; /**< Directory the geometry files are kept in */
+	};
+}
+
+#endif
@@ -13,10 +13,28 @@
 #define FALCONGRIP_H
 
 #include <cstdlib>
+#include <stdint.h>
+#include <array>
+#include <atomic>
 #include "falcon/core/FalconCore.h"
+#include "falcon/core/FalconSPSCQueue.h"
 
 namespace libnifalcon
 {
+/**
+ * @struct FalconGripEvent
+ * @ingroup CoreClasses
+ *
+ * A digital input changing state, as seen by the I/O loop
+ */
+	struct FalconGripEvent
+	{
+		unsigned int button; /**< Bit of the input that changed, as in getDigitalInputs() (e.g. FalconGripFourButton::BUTTON_1) */
+		bool pressed; /**< True if the input went high (pressed), false if it went low (released) */
+		uint64_t timestamp; /**< Receive time of the packet the change arrived in (see getFalconTimestamp()) */
+		std::array<double, 3> position; /**< End effector position computed from that packet */
+	};
+
 /**
  * @class FalconGrip
  * @ingroup CoreClasses
@@ -24,6 +42,20 @@ namespace libnifalcon
  *
  * Grip classes define how we deal with whatever grip might appear on the falcon. The base class tries to be as generic as possible,
  * allowing for up to 32 digital inputs and 128 analog inputs. 
+ *
+ * Polling getDigitalInputs() from an application running at frame rate misses presses shorter than a
+ * frame, and can only place a click to within a frame. So the I/O loop also compares the digital inputs
+ * of every packet against the last ones, and queues an event for every press and release, with the packet
+ * time and the end effector position at that packet. The queue is lock-free; the application drains it
+ * with popEvent() from its own thread, at whatever rate it likes:
+ *
+ * @code
+ * FalconGripEvent event;
+ * while(grip->popEvent(event))
+ *     if(event.button == FalconGripFourButton::CENTER_BUTTON && event.pressed) startDrag(event.position);
+ * @endcode
+ *
+ * If the application never drains the queue, it fills up and further events are dropped (and counted).
  */
 	
 	class FalconGrip : public FalconCore
@@ -34,6 +66,8 @@ namespace libnifalcon
 			FALCON_GRIP_INDEX_OUT_OF_RANGE = 4000 /**< Returned if button index requested is out of range for the current grip */
 		};
 
+		static const unsigned int EVENT_QUEUE_SIZE = 64; /**< Number of edge events that can wait to be popped */
+
 
 		/**
 		 * Constructor. Defines the grip capabilities.
@@ -45,7 +79,9 @@ namespace libnifalcon
 		FalconGrip(int32_t digital_inputs, int32_t analog_inputs) :
 			m_numDigitalInputs(digital_inputs),
 			m_numAnalogInputs(analog_inputs),
-			m_digitalInputs(0)
+			m_digitalInputs(0),
+			m_lastDigitalInputs(0),
+			m_droppedEvents(0)
 		{
 		}
 
@@ -124,12 +160,65 @@ namespace libnifalcon
 			}
 			return m_analogInputs[index];
 		}
+
+		/**
+		 * Queues an event for every digital input that changed since the last call. Called by the I/O loop
+		 * (FalconDevice::runIOLoop) after each grip and kinematic update; only the thread running the
+		 * I/O loop may call it.
+		 *
+		 * @param timestamp Receive time of the packet the inputs came from
+		 * @param position End effector position computed from the same packet
+		 */
+		void queueEdges(uint64_t timestamp, const std::array<double, 3>& position)
+		{
+			unsigned int changed = m_digitalInputs ^ m_lastDigitalInputs;
+			m_lastDigitalInputs = m_digitalInputs;
+			//One event per changed bit, lowest bit first
+			while(changed != 0)
+			{
+				FalconGripEvent event;
+				event.button = changed & (~changed + 1);
+				event.pressed = (m_digitalInputs & event.button) != 0;
+				event.timestamp = timestamp;
+				event.position = position;
+				if(!m_events.push(event))
+				{
+					m_droppedEvents.fetch_add(1, std::memory_order_relaxed);
+				}
+				changed &= changed - 1;
+			}
+		}
+
+		/**
+		 * Takes the oldest press/release event off the queue. Only one thread may pop events.
+		 *
+		 * @param event Event to fill in
+		 *
+		 * @return true if an event was taken, false if there are none waiting
+		 */
+		bool popEvent(FalconGripEvent& event) { return m_events.pop(event); }
+
+		/**
+		 * Drops all waiting events, e.g. after a pause in which the application wasn't listening. Only the
+		 * thread popping events may call this.
+		 */
+		void clearEvents() { m_events.clear(); }
+
+		/**
+		 * Returns the number of events dropped because the queue was full
+		 *
+		 * @return Number of dropped events since the grip was created
+		 */
+		unsigned int getDroppedEventCount() const { return m_droppedEvents.load(std::memory_order_relaxed); }
 	protected:
 		unsigned int m_numDigitalInputs; /**< Number of digital inputs available on the grip */
 		unsigned int m_numAnalogInputs; /**< Number of analog inputs available on the grip */
 		//I think assuming 32 digital inputs and 128 analog is enough
 		unsigned int m_digitalInputs; /**< Bitfield to hold digital input values */
 		int m_analogInputs[128]; /**< Array of analog input values */
+		unsigned int m_lastDigitalInputs; /**< Digital inputs at the last queueEdges call */
+		FalconSPSCQueue<FalconGripEvent, EVENT_QUEUE_SIZE> m_events; /**< Edge events waiting for the application */
+		std::atomic<unsigned int> m_droppedEvents; /**< Number of events dropped on a full queue */
 	};
 }
 
@@ -0,0 +1,70 @@
+/***
+ * @file FalconHapticRenderer.h
+ * @brief Base class for scene renderers run on the I/O thread
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#ifndef FALCONHAPTICRENDERER_H
+#define FALCONHAPTICRENDERER_H
+
+#include <array>
+
+#include "falcon/core/FalconCore.h"
+
+namespace libnifalcon
+{
+/**
+ * @class FalconHapticRenderer
+ * @ingroup CoreClasses
+ * @ingroup HapticClasses
+ *
+ * Haptic renderers compute contact forces against a scene that is too large or too detailed for
+ * FalconForceField's fixed primitives (meshes, distance fields, point clouds, etc...). A renderer handed
+ * to FalconDevice::setHapticRenderer is run by FalconDevice::runIOLoop on every loop, on whatever thread
+ * runs the loop, with the position and velocity from the previous packet. Its force is added to the force
+ * set by FalconDevice::setForce and the force field's.
+ *
+ * Unlike force fields, renderers may keep state between loops (a proxy position, for instance), so only
+ * one device should run a given renderer. Scene updates from the application thread are up to each
+ * implementation, and must not block the I/O thread.
+ *
+ * Implementations must not allocate or lock in render(), as it runs inside the I/O loop.
+ */
+	class FalconHapticRenderer : public FalconCore
+	{
+	public:
+		/**
+		 * Constructor
+		 *
+		 */
+		FalconHapticRenderer() {}
+
+		/**
+		 * Destructor
+		 *
+		 */
+		virtual ~FalconHapticRenderer() {}
+
+		/**
+		 * Computes the scene's force on the end effector. Only the thread running the I/O loop may call this.
+		 *
+		 * @param position End effector position, in meters
+		 * @param velocity End effector velocity, in m/s. Zero unless a velocity estimator is set.
+		 * @param force Array to write the force into, in newtons
+		 */
+		virtual void render(const std::array<double, 3>& position, const std::array<double, 3>& velocity, std::array<double, 3>& force) = 0;
+
+		/**
+		 * Clears any state kept between loops. Called by FalconDevice whenever the position stream is
+		 * discontinuous (device opened or reconnected).
+		 */
+		virtual void reset() {}
+	};
+}
+
+#endif
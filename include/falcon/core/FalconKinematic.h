@@ -27,6 +27,9 @@ namespace libnifalcon
  * The Kinematic base class provides virtual functions for forward and inverse kinematic functions, as well
  * as utility functions that all kinematics cores can share.
  *
+ * Kinematics work from a FalconGeometryParameters set, which starts out as the nominal geometry in
+ * FalconGeometry.h. FalconDevice replaces it with the device's calibrated geometry on open, if it has
+ * one (see FalconDevice::setGeometryStore).
  */
 	class FalconKinematic : public FalconCore
 	{
@@ -50,7 +53,8 @@ namespace libnifalcon
 		virtual ~FalconKinematic() {}
 
 		/**
-		 * Given an encoder value, return the angle (in degrees) the leg is at (in the leg's local reference frame)
+		 * Given an encoder value, return the angle (in degrees) the leg is at (in the leg's local reference frame),
+		 * using the nominal encoder offset. See getTheta(int, unsigned int) for the offset of a certain leg.
 		 *
 		 * @param encoder_value Encoder ticks for a leg
 		 *
@@ -61,6 +65,35 @@ namespace libnifalcon
 			return (((SHAFT_DIAMETER*PI) / (WHEEL_SLOTS_NUMBER*4)) * (encoder_value))/((PI*SMALL_ARM_DIAMETER)/360.0f) + THETA_OFFSET_ANGLE;
 		}
 
+		/**
+		 * Given an encoder value, return the angle (in degrees) a leg is at (in the leg's local reference frame),
+		 * using that leg's encoder offset from the current geometry
+		 *
+		 * @param encoder_value Encoder ticks for the leg
+		 * @param leg Index of the leg (0-2)
+		 *
+		 * @return Angle (in degrees) the leg is at
+		 */
+		double getTheta(int encoder_value, unsigned int leg)
+		{
+			return (((SHAFT_DIAMETER*PI) / (WHEEL_SLOTS_NUMBER*4)) * (encoder_value))/((PI*SMALL_ARM_DIAMETER)/360.0) + m_geometry.theta_offset[leg];
+		}
+
+		/**
+		 * Sets the geometry to work from. Not thread safe: set the geometry before starting the thread
+		 * that runs the I/O loop.
+		 *
+		 * @param geometry Mechanical measurements of the device
+		 */
+		virtual void setGeometry(const FalconGeometryParameters& geometry) { m_geometry = geometry; }
+
+		/**
+		 * Returns the geometry in use
+		 *
+		 * @return Mechanical measurements of the device
+		 */
+		const FalconGeometryParameters& getGeometry() const { return m_geometry; }
+
 		/**
 		 * Given a caretesian position (in meters), return the angle of the legs requires to achieve the positions
 		 *
@@ -102,6 +135,22 @@ namespace libnifalcon
 		 */
 
 		virtual bool getForces(const std::array<double, 3> &position, const std::array<double, 3>& cart_force, std::array<int, 3> &enc_force) = 0;
+
+		/**
+		 * Given a cartesian position (in meters), return the jacobian mapping leg angular velocities (radians/s)
+		 * to end effector velocity (meters/s) at that position. Used to map joint space velocity estimates
+		 * (see FalconVelocityEstimator) to cartesian coordinates.
+		 *
+		 * Kinematics that can't supply a jacobian don't need to override this.
+		 *
+		 * @param position Current position of the end effector
+		 * @param jacobian_matrix Row major 3x3 matrix to write result into
+		 *
+		 * @return true if the jacobian is found, false otherwise
+		 */
+		virtual bool getJacobian(const std::array<double, 3>& /*position*/, std::array<double, 9>& /*jacobian_matrix*/) { return false; }
+	protected:
+		FalconGeometryParameters m_geometry; /**< Geometry the kinematics work from */
 	};
 }
 
@@ -0,0 +1,110 @@
+/***
+ * @file FalconMappedFile.h
+ * @brief Cross platform memory mapped file
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#ifndef FALCONMAPPEDFILE_H
+#define FALCONMAPPEDFILE_H
+
+#include <stdint.h>
+#include <string>
+
+namespace libnifalcon
+{
+/**
+ * @class FalconMappedFile
+ * @ingroup CoreClasses
+ *
+ * Maps a whole file into memory, either read only or as a freshly created read/write file of a fixed
+ * size. Used wherever data has to be reached from the I/O thread without going through the kernel
+ * (session recordings, distance field grids, etc...).
+ *
+ * Mappings can be populated when opened, which faults every page in up front so the I/O thread never
+ * takes a page fault on first touch. Population is a hint, and is only done where the platform
+ * supports it.
+ */
+	class FalconMappedFile
+	{
+	public:
+		/**
+		 * Constructor
+		 */
+		FalconMappedFile();
+
+		/**
+		 * Destructor. Closes the file if open.
+		 */
+		~FalconMappedFile();
+
+		/**
+		 * Creates (or truncates) a file of a given size and maps it read/write. Closes any file already open.
+		 *
+		 * @param filename File to create
+		 * @param size Size of the file, in bytes
+		 * @param populate True to fault the whole mapping in now
+		 *
+		 * @return True if mapped, false otherwise
+		 */
+		bool create(const std::string& filename, uint64_t size, bool populate);
+
+		/**
+		 * Maps an existing file read only. Closes any file already open.
+		 *
+		 * @param filename File to open
+		 * @param populate True to fault the whole mapping in now
+		 *
+		 * @return True if mapped, false otherwise
+		 */
+		bool open(const std::string& filename, bool populate);
+
+		/**
+		 * Unmaps the file. Files opened with create() are flushed to disk first.
+		 */
+		void close();
+
+		/**
+		 * Checks whether a file is mapped
+		 *
+		 * @return True if mapped
+		 */
+		bool isOpen() const { return m_data != nullptr; }
+
+		/**
+		 * Returns the start of the mapping. Only writable if the file was opened with create().
+		 *
+		 * @return Start of the mapping, or nullptr if not open
+		 */
+		void* getData() const { return m_data; }
+
+		/**
+		 * Returns the size of the mapping
+		 *
+		 * @return Size, in bytes
+		 */
+		uint64_t getSize() const { return m_size; }
+	protected:
+		/**
+		 * Maps a file
+		 *
+		 * @return True if mapped. Handles are released if false.
+		 */
+		bool map(const std::string& filename, bool create, bool populate);
+
+		void* m_data; /**< Start of the mapping */
+		uint64_t m_size; /**< Size of the mapping, in bytes */
+		bool m_writable; /**< True if opened with create() */
+		void* m_fileHandle; /**< Platform specific file handle (unused on posix) */
+		void* m_mapHandle; /**< Platform specific mapping handle (unused on posix) */
+	private:
+		FalconMappedFile(const FalconMappedFile&);
+		FalconMappedFile& operator=(const FalconMappedFile&);
+	};
+}
+
+#endif
@@ -0,0 +1,175 @@
+/***
+ * @file FalconPointFit.h
+ * @brief Plane and ellipsoid fitting to large sets of positions
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#ifndef FALCONPOINTFIT_H
+#define FALCONPOINTFIT_H
+
+#include <array>
+#include <stdint.h>
+#include <vector>
+
+#include "falcon/core/FalconCore.h"
+#include "falcon/gmtl/Matrix.h"
+#include "falcon/gmtl/Vec.h"
+
+namespace libnifalcon
+{
+/**
+ * @class FalconPointFit
+ * @ingroup CoreClasses
+ *
+ * Accumulates the mean and covariance of a set of positions, such as every position of a recorded
+ * session, and fits a plane or an ellipsoid to them. Used in calibration, for instance to find the
+ * plane a fixture's surface was probed in.
+ *
+ * Points are added in batches. A batch is split over threads, each summing its share in SIMD registers
+ * relative to its first point, and the partial sums are merged with the pairwise update of Chan, Golub
+ * and LeVeque, which keeps full precision however far the points are from the origin and however many
+ * there are. Batches merge the same way, so sets too big to hold at once can be fed in pieces, and
+ * fits running on separate threads can be merged with merge().
+ *
+ * Fits solve the 3x3 covariance with gmtl::eigenSymmetric, in closed form, so the cost of a fit is the
+ * single pass over the points.
+ *
+ * Positions are in meters, in the kinematic's coordinate frame.
+ */
+	class FalconPointFit : public FalconCore
+	{
+	public:
+		enum {
+			FALCON_POINT_FIT_TOO_FEW_POINTS = 14000 /**< Returned if there aren't enough points to fit */
+		};
+
+		/**
+		 * Constructor. Starts with no points.
+		 */
+		FalconPointFit();
+
+		/**
+		 * Destructor
+		 */
+		virtual ~FalconPointFit() {}
+
+		/**
+		 * Drops every point
+		 */
+		void clear();
+
+		/**
+		 * Adds a point
+		 *
+		 * @param point Position
+		 */
+		void addPoint(const std::array<double, 3>& point);
+
+		/**
+		 * Adds a batch of points
+		 *
+		 * @param points Positions
+		 * @param threads Number of threads to sum with. 0 uses one per core. Small batches use one.
+		 */
+		void addPoints(const std::vector<std::array<double, 3> >& points, unsigned int threads = 0);
+
+		/**
+		 * Adds every point of another fit
+		 *
+		 * @param other Fit to add the points of
+		 */
+		void merge(const FalconPointFit& other);
+
+		/**
+		 * Returns the number of points added
+		 *
+		 * @return Number of points
+		 */
+		uint64_t getCount() const { return m_moments.count; }
+
+		/**
+		 * Returns the mean of the points
+		 *
+		 * @param center Set to the mean. Zero if there are no points.
+		 */
+		void getCenter(std::array<double, 3>& center) const;
+
+		/**
+		 * Returns the covariance of the points, normalized by the number of points
+		 *
+		 * @param covariance Set to the covariance matrix. Zero if there are no points.
+		 */
+		void getCovariance(gmtl::Matrix33d& covariance) const;
+
+		/**
+		 * Fits a plane to the points, minimizing the sum of squared distances to it
+		 *
+		 * @param center Set to a point on the plane, the mean of the points
+		 * @param normal Set to the unit normal of the plane. Which of the two ways it points is arbitrary.
+		 * @param rms Set to the RMS distance of the points from the plane
+		 *
+		 * @return True if fitted, false if there are fewer than 3 points. Error code set if false.
+		 */
+		bool fitPlane(std::array<double, 3>& center, std::array<double, 3>& normal, double& rms);
+
+		/**
+		 * Fits the ellipsoid of one standard deviation to the points: centered on their mean, with axes
+		 * along the principal directions of their spread. For points spread evenly over the surface of an
+		 * ellipsoid, its semi-axes are the deviations times sqrt(3) (exact for a sphere), and for points
+		 * filling one, times sqrt(5).
+		 *
+		 * @param center Set to the center, the mean of the points
+		 * @param axes Set to the unit axes, smallest deviation first. They form a right handed basis.
+		 * @param deviations Set to the standard deviation of the points along each axis
+		 *
+		 * @return True if fitted, false if there are fewer than 3 points. Error code set if false.
+		 */
+		bool fitEllipsoid(std::array<double, 3>& center, std::array<std::array<double, 3>, 3>& axes, std::array<double, 3>& deviations);
+	protected:
+		/**
+		 * Running mean and scatter of a set of points
+		 */
+		struct Moments
+		{
+			uint64_t count; /**< Number of points */
+			double mean[3]; /**< Mean */
+			double scatter[6]; /**< Sums of products of deviations from the mean: xx yy zz xy yz zx */
+		};
+
+		/**
+		 * Works out the moments of a run of points, on the calling thread
+		 *
+		 * @param points First point
+		 * @param count Number of points
+		 * @param moments Set to their moments
+		 */
+		static void accumulate(const std::array<double, 3>* points, size_t count, Moments& moments);
+
+		/**
+		 * Merges the moments of two sets of points
+		 *
+		 * @param moments Moments of the first set, set to those of both
+		 * @param other Moments of the second set
+		 */
+		static void mergeMoments(Moments& moments, const Moments& other);
+
+		/**
+		 * Solves the covariance of the points
+		 *
+		 * @param values Set to its eigenvalues, smallest first
+		 * @param vectors Set to its unit eigenvectors, as columns
+		 *
+		 * @return True if solved, false if there are fewer than 3 points. Error code set if false.
+		 */
+		bool solve(gmtl::Vec3d& values, gmtl::Matrix33d& vectors);
+
+		Moments m_moments; /**< Moments of every point added */
+	};
+}
+
+#endif
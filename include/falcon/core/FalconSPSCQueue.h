@@ -0,0 +1,119 @@
+/***
+ * @file FalconSPSCQueue.h
+ * @brief Lock-free single producer/single consumer queue for handing events out of the I/O thread
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#ifndef FALCONSPSCQUEUE_H
+#define FALCONSPSCQUEUE_H
+
+#include <array>
+#include <atomic>
+
+namespace libnifalcon
+{
+/**
+ * @class FalconSPSCQueue
+ * @ingroup CoreClasses
+ *
+ * Fixed size queue for passing a stream of objects from one writer thread (usually the I/O loop) to one
+ * reader thread (usually the application) without locks or allocation. Where FalconTripleBuffer only
+ * ever hands over the newest object, this hands over every object, in order, as long as the reader keeps
+ * up. When the queue is full, push() fails and the new object is not queued.
+ *
+ * @code
+ * //I/O thread
+ * queue.push(event);
+ *
+ * //Application thread
+ * while(queue.pop(event))
+ *     handle(event);
+ * @endcode
+ */
+	template<class T, unsigned int N>
+	class FalconSPSCQueue
+	{
+		static_assert(N > 0 && (N & (N - 1)) == 0, "FalconSPSCQueue size must be a power of 2");
+	public:
+		/**
+		 * Constructor. Creates an empty queue.
+		 */
+		FalconSPSCQueue() :
+			m_head(0),
+			m_tail(0)
+		{
+		}
+
+		/**
+		 * Adds an object to the back of the queue. Only the writer thread may call this.
+		 *
+		 * @param value Object to add
+		 *
+		 * @return True if added, false if the queue is full
+		 */
+		bool push(const T& value)
+		{
+			unsigned int head = m_head.load(std::memory_order_relaxed);
+			if(head - m_tail.load(std::memory_order_acquire) == N)
+			{
+				return false;
+			}
+			m_items[head & (N - 1)] = value;
+			m_head.store(head + 1, std::memory_order_release);
+			return true;
+		}
+
+		/**
+		 * Takes the object at the front of the queue. Only the reader thread may call this.
+		 *
+		 * @param value Object to copy the front of the queue into
+		 *
+		 * @return True if an object was taken, false if the queue is empty
+		 */
+		bool pop(T& value)
+		{
+			unsigned int tail = m_tail.load(std::memory_order_relaxed);
+			if(m_head.load(std::memory_order_acquire) == tail)
+			{
+				return false;
+			}
+			value = m_items[tail & (N - 1)];
+			m_tail.store(tail + 1, std::memory_order_release);
+			return true;
+		}
+
+		/**
+		 * Drops everything in the queue. Only the reader thread may call this.
+		 */
+		void clear()
+		{
+			m_tail.store(m_head.load(std::memory_order_acquire), std::memory_order_release);
+		}
+
+		/**
+		 * Returns the number of objects in the queue. Only exact when called from one of the two threads
+		 * while the other isn't using the queue.
+		 *
+		 * @return Number of queued objects
+		 */
+		unsigned int size() const { return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire); }
+
+		/**
+		 * Returns the number of objects the queue can hold
+		 *
+		 * @return Capacity of the queue
+		 */
+		static unsigned int capacity() { return N; }
+	protected:
+		std::array<T, N> m_items; /**< Queue storage, indexed by counter modulo N */
+		std::atomic<unsigned int> m_head; /**< Number of objects ever pushed. Only the writer changes it. */
+		std::atomic<unsigned int> m_tail; /**< Number of objects ever popped. Only the reader changes it. */
+	};
+}
+
+#endif
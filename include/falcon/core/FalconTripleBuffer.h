@@ -0,0 +1,136 @@
+/***
+ * @file FalconTripleBuffer.h
+ * @brief Lock-free single producer/single consumer triple buffer for handing data to the I/O thread
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#ifndef FALCONTRIPLEBUFFER_H
+#define FALCONTRIPLEBUFFER_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace libnifalcon
+{
+/**
+ * @class FalconTripleBuffer
+ * @ingroup CoreClasses
+ *
+ * Triple buffer for passing a whole object from one writer thread (usually the application) to one
+ * reader thread (usually the I/O loop) without locks or allocation. The writer fills the write buffer
+ * and publishes it; the reader picks up the newest published buffer whenever it calls update(). Neither
+ * side ever waits on the other, and the reader always sees a complete object.
+ *
+ * @code
+ * //Application thread
+ * buffer.getWriteBuffer() = new_value;
+ * buffer.publish();
+ *
+ * //I/O thread
+ * buffer.update();
+ * use(buffer.getReadBuffer());
+ * @endcode
+ */
+	template<class T>
+	class FalconTripleBuffer
+	{
+	public:
+		/**
+		 * Constructor
+		 */
+		FalconTripleBuffer() :
+			m_writeIndex(0),
+			m_readIndex(2),
+			m_middle(1)
+		{
+		}
+
+		/**
+		 * Copy constructor. Not thread safe, neither side may be using the buffer being copied.
+		 *
+		 * @param other Buffer to copy
+		 */
+		FalconTripleBuffer(const FalconTripleBuffer& other) :
+			m_buffers(other.m_buffers),
+			m_writeIndex(other.m_writeIndex),
+			m_readIndex(other.m_readIndex),
+			m_middle(other.m_middle.load())
+		{
+		}
+
+		/**
+		 * Assignment operator. Not thread safe, neither side may be using either buffer.
+		 *
+		 * @param other Buffer to copy
+		 *
+		 * @return Reference to this buffer
+		 */
+		FalconTripleBuffer& operator=(const FalconTripleBuffer& other)
+		{
+			m_buffers = other.m_buffers;
+			m_writeIndex = other.m_writeIndex;
+			m_readIndex = other.m_readIndex;
+			m_middle = other.m_middle.load();
+			return *this;
+		}
+
+		/**
+		 * Returns the buffer the writer should fill. Only the writer thread may call this.
+		 *
+		 * @return Reference to the write buffer
+		 */
+		T& getWriteBuffer() { return m_buffers[m_writeIndex]; }
+
+		/**
+		 * Hands the write buffer to the reader, and takes a free buffer to write into next. The new write
+		 * buffer holds stale data. Only the writer thread may call this.
+		 */
+		void publish()
+		{
+			uint8_t previous = m_middle.exchange(m_writeIndex | DIRTY, std::memory_order_acq_rel);
+			m_writeIndex = previous & INDEX_MASK;
+		}
+
+		/**
+		 * Takes the newest published buffer as the read buffer, if anything has been published since the
+		 * last call. Only the reader thread may call this.
+		 *
+		 * @return True if the read buffer changed
+		 */
+		bool update()
+		{
+			if(!(m_middle.load(std::memory_order_relaxed) & DIRTY))
+			{
+				return false;
+			}
+			uint8_t previous = m_middle.exchange(m_readIndex, std::memory_order_acq_rel);
+			m_readIndex = previous & INDEX_MASK;
+			return true;
+		}
+
+		/**
+		 * Returns the buffer last picked up by update(). Only the reader thread may call this.
+		 *
+		 * @return Reference to the read buffer
+		 */
+		const T& getReadBuffer() const { return m_buffers[m_readIndex]; }
+	protected:
+		enum {
+			INDEX_MASK = 0x3, /**< Bits of m_middle holding the buffer index */
+			DIRTY = 0x4 /**< Set in m_middle when it holds a buffer the reader hasn't seen */
+		};
+
+		std::array<T, 3> m_buffers; /**< Write, middle and read buffers, in no fixed order */
+		uint8_t m_writeIndex; /**< Buffer owned by the writer */
+		uint8_t m_readIndex; /**< Buffer owned by the reader */
+		std::atomic<uint8_t> m_middle; /**< Buffer in transit, plus the DIRTY flag */
+	};
+}
+
+#endif
@@ -0,0 +1,134 @@
+/***
+ * @file FalconVelocityEstimator.h
+ * @brief Base class for estimating joint velocity and acceleration from encoder samples
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#ifndef FALCONVELOCITYESTIMATOR_H
+#define FALCONVELOCITYESTIMATOR_H
+
+#include <array>
+#include <cstdint>
+
+#include "falcon/core/FalconCore.h"
+#include "falcon/core/FalconGeometry.h"
+
+namespace libnifalcon
+{
+/**
+ * @class FalconVelocityEstimator
+ * @ingroup CoreClasses
+ * @ingroup EstimatorClasses
+ *
+ * Velocity estimators turn the stream of raw encoder values coming back from the firmware into joint
+ * (leg) angular velocity and acceleration. They are run by FalconDevice::runIOLoop for every packet
+ * received, using the firmware's receive timestamps, so estimates are made at I/O rate instead of being
+ * differentiated out of getPosition() at application rate.
+ *
+ * Estimation is done in joint space, in radians. FalconDevice maps the results to cartesian
+ * coordinates through the kinematic jacobian (see FalconKinematic::getJacobian).
+ *
+ * Implementations must not allocate after construction, as they run inside the I/O loop.
+ */
+	class FalconVelocityEstimator : public FalconCore
+	{
+	public:
+		/**
+		 * Constructor
+		 *
+		 */
+		FalconVelocityEstimator() :
+			m_hasStartTime(false),
+			m_startTime(0)
+		{
+			m_velocity.fill(0.0);
+			m_acceleration.fill(0.0);
+		}
+
+		/**
+		 * Destructor
+		 *
+		 */
+		virtual ~FalconVelocityEstimator() {}
+
+		/**
+		 * Returns the angle (in radians) that one encoder tick corresponds to. This is the quantization
+		 * noise floor every estimator has to deal with.
+		 *
+		 * @return Radians per encoder tick
+		 */
+		static double getEncoderResolution()
+		{
+			return (((SHAFT_DIAMETER*PI) / (WHEEL_SLOTS_NUMBER*4)) / ((PI*SMALL_ARM_DIAMETER)/360.0)) * (PI / 180.0);
+		}
+
+		/**
+		 * Adds a new set of encoder values to the estimator and updates the velocity and acceleration estimates
+		 *
+		 * @param encoders Raw encoder values for the 3 legs
+		 * @param timestamp Time the values were received at, in nanoseconds (see getFalconTimestamp)
+		 */
+		void addSample(const std::array<int, 3>& encoders, uint64_t timestamp)
+		{
+			if(!m_hasStartTime)
+			{
+				m_startTime = timestamp;
+				m_hasStartTime = true;
+			}
+			const double resolution = getEncoderResolution();
+			std::array<double, 3> angles = {{encoders[0] * resolution, encoders[1] * resolution, encoders[2] * resolution}};
+			update(angles, (double)(int64_t)(timestamp - m_startTime) / 1e9);
+		}
+
+		/**
+		 * Clears all sample history and estimates. Should be called whenever the encoder stream is
+		 * discontinuous (device reopened, homing, etc...)
+		 */
+		void reset()
+		{
+			m_hasStartTime = false;
+			m_velocity.fill(0.0);
+			m_acceleration.fill(0.0);
+			resetHistory();
+		}
+
+		/**
+		 * Returns the current joint velocity estimate
+		 *
+		 * @return Angular velocity of the 3 legs, in radians/s
+		 */
+		const std::array<double, 3>& getJointVelocity() const { return m_velocity; }
+
+		/**
+		 * Returns the current joint acceleration estimate
+		 *
+		 * @return Angular acceleration of the 3 legs, in radians/s^2
+		 */
+		const std::array<double, 3>& getJointAcceleration() const { return m_acceleration; }
+	protected:
+		/**
+		 * Runs the estimator on a new sample. Implementations should update m_velocity and m_acceleration.
+		 *
+		 * @param angles Leg angles, in radians, relative to the encoder zero
+		 * @param time Time of the sample, in seconds since the first sample
+		 */
+		virtual void update(const std::array<double, 3>& angles, double time) = 0;
+
+		/**
+		 * Clears the implementation's sample history
+		 */
+		virtual void resetHistory() = 0;
+
+		bool m_hasStartTime; /**< True once the first sample has been seen */
+		uint64_t m_startTime; /**< Timestamp of the first sample, in nanoseconds */
+		std::array<double, 3> m_velocity; /**< Current joint velocity estimate, radians/s */
+		std::array<double, 3> m_acceleration; /**< Current joint acceleration estimate, radians/s^2 */
+	};
+}
+
+#endif
@@ -0,0 +1,97 @@
+/***
+ * @file FalconVelocityEstimatorFOAW.h
+ * @brief First-order adaptive windowing velocity estimator
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#ifndef FALCONVELOCITYESTIMATORFOAW_H
+#define FALCONVELOCITYESTIMATORFOAW_H
+
+#include "falcon/core/FalconVelocityEstimator.h"
+
+namespace libnifalcon
+{
+/**
+ * @class FalconVelocityEstimatorFOAW
+ * @ingroup EstimatorClasses
+ *
+ * First-order adaptive windowing (best-fit FOAW) estimator, after Janabi-Sharifi, Hayward and Chen,
+ * "Discrete-time adaptive windowing for velocity estimation" (IEEE TCST, 2000).
+ *
+ * For every sample, the estimator looks for the longest window of past samples whose least squares line
+ * stays within a noise bound of every sample in the window, and uses the slope of that line as the
+ * velocity. Slow motion gets long windows (little quantization noise), fast motion gets short ones
+ * (little lag). Acceleration is estimated by running the same algorithm over the velocity estimates,
+ * with its own noise bound.
+ *
+ * The window search is quadratic in the window size, so this is the most expensive of the estimators
+ * (a few microseconds per sample at the default window), and it lags more than the Kalman estimator
+ * under strong acceleration. It is at its best for slow, precise motion.
+ */
+	class FalconVelocityEstimatorFOAW : public FalconVelocityEstimator
+	{
+	public:
+		static const unsigned int MAX_WINDOW = 32; /**< Maximum number of samples a window can span */
+
+		/**
+		 * Constructor. Position noise bound defaults to one encoder tick.
+		 *
+		 */
+		FalconVelocityEstimatorFOAW();
+
+		/**
+		 * Destructor
+		 *
+		 */
+		~FalconVelocityEstimatorFOAW() {}
+
+		/**
+		 * Sets the noise bounds used to decide how far a window can grow
+		 *
+		 * @param position_bound Maximum deviation of a joint angle from the fitted line, in radians
+		 * @param velocity_bound Maximum deviation of a joint velocity from the fitted line, in radians/s
+		 */
+		void setNoiseBounds(double position_bound, double velocity_bound)
+		{
+			m_positionBound = position_bound;
+			m_velocityBound = velocity_bound;
+		}
+
+		/**
+		 * Sets the largest window, in samples, the estimator will consider
+		 *
+		 * @param window Window size, clamped to [2, MAX_WINDOW]
+		 */
+		void setMaxWindow(unsigned int window);
+	protected:
+		virtual void update(const std::array<double, 3>& angles, double time);
+		virtual void resetHistory();
+
+		/**
+		 * Runs the best-fit FOAW over one channel of a history
+		 *
+		 * @param history History to fit, newest sample at m_head
+		 * @param axis Channel of the history to use
+		 * @param bound Noise bound for the channel
+		 *
+		 * @return Slope of the longest window whose line fits within the bound
+		 */
+		double fit(const std::array<std::array<double, 3>, MAX_WINDOW>& history, int axis, double bound);
+
+		std::array<double, MAX_WINDOW> m_times; /**< Ring buffer of sample times */
+		std::array<std::array<double, 3>, MAX_WINDOW> m_angles; /**< Ring buffer of joint angles */
+		std::array<std::array<double, 3>, MAX_WINDOW> m_velocities; /**< Ring buffer of joint velocity estimates */
+		unsigned int m_head; /**< Index of the newest sample */
+		unsigned int m_count; /**< Number of valid samples in the ring buffers */
+		unsigned int m_maxWindow; /**< Largest window to consider */
+		double m_positionBound; /**< Position noise bound, radians */
+		double m_velocityBound; /**< Velocity noise bound, radians/s */
+	};
+}
+
+#endif
@@ -0,0 +1,73 @@
+/***
+ * @file FalconVelocityEstimatorKalman.h
+ * @brief Fixed-gain (steady state) Kalman filter velocity and acceleration estimator
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#ifndef FALCONVELOCITYESTIMATORKALMAN_H
+#define FALCONVELOCITYESTIMATORKALMAN_H
+
+#include "falcon/core/FalconVelocityEstimator.h"
+
+namespace libnifalcon
+{
+/**
+ * @class FalconVelocityEstimatorKalman
+ * @ingroup EstimatorClasses
+ *
+ * Kalman filter over a constant acceleration (white jerk) model of each joint, run with the steady
+ * state gains. The gains are found once, by iterating the Riccati equation at a nominal sample period
+ * whenever the noise parameters change, so the per-sample cost is a handful of multiply-adds (this is
+ * an alpha-beta-gamma filter with optimal coefficients).
+ *
+ * The gains are applied to the actual time between samples, so the filter keeps working through
+ * sample period jitter.
+ */
+	class FalconVelocityEstimatorKalman : public FalconVelocityEstimator
+	{
+	public:
+		/**
+		 * Constructor. Measurement noise defaults to encoder quantization noise, sample period to 1ms.
+		 *
+		 */
+		FalconVelocityEstimatorKalman();
+
+		/**
+		 * Destructor
+		 *
+		 */
+		~FalconVelocityEstimatorKalman() {}
+
+		/**
+		 * Sets the model noise and recalculates the filter gains. Higher process noise follows quick
+		 * changes in acceleration better, at the cost of noisier estimates.
+		 *
+		 * @param process_noise Spectral density of joint jerk, in radians^2/s^5
+		 * @param measurement_noise Variance of joint angle measurements, in radians^2
+		 * @param period Nominal sample period, in seconds
+		 */
+		void setNoise(double process_noise, double measurement_noise, double period = 0.001);
+
+		/**
+		 * Returns the dimensionless gains in use
+		 *
+		 * @return Alpha, beta and gamma coefficients of the filter
+		 */
+		std::array<double, 3> getGains() const { return m_gains; }
+	protected:
+		virtual void update(const std::array<double, 3>& angles, double time);
+		virtual void resetHistory();
+
+		std::array<double, 3> m_gains; /**< Alpha, beta, gamma gains */
+		std::array<double, 3> m_angles; /**< Filtered joint angles */
+		double m_lastTime; /**< Time of the last sample */
+		bool m_initialized; /**< True once the state has been set from a sample */
+	};
+}
+
+#endif
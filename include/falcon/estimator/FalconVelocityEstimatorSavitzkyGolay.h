@@ -0,0 +1,66 @@
+/***
+ * @file FalconVelocityEstimatorSavitzkyGolay.h
+ * @brief Savitzky-Golay (local quadratic fit) velocity and acceleration estimator
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#ifndef FALCONVELOCITYESTIMATORSAVITZKYGOLAY_H
+#define FALCONVELOCITYESTIMATORSAVITZKYGOLAY_H
+
+#include "falcon/core/FalconVelocityEstimator.h"
+
+namespace libnifalcon
+{
+/**
+ * @class FalconVelocityEstimatorSavitzkyGolay
+ * @ingroup EstimatorClasses
+ *
+ * Causal Savitzky-Golay estimator. A quadratic is least-squares fitted to the last N samples of each
+ * joint, and its first and second derivatives at the newest sample are used as velocity and
+ * acceleration.
+ *
+ * The fit uses the actual sample times instead of precomputed convolution coefficients, so it stays
+ * correct when USB scheduling makes the sample period jitter. With evenly spaced samples it reduces to
+ * the classic Savitzky-Golay filter.
+ */
+	class FalconVelocityEstimatorSavitzkyGolay : public FalconVelocityEstimator
+	{
+	public:
+		static const unsigned int MAX_WINDOW = 64; /**< Maximum number of samples in the fit */
+
+		/**
+		 * Constructor. Window defaults to 15 samples.
+		 *
+		 */
+		FalconVelocityEstimatorSavitzkyGolay();
+
+		/**
+		 * Destructor
+		 *
+		 */
+		~FalconVelocityEstimatorSavitzkyGolay() {}
+
+		/**
+		 * Sets the number of samples the quadratic is fitted over. Longer windows are smoother but lag more.
+		 *
+		 * @param window Window size, clamped to [3, MAX_WINDOW]
+		 */
+		void setWindow(unsigned int window);
+	protected:
+		virtual void update(const std::array<double, 3>& angles, double time);
+		virtual void resetHistory();
+
+		std::array<double, MAX_WINDOW> m_times; /**< Ring buffer of sample times */
+		std::array<std::array<double, 3>, MAX_WINDOW> m_angles; /**< Ring buffer of joint angles */
+		unsigned int m_head; /**< Index of the newest sample */
+		unsigned int m_count; /**< Number of valid samples in the ring buffers */
+		unsigned int m_window; /**< Number of samples to fit over */
+	};
+}
+
+#endif
@@ -0,0 +1,104 @@
+/***
+ * @file FalconFirmwareImages.h
+ * @brief Registry of the firmware images built into the library
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#ifndef FALCONFIRMWAREIMAGES_H
+#define FALCONFIRMWAREIMAGES_H
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace libnifalcon
+{
+/**
+ * @struct FalconFirmwareImage
+ * @ingroup FirmwareClasses
+ *
+ * One firmware image built into the library. Images are stored compressed, and need to go through
+ * FalconFirmwareImages::decode before they can be loaded to a falcon.
+ */
+	struct FalconFirmwareImage
+	{
+		const char* name; /**< Name used to look the image up (e.g. "nvent") */
+		const char* description; /**< Human readable description of the image */
+		unsigned int size; /**< Size of the decoded image, in bytes */
+		unsigned int compressedSize; /**< Size of the compressed image, in bytes */
+		uint32_t crc; /**< CRC32 of the decoded image */
+		const uint8_t* data; /**< Compressed image */
+	};
+
+/**
+ * @class FalconFirmwareImages
+ * @ingroup FirmwareClasses
+ *
+ * Registry of the firmware images in the firmware/ directory of the source tree, compiled into
+ * the library once. Images are LZSS compressed, which takes them to a bit over half their size,
+ * and are only decoded when a load is actually needed:
+ *
+ * @code
+ * std::vector<uint8_t> buffer;
+ * const FalconFirmwareImage* image = FalconFirmwareImages::findImage("nvent");
+ * if(image != NULL && FalconFirmwareImages::decode(*image, buffer))
+ *     firmware->loadFirmware(true, buffer.size(), buffer.data());
+ * @endcode
+ *
+ * FalconFirmware::loadFirmwareImage does the same, into a buffer it keeps around between loads.
+ *
+ * The image data is generated by util/firmware2cpp.py, which needs to be rerun when the contents
+ * of firmware/ change.
+ */
+	class FalconFirmwareImages
+	{
+	public:
+		static const char* const DEFAULT_IMAGE; /**< Name of the image to use when none is specified ("nvent") */
+
+		/**
+		 * Returns the number of built in images
+		 *
+		 * @return Number of images
+		 */
+		static unsigned int getImageCount() { return IMAGE_COUNT; }
+
+		/**
+		 * Returns a built in image by index
+		 *
+		 * @param index Index of the image, in [0, getImageCount())
+		 *
+		 * @return Image, or NULL if the index is out of range
+		 */
+		static const FalconFirmwareImage* getImage(unsigned int index);
+
+		/**
+		 * Returns a built in image by name
+		 *
+		 * @param name Name of the image (see getImage(unsigned int)->name)
+		 *
+		 * @return Image, or NULL if there's no image by that name
+		 */
+		static const FalconFirmwareImage* findImage(const std::string& name);
+
+		/**
+		 * Decodes an image. The buffer is resized to fit the image, so passing the same buffer for
+		 * every decode means it's only allocated once.
+		 *
+		 * @param image Image to decode
+		 * @param buffer Buffer to decode into
+		 *
+		 * @return True if the image decoded to the expected size and CRC, false otherwise
+		 */
+		static bool decode(const FalconFirmwareImage& image, std::vector<uint8_t>& buffer);
+	protected:
+		static const FalconFirmwareImage IMAGES[]; /**< Built in images, generated by util/firmware2cpp.py */
+		static const unsigned int IMAGE_COUNT; /**< Number of entries in IMAGES */
+	};
+}
+
+#endif
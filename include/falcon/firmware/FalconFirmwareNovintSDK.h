@@ -142,6 +142,14 @@ namespace libnifalcon
 		 * @return Const pointer to internal representation of raw grip info
 		 */		
 		const uint8_t* getGripInfo() { return &(m_gripInfo); }
+
+		/**
+		 * Returns the number of times the packet framer had to throw away data to find the start of a
+		 * packet (dropped or corrupted bytes on the wire)
+		 *
+		 * @return Number of resynchronization events since construction
+		 */
+		uint64_t getResyncCount() { return m_resyncCount; }
 	protected:
 
 		/**
@@ -153,9 +161,17 @@ namespace libnifalcon
 		/**
 		 * Formats current output from falcon (joint positions, calibration, etc...)
 		 *
-		 * @return True if at least one complete packet has been parsed
+		 * @return True if the packet at m_currentOutputIndex was well formed and has been parsed
 		 */		
 		bool formatOutput();
+
+		/**
+		 * Throws away data from m_currentOutputIndex up to the next packet start marker, or all of it if
+		 * there is none
+		 *
+		 * @param skip_current If true, a start marker at m_currentOutputIndex itself is skipped too
+		 */
+		void resync(bool skip_current);
 		
 		uint8_t m_gripInfo; /**< Internal representation of grip data (buttons pressed, etc...) */
 		uint8_t m_rawData[128]; /**< Raw buffer to read into */
@@ -165,6 +181,7 @@ namespace libnifalcon
 
 		unsigned int m_currentOutputIndex; /**< How far the firmware object is into parsing the current packet */
 		unsigned int m_rawDataSize; /**< Amount of data last returned from communications object read */
+		uint64_t m_resyncCount; /**< Number of times the framer has thrown away data */
 	private:
 		DECLARE_LOGGER();
 
@@ -42,6 +42,11 @@
  */
 //#define GMTL_COUNT_CONSTRUCT_CALLS 1
 
+/** If defined, the SSE/AVX/NEON overloads in SimdOps.h are left out
+ * and 3x3 operations use the generic templates.
+ */
+//#define GMTL_NO_SIMD 1
+
 
 
 #endif
@@ -42,173 +42,102 @@
 // Fit points with a Gaussian distribution.  The center is the mean of the
 // points, the axes are the eigenvectors of the covariance matrix, and the
 // extents are the eigenvalues of the covariance matrix and are returned in
-// increasing order.  The last two functions allow selection of valid
-// vertices from a pool.  The return value is 'true' if and only if at least
-// one vertex was valid.
+// increasing order.  The last function allows selection of valid vertices
+// from a pool.  The return value is 'true' if and only if at least one vertex
+// was valid.
+//
+// The covariance is accumulated about the first point, so that points far
+// from the origin don't lose their spread to cancellation, and solved with the
+// closed form eigenSymmetric().
 
-#include <falcon/gmtl/Vec3.h>
-#include <falcon/gmtl/Point3.h>
-#include <falcon/gmtl/Numerics/Eigen.h>
+#include <falcon/gmtl/Point.h>
+#include <falcon/gmtl/Vec.h>
+#include <falcon/gmtl/Matrix.h>
+#include <falcon/gmtl/Numerics/SymmetricEigen3.h>
 
 namespace gmtl
 {
 
-/*
-void MgcGaussPointsFit (int iQuantity, const MgcVector2* akPoint,
-    MgcVector2& rkCenter, MgcVector2 akAxis[2], MgcReal afExtent[2]);
-*/
-
-void GaussPointsFit (int iQuantity, const Point3* akPoint,
-    Point3& rkCenter, Vec3 akAxis[3], float afExtent[3]);
-
-/*
-bool MgcGaussPointsFit (int iQuantity, const MgcVector2* akPoint,
-    const bool* abValid, MgcVector2& rkCenter, MgcVector2 akAxis[2],
-    MgcReal afExtent[2]);
-*/
-
-bool GaussPointsFit (int iQuantity, const Vec3* akPoint,
-    const bool* abValid, Vec3& rkCenter, Vec3 akAxis[3],
-    float afExtent[3]);
-	
-
-// --- Implementations ---- //
-void GaussPointsFit (int iQuantity, const Point3* akPoint,
-    Point3& rkCenter, Vec3 akAxis[3], float afExtent[3])
+namespace helpers
 {
-    // compute mean of points
-    rkCenter = akPoint[0];
-    unsigned i;
-    for (i = 1; i < iQuantity; i++)
-        rkCenter += akPoint[i];
-    float fInvQuantity = 1.0f/iQuantity;
-    rkCenter *= fInvQuantity;
-
-    // compute covariances of points
-    float fSumXX = 0.0, fSumXY = 0.0, fSumXZ = 0.0;
-    float fSumYY = 0.0, fSumYZ = 0.0, fSumZZ = 0.0;
-    for (i = 0; i < iQuantity; i++)
-    {
-        Vec3 kDiff = akPoint[i] - rkCenter;
-        fSumXX += kDiff[Xelt]*kDiff[Xelt];
-        fSumXY += kDiff[Xelt]*kDiff[Yelt];
-        fSumXZ += kDiff[Xelt]*kDiff[Zelt];
-        fSumYY += kDiff[Yelt]*kDiff[Yelt];
-        fSumYZ += kDiff[Yelt]*kDiff[Zelt];
-        fSumZZ += kDiff[Zelt]*kDiff[Zelt];
-    }
-    fSumXX *= fInvQuantity;
-    fSumXY *= fInvQuantity;
-    fSumXZ *= fInvQuantity;
-    fSumYY *= fInvQuantity;
-    fSumYZ *= fInvQuantity;
-    fSumZZ *= fInvQuantity;
-
-    // compute eigenvectors for covariance matrix
-    gmtl::Eigen kES(3);
-    kES.Matrix(0,0) = fSumXX;
-    kES.Matrix(0,1) = fSumXY;
-    kES.Matrix(0,2) = fSumXZ;
-    kES.Matrix(1,0) = fSumXY;
-    kES.Matrix(1,1) = fSumYY;
-    kES.Matrix(1,2) = fSumYZ;
-    kES.Matrix(2,0) = fSumXZ;
-    kES.Matrix(2,1) = fSumYZ;
-    kES.Matrix(2,2) = fSumZZ;
-    kES.IncrSortEigenStuff3();
-
-    akAxis[0][Xelt] = kES.GetEigenvector(0,0);
-    akAxis[0][Yelt] = kES.GetEigenvector(1,0);
-    akAxis[0][Zelt] = kES.GetEigenvector(2,0);
-
-    akAxis[1][Xelt] = kES.GetEigenvector(0,1);
-    akAxis[1][Yelt] = kES.GetEigenvector(1,1);
-    akAxis[1][Zelt] = kES.GetEigenvector(2,1);
-
-    akAxis[2][Xelt] = kES.GetEigenvector(0,2);
-    akAxis[2][Yelt] = kES.GetEigenvector(1,2);
-    akAxis[2][Zelt] = kES.GetEigenvector(2,2);
-
-    afExtent[0] = kES.GetEigenvalue(0);
-    afExtent[1] = kES.GetEigenvalue(1);
-    afExtent[2] = kES.GetEigenvalue(2);
+   /** Mean and covariance of the valid points (all points if abValid is NULL).
+    *  @return the number of points used
+    */
+   template <typename DATA_TYPE>
+   inline int GaussPointsMoments (int iQuantity, const Point<DATA_TYPE, 3>* akPoint,
+       const bool* abValid, Point<DATA_TYPE, 3>& rkCenter, Matrix<DATA_TYPE, 3, 3>& rkCovariance)
+   {
+       int i, iValidQuantity = 0;
+       Vec<DATA_TYPE, 3> kPivot, kSum;
+       DATA_TYPE afSum[6] = { 0, 0, 0, 0, 0, 0 };
+       for (i = 0; i < iQuantity; i++)
+       {
+           if ( abValid && !abValid[i] )
+               continue;
+           if ( iValidQuantity == 0 )
+               kPivot = akPoint[i];
+           Vec<DATA_TYPE, 3> kDiff = akPoint[i] - kPivot;
+           kSum += kDiff;
+           afSum[0] += kDiff[Xelt]*kDiff[Xelt];
+           afSum[1] += kDiff[Xelt]*kDiff[Yelt];
+           afSum[2] += kDiff[Xelt]*kDiff[Zelt];
+           afSum[3] += kDiff[Yelt]*kDiff[Yelt];
+           afSum[4] += kDiff[Yelt]*kDiff[Zelt];
+           afSum[5] += kDiff[Zelt]*kDiff[Zelt];
+           iValidQuantity++;
+       }
+       if ( iValidQuantity == 0 )
+           return 0;
+
+       DATA_TYPE fInvQuantity = DATA_TYPE(1)/iValidQuantity;
+       Vec<DATA_TYPE, 3> kMean = kSum * fInvQuantity;
+       rkCenter = kPivot + kMean;
+       rkCovariance(0,0) = afSum[0]*fInvQuantity - kMean[Xelt]*kMean[Xelt];
+       rkCovariance(0,1) = afSum[1]*fInvQuantity - kMean[Xelt]*kMean[Yelt];
+       rkCovariance(0,2) = afSum[2]*fInvQuantity - kMean[Xelt]*kMean[Zelt];
+       rkCovariance(1,1) = afSum[3]*fInvQuantity - kMean[Yelt]*kMean[Yelt];
+       rkCovariance(1,2) = afSum[4]*fInvQuantity - kMean[Yelt]*kMean[Zelt];
+       rkCovariance(2,2) = afSum[5]*fInvQuantity - kMean[Zelt]*kMean[Zelt];
+       rkCovariance(1,0) = rkCovariance(0,1);
+       rkCovariance(2,0) = rkCovariance(0,2);
+       rkCovariance(2,1) = rkCovariance(1,2);
+       return iValidQuantity;
+   }
+
+   /** Splits an eigen decomposition into axes and extents. */
+   template <typename DATA_TYPE>
+   inline void GaussPointsAxes (const Matrix<DATA_TYPE, 3, 3>& rkCovariance,
+       Vec<DATA_TYPE, 3> akAxis[3], DATA_TYPE afExtent[3])
+   {
+       Vec<DATA_TYPE, 3> kValues;
+       Matrix<DATA_TYPE, 3, 3> kVectors;
+       eigenSymmetric(kValues, kVectors, rkCovariance);
+       for (int i = 0; i < 3; i++)
+       {
+           akAxis[i].set(kVectors(0,i), kVectors(1,i), kVectors(2,i));
+           afExtent[i] = kValues[i];
+       }
+   }
 }
 
+template <typename DATA_TYPE>
+void GaussPointsFit (int iQuantity, const Point<DATA_TYPE, 3>* akPoint,
+    Point<DATA_TYPE, 3>& rkCenter, Vec<DATA_TYPE, 3> akAxis[3], DATA_TYPE afExtent[3])
+{
+    Matrix<DATA_TYPE, 3, 3> kCovariance;
+    helpers::GaussPointsMoments(iQuantity, akPoint, (const bool*)NULL, rkCenter, kCovariance);
+    helpers::GaussPointsAxes(kCovariance, akAxis, afExtent);
+}
 
-//
-bool GaussPointsFit (int iQuantity, const Vec3* akPoint,
-    const bool* abValid, Vec3& rkCenter, Vec3 akAxis[3],
-    float afExtent[3])
+template <typename DATA_TYPE>
+bool GaussPointsFit (int iQuantity, const Point<DATA_TYPE, 3>* akPoint,
+    const bool* abValid, Point<DATA_TYPE, 3>& rkCenter, Vec<DATA_TYPE, 3> akAxis[3],
+    DATA_TYPE afExtent[3])
 {
-    // compute mean of points
-    rkCenter = ZeroVec3;
-    int i, iValidQuantity = 0;
-    for (i = 0; i < iQuantity; i++)
-    {
-        if ( abValid[i] )
-        {
-            rkCenter += akPoint[i];
-            iValidQuantity++;
-        }
-    }
-    if ( iValidQuantity == 0 )
+    Matrix<DATA_TYPE, 3, 3> kCovariance;
+    if ( helpers::GaussPointsMoments(iQuantity, akPoint, abValid, rkCenter, kCovariance) == 0 )
         return false;
-
-    float fInvQuantity = 1.0/iValidQuantity;
-    rkCenter *= fInvQuantity;
-
-    // compute covariances of points
-    float fSumXX = 0.0, fSumXY = 0.0, fSumXZ = 0.0;
-    float fSumYY = 0.0, fSumYZ = 0.0, fSumZZ = 0.0;
-    for (i = 0; i < iQuantity; i++)
-    {
-        if ( abValid[i] )
-        {
-            Vec3 kDiff = akPoint[i] - rkCenter;
-            fSumXX += kDiff[Xelt]*kDiff[Xelt];
-            fSumXY += kDiff[Xelt]*kDiff[Yelt];
-            fSumXZ += kDiff[Xelt]*kDiff[Zelt];
-            fSumYY += kDiff[Yelt]*kDiff[Yelt];
-            fSumYZ += kDiff[Yelt]*kDiff[Zelt];
-            fSumZZ += kDiff[Zelt]*kDiff[Zelt];
-        }
-    }
-    fSumXX *= fInvQuantity;
-    fSumXY *= fInvQuantity;
-    fSumXZ *= fInvQuantity;
-    fSumYY *= fInvQuantity;
-    fSumYZ *= fInvQuantity;
-    fSumZZ *= fInvQuantity;
-
-    // compute eigenvectors for covariance matrix
-    Eigen kES(3);
-    kES.Matrix(0,0) = fSumXX;
-    kES.Matrix(0,1) = fSumXY;
-    kES.Matrix(0,2) = fSumXZ;
-    kES.Matrix(1,0) = fSumXY;
-    kES.Matrix(1,1) = fSumYY;
-    kES.Matrix(1,2) = fSumYZ;
-    kES.Matrix(2,0) = fSumXZ;
-    kES.Matrix(2,1) = fSumYZ;
-    kES.Matrix(2,2) = fSumZZ;
-    kES.IncrSortEigenStuff3();
-
-    akAxis[0][Xelt] = kES.GetEigenvector(0,0);
-    akAxis[0][Yelt] = kES.GetEigenvector(1,0);
-    akAxis[0][Zelt] = kES.GetEigenvector(2,0);
-
-    akAxis[1][Xelt] = kES.GetEigenvector(0,1);
-    akAxis[1][Yelt] = kES.GetEigenvector(1,1);
-    akAxis[1][Zelt] = kES.GetEigenvector(2,1);
-
-    akAxis[2][Xelt] = kES.GetEigenvector(0,2);
-    akAxis[2][Yelt] = kES.GetEigenvector(1,2);
-    akAxis[2][Zelt] = kES.GetEigenvector(2,2);
-
-    afExtent[0] = kES.GetEigenvalue(0);
-    afExtent[1] = kES.GetEigenvalue(1);
-    afExtent[2] = kES.GetEigenvalue(2);
-
+    helpers::GaussPointsAxes(kCovariance, akAxis, afExtent);
     return true;
 }
 
@@ -0,0 +1,95 @@
+/***
+ * @file MatrixExprMeta.h
+ * @brief Expression templates for matrix-vector products
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#ifndef _GMTL_MATRIX_EXPR_META_H
+#define _GMTL_MATRIX_EXPR_META_H
+
+#include <falcon/gmtl/Matrix.h>
+#include <falcon/gmtl/VecBase.h>
+#ifndef GMTL_NO_METAPROG
+#include <falcon/gmtl/VecExprMeta.h>
+#endif
+
+/** Expression template classes for matrix-vector products.
+ * They plug into the vector expressions of VecExprMeta.h, so a chain like m * v + w is evaluated one
+ * element at a time, without a temporary vector for m * v.
+ */
+namespace gmtl
+{
+namespace meta
+{
+/** @ingroup VecExprMeta */
+//@{
+
+#ifndef GMTL_NO_METAPROG
+
+/** Element (row, col) of a matrix, or of its transpose. */
+template <bool TRANSPOSED>
+struct MatElt
+{
+   template <typename MATRIX_T>
+   static inline typename MATRIX_T::DataType get(const MATRIX_T& m, const unsigned row, const unsigned col)
+   { return m(row, col); }
+};
+
+template <>
+struct MatElt<true>
+{
+   template <typename MATRIX_T>
+   static inline typename MATRIX_T::DataType get(const MATRIX_T& m, const unsigned row, const unsigned col)
+   { return m(col, row); }
+};
+
+/** meta class to unroll the dot product of a matrix row with a vector expression.
+ * Adds in the same order as xform(), so results match it exactly.
+ */
+template <int ELT, typename MATRIX_T, typename EXP_T, bool TRANSPOSED>
+struct MatVecDotUnrolled
+{
+   static inline typename EXP_T::DataType func(const MATRIX_T& m, const EXP_T& v, const unsigned row)
+   {  return MatVecDotUnrolled<ELT-1, MATRIX_T, EXP_T, TRANSPOSED>::func(m, v, row) + (MatElt<TRANSPOSED>::get(m, row, ELT) * v[ELT]); }
+};
+
+/** base case for matrix row dot product unrolling. */
+template <typename MATRIX_T, typename EXP_T, bool TRANSPOSED>
+struct MatVecDotUnrolled<0, MATRIX_T, EXP_T, TRANSPOSED>
+{
+   static inline typename EXP_T::DataType func(const MATRIX_T& m, const EXP_T& v, const unsigned row)
+   {  return (MatElt<TRANSPOSED>::get(m, row, 0) * v[0]); }
+};
+
+/** Matrix-vector product expression.
+*
+* Holds the matrix by reference and the vector expression as any other expression does. Element i is
+* row i of the matrix (column i if TRANSPOSED) dotted with the vector, worked out when it is read, so the
+* vector expression is evaluated once for every element of the result.
+*/
+template <typename MATRIX_T, typename EXP_T, bool TRANSPOSED>
+struct MatVecXformExpr
+{
+   typedef typename EXP_T::DataType DataType;
+
+   const MATRIX_T& Mat;
+   typename ExprTraits<EXP_T>::ExprRef Exp;
+
+   inline MatVecXformExpr(const MATRIX_T& m, const EXP_T& e) : Mat(m), Exp(e) {;}
+   inline DataType operator[](const unsigned i) const
+   { return MatVecDotUnrolled<EXP_T::Size-1, MATRIX_T, EXP_T, TRANSPOSED>::func(Mat, Exp, i); }
+};
+
+#endif
+
+//@}
+
+} // namespace meta
+} // end namespace
+
+#endif
@@ -38,26 +38,31 @@
 #ifndef _EIGEN_H
 #define _EIGEN_H
 
-#include <falcon/gmtl/gmtlConfig.h>
+#include <cassert>
+#include <falcon/gmtl/Math.h>
 
 namespace gmtl
 {
 
-class Eigen
+/** Symmetric NxN eigen solver: Householder reduction to tridiagonal form, then QL iteration.
+ * Eigen is the float version.
+ */
+template <typename DATA_TYPE>
+class EigenSolver
 {
 public:
-    Eigen (int iSize);
-    ~Eigen ();
+    EigenSolver (int iSize);
+    ~EigenSolver ();
 
     // set the matrix for eigensolving
-    float& Matrix (int iRow, int iCol);
-    void SetMatrix (float** aafMat);
+    DATA_TYPE& Matrix (int iRow, int iCol);
+    void SetMatrix (DATA_TYPE** aafMat);
 
     // get the results of eigensolving (eigenvectors are columns of matrix)
-    float GetEigenvalue (int i) const;
-    float GetEigenvector (int iRow, int iCol) const;
-    float* GetEigenvalue ();
-    float** GetEigenvector ();
+    DATA_TYPE GetEigenvalue (int i) const;
+    DATA_TYPE GetEigenvector (int iRow, int iCol) const;
+    DATA_TYPE* GetEigenvalue ();
+    DATA_TYPE** GetEigenvector ();
 
     // solve eigensystem
     void EigenStuff2 ();
@@ -82,55 +87,60 @@ public:
 
 protected:
     int m_iSize;
-    float** m_aafMat;
-    float* m_afDiag;
-    float* m_afSubd;
+    DATA_TYPE** m_aafMat;
+    DATA_TYPE* m_afDiag;
+    DATA_TYPE* m_afSubd;
 
     // Householder reduction to tridiagonal form
-    static void Tridiagonal2 (float** aafMat, float* afDiag,
-        float* afSubd);
-    static void Tridiagonal3 (float** aafMat, float* afDiag,
-        float* afSubd);
-    static void Tridiagonal4 (float** aafMat, float* afDiag,
-        float* afSubd);
-    static void TridiagonalN (int iSize, float** aafMat, float* afDiag,
-        float* afSubd);
+    static void Tridiagonal2 (DATA_TYPE** aafMat, DATA_TYPE* afDiag,
+        DATA_TYPE* afSubd);
+    static void Tridiagonal3 (DATA_TYPE** aafMat, DATA_TYPE* afDiag,
+        DATA_TYPE* afSubd);
+    static void Tridiagonal4 (DATA_TYPE** aafMat, DATA_TYPE* afDiag,
+        DATA_TYPE* afSubd);
+    static void TridiagonalN (int iSize, DATA_TYPE** aafMat, DATA_TYPE* afDiag,
+        DATA_TYPE* afSubd);
 
     // QL algorithm with implicit shifting, applies to tridiagonal matrices
-    static bool QLAlgorithm (int iSize, float* afDiag, float* afSubd,
-        float** aafMat);
+    static bool QLAlgorithm (int iSize, DATA_TYPE* afDiag, DATA_TYPE* afSubd,
+        DATA_TYPE** aafMat);
 
     // sort eigenvalues from largest to smallest
-    static void DecreasingSort (int iSize, float* afEigval,
-        float** aafEigvec);
+    static void DecreasingSort (int iSize, DATA_TYPE* afEigval,
+        DATA_TYPE** aafEigvec);
 
     // sort eigenvalues from smallest to largest
-    static void IncreasingSort (int iSize, float* afEigval,
-        float** aafEigvec);
+    static void IncreasingSort (int iSize, DATA_TYPE* afEigval,
+        DATA_TYPE** aafEigvec);
 };
 
 //---------------------------------------------------------------------------
-inline float& Eigen::Matrix (int iRow, int iCol)
+template <typename DATA_TYPE>
+inline DATA_TYPE& EigenSolver<DATA_TYPE>::Matrix (int iRow, int iCol)
 {
     return m_aafMat[iRow][iCol];
 }
 //---------------------------------------------------------------------------
-inline float Eigen::GetEigenvalue (int i) const
+template <typename DATA_TYPE>
+inline DATA_TYPE EigenSolver<DATA_TYPE>::GetEigenvalue (int i) const
 {
     return m_afDiag[i];
 }
 //---------------------------------------------------------------------------
-inline float Eigen::GetEigenvector (int iRow, int iCol) const
+template <typename DATA_TYPE>
+inline DATA_TYPE EigenSolver<DATA_TYPE>::GetEigenvector (int iRow, int iCol) const
 {
     return m_aafMat[iRow][iCol];
 }
 //---------------------------------------------------------------------------
-inline float* Eigen::GetEigenvalue ()
+template <typename DATA_TYPE>
+inline DATA_TYPE* EigenSolver<DATA_TYPE>::GetEigenvalue ()
 {
     return m_afDiag;
 }
 //---------------------------------------------------------------------------
-inline float** Eigen::GetEigenvector ()
+template <typename DATA_TYPE>
+inline DATA_TYPE** EigenSolver<DATA_TYPE>::GetEigenvector ()
 {
     return m_aafMat;
 }
@@ -141,20 +151,22 @@ inline float** Eigen::GetEigenvector ()
 
 
 //---------------------------------------------------------------------------
-Eigen::Eigen (int iSize)
+template <typename DATA_TYPE>
+inline EigenSolver<DATA_TYPE>::EigenSolver (int iSize)
 {
     assert( iSize >= 2 );
     m_iSize = iSize;
 
-    m_aafMat = new float*[m_iSize];
+    m_aafMat = new DATA_TYPE*[m_iSize];
     for (int i = 0; i < m_iSize; i++)
-        m_aafMat[i] = new float[m_iSize];
+        m_aafMat[i] = new DATA_TYPE[m_iSize];
 
-    m_afDiag = new float[m_iSize];
-    m_afSubd = new float[m_iSize];
+    m_afDiag = new DATA_TYPE[m_iSize];
+    m_afSubd = new DATA_TYPE[m_iSize];
 }
 //---------------------------------------------------------------------------
-Eigen::~Eigen ()
+template <typename DATA_TYPE>
+inline EigenSolver<DATA_TYPE>::~EigenSolver ()
 {
     delete[] m_afSubd;
     delete[] m_afDiag;
@@ -163,8 +175,9 @@ Eigen::~Eigen ()
     delete[] m_aafMat;
 }
 //---------------------------------------------------------------------------
-void Eigen::Tridiagonal2 (float** m_aafMat, float* m_afDiag,
-    float* m_afSubd)
+template <typename DATA_TYPE>
+inline void EigenSolver<DATA_TYPE>::Tridiagonal2 (DATA_TYPE** m_aafMat, DATA_TYPE* m_afDiag,
+    DATA_TYPE* m_afSubd)
 {
     // matrix is already tridiagonal
     m_afDiag[0] = m_aafMat[0][0];
@@ -177,25 +190,26 @@ void Eigen::Tridiagonal2 (float** m_aafMat, float* m_afDiag,
     m_aafMat[1][1] = 1.0;
 }
 //---------------------------------------------------------------------------
-void Eigen::Tridiagonal3 (float** m_aafMat, float* m_afDiag,
-    float* m_afSubd)
+template <typename DATA_TYPE>
+inline void EigenSolver<DATA_TYPE>::Tridiagonal3 (DATA_TYPE** m_aafMat, DATA_TYPE* m_afDiag,
+    DATA_TYPE* m_afSubd)
 {
-    float fM00 = m_aafMat[0][0];
-    float fM01 = m_aafMat[0][1];
-    float fM02 = m_aafMat[0][2];
-    float fM11 = m_aafMat[1][1];
-    float fM12 = m_aafMat[1][2];
-    float fM22 = m_aafMat[2][2];
+    DATA_TYPE fM00 = m_aafMat[0][0];
+    DATA_TYPE fM01 = m_aafMat[0][1];
+    DATA_TYPE fM02 = m_aafMat[0][2];
+    DATA_TYPE fM11 = m_aafMat[1][1];
+    DATA_TYPE fM12 = m_aafMat[1][2];
+    DATA_TYPE fM22 = m_aafMat[2][2];
 
     m_afDiag[0] = fM00;
     m_afSubd[2] = 0.0;
     if ( fM02 != 0.0 )
     {
-        float fLength = Math::sqrt(fM01*fM01+fM02*fM02);
-        float fInvLength = 1.0/fLength;
+        DATA_TYPE fLength = Math::sqrt(fM01*fM01+fM02*fM02);
+        DATA_TYPE fInvLength = 1.0/fLength;
         fM01 *= fInvLength;
         fM02 *= fInvLength;
-        float fQ = 2.0*fM01*fM12+fM02*(fM22-fM11);
+        DATA_TYPE fQ = 2.0*fM01*fM12+fM02*(fM22-fM11);
         m_afDiag[1] = fM11+fM02*fQ;
         m_afDiag[2] = fM22-fM02*fQ;
         m_afSubd[0] = fLength;
@@ -216,20 +230,21 @@ void Eigen::Tridiagonal3 (float** m_aafMat, float* m_afDiag,
     }
 }
 //---------------------------------------------------------------------------
-void Eigen::Tridiagonal4 (float** m_aafMat, float* m_afDiag,
-    float* m_afSubd)
+template <typename DATA_TYPE>
+inline void EigenSolver<DATA_TYPE>::Tridiagonal4 (DATA_TYPE** m_aafMat, DATA_TYPE* m_afDiag,
+    DATA_TYPE* m_afSubd)
 {
     // save matrix M
-    float fM00 = m_aafMat[0][0];
-    float fM01 = m_aafMat[0][1];
-    float fM02 = m_aafMat[0][2];
-    float fM03 = m_aafMat[0][3];
-    float fM11 = m_aafMat[1][1];
-    float fM12 = m_aafMat[1][2];
-    float fM13 = m_aafMat[1][3];
-    float fM22 = m_aafMat[2][2];
-    float fM23 = m_aafMat[2][3];
-    float fM33 = m_aafMat[3][3];
+    DATA_TYPE fM00 = m_aafMat[0][0];
+    DATA_TYPE fM01 = m_aafMat[0][1];
+    DATA_TYPE fM02 = m_aafMat[0][2];
+    DATA_TYPE fM03 = m_aafMat[0][3];
+    DATA_TYPE fM11 = m_aafMat[1][1];
+    DATA_TYPE fM12 = m_aafMat[1][2];
+    DATA_TYPE fM13 = m_aafMat[1][3];
+    DATA_TYPE fM22 = m_aafMat[2][2];
+    DATA_TYPE fM23 = m_aafMat[2][3];
+    DATA_TYPE fM33 = m_aafMat[3][3];
 
     m_afDiag[0] = fM00;
     m_afSubd[3] = 0.0;
@@ -242,13 +257,13 @@ void Eigen::Tridiagonal4 (float** m_aafMat, float* m_afDiag,
     m_aafMat[2][0] = 0.0;
     m_aafMat[3][0] = 0.0;
 
-    float fLength, fInvLength;
+    DATA_TYPE fLength, fInvLength;
 
     if ( fM02 != 0.0 || fM03 != 0.0 )
     {
-        float fQ11, fQ12, fQ13;
-        float fQ21, fQ22, fQ23;
-        float fQ31, fQ32, fQ33;
+        DATA_TYPE fQ11, fQ12, fQ13;
+        DATA_TYPE fQ21, fQ22, fQ23;
+        DATA_TYPE fQ31, fQ32, fQ33;
 
         // build column Q1
         fLength = Math::sqrt(fM01*fM01 + fM02*fM02 + fM03*fM03);
@@ -260,9 +275,9 @@ void Eigen::Tridiagonal4 (float** m_aafMat, float* m_afDiag,
         m_afSubd[0] = fLength;
 
         // compute S*Q1
-        float fV0 = fM11*fQ11+fM12*fQ21+fM13*fQ31;
-        float fV1 = fM12*fQ11+fM22*fQ21+fM23*fQ31;
-        float fV2 = fM13*fQ11+fM23*fQ21+fM33*fQ31;
+        DATA_TYPE fV0 = fM11*fQ11+fM12*fQ21+fM13*fQ31;
+        DATA_TYPE fV1 = fM12*fQ11+fM22*fQ21+fM23*fQ31;
+        DATA_TYPE fV2 = fM13*fQ11+fM23*fQ21+fM33*fQ31;
 
         m_afDiag[1] = fQ11*fV0+fQ21*fV1+fQ31*fV2;
 
@@ -304,7 +319,7 @@ void Eigen::Tridiagonal4 (float** m_aafMat, float* m_afDiag,
             if ( fLength > 0.0 )
             {
                 fInvLength = 1.0/fLength;
-                float fTmp = fQ11-1.0;
+                DATA_TYPE fTmp = fQ11-1.0;
                 fQ12 = -fQ21;
                 fQ22 = 1.0+fTmp*fQ21*fQ21*fInvLength;
                 fQ32 = fTmp*fQ21*fQ31*fInvLength;
@@ -354,7 +369,7 @@ void Eigen::Tridiagonal4 (float** m_aafMat, float* m_afDiag,
             fInvLength = 1.0/fLength;
             fM12 *= fInvLength;
             fM13 *= fInvLength;
-            float fQ = 2.0*fM12*fM23+fM13*(fM33-fM22);
+            DATA_TYPE fQ = 2.0*fM12*fM23+fM13*(fM33-fM22);
 
             m_afDiag[2] = fM22+fM13*fQ;
             m_afDiag[3] = fM33-fM13*fQ;
@@ -383,14 +398,15 @@ void Eigen::Tridiagonal4 (float** m_aafMat, float* m_afDiag,
     }
 }
 //---------------------------------------------------------------------------
-void Eigen::TridiagonalN (int iSize, float** m_aafMat,
-    float* m_afDiag, float* m_afSubd)
+template <typename DATA_TYPE>
+inline void EigenSolver<DATA_TYPE>::TridiagonalN (int iSize, DATA_TYPE** m_aafMat,
+    DATA_TYPE* m_afDiag, DATA_TYPE* m_afSubd)
 {
     int i0, i1, i2, i3;
 
     for (i0 = iSize-1, i3 = iSize-2; i0 >= 1; i0--, i3--)
     {
-        float fH = 0.0, fScale = 0.0;
+        DATA_TYPE fH = 0.0, fScale = 0.0;
 
         if ( i3 > 0 )
         {
@@ -402,21 +418,21 @@ void Eigen::TridiagonalN (int iSize, float** m_aafMat,
             }
             else
             {
-                float fInvScale = 1.0/fScale;
+                DATA_TYPE fInvScale = 1.0/fScale;
                 for (i2 = 0; i2 <= i3; i2++)
                 {
                     m_aafMat[i0][i2] *= fInvScale;
                     fH += m_aafMat[i0][i2]*m_aafMat[i0][i2];
                 }
-                float fF = m_aafMat[i0][i3];
-                float fG = Math::sqrt(fH);
+                DATA_TYPE fF = m_aafMat[i0][i3];
+                DATA_TYPE fG = Math::sqrt(fH);
                 if ( fF > 0.0 )
                     fG = -fG;
                 m_afSubd[i0] = fScale*fG;
                 fH -= fF*fG;
                 m_aafMat[i0][i3] = fF-fG;
                 fF = 0.0;
-                float fInvH = 1.0/fH;
+                DATA_TYPE fInvH = 1.0/fH;
                 for (i1 = 0; i1 <= i3; i1++)
                 {
                     m_aafMat[i1][i0] = m_aafMat[i0][i1]*fInvH;
@@ -428,7 +444,7 @@ void Eigen::TridiagonalN (int iSize, float** m_aafMat,
                     m_afSubd[i1] = fG*fInvH;
                     fF += m_afSubd[i1]*m_aafMat[i0][i1];
                 }
-                float fHalfFdivH = 0.5*fF*fInvH;
+                DATA_TYPE fHalfFdivH = 0.5*fF*fInvH;
                 for (i1 = 0; i1 <= i3; i1++)
                 {
                     fF = m_aafMat[i0][i1];
@@ -457,7 +473,7 @@ void Eigen::TridiagonalN (int iSize, float** m_aafMat,
         {
             for (i1 = 0; i1 <= i3; i1++)
             {
-                float fSum = 0;
+                DATA_TYPE fSum = 0;
                 for (i2 = 0; i2 <= i3; i2++)
                     fSum += m_aafMat[i0][i2]*m_aafMat[i2][i1];
                 for (i2 = 0; i2 <= i3; i2++)
@@ -470,14 +486,15 @@ void Eigen::TridiagonalN (int iSize, float** m_aafMat,
             m_aafMat[i1][i0] = m_aafMat[i0][i1] = 0;
     }
 
-    // re-ordering if Eigen::QLAlgorithm is used subsequently
+    // re-ordering if EigenSolver::QLAlgorithm is used subsequently
     for (i0 = 1, i3 = 0; i0 < iSize; i0++, i3++)
         m_afSubd[i3] = m_afSubd[i0];
     m_afSubd[iSize-1] = 0;
 }
 //---------------------------------------------------------------------------
-bool Eigen::QLAlgorithm (int iSize, float* m_afDiag, float* m_afSubd,
-    float** m_aafMat)
+template <typename DATA_TYPE>
+inline bool EigenSolver<DATA_TYPE>::QLAlgorithm (int iSize, DATA_TYPE* m_afDiag, DATA_TYPE* m_afSubd,
+    DATA_TYPE** m_aafMat)
 {
     const int iMaxIter = 32;
 
@@ -489,7 +506,7 @@ bool Eigen::QLAlgorithm (int iSize, float* m_afDiag, float* m_afSubd,
             int i2;
             for (i2 = i0; i2 <= iSize-2; i2++)
             {
-                float fTmp =
+                DATA_TYPE fTmp =
                     Math::abs(m_afDiag[i2])+ Math::abs(m_afDiag[i2+1]);
                 if ( Math::abs(m_afSubd[i2]) + fTmp == fTmp )
                     break;
@@ -497,17 +514,17 @@ bool Eigen::QLAlgorithm (int iSize, float* m_afDiag, float* m_afSubd,
             if ( i2 == i0 )
                 break;
 
-            float fG = (m_afDiag[i0+1]-m_afDiag[i0])/(2.0*m_afSubd[i0]);
-            float fR = Math::sqrt(fG*fG+1.0);
+            DATA_TYPE fG = (m_afDiag[i0+1]-m_afDiag[i0])/(2.0*m_afSubd[i0]);
+            DATA_TYPE fR = Math::sqrt(fG*fG+1.0);
             if ( fG < 0.0 )
                 fG = m_afDiag[i2]-m_afDiag[i0]+m_afSubd[i0]/(fG-fR);
             else
                 fG = m_afDiag[i2]-m_afDiag[i0]+m_afSubd[i0]/(fG+fR);
-            float fSin = 1.0, fCos = 1.0, fP = 0.0;
+            DATA_TYPE fSin = 1.0, fCos = 1.0, fP = 0.0;
             for (int i3 = i2-1; i3 >= i0; i3--)
             {
-                float fF = fSin*m_afSubd[i3];
-                float fB = fCos*m_afSubd[i3];
+                DATA_TYPE fF = fSin*m_afSubd[i3];
+                DATA_TYPE fB = fCos*m_afSubd[i3];
                 if ( Math::abs(fF) >= Math::abs(fG) )
                 {
                     fCos = fG/fF;
@@ -548,15 +565,16 @@ bool Eigen::QLAlgorithm (int iSize, float* m_afDiag, float* m_afSubd,
     return true;
 }
 //---------------------------------------------------------------------------
-void Eigen::DecreasingSort (int iSize, float* afEigval,
-    float** aafEigvec)
+template <typename DATA_TYPE>
+inline void EigenSolver<DATA_TYPE>::DecreasingSort (int iSize, DATA_TYPE* afEigval,
+    DATA_TYPE** aafEigvec)
 {
     // sort eigenvalues in decreasing order, e[0] >= ... >= e[iSize-1]
     for (int i0 = 0, i1; i0 <= iSize-2; i0++)
     {
         // locate maximum eigenvalue
         i1 = i0;
-        float fMax = afEigval[i1];
+        DATA_TYPE fMax = afEigval[i1];
         int i2;
         for (i2 = i0+1; i2 < iSize; i2++)
         {
@@ -576,7 +594,7 @@ void Eigen::DecreasingSort (int iSize, float* afEigval,
             // swap eigenvectors
             for (i2 = 0; i2 < iSize; i2++)
             {
-                float fTmp = aafEigvec[i2][i0];
+                DATA_TYPE fTmp = aafEigvec[i2][i0];
                 aafEigvec[i2][i0] = aafEigvec[i2][i1];
                 aafEigvec[i2][i1] = fTmp;
             }
@@ -584,15 +602,16 @@ void Eigen::DecreasingSort (int iSize, float* afEigval,
     }
 }
 //---------------------------------------------------------------------------
-void Eigen::IncreasingSort (int iSize, float* afEigval,
-    float** aafEigvec)
+template <typename DATA_TYPE>
+inline void EigenSolver<DATA_TYPE>::IncreasingSort (int iSize, DATA_TYPE* afEigval,
+    DATA_TYPE** aafEigvec)
 {
     // sort eigenvalues in increasing order, e[0] <= ... <= e[iSize-1]
     for (int i0 = 0, i1; i0 <= iSize-2; i0++)
     {
         // locate minimum eigenvalue
         i1 = i0;
-        float fMin = afEigval[i1];
+        DATA_TYPE fMin = afEigval[i1];
         int i2;
         for (i2 = i0+1; i2 < iSize; i2++)
         {
@@ -612,7 +631,7 @@ void Eigen::IncreasingSort (int iSize, float* afEigval,
             // swap eigenvectors
             for (i2 = 0; i2 < iSize; i2++)
             {
-                float fTmp = aafEigvec[i2][i0];
+                DATA_TYPE fTmp = aafEigvec[i2][i0];
                 aafEigvec[i2][i0] = aafEigvec[i2][i1];
                 aafEigvec[i2][i1] = fTmp;
             }
@@ -620,7 +639,8 @@ void Eigen::IncreasingSort (int iSize, float* afEigval,
     }
 }
 //---------------------------------------------------------------------------
-void Eigen::SetMatrix (float** aafMat)
+template <typename DATA_TYPE>
+inline void EigenSolver<DATA_TYPE>::SetMatrix (DATA_TYPE** aafMat)
 {
     for (int iRow = 0; iRow < m_iSize; iRow++)
     {
@@ -629,31 +649,36 @@ void Eigen::SetMatrix (float** aafMat)
     }
 }
 //---------------------------------------------------------------------------
-void Eigen::EigenStuff2 ()
+template <typename DATA_TYPE>
+inline void EigenSolver<DATA_TYPE>::EigenStuff2 ()
 {
     Tridiagonal2(m_aafMat,m_afDiag,m_afSubd);
     QLAlgorithm(m_iSize,m_afDiag,m_afSubd,m_aafMat);
 }
 //---------------------------------------------------------------------------
-void Eigen::EigenStuff3 ()
+template <typename DATA_TYPE>
+inline void EigenSolver<DATA_TYPE>::EigenStuff3 ()
 {
     Tridiagonal3(m_aafMat,m_afDiag,m_afSubd);
     QLAlgorithm(m_iSize,m_afDiag,m_afSubd,m_aafMat);
 }
 //---------------------------------------------------------------------------
-void Eigen::EigenStuff4 ()
+template <typename DATA_TYPE>
+inline void EigenSolver<DATA_TYPE>::EigenStuff4 ()
 {
     Tridiagonal4(m_aafMat,m_afDiag,m_afSubd);
     QLAlgorithm(m_iSize,m_afDiag,m_afSubd,m_aafMat);
 }
 //---------------------------------------------------------------------------
-void Eigen::EigenStuffN ()
+template <typename DATA_TYPE>
+inline void EigenSolver<DATA_TYPE>::EigenStuffN ()
 {
     TridiagonalN(m_iSize,m_aafMat,m_afDiag,m_afSubd);
     QLAlgorithm(m_iSize,m_afDiag,m_afSubd,m_aafMat);
 }
 //---------------------------------------------------------------------------
-void Eigen::EigenStuff ()
+template <typename DATA_TYPE>
+inline void EigenSolver<DATA_TYPE>::EigenStuff ()
 {
     switch ( m_iSize )
     {
@@ -673,35 +698,40 @@ void Eigen::EigenStuff ()
     QLAlgorithm(m_iSize,m_afDiag,m_afSubd,m_aafMat);
 }
 //---------------------------------------------------------------------------
-void Eigen::DecrSortEigenStuff2 ()
+template <typename DATA_TYPE>
+inline void EigenSolver<DATA_TYPE>::DecrSortEigenStuff2 ()
 {
     Tridiagonal2(m_aafMat,m_afDiag,m_afSubd);
     QLAlgorithm(m_iSize,m_afDiag,m_afSubd,m_aafMat);
     DecreasingSort(m_iSize,m_afDiag,m_aafMat);
 }
 //---------------------------------------------------------------------------
-void Eigen::DecrSortEigenStuff3 ()
+template <typename DATA_TYPE>
+inline void EigenSolver<DATA_TYPE>::DecrSortEigenStuff3 ()
 {
     Tridiagonal3(m_aafMat,m_afDiag,m_afSubd);
     QLAlgorithm(m_iSize,m_afDiag,m_afSubd,m_aafMat);
     DecreasingSort(m_iSize,m_afDiag,m_aafMat);
 }
 //---------------------------------------------------------------------------
-void Eigen::DecrSortEigenStuff4 ()
+template <typename DATA_TYPE>
+inline void EigenSolver<DATA_TYPE>::DecrSortEigenStuff4 ()
 {
     Tridiagonal4(m_aafMat,m_afDiag,m_afSubd);
     QLAlgorithm(m_iSize,m_afDiag,m_afSubd,m_aafMat);
     DecreasingSort(m_iSize,m_afDiag,m_aafMat);
 }
 //---------------------------------------------------------------------------
-void Eigen::DecrSortEigenStuffN ()
+template <typename DATA_TYPE>
+inline void EigenSolver<DATA_TYPE>::DecrSortEigenStuffN ()
 {
     TridiagonalN(m_iSize,m_aafMat,m_afDiag,m_afSubd);
     QLAlgorithm(m_iSize,m_afDiag,m_afSubd,m_aafMat);
     DecreasingSort(m_iSize,m_afDiag,m_aafMat);
 }
 //---------------------------------------------------------------------------
-void Eigen::DecrSortEigenStuff ()
+template <typename DATA_TYPE>
+inline void EigenSolver<DATA_TYPE>::DecrSortEigenStuff ()
 {
     switch ( m_iSize )
     {
@@ -722,35 +752,40 @@ void Eigen::DecrSortEigenStuff ()
     DecreasingSort(m_iSize,m_afDiag,m_aafMat);
 }
 //---------------------------------------------------------------------------
-void Eigen::IncrSortEigenStuff2 ()
+template <typename DATA_TYPE>
+inline void EigenSolver<DATA_TYPE>::IncrSortEigenStuff2 ()
 {
     Tridiagonal2(m_aafMat,m_afDiag,m_afSubd);
     QLAlgorithm(m_iSize,m_afDiag,m_afSubd,m_aafMat);
     IncreasingSort(m_iSize,m_afDiag,m_aafMat);
 }
 //---------------------------------------------------------------------------
-void Eigen::IncrSortEigenStuff3 ()
+template <typename DATA_TYPE>
+inline void EigenSolver<DATA_TYPE>::IncrSortEigenStuff3 ()
 {
     Tridiagonal3(m_aafMat,m_afDiag,m_afSubd);
     QLAlgorithm(m_iSize,m_afDiag,m_afSubd,m_aafMat);
     IncreasingSort(m_iSize,m_afDiag,m_aafMat);
 }
 //---------------------------------------------------------------------------
-void Eigen::IncrSortEigenStuff4 ()
+template <typename DATA_TYPE>
+inline void EigenSolver<DATA_TYPE>::IncrSortEigenStuff4 ()
 {
     Tridiagonal4(m_aafMat,m_afDiag,m_afSubd);
     QLAlgorithm(m_iSize,m_afDiag,m_afSubd,m_aafMat);
     IncreasingSort(m_iSize,m_afDiag,m_aafMat);
 }
 //---------------------------------------------------------------------------
-void Eigen::IncrSortEigenStuffN ()
+template <typename DATA_TYPE>
+inline void EigenSolver<DATA_TYPE>::IncrSortEigenStuffN ()
 {
     TridiagonalN(m_iSize,m_aafMat,m_afDiag,m_afSubd);
     QLAlgorithm(m_iSize,m_afDiag,m_afSubd,m_aafMat);
     IncreasingSort(m_iSize,m_afDiag,m_aafMat);
 }
 //---------------------------------------------------------------------------
-void Eigen::IncrSortEigenStuff ()
+template <typename DATA_TYPE>
+inline void EigenSolver<DATA_TYPE>::IncrSortEigenStuff ()
 {
     switch ( m_iSize )
     {
@@ -772,6 +807,8 @@ void Eigen::IncrSortEigenStuff ()
 }
 //---------------------------------------------------------------------------
 
+typedef EigenSolver<float> Eigen;
+
 };
 
 
@@ -0,0 +1,243 @@
+/***
+ * @file SymmetricEigen3.h
+ * @brief Closed form eigen decomposition of symmetric 3x3 matrices
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#ifndef _GMTL_SYMMETRIC_EIGEN3_H_
+#define _GMTL_SYMMETRIC_EIGEN3_H_
+
+#include <algorithm>
+#include <falcon/gmtl/Math.h>
+#include <falcon/gmtl/Matrix.h>
+#include <falcon/gmtl/MatrixOps.h>
+#include <falcon/gmtl/Vec.h>
+#include <falcon/gmtl/VecOps.h>
+
+/*
+ * Eigen.h solves an NxN system by Householder reduction and QL iteration, with a heap allocated
+ * matrix per solver. The covariance matrices of point fitting are all symmetric 3x3, where the
+ * eigenvalues are the roots of a cubic and come out in closed form:
+ *
+ *   A = q I + p B, with q = trace(A) / 3 and p chosen so that B has unit Frobenius norm / sqrt(6)
+ *   eigenvalues of B are 2 cos(phi + 2 pi k / 3), with phi = acos(det(B) / 2) / 3
+ *
+ * Only the root furthest from the others is used: its eigenvector is the longest cross product of two
+ * rows of B - beta I. The other two eigenvectors come from the 2x2 problem left in the plane normal to it,
+ * solved with a Jacobi rotation (D. Eberly, "A Robust Eigensolver for 3x3 Symmetric Matrices", Geometric
+ * Tools, with the rotation in place of his second root). Near equal eigenvalues, where the roots of the
+ * cubic are only good to about half their digits, the eigenvectors stay orthonormal and accurate, and
+ * the eigenvalues are taken from them at the end as Rayleigh quotients.
+ *
+ * The matrix is scaled by its largest element first, so the cubic neither overflows nor underflows.
+ */
+
+namespace gmtl
+{
+namespace helpers
+{
+   /** Two unit vectors that make a right handed orthonormal basis with unit vector w. */
+   template <typename DATA_TYPE>
+   inline void symEigenComplement( const Vec<DATA_TYPE, 3>& w, Vec<DATA_TYPE, 3>& u, Vec<DATA_TYPE, 3>& v )
+   {
+      if (Math::abs( w[0] ) > Math::abs( w[1] ))
+      {
+         DATA_TYPE inv_length = DATA_TYPE( 1 ) / Math::sqrt( w[0] * w[0] + w[2] * w[2] );
+         u.set( -w[2] * inv_length, DATA_TYPE( 0 ), w[0] * inv_length );
+      }
+      else
+      {
+         DATA_TYPE inv_length = DATA_TYPE( 1 ) / Math::sqrt( w[1] * w[1] + w[2] * w[2] );
+         u.set( DATA_TYPE( 0 ), w[2] * inv_length, -w[1] * inv_length );
+      }
+      cross( v, w, u );
+   }
+
+   /** Unit eigenvector for a simple eigenvalue of the symmetric matrix with upper triangle a, at unit scale.
+    *  The rows of A - value I span the plane normal to it, so it is the longest of their cross products.
+    */
+   template <typename DATA_TYPE>
+   inline void symEigenvector0( const DATA_TYPE a[6], DATA_TYPE value, Vec<DATA_TYPE, 3>& vector )
+   {
+      Vec<DATA_TYPE, 3> r0( a[0] - value, a[1], a[2] );
+      Vec<DATA_TYPE, 3> r1( a[1], a[3] - value, a[4] );
+      Vec<DATA_TYPE, 3> r2( a[2], a[4], a[5] - value );
+      Vec<DATA_TYPE, 3> r0xr1, r0xr2, r1xr2;
+      cross( r0xr1, r0, r1 );
+      cross( r0xr2, r0, r2 );
+      cross( r1xr2, r1, r2 );
+      DATA_TYPE d0 = dot( r0xr1, r0xr1 ), d1 = dot( r0xr2, r0xr2 ), d2 = dot( r1xr2, r1xr2 );
+      if (d0 >= d1 && d0 >= d2)
+      {
+         vector = r0xr1 * (DATA_TYPE( 1 ) / Math::sqrt( d0 ));
+      }
+      else if (d1 >= d2)
+      {
+         vector = r0xr2 * (DATA_TYPE( 1 ) / Math::sqrt( d1 ));
+      }
+      else
+      {
+         vector = r1xr2 * (DATA_TYPE( 1 ) / Math::sqrt( d2 ));
+      }
+   }
+
+   /** The other two unit eigenvectors, given one unit eigenvector of the symmetric matrix with upper
+    *  triangle a. They are the eigenvectors of the 2x2 matrix A is restricted to in the plane normal to
+    *  the first, found with one Jacobi rotation, which needs no eigenvalues and so loses nothing when
+    *  the two are close. (first, second, third) is right handed.
+    */
+   template <typename DATA_TYPE>
+   inline void symEigenvectors12( const DATA_TYPE a[6], const Vec<DATA_TYPE, 3>& first, Vec<DATA_TYPE, 3>& second, Vec<DATA_TYPE, 3>& third )
+   {
+      Vec<DATA_TYPE, 3> u, v;
+      symEigenComplement( first, u, v );
+      Vec<DATA_TYPE, 3> au( a[0] * u[0] + a[1] * u[1] + a[2] * u[2],
+                            a[1] * u[0] + a[3] * u[1] + a[4] * u[2],
+                            a[2] * u[0] + a[4] * u[1] + a[5] * u[2] );
+      Vec<DATA_TYPE, 3> av( a[0] * v[0] + a[1] * v[1] + a[2] * v[2],
+                            a[1] * v[0] + a[3] * v[1] + a[4] * v[2],
+                            a[2] * v[0] + a[4] * v[1] + a[5] * v[2] );
+      const DATA_TYPE m00 = dot( u, au ), m01 = dot( u, av ), m11 = dot( v, av );
+
+      // Rotation by the smaller angle that zeroes m01: t = tan(angle), picked so |t| <= 1
+      DATA_TYPE t = DATA_TYPE( 0 );
+      if (m01 != DATA_TYPE( 0 ))
+      {
+         const DATA_TYPE theta = (m11 - m00) / (DATA_TYPE( 2 ) * m01);
+         const DATA_TYPE abs_theta = Math::abs( theta );
+         t = abs_theta > DATA_TYPE( 1 )
+            ? DATA_TYPE( 1 ) / (abs_theta * (DATA_TYPE( 1 ) + Math::sqrt( DATA_TYPE( 1 ) + DATA_TYPE( 1 ) / (theta * theta) )))
+            : DATA_TYPE( 1 ) / (abs_theta + Math::sqrt( DATA_TYPE( 1 ) + theta * theta ));
+         if (theta < DATA_TYPE( 0 ))
+         {
+            t = -t;
+         }
+      }
+      const DATA_TYPE c = DATA_TYPE( 1 ) / Math::sqrt( DATA_TYPE( 1 ) + t * t );
+      const DATA_TYPE s = t * c;
+      second = u * c - v * s;
+      third = u * s + v * c;
+   }
+}
+
+   /** @ingroup Ops
+    * @name Symmetric Eigen Decomposition
+    * @{
+    */
+
+   /** Eigen decomposition of a symmetric 3x3 matrix, in closed form.
+    *  Only the upper triangle of the matrix is read.
+    *  @param values    set to the eigenvalues, smallest first
+    *  @param vectors   set to the unit eigenvectors, as columns in the same order as the values. They
+    *                   form a right handed orthonormal basis.
+    *  @param m         the symmetric matrix
+    *  @post m == vectors * diag(values) * transpose(vectors), to rounding error
+    */
+   template <typename DATA_TYPE>
+   inline void eigenSymmetric( Vec<DATA_TYPE, 3>& values, Matrix<DATA_TYPE, 3, 3>& vectors, const Matrix<DATA_TYPE, 3, 3>& m )
+   {
+      // Upper triangle: 00 01 02 11 12 22
+      DATA_TYPE a[6] = { m( 0, 0 ), m( 0, 1 ), m( 0, 2 ), m( 1, 1 ), m( 1, 2 ), m( 2, 2 ) };
+      DATA_TYPE max_abs = Math::abs( a[0] );
+      for (unsigned i = 1; i < 6; ++i)
+      {
+         max_abs = Math::Max( max_abs, Math::abs( a[i] ) );
+      }
+      identity( vectors );
+      if (max_abs == DATA_TYPE( 0 ))
+      {
+         values.set( DATA_TYPE( 0 ), DATA_TYPE( 0 ), DATA_TYPE( 0 ) );
+         return;
+      }
+      const DATA_TYPE inv_max = DATA_TYPE( 1 ) / max_abs;
+      for (unsigned i = 0; i < 6; ++i)
+      {
+         a[i] *= inv_max;
+      }
+
+      const DATA_TYPE off_diagonal = a[1] * a[1] + a[2] * a[2] + a[4] * a[4];
+      if (off_diagonal == DATA_TYPE( 0 ))
+      {
+         // Already diagonal: the eigenvectors are the axes, sorted with their values
+         values.set( a[0], a[3], a[5] );
+         for (unsigned i = 0; i < 2; ++i)
+         {
+            for (unsigned j = 2; j > i; --j)
+            {
+               if (values[j] < values[j - 1])
+               {
+                  std::swap( values[j], values[j - 1] );
+                  for (unsigned row = 0; row < 3; ++row)
+                  {
+                     std::swap( vectors( row, j ), vectors( row, j - 1 ) );
+                  }
+               }
+            }
+         }
+         values *= max_abs;
+         return;
+      }
+
+      // B = (A - q I) / p, formed before the determinant so that a small p can't underflow p^3
+      const DATA_TYPE q = (a[0] + a[3] + a[5]) / DATA_TYPE( 3 );
+      const DATA_TYPE d00 = a[0] - q, d11 = a[3] - q, d22 = a[5] - q;
+      const DATA_TYPE p = Math::sqrt( (d00 * d00 + d11 * d11 + d22 * d22 + DATA_TYPE( 2 ) * off_diagonal) / DATA_TYPE( 6 ) );
+      const DATA_TYPE inv_p = DATA_TYPE( 1 ) / p;
+      const DATA_TYPE b00 = d00 * inv_p, b01 = a[1] * inv_p, b02 = a[2] * inv_p;
+      const DATA_TYPE b11 = d11 * inv_p, b12 = a[4] * inv_p, b22 = d22 * inv_p;
+      DATA_TYPE half_det = (b00 * (b11 * b22 - b12 * b12) - b01 * (b01 * b22 - b12 * b02) + b02 * (b01 * b12 - b11 * b02)) / DATA_TYPE( 2 );
+      half_det = Math::clamp( half_det, DATA_TYPE( -1 ), DATA_TYPE( 1 ) );
+
+      // Roots 2 cos(phi + 2 pi / 3) <= 2 cos(phi + 4 pi / 3) <= 2 cos(phi), with phi in [0, pi / 3]. The
+      // largest is furthest from the middle one if det(B) >= 0, else the smallest is. B has the
+      // eigenvectors of A at unit scale, so they are found from B: the rows of A - lambda I can be
+      // small enough for their cross products to underflow.
+      const DATA_TYPE phi = Math::aCos( half_det ) / DATA_TYPE( 3 );
+      const DATA_TYPE c = Math::cos( phi );
+      const DATA_TYPE separated = half_det >= DATA_TYPE( 0 )
+         ? c + c
+         : -(c + Math::sin( phi ) * DATA_TYPE( 1.73205080756887729 ));
+      const DATA_TYPE b[6] = { b00, b01, b02, b11, b12, b22 };
+
+      Vec<DATA_TYPE, 3> v[3];
+      helpers::symEigenvector0( b, separated, v[2] );
+      helpers::symEigenvectors12( b, v[2], v[0], v[1] );
+
+      // Eigenvalues as Rayleigh quotients, in order. Swapping two columns and negating one keeps the basis
+      // right handed.
+      for (unsigned i = 0; i < 3; ++i)
+      {
+         values[i] = v[i][0] * (a[0] * v[i][0] + a[1] * v[i][1] + a[2] * v[i][2])
+                   + v[i][1] * (a[1] * v[i][0] + a[3] * v[i][1] + a[4] * v[i][2])
+                   + v[i][2] * (a[2] * v[i][0] + a[4] * v[i][1] + a[5] * v[i][2]);
+      }
+      for (unsigned i = 0; i < 2; ++i)
+      {
+         for (unsigned j = 2; j > i; --j)
+         {
+            if (values[j] < values[j - 1])
+            {
+               std::swap( values[j], values[j - 1] );
+               std::swap( v[j], v[j - 1] );
+               v[j] = -v[j];
+            }
+         }
+      }
+      for (unsigned row = 0; row < 3; ++row)
+      {
+         vectors( row, 0 ) = v[0][row];
+         vectors( row, 1 ) = v[1][row];
+         vectors( row, 2 ) = v[2][row];
+      }
+      values *= max_abs;
+   }
+   /** @} */
+
+} // namespace gmtl
+
+#endif
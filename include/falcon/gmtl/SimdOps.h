@@ -0,0 +1,479 @@
+/***
+ * @file SimdOps.h
+ * @brief SSE/AVX/NEON overloads of the gmtl 3x3 matrix operations
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#ifndef _GMTL_SIMD_OPS_H_
+#define _GMTL_SIMD_OPS_H_
+
+#include <falcon/gmtl/Config.h>
+#include <falcon/gmtl/Matrix.h>
+#include <falcon/gmtl/MatrixOps.h>
+#include <falcon/gmtl/Vec.h>
+#include <falcon/gmtl/VecOps.h>
+#include <falcon/gmtl/Xforms.h>
+
+/*
+ * The kinematics spend their matrix time on 3-vectors and 3x3 matrices of doubles, which the generic
+ * templates handle an element at a time (and invert with a full pivoting Gauss-Jordan). The overloads
+ * below take over for Matrix<T,3,3> products and inverses with T float or double. Being non-templates, they are
+ * picked over the generic templates wherever both match, so callers don't change. Calling a template
+ * with its arguments spelled out (mult<double,3,3,3>(...)) still reaches the generic version.
+ *
+ * Matrices are column major, so every column is three contiguous values and the products are sums of
+ * scaled columns. These add in the same order as the generic loops, so results match them bit for bit
+ * unless the compiler contracts the multiplies and adds into FMAs, and apart from the sign of zero
+ * results. The inverse is the cofactor form, which rounds differently from Gauss-Jordan: expect
+ * agreement to within a few ulps times the condition number.
+ *
+ * dot() and cross() keep the generic versions. A 3-vector is too short for the shuffles and horizontal
+ * add to pay for themselves, and the compiler already does as well with the unrolled scalar code.
+ *
+ * Define GMTL_NO_SIMD to compile the generic versions only.
+ */
+
+#if !defined(GMTL_NO_SIMD)
+#  if defined(__AVX__)
+#     define GMTL_SIMD_AVX 1
+#     define GMTL_SIMD_SSE2 1
+#  elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#     define GMTL_SIMD_SSE2 1
+#  elif defined(__ARM_NEON) && defined(__aarch64__)
+#     define GMTL_SIMD_NEON 1
+#  endif
+#endif
+
+#if defined(GMTL_SIMD_SSE2) || defined(GMTL_SIMD_NEON)
+#define GMTL_SIMD 1
+
+#if defined(GMTL_SIMD_AVX)
+#include <immintrin.h>
+#elif defined(GMTL_SIMD_SSE2)
+#include <emmintrin.h>
+#elif defined(GMTL_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace gmtl
+{
+namespace simd
+{
+   /** A 3-vector held in registers, x y z in order. Specialized for float and double.
+    *  Loads and stores touch exactly three elements, so columns can be read straight out of a Matrix.
+    */
+   template <typename DATA_TYPE>
+   struct Packed3;
+
+#if defined(GMTL_SIMD_AVX)
+   template <>
+   struct Packed3<double>
+   {
+      __m256d v;
+
+      static Packed3 load( const double* p )
+      {
+         Packed3 r;
+         r.v = _mm256_insertf128_pd( _mm256_castpd128_pd256( _mm_loadu_pd( p ) ), _mm_load_sd( p + 2 ), 1 );
+         return r;
+      }
+      void store( double* p ) const
+      {
+         _mm_storeu_pd( p, _mm256_castpd256_pd128( v ) );
+         _mm_store_sd( p + 2, _mm256_extractf128_pd( v, 1 ) );
+      }
+      friend Packed3 operator+( const Packed3& a, const Packed3& b ) { Packed3 r; r.v = _mm256_add_pd( a.v, b.v ); return r; }
+      friend Packed3 operator-( const Packed3& a, const Packed3& b ) { Packed3 r; r.v = _mm256_sub_pd( a.v, b.v ); return r; }
+      friend Packed3 operator*( const Packed3& a, const Packed3& b ) { Packed3 r; r.v = _mm256_mul_pd( a.v, b.v ); return r; }
+      friend Packed3 operator*( const Packed3& a, double s ) { Packed3 r; r.v = _mm256_mul_pd( a.v, _mm256_set1_pd( s ) ); return r; }
+      /** y z x */
+      Packed3 rotate() const
+      {
+         Packed3 r;
+#if defined(__AVX2__)
+         r.v = _mm256_permute4x64_pd( v, _MM_SHUFFLE(3, 0, 2, 1) );
+#else
+         __m128d xy = _mm256_castpd256_pd128( v );
+         __m128d yz = _mm_shuffle_pd( xy, _mm256_extractf128_pd( v, 1 ), 1 );
+         r.v = _mm256_insertf128_pd( _mm256_castpd128_pd256( yz ), xy, 1 );
+#endif
+         return r;
+      }
+      /** (x + y) + z */
+      double sum() const
+      {
+         __m128d xy = _mm256_castpd256_pd128( v );
+         return _mm_cvtsd_f64( _mm_add_sd( xy, _mm_unpackhi_pd( xy, xy ) ) ) + _mm_cvtsd_f64( _mm256_extractf128_pd( v, 1 ) );
+      }
+   };
+#elif defined(GMTL_SIMD_SSE2)
+   template <>
+   struct Packed3<double>
+   {
+      __m128d xy;
+      double z;
+
+      static Packed3 load( const double* p )
+      {
+         Packed3 r;
+         r.xy = _mm_loadu_pd( p );
+         r.z = p[2];
+         return r;
+      }
+      void store( double* p ) const
+      {
+         _mm_storeu_pd( p, xy );
+         p[2] = z;
+      }
+      friend Packed3 operator+( const Packed3& a, const Packed3& b ) { Packed3 r; r.xy = _mm_add_pd( a.xy, b.xy ); r.z = a.z + b.z; return r; }
+      friend Packed3 operator-( const Packed3& a, const Packed3& b ) { Packed3 r; r.xy = _mm_sub_pd( a.xy, b.xy ); r.z = a.z - b.z; return r; }
+      friend Packed3 operator*( const Packed3& a, const Packed3& b ) { Packed3 r; r.xy = _mm_mul_pd( a.xy, b.xy ); r.z = a.z * b.z; return r; }
+      friend Packed3 operator*( const Packed3& a, double s ) { Packed3 r; r.xy = _mm_mul_pd( a.xy, _mm_set1_pd( s ) ); r.z = a.z * s; return r; }
+      /** y z x */
+      Packed3 rotate() const
+      {
+         Packed3 r;
+         r.xy = _mm_shuffle_pd( xy, _mm_set_sd( z ), 1 );
+         r.z = _mm_cvtsd_f64( xy );
+         return r;
+      }
+      /** (x + y) + z */
+      double sum() const
+      {
+         return _mm_cvtsd_f64( _mm_add_sd( xy, _mm_unpackhi_pd( xy, xy ) ) ) + z;
+      }
+   };
+#elif defined(GMTL_SIMD_NEON)
+   template <>
+   struct Packed3<double>
+   {
+      float64x2_t xy;
+      double z;
+
+      static Packed3 load( const double* p )
+      {
+         Packed3 r;
+         r.xy = vld1q_f64( p );
+         r.z = p[2];
+         return r;
+      }
+      void store( double* p ) const
+      {
+         vst1q_f64( p, xy );
+         p[2] = z;
+      }
+      friend Packed3 operator+( const Packed3& a, const Packed3& b ) { Packed3 r; r.xy = vaddq_f64( a.xy, b.xy ); r.z = a.z + b.z; return r; }
+      friend Packed3 operator-( const Packed3& a, const Packed3& b ) { Packed3 r; r.xy = vsubq_f64( a.xy, b.xy ); r.z = a.z - b.z; return r; }
+      friend Packed3 operator*( const Packed3& a, const Packed3& b ) { Packed3 r; r.xy = vmulq_f64( a.xy, b.xy ); r.z = a.z * b.z; return r; }
+      friend Packed3 operator*( const Packed3& a, double s ) { Packed3 r; r.xy = vmulq_n_f64( a.xy, s ); r.z = a.z * s; return r; }
+      /** y z x */
+      Packed3 rotate() const
+      {
+         Packed3 r;
+         r.xy = vextq_f64( xy, vdupq_n_f64( z ), 1 );
+         r.z = vgetq_lane_f64( xy, 0 );
+         return r;
+      }
+      /** (x + y) + z */
+      double sum() const
+      {
+         return ( vgetq_lane_f64( xy, 0 ) + vgetq_lane_f64( xy, 1 ) ) + z;
+      }
+   };
+#endif
+
+#if defined(GMTL_SIMD_SSE2)
+   template <>
+   struct Packed3<float>
+   {
+      __m128 v;
+
+      static Packed3 load( const float* p )
+      {
+         Packed3 r;
+         r.v = _mm_movelh_ps( _mm_loadl_pi( _mm_setzero_ps(), (const __m64*)p ), _mm_load_ss( p + 2 ) );
+         return r;
+      }
+      void store( float* p ) const
+      {
+         _mm_storel_pi( (__m64*)p, v );
+         _mm_store_ss( p + 2, _mm_movehl_ps( v, v ) );
+      }
+      friend Packed3 operator+( const Packed3& a, const Packed3& b ) { Packed3 r; r.v = _mm_add_ps( a.v, b.v ); return r; }
+      friend Packed3 operator-( const Packed3& a, const Packed3& b ) { Packed3 r; r.v = _mm_sub_ps( a.v, b.v ); return r; }
+      friend Packed3 operator*( const Packed3& a, const Packed3& b ) { Packed3 r; r.v = _mm_mul_ps( a.v, b.v ); return r; }
+      friend Packed3 operator*( const Packed3& a, float s ) { Packed3 r; r.v = _mm_mul_ps( a.v, _mm_set1_ps( s ) ); return r; }
+      /** y z x */
+      Packed3 rotate() const
+      {
+         Packed3 r;
+         r.v = _mm_shuffle_ps( v, v, _MM_SHUFFLE(3, 0, 2, 1) );
+         return r;
+      }
+      /** (x + y) + z */
+      float sum() const
+      {
+         __m128 xy = _mm_add_ss( v, _mm_shuffle_ps( v, v, _MM_SHUFFLE(1, 1, 1, 1) ) );
+         return _mm_cvtss_f32( _mm_add_ss( xy, _mm_movehl_ps( v, v ) ) );
+      }
+   };
+#elif defined(GMTL_SIMD_NEON)
+   template <>
+   struct Packed3<float>
+   {
+      float32x4_t v;
+
+      static Packed3 load( const float* p )
+      {
+         Packed3 r;
+         r.v = vcombine_f32( vld1_f32( p ), vld1_lane_f32( p + 2, vdup_n_f32( 0.0f ), 0 ) );
+         return r;
+      }
+      void store( float* p ) const
+      {
+         vst1_f32( p, vget_low_f32( v ) );
+         vst1q_lane_f32( p + 2, v, 2 );
+      }
+      friend Packed3 operator+( const Packed3& a, const Packed3& b ) { Packed3 r; r.v = vaddq_f32( a.v, b.v ); return r; }
+      friend Packed3 operator-( const Packed3& a, const Packed3& b ) { Packed3 r; r.v = vsubq_f32( a.v, b.v ); return r; }
+      friend Packed3 operator*( const Packed3& a, const Packed3& b ) { Packed3 r; r.v = vmulq_f32( a.v, b.v ); return r; }
+      friend Packed3 operator*( const Packed3& a, float s ) { Packed3 r; r.v = vmulq_n_f32( a.v, s ); return r; }
+      /** y z x */
+      Packed3 rotate() const
+      {
+         Packed3 r;
+         r.v = vsetq_lane_f32( vgetq_lane_f32( v, 0 ), vextq_f32( v, v, 1 ), 2 );
+         return r;
+      }
+      /** (x + y) + z */
+      float sum() const
+      {
+         return ( vgetq_lane_f32( v, 0 ) + vgetq_lane_f32( v, 1 ) ) + vgetq_lane_f32( v, 2 );
+      }
+   };
+#endif
+
+   /** result = matrix * vector, for column major 3x3 matrix data. result may alias vector. */
+   template <typename DATA_TYPE>
+   inline void xform33( DATA_TYPE* result, const DATA_TYPE* matrix, const DATA_TYPE* vector )
+   {
+      typedef Packed3<DATA_TYPE> P;
+      P r = P::load( matrix ) * vector[0];
+      r = r + P::load( matrix + 3 ) * vector[1];
+      r = r + P::load( matrix + 6 ) * vector[2];
+      r.store( result );
+   }
+
+   /** result = lhs * rhs, for column major 3x3 matrix data. result may alias either operand. */
+   template <typename DATA_TYPE>
+   inline void mult33( DATA_TYPE* result, const DATA_TYPE* lhs, const DATA_TYPE* rhs )
+   {
+      typedef Packed3<DATA_TYPE> P;
+      const P a0 = P::load( lhs ), a1 = P::load( lhs + 3 ), a2 = P::load( lhs + 6 );
+      const P c0 = a0 * rhs[0] + a1 * rhs[1] + a2 * rhs[2];
+      const P c1 = a0 * rhs[3] + a1 * rhs[4] + a2 * rhs[5];
+      const P c2 = a0 * rhs[6] + a1 * rhs[7] + a2 * rhs[8];
+      c0.store( result );
+      c1.store( result + 3 );
+      c2.store( result + 6 );
+   }
+
+   /** v1 x v2 */
+   template <typename DATA_TYPE>
+   inline Packed3<DATA_TYPE> cross( const Packed3<DATA_TYPE>& v1, const Packed3<DATA_TYPE>& v2 )
+   {
+      // Lane i of t is v1[i]*v2[i+1] - v1[i+1]*v2[i], which is lane i-1 of the cross product
+      return ( v1 * v2.rotate() - v1.rotate() * v2 ).rotate();
+   }
+
+   /** Inverts column major 3x3 matrix data by cofactors.
+    *  The singularity test is relative to the scale of the matrix. |det| is at most the product of
+    *  the column lengths, and the matrix is taken as singular when it is within eps of that, so
+    *  scaling a matrix doesn't change whether it inverts.
+    *  @return false, leaving result untouched, if |det| <= eps * |c0| * |c1| * |c2|
+    */
+   template <typename DATA_TYPE>
+   inline bool invert33( DATA_TYPE* result, const DATA_TYPE* src, DATA_TYPE eps )
+   {
+      typedef Packed3<DATA_TYPE> P;
+      const P c0 = P::load( src ), c1 = P::load( src + 3 ), c2 = P::load( src + 6 );
+      // The rows of the inverse are the cross products of column pairs over the determinant
+      const P r0 = cross( c1, c2 ), r1 = cross( c2, c0 ), r2 = cross( c0, c1 );
+      const DATA_TYPE det = ( c0 * r0 ).sum();
+      const DATA_TYPE bound = Math::sqrt( ( c0 * c0 ).sum() ) * Math::sqrt( ( c1 * c1 ).sum() ) * Math::sqrt( ( c2 * c2 ).sum() );
+      if (!(Math::abs( det ) > eps * bound))
+         return false;
+      const DATA_TYPE inv_det = DATA_TYPE(1) / det;
+      DATA_TYPE rows[9];
+      ( r0 * inv_det ).store( rows );
+      ( r1 * inv_det ).store( rows + 3 );
+      ( r2 * inv_det ).store( rows + 6 );
+      for (unsigned c = 0; c < 3; ++c)
+         for (unsigned r = 0; r < 3; ++r)
+            result[c * 3 + r] = rows[r * 3 + c];
+      return true;
+   }
+} // namespace simd
+
+/** @ingroup Ops
+ * @name SIMD 3x3 matrix overloads
+ * @{
+ */
+
+   /** matrix multiply, 3x3 float. @see mult() */
+   inline Matrix<float, 3, 3>& mult( Matrix<float, 3, 3>& result, const Matrix<float, 3, 3>& lhs, const Matrix<float, 3, 3>& rhs )
+   {
+      const int state = combineMatrixStates( lhs.mState, rhs.mState );
+      simd::mult33( result.mData, lhs.mData, rhs.mData );
+      result.mState = state;
+      return result;
+   }
+
+   /** matrix multiply, 3x3 double. @see mult() */
+   inline Matrix<double, 3, 3>& mult( Matrix<double, 3, 3>& result, const Matrix<double, 3, 3>& lhs, const Matrix<double, 3, 3>& rhs )
+   {
+      const int state = combineMatrixStates( lhs.mState, rhs.mState );
+      simd::mult33( result.mData, lhs.mData, rhs.mData );
+      result.mState = state;
+      return result;
+   }
+
+   /** matrix * matrix, 3x3 float. @see operator*() */
+   inline Matrix<float, 3, 3> operator*( const Matrix<float, 3, 3>& lhs, const Matrix<float, 3, 3>& rhs )
+   {
+      Matrix<float, 3, 3> temporary;
+      return mult( temporary, lhs, rhs );
+   }
+
+   /** matrix * matrix, 3x3 double. @see operator*() */
+   inline Matrix<double, 3, 3> operator*( const Matrix<double, 3, 3>& lhs, const Matrix<double, 3, 3>& rhs )
+   {
+      Matrix<double, 3, 3> temporary;
+      return mult( temporary, lhs, rhs );
+   }
+
+   /** matrix postmult (operator*=), 3x3 float. */
+   inline Matrix<float, 3, 3>& operator*=( Matrix<float, 3, 3>& result, const Matrix<float, 3, 3>& operand )
+   {
+      return mult( result, result, operand );
+   }
+
+   /** matrix postmult (operator*=), 3x3 double. */
+   inline Matrix<double, 3, 3>& operator*=( Matrix<double, 3, 3>& result, const Matrix<double, 3, 3>& operand )
+   {
+      return mult( result, result, operand );
+   }
+
+   /** xform a vector by a matrix, 3x3 float. @see xform() */
+   inline Vec<float, 3>& xform( Vec<float, 3>& result, const Matrix<float, 3, 3>& matrix, const Vec<float, 3>& vector )
+   {
+      simd::xform33( result.getData(), matrix.mData, vector.getData() );
+      return result;
+   }
+
+   /** xform a vector by a matrix, 3x3 double. @see xform() */
+   inline Vec<double, 3>& xform( Vec<double, 3>& result, const Matrix<double, 3, 3>& matrix, const Vec<double, 3>& vector )
+   {
+      simd::xform33( result.getData(), matrix.mData, vector.getData() );
+      return result;
+   }
+
+   /** matrix * vector xform, 3x3 float. @see operator*() */
+   inline Vec<float, 3> operator*( const Matrix<float, 3, 3>& matrix, const Vec<float, 3>& vector )
+   {
+      Vec<float, 3> temporary;
+      return xform( temporary, matrix, vector );
+   }
+
+   /** matrix * vector xform, 3x3 double. @see operator*() */
+   inline Vec<double, 3> operator*( const Matrix<double, 3, 3>& matrix, const Vec<double, 3>& vector )
+   {
+      Vec<double, 3> temporary;
+      return xform( temporary, matrix, vector );
+   }
+
+   /** full matrix inversion by cofactors, 3x3 float.
+    *  Sets the error bit and leaves result as it was if the matrix is singular. @see invertFull()
+    */
+   inline Matrix<float, 3, 3>& invertFull( Matrix<float, 3, 3>& result, const Matrix<float, 3, 3>& src )
+   {
+      const int state = src.mState;
+      if (!simd::invert33( result.mData, src.mData, 1e-6f ))
+      {
+         result.setError();
+         return result;
+      }
+      result.mState = state;
+      return result;
+   }
+
+   /** full matrix inversion by cofactors, 3x3 double.
+    *  Sets the error bit and leaves result as it was if the matrix is singular. @see invertFull()
+    */
+   inline Matrix<double, 3, 3>& invertFull( Matrix<double, 3, 3>& result, const Matrix<double, 3, 3>& src )
+   {
+      const int state = src.mState;
+      if (!simd::invert33( result.mData, src.mData, 1e-12 ))
+      {
+         result.setError();
+         return result;
+      }
+      result.mState = state;
+      return result;
+   }
+
+   /** smart matrix inversion, 3x3 float. Full inversions use invertFull(). @see invert() */
+   inline Matrix<float, 3, 3>& invert( Matrix<float, 3, 3>& result, const Matrix<float, 3, 3>& src )
+   {
+      typedef Matrix<float, 3, 3> M;
+      if (src.mState == M::IDENTITY)
+         return result = src;
+      else if (src.mState == M::TRANS)
+         return invertTrans( result, src );
+      else if (src.mState == M::ORTHOGONAL)
+         return invertOrthogonal( result, src );
+      else if (src.mState == M::AFFINE || src.mState == (M::AFFINE | M::NON_UNISCALE))
+         return invertAffine( result, src );
+      else
+         return invertFull( result, src );
+   }
+
+   /** smart matrix inversion, 3x3 double. Full inversions use invertFull(). @see invert() */
+   inline Matrix<double, 3, 3>& invert( Matrix<double, 3, 3>& result, const Matrix<double, 3, 3>& src )
+   {
+      typedef Matrix<double, 3, 3> M;
+      if (src.mState == M::IDENTITY)
+         return result = src;
+      else if (src.mState == M::TRANS)
+         return invertTrans( result, src );
+      else if (src.mState == M::ORTHOGONAL)
+         return invertOrthogonal( result, src );
+      else if (src.mState == M::AFFINE || src.mState == (M::AFFINE | M::NON_UNISCALE))
+         return invertAffine( result, src );
+      else
+         return invertFull( result, src );
+   }
+
+   /** smart matrix inversion in place, 3x3 float. @see invert() */
+   inline Matrix<float, 3, 3>& invert( Matrix<float, 3, 3>& result )
+   {
+      return invert( result, result );
+   }
+
+   /** smart matrix inversion in place, 3x3 double. @see invert() */
+   inline Matrix<double, 3, 3>& invert( Matrix<double, 3, 3>& result )
+   {
+      return invert( result, result );
+   }
+
+/** @} */
+} // namespace gmtl
+
+#endif // GMTL_SIMD_SSE2 || GMTL_SIMD_NEON
+
+#endif
@@ -130,6 +130,24 @@ struct AssignArrayUnrolled<0,T>
    { lVec[0] = rVec[0]; }
 };
 
+// Template programs for evaluating a vector expression into an array, unrolled
+template<int ELT, typename T, typename EXPR>
+struct EvalVecExprUnrolled
+{
+   static void func(T* result, const EXPR& expr)
+   {
+      EvalVecExprUnrolled<ELT-1,T,EXPR>::func(result, expr);
+      result[ELT] = expr[ELT];
+   }
+};
+
+template<typename T, typename EXPR>
+struct EvalVecExprUnrolled<0,T,EXPR>
+{
+   static void func(T* result, const EXPR& expr)
+   { result[0] = expr[0]; }
+};
+
 }  // namespace meta
 }  // namespace gmtl
 #endif /* ! GMTL_NO_METAPROG */
@@ -175,8 +175,7 @@ public:
 #ifdef GMTL_COUNT_CONSTRUCT_CALLS
       gmtl::helpers::VecCtrCounterInstance()->inc();
 #endif
-      for(unsigned i=0;i<SIZE;++i)
-      {  mData[i] = rVec[i]; }
+      gmtl::meta::EvalVecExprUnrolled<SIZE-1, DATA_TYPE, VecBase<DATA_TYPE,SIZE,REP2> >::func(mData, rVec);
    }
 #endif
 
@@ -290,12 +289,11 @@ public:
    template<typename REP2>
    inline VecType& operator=(const VecBase<DATA_TYPE,SIZE,REP2>& rhs)
    {
-      for(unsigned i=0;i<SIZE;++i)
-      {
-         mData[i] = rhs[i];
-      }
-
-      //gmtl::meta::AssignVecUnrolled<SIZE-1, VecBase<DATA_TYPE,SIZE> >::func(*this, rVec);
+      // Evaluate every element before storing any. The expression may read this vector, and
+      // without the copy each store could change the operands the compiler has to reload.
+      DATA_TYPE result[SIZE];
+      gmtl::meta::EvalVecExprUnrolled<SIZE-1, DATA_TYPE, VecBase<DATA_TYPE,SIZE,REP2> >::func(result, rhs);
+      gmtl::meta::AssignArrayUnrolled<SIZE-1, DATA_TYPE>::func(mData, result);
       return *this;
    }
 #endif
@@ -51,6 +51,7 @@
 #include <falcon/gmtl/LineSegOps.h>
 #include <falcon/gmtl/Math.h>
 #include <falcon/gmtl/Matrix.h>
+#include <falcon/gmtl/MatrixExprMeta.h>
 #include <falcon/gmtl/MatrixOps.h>
 #include <falcon/gmtl/Output.h>
 #include <falcon/gmtl/Plane.h>
@@ -59,6 +60,7 @@
 #include <falcon/gmtl/Quat.h>
 #include <falcon/gmtl/QuatOps.h>
 #include <falcon/gmtl/Ray.h>
+#include <falcon/gmtl/SimdOps.h>
 #include <falcon/gmtl/Sphere.h>
 #include <falcon/gmtl/SphereOps.h>
 #include <falcon/gmtl/Tri.h>
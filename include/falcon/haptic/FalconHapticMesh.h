@@ -0,0 +1,175 @@
+/***
+ * @file FalconHapticMesh.h
+ * @brief God-object renderer for triangle mesh scenes
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#ifndef FALCONHAPTICMESH_H
+#define FALCONHAPTICMESH_H
+
+#include <array>
+#include <memory>
+
+#include "falcon/core/FalconHapticRenderer.h"
+#include "falcon/core/FalconTripleBuffer.h"
+#include "falcon/haptic/FalconMeshBVH.h"
+#include "falcon/gmtl/Plane.h"
+#include "falcon/gmtl/Point.h"
+
+namespace libnifalcon
+{
+/**
+ * @class FalconHapticMesh
+ * @ingroup HapticClasses
+ *
+ * Renders a triangle mesh with a god-object (proxy) constraint solver. The proxy follows the end
+ * effector through free space, but can't pass through the front of a triangle. Once the end effector
+ * is inside, the proxy slides along the surface to the point closest to it, held there by up to three
+ * constraint planes (face, edge or corner contact), and a spring between the two pushes the end
+ * effector back out. Unlike penalty forces, this renders thin shells and sharp features without
+ * pushing through them.
+ *
+ * Every loop moves the proxy towards the end effector along a path checked against the mesh's
+ * FalconMeshBVH, so a loop costs a handful of segment queries whatever the size of the mesh.
+ *
+ * Meshes are built on the application thread (in parallel, see FalconMeshBVH::build), then handed over
+ * with setMesh(). The renderer picks up the newest mesh at the start of a loop, without locking. The
+ * previous mesh is released on the application thread the next time a mesh is set, never by the I/O
+ * thread.
+ *
+ * @code
+ * std::shared_ptr<FalconHapticMesh> renderer = std::make_shared<FalconHapticMesh>();
+ * std::shared_ptr<FalconMeshBVH> mesh = std::make_shared<FalconMeshBVH>();
+ * mesh->build(vertices, indices);
+ * renderer->setMesh(mesh);
+ * device.setHapticRenderer(renderer);
+ * @endcode
+ *
+ * The end effector has to approach triangles from the front to touch them. If it is already inside the
+ * mesh when rendering starts, the proxy follows it until it comes back out.
+ *
+ * Damping acts only in contact, along the spring, and never pulls the end effector into the surface.
+ * It uses FalconDevice::getVelocity(), so a velocity estimator should be set when using it.
+ */
+	class FalconHapticMesh : public FalconHapticRenderer
+	{
+	public:
+		static const unsigned int MAX_CONSTRAINTS = 3; /**< Most constraint planes the proxy can be held by */
+		static const unsigned int MAX_ITERATIONS = 8; /**< Most segment queries run per loop */
+
+		/**
+		 * Constructor. Renders nothing until a mesh is set.
+		 */
+		FalconHapticMesh();
+
+		/**
+		 * Destructor
+		 */
+		virtual ~FalconHapticMesh() {}
+
+		/**
+		 * Hands a new mesh to the renderer. Only one thread may set meshes, and the mesh must not change
+		 * after being set.
+		 *
+		 * @param mesh Built mesh, or nullptr to render nothing
+		 */
+		void setMesh(std::shared_ptr<const FalconMeshBVH> mesh);
+
+		/**
+		 * Sets the stiffness of the spring between the proxy and the end effector. Set before rendering starts.
+		 *
+		 * @param stiffness Stiffness, in N/m
+		 */
+		void setStiffness(double stiffness) { m_stiffness = stiffness; }
+
+		/**
+		 * Returns the stiffness of the spring between the proxy and the end effector
+		 *
+		 * @return Stiffness, in N/m
+		 */
+		double getStiffness() const { return m_stiffness; }
+
+		/**
+		 * Sets the contact damping. Set before rendering starts.
+		 *
+		 * @param damping Damping, in Ns/m
+		 */
+		void setDamping(double damping) { m_damping = damping; }
+
+		/**
+		 * Returns the contact damping
+		 *
+		 * @return Damping, in Ns/m
+		 */
+		double getDamping() const { return m_damping; }
+
+		/**
+		 * Sets the largest force magnitude the renderer will output. 0 (the default) means no limit. Set
+		 * before rendering starts.
+		 *
+		 * @param max_force Force limit, in newtons
+		 */
+		void setMaxForce(double max_force) { m_maxForce = max_force; }
+
+		/**
+		 * Returns the force limit
+		 *
+		 * @return Force limit, in newtons. 0 if unlimited.
+		 */
+		double getMaxForce() const { return m_maxForce; }
+
+		/**
+		 * Returns the proxy position after the last loop. Only the thread running the I/O loop may call this.
+		 *
+		 * @return Proxy position, in meters
+		 */
+		std::array<double, 3> getProxyPosition() const;
+
+		/**
+		 * Returns the number of constraint planes holding the proxy after the last loop. Only the thread
+		 * running the I/O loop may call this.
+		 *
+		 * @return 0 in free space, 1 on a face, 2 on an edge, 3 in a corner
+		 */
+		unsigned int getContactCount() const { return m_constraintCount; }
+
+		virtual void render(const std::array<double, 3>& position, const std::array<double, 3>& velocity, std::array<double, 3>& force);
+		virtual void reset();
+	protected:
+		/**
+		 * Finds the point closest to the target that is on the free side of every constraint plane
+		 *
+		 * @param target Point to get close to (the end effector position)
+		 * @param goal Set to the closest point, if found
+		 *
+		 * @return True if a point was found
+		 */
+		bool solveGoal(const gmtl::Point3d& target, gmtl::Point3d& goal) const;
+
+		/**
+		 * Checks whether a point is on the free side of every constraint plane
+		 *
+		 * @param point Point to check
+		 *
+		 * @return True if no constraint is violated
+		 */
+		bool isFree(const gmtl::Point3d& point) const;
+
+		FalconTripleBuffer<std::shared_ptr<const FalconMeshBVH> > m_meshes; /**< Meshes handed from setMesh to the I/O loop */
+		std::array<gmtl::Planed, MAX_CONSTRAINTS> m_constraints; /**< Planes holding the proxy, offset from the surface */
+		unsigned int m_constraintCount; /**< Number of planes in m_constraints */
+		gmtl::Point3d m_proxy; /**< Proxy position */
+		bool m_hasProxy; /**< False until the proxy has been placed at the end effector */
+		double m_stiffness; /**< Proxy spring stiffness, N/m */
+		double m_damping; /**< Contact damping, Ns/m */
+		double m_maxForce; /**< Force limit, 0 for none */
+		double m_surfaceOffset; /**< Distance the proxy is held above the surface, in meters */
+	};
+}
+
+#endif
@@ -0,0 +1,237 @@
+/***
+ * @file FalconHapticPointCloud.h
+ * @brief Proxy renderer for point clouds, with indexing on a worker thread
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#ifndef FALCONHAPTICPOINTCLOUD_H
+#define FALCONHAPTICPOINTCLOUD_H
+
+#include <array>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "falcon/core/FalconHapticRenderer.h"
+#include "falcon/core/FalconTripleBuffer.h"
+#include "falcon/haptic/FalconPointCloud.h"
+
+namespace libnifalcon
+{
+/**
+ * @class FalconHapticPointCloud
+ * @ingroup HapticClasses
+ *
+ * Renders a point cloud (a depth capture, a laser scan) with a proxy. The proxy is a small sphere that
+ * follows the end effector through free space but isn't let within its radius of the cloud. Every loop,
+ * the points near the proxy are found through a FalconPointCloud k-d tree, and their weighted center
+ * gives a local surface plane, normal pointing from the center to the proxy. The proxy slides along that
+ * plane towards the end effector, in steps short enough that it can't pass between points, and a spring
+ * between the two pushes the end effector back out.
+ *
+ * The surface felt is the cloud grown by the proxy radius, like touching it with a ball tipped stylus.
+ * The radius should be a few times the spacing between points, or the proxy will find holes to fall
+ * through.
+ *
+ * Points are indexed on a worker thread owned by the renderer, so the application thread never waits on
+ * a build and the I/O loop keeps rendering the previous index until the new one is ready. Added points go
+ * into a small second tree, rebuilt alone, and are only merged into the main tree once they make up a
+ * fair part of the cloud, so streaming points in a few thousand at a time stays cheap.
+ *
+ * @code
+ * std::shared_ptr<FalconHapticPointCloud> renderer = std::make_shared<FalconHapticPointCloud>();
+ * renderer->setPoints(scan);
+ * device.setHapticRenderer(renderer);
+ * ...
+ * renderer->addPoints(more_scan);
+ * @endcode
+ *
+ * Damping acts only in contact, along the spring, and never pulls the end effector into the surface.
+ * It uses FalconDevice::getVelocity(), so a velocity estimator should be set when using it.
+ */
+	class FalconHapticPointCloud : public FalconHapticRenderer
+	{
+	public:
+		static const unsigned int MAX_NEIGHBORS = 16; /**< Most points used to fit the local surface */
+		static const unsigned int MAX_ITERATIONS = 8; /**< Most proxy steps per loop */
+
+		/**
+		 * Constructor. Renders nothing until points are set.
+		 */
+		FalconHapticPointCloud();
+
+		/**
+		 * Destructor. Stops the worker thread, dropping any changes it hasn't indexed yet.
+		 */
+		virtual ~FalconHapticPointCloud();
+
+		/**
+		 * Replaces the cloud. Returns straight away; the new points are rendered once indexed.
+		 *
+		 * @param points Points of the new cloud, in meters. Empty to render nothing.
+		 */
+		void setPoints(const std::vector<std::array<double, 3> >& points);
+
+		/**
+		 * Adds points to the cloud. Returns straight away; the new points are rendered once indexed.
+		 *
+		 * @param points Points to add, in meters
+		 */
+		void addPoints(const std::vector<std::array<double, 3> >& points);
+
+		/**
+		 * Blocks until every change made so far is indexed and handed to the I/O loop
+		 */
+		void waitForIndex();
+
+		/**
+		 * Sets the number of threads the worker builds trees with. Set before setting points.
+		 *
+		 * @param threads Number of threads. 0 (the default) uses one per core.
+		 */
+		void setBuildThreads(unsigned int threads) { m_buildThreads = threads; }
+
+		/**
+		 * Sets the proxy radius. Set before rendering starts.
+		 *
+		 * @param radius Radius, in meters
+		 */
+		void setRadius(double radius) { m_radius = radius; }
+
+		/**
+		 * Returns the proxy radius
+		 *
+		 * @return Radius, in meters
+		 */
+		double getRadius() const { return m_radius; }
+
+		/**
+		 * Sets the stiffness of the spring between the proxy and the end effector. Set before rendering starts.
+		 *
+		 * @param stiffness Stiffness, in N/m
+		 */
+		void setStiffness(double stiffness) { m_stiffness = stiffness; }
+
+		/**
+		 * Returns the stiffness of the spring between the proxy and the end effector
+		 *
+		 * @return Stiffness, in N/m
+		 */
+		double getStiffness() const { return m_stiffness; }
+
+		/**
+		 * Sets the contact damping. Set before rendering starts.
+		 *
+		 * @param damping Damping, in Ns/m
+		 */
+		void setDamping(double damping) { m_damping = damping; }
+
+		/**
+		 * Returns the contact damping
+		 *
+		 * @return Damping, in Ns/m
+		 */
+		double getDamping() const { return m_damping; }
+
+		/**
+		 * Sets the largest force magnitude the renderer will output. 0 (the default) means no limit. Set
+		 * before rendering starts.
+		 *
+		 * @param max_force Force limit, in newtons
+		 */
+		void setMaxForce(double max_force) { m_maxForce = max_force; }
+
+		/**
+		 * Returns the force limit
+		 *
+		 * @return Force limit, in newtons. 0 if unlimited.
+		 */
+		double getMaxForce() const { return m_maxForce; }
+
+		/**
+		 * Returns the proxy position after the last loop. Only the thread running the I/O loop may call this.
+		 *
+		 * @return Proxy position, in meters
+		 */
+		std::array<double, 3> getProxyPosition() const { return m_proxy; }
+
+		/**
+		 * Checks whether the proxy was held back by the cloud in the last loop. Only the thread running
+		 * the I/O loop may call this.
+		 *
+		 * @return True in contact
+		 */
+		bool isInContact() const { return m_inContact; }
+
+		virtual void render(const std::array<double, 3>& position, const std::array<double, 3>& velocity, std::array<double, 3>& force);
+		virtual void reset();
+	protected:
+		/**
+		 * Indexed cloud, as handed to the I/O loop
+		 */
+		struct Index
+		{
+			std::shared_ptr<const FalconPointCloud> base; /**< Tree over most of the points */
+			std::shared_ptr<const FalconPointCloud> added; /**< Tree over points added since base was built */
+		};
+
+		/**
+		 * Worker thread body. Indexes queued changes until stopped.
+		 */
+		void runWorker();
+
+		/**
+		 * Queues a change for the worker, starting it if needed
+		 *
+		 * @param points Points to set or add
+		 * @param replace True to replace the cloud, false to add to it
+		 */
+		void queuePoints(const std::vector<std::array<double, 3> >& points, bool replace);
+
+		/**
+		 * Fits the local surface around the proxy
+		 *
+		 * @param index Cloud to search
+		 * @param center Set to the weighted center of the points near the proxy
+		 * @param normal Set to the unit surface normal, pointing towards the proxy
+		 * @param nearest Set to the squared distance from the proxy to the nearest point
+		 *
+		 * @return True if there were points near the proxy
+		 */
+		bool fitSurface(const Index& index, std::array<double, 3>& center, std::array<double, 3>& normal, double& nearest) const;
+
+		FalconTripleBuffer<Index> m_indices; /**< Indices handed from the worker to the I/O loop */
+
+		//Worker side
+		std::unique_ptr<std::thread> m_worker; /**< Indexing thread, started with the first change */
+		std::mutex m_mutex; /**< Guards the queue and flags below */
+		std::condition_variable m_changed; /**< Signalled when changes are queued, or the worker goes idle */
+		std::vector<std::array<double, 3> > m_queued; /**< Points waiting to be indexed */
+		bool m_queuedReplace; /**< True if m_queued replaces the cloud */
+		bool m_hasQueued; /**< True if there is a change in m_queued */
+		bool m_isIndexing; /**< True while the worker is building */
+		bool m_stopWorker; /**< Tells the worker to exit */
+		unsigned int m_buildThreads; /**< Threads to build trees with */
+
+		//I/O loop side
+		std::array<double, 3> m_proxy; /**< Proxy position */
+		bool m_hasProxy; /**< False until the proxy has been placed at the end effector */
+		bool m_inContact; /**< True if the proxy was held back in the last loop */
+		double m_radius; /**< Proxy radius, in meters */
+		double m_stiffness; /**< Proxy spring stiffness, N/m */
+		double m_damping; /**< Contact damping, Ns/m */
+		double m_maxForce; /**< Force limit, 0 for none */
+	private:
+		FalconHapticPointCloud(const FalconHapticPointCloud&);
+		FalconHapticPointCloud& operator=(const FalconHapticPointCloud&);
+	};
+}
+
+#endif
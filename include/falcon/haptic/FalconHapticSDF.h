@@ -0,0 +1,131 @@
+/***
+ * @file FalconHapticSDF.h
+ * @brief Penalty renderer for signed distance grids
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#ifndef FALCONHAPTICSDF_H
+#define FALCONHAPTICSDF_H
+
+#include <array>
+#include <memory>
+
+#include "falcon/core/FalconHapticRenderer.h"
+#include "falcon/core/FalconTripleBuffer.h"
+#include "falcon/haptic/FalconSDFGrid.h"
+
+namespace libnifalcon
+{
+/**
+ * @class FalconHapticSDF
+ * @ingroup HapticClasses
+ *
+ * Renders a shape stored as a FalconSDFGrid with a penalty force, the same way the sphere test pushes
+ * the end effector out of its sphere: once the end effector is inside, it is pushed along the field's
+ * gradient with a force proportional to how deep it is. A loop costs one trilinear lookup whatever the
+ * complexity of the shape, but as with any penalty force, thin parts can be pushed through.
+ *
+ * Grids are opened on the application thread, then handed over with setGrid(). The renderer picks up
+ * the newest grid at the start of a loop, without locking. The previous grid is released on the
+ * application thread the next time a grid is set, never by the I/O thread.
+ *
+ * @code
+ * std::shared_ptr<FalconSDFGrid> grid = std::make_shared<FalconSDFGrid>();
+ * grid->open("bunny.sdf");
+ * std::shared_ptr<FalconHapticSDF> renderer = std::make_shared<FalconHapticSDF>();
+ * renderer->setGrid(grid);
+ * device.setHapticRenderer(renderer);
+ * @endcode
+ *
+ * Outside the grid, no force is rendered. Damping acts only inside the shape, along the gradient, and
+ * never pulls the end effector in. It uses FalconDevice::getVelocity(), so a velocity estimator should
+ * be set when using it.
+ */
+	class FalconHapticSDF : public FalconHapticRenderer
+	{
+	public:
+		/**
+		 * Constructor. Renders nothing until a grid is set.
+		 */
+		FalconHapticSDF();
+
+		/**
+		 * Destructor
+		 */
+		virtual ~FalconHapticSDF() {}
+
+		/**
+		 * Hands a new grid to the renderer. Only one thread may set grids, and the grid must not change
+		 * or be closed after being set.
+		 *
+		 * @param grid Open grid, or nullptr to render nothing
+		 */
+		void setGrid(std::shared_ptr<const FalconSDFGrid> grid);
+
+		/**
+		 * Sets the penalty stiffness. Set before rendering starts.
+		 *
+		 * @param stiffness Stiffness, in N/m
+		 */
+		void setStiffness(double stiffness) { m_stiffness = stiffness; }
+
+		/**
+		 * Returns the penalty stiffness
+		 *
+		 * @return Stiffness, in N/m
+		 */
+		double getStiffness() const { return m_stiffness; }
+
+		/**
+		 * Sets the contact damping. Set before rendering starts.
+		 *
+		 * @param damping Damping, in Ns/m
+		 */
+		void setDamping(double damping) { m_damping = damping; }
+
+		/**
+		 * Returns the contact damping
+		 *
+		 * @return Damping, in Ns/m
+		 */
+		double getDamping() const { return m_damping; }
+
+		/**
+		 * Sets the largest force magnitude the renderer will output. 0 (the default) means no limit. Set
+		 * before rendering starts.
+		 *
+		 * @param max_force Force limit, in newtons
+		 */
+		void setMaxForce(double max_force) { m_maxForce = max_force; }
+
+		/**
+		 * Returns the force limit
+		 *
+		 * @return Force limit, in newtons. 0 if unlimited.
+		 */
+		double getMaxForce() const { return m_maxForce; }
+
+		/**
+		 * Returns the signed distance sampled in the last loop. Only the thread running the I/O loop may
+		 * call this.
+		 *
+		 * @return Distance to the surface, in meters, negative inside. 0 if the end effector was outside the grid.
+		 */
+		double getDistance() const { return m_distance; }
+
+		virtual void render(const std::array<double, 3>& position, const std::array<double, 3>& velocity, std::array<double, 3>& force);
+	protected:
+		FalconTripleBuffer<std::shared_ptr<const FalconSDFGrid> > m_grids; /**< Grids handed from setGrid to the I/O loop */
+		double m_stiffness; /**< Penalty stiffness, N/m */
+		double m_damping; /**< Contact damping, Ns/m */
+		double m_maxForce; /**< Force limit, 0 for none */
+		double m_distance; /**< Distance sampled in the last loop */
+	};
+}
+
+#endif
@@ -0,0 +1,216 @@
+/***
+ * @file FalconMeshBVH.h
+ * @brief Bounding volume hierarchy over a triangle mesh, for segment and closest point queries
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#ifndef FALCONMESHBVH_H
+#define FALCONMESHBVH_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "falcon/core/FalconCore.h"
+#include "falcon/gmtl/AABox.h"
+#include "falcon/gmtl/LineSeg.h"
+#include "falcon/gmtl/Point.h"
+#include "falcon/gmtl/Tri.h"
+#include "falcon/gmtl/Vec.h"
+
+namespace libnifalcon
+{
+/**
+ * @class FalconMeshBVH
+ * @ingroup HapticClasses
+ *
+ * Axis aligned bounding box hierarchy over a triangle mesh, for segment and closest point queries. Built
+ * once, from the application thread, then only read, so any number of threads can query it at the same time.
+ *
+ * Nodes split their triangles at the median along the longest axis of the triangle centers. That makes
+ * the size of every subtree a function of its triangle count alone, so the node array is laid out up
+ * front and subtrees are built on separate threads without any synchronization. Triangles are reordered
+ * to match the leaves, so a leaf's triangles are contiguous in memory.
+ *
+ * Triangles are one sided, facing the side their vertices are counter clockwise from (the gmtl::Tri
+ * convention). Degenerate triangles are dropped when building.
+ *
+ * Positions are in meters, in the kinematic's coordinate frame.
+ */
+	class FalconMeshBVH : public FalconCore
+	{
+	public:
+		enum {
+			FALCON_MESH_NO_TRIANGLES = 10000, /**< Returned if a mesh has no usable triangles */
+			FALCON_MESH_BAD_INDEX /**< Returned if a mesh's index list refers to a missing vertex */
+		};
+
+		static const unsigned int LEAF_SIZE = 4; /**< Largest number of triangles in a leaf */
+
+		/**
+		 * Constructor. Creates an empty hierarchy.
+		 */
+		FalconMeshBVH() {}
+
+		/**
+		 * Destructor
+		 */
+		virtual ~FalconMeshBVH() {}
+
+		/**
+		 * Builds the hierarchy from a triangle soup, replacing anything built before.
+		 *
+		 * @param triangles Triangles of the mesh
+		 * @param threads Number of threads to build with. 0 uses one per core.
+		 *
+		 * @return True if built, false if there were no usable triangles. Error code set if false.
+		 */
+		bool build(const std::vector<gmtl::Tri<double> >& triangles, unsigned int threads = 0);
+
+		/**
+		 * Builds the hierarchy from an indexed mesh, replacing anything built before.
+		 *
+		 * @param vertices Vertex positions
+		 * @param indices Vertex indices, 3 per triangle
+		 * @param threads Number of threads to build with. 0 uses one per core.
+		 *
+		 * @return True if built, false if an index was out of range or there were no usable triangles. Error code set if false.
+		 */
+		bool build(const std::vector<std::array<double, 3> >& vertices, const std::vector<unsigned int>& indices, unsigned int threads = 0);
+
+		/**
+		 * Checks whether the hierarchy holds any triangles
+		 *
+		 * @return True if there is nothing to query
+		 */
+		bool isEmpty() const { return m_triangles.empty(); }
+
+		/**
+		 * Returns the number of triangles in the hierarchy
+		 *
+		 * @return Number of triangles, not counting dropped degenerate triangles
+		 */
+		unsigned int getTriangleCount() const { return (unsigned int)m_triangles.size(); }
+
+		/**
+		 * Returns the number of nodes in the hierarchy
+		 *
+		 * @return Number of nodes, including leaves
+		 */
+		unsigned int getNodeCount() const { return (unsigned int)m_nodes.size(); }
+
+		/**
+		 * Returns a triangle. Indices are in leaf order, not the order triangles were passed to build().
+		 *
+		 * @param index Index of the triangle, in [0, getTriangleCount())
+		 *
+		 * @return Triangle
+		 */
+		const gmtl::Tri<double>& getTriangle(unsigned int index) const { return m_triangles[index]; }
+
+		/**
+		 * Returns the unit normal of a triangle, pointing to its front side
+		 *
+		 * @param index Index of the triangle, in [0, getTriangleCount())
+		 *
+		 * @return Normal
+		 */
+		const gmtl::Vec3d& getNormal(unsigned int index) const { return m_normals[index]; }
+
+		/**
+		 * Returns the box around the whole mesh
+		 *
+		 * @return Bounds of the mesh. Empty if nothing has been built.
+		 */
+		const gmtl::AABox<double>& getBounds() const;
+
+		/**
+		 * Finds the first triangle a segment enters through its front side. Segments leaving a triangle
+		 * through its back side, or running along it, don't hit it.
+		 *
+		 * @param segment Segment to test
+		 * @param t Set to the position of the hit along the segment, in [0, 1], if found
+		 * @param triangle Set to the index of the triangle hit, if found
+		 *
+		 * @return True if the segment hits a triangle
+		 */
+		bool intersect(const gmtl::LineSeg<double>& segment, double& t, unsigned int& triangle) const;
+
+		/**
+		 * Finds the point on the mesh closest to a given point. When several triangles are equally close
+		 * (the closest point is on an edge or a vertex), the one whose plane faces the point most directly
+		 * is picked, so the sign of (point - closest) . getNormal(triangle) tells which side of the surface
+		 * the point is on.
+		 *
+		 * @param point Point to search from
+		 * @param max_distance Distance beyond which triangles are ignored
+		 * @param closest Set to the closest point on the mesh, if found
+		 * @param triangle Set to the index of the triangle the closest point is on, if found
+		 *
+		 * @return True if a triangle was found within max_distance
+		 */
+		bool findClosest(const gmtl::Point3d& point, double max_distance, gmtl::Point3d& closest, unsigned int& triangle) const;
+	protected:
+		/**
+		 * Hierarchy node. Nodes are stored depth first, so the first child of an inner node always
+		 * directly follows it.
+		 */
+		struct Node
+		{
+			gmtl::AABox<double> bounds; /**< Box around every triangle under the node */
+			uint32_t index; /**< First triangle for leaves, second child for inner nodes */
+			uint32_t count; /**< Number of triangles for leaves, 0 for inner nodes */
+		};
+
+		/**
+		 * Per triangle data used while building
+		 */
+		struct BuildItem
+		{
+			gmtl::AABox<double> bounds; /**< Box around the triangle */
+			gmtl::Point3d center; /**< Center of the box */
+			uint32_t triangle; /**< Index of the triangle in the input */
+		};
+
+		/**
+		 * Returns the number of nodes a subtree over a given number of triangles takes
+		 *
+		 * @param count Number of triangles
+		 *
+		 * @return Number of nodes
+		 */
+		static uint32_t subtreeSize(uint32_t count);
+
+		/**
+		 * Builds the subtree over m_buildItems[begin, end) into m_nodes, starting at node
+		 *
+		 * @param node Index of the subtree root
+		 * @param begin First build item of the subtree
+		 * @param end One past the last build item of the subtree
+		 * @param threads Number of threads this subtree may use
+		 */
+		void buildNode(uint32_t node, uint32_t begin, uint32_t end, unsigned int threads);
+
+		/**
+		 * Builds the hierarchy over m_buildItems, then fills in the triangles in leaf order
+		 *
+		 * @param triangles Triangles the build items refer to
+		 * @param threads Number of threads to build with. 0 uses one per core.
+		 *
+		 * @return True if built. Error code set if false.
+		 */
+		bool buildFromItems(const std::vector<gmtl::Tri<double> >& triangles, unsigned int threads);
+
+		std::vector<Node> m_nodes; /**< Hierarchy, depth first. m_nodes[0] is the root. */
+		std::vector<gmtl::Tri<double> > m_triangles; /**< Triangles, in leaf order */
+		std::vector<gmtl::Vec3d> m_normals; /**< Unit normal of each triangle */
+		std::vector<BuildItem> m_buildItems; /**< Scratch space for build() */
+	};
+}
+
+#endif
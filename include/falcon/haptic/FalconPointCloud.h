@@ -0,0 +1,138 @@
+/***
+ * @file FalconPointCloud.h
+ * @brief k-d tree over a point cloud, for nearest neighbour queries
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#ifndef FALCONPOINTCLOUD_H
+#define FALCONPOINTCLOUD_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "falcon/core/FalconCore.h"
+
+namespace libnifalcon
+{
+/**
+ * @class FalconPointCloud
+ * @ingroup HapticClasses
+ *
+ * Balanced k-d tree over a point cloud, for nearest neighbour queries. Built once, then only read, so
+ * any number of threads can query it at the same time.
+ *
+ * Points are reordered so that every subtree is a contiguous range, split at its median along its
+ * widest axis, and each node keeps the tight box around its points. Scans are surfaces, so most cells
+ * end up flat; the boxes let a query skip a cell by its distance along any axis, not just the ones split
+ * on so far. As in FalconMeshBVH, subtree sizes depend only on point counts, so the node array is laid
+ * out up front and large subtrees are built on separate threads.
+ *
+ * Positions are in meters, in the kinematic's coordinate frame.
+ */
+	class FalconPointCloud : public FalconCore
+	{
+	public:
+		enum {
+			FALCON_POINT_CLOUD_NO_POINTS = 12000 /**< Returned if a cloud has no points */
+		};
+
+		static const unsigned int LEAF_SIZE = 8; /**< Largest number of points in a leaf */
+
+		/**
+		 * Constructor. Creates an empty tree.
+		 */
+		FalconPointCloud() {}
+
+		/**
+		 * Destructor
+		 */
+		virtual ~FalconPointCloud() {}
+
+		/**
+		 * Builds the tree, replacing anything built before.
+		 *
+		 * @param points Points of the cloud
+		 * @param threads Number of threads to build with. 0 uses one per core.
+		 *
+		 * @return True if built, false if there were no points. Error code set if false.
+		 */
+		bool build(const std::vector<std::array<double, 3> >& points, unsigned int threads = 0);
+
+		/**
+		 * Checks whether the tree holds any points
+		 *
+		 * @return True if there is nothing to query
+		 */
+		bool isEmpty() const { return m_points.empty(); }
+
+		/**
+		 * Returns the number of points in the tree
+		 *
+		 * @return Number of points
+		 */
+		unsigned int getPointCount() const { return (unsigned int)m_points.size(); }
+
+		/**
+		 * Returns the points, in leaf order (not the order they were passed to build())
+		 *
+		 * @return Points
+		 */
+		const std::vector<std::array<double, 3> >& getPoints() const { return m_points; }
+
+		/**
+		 * Finds the points closest to a given point, nearest first. Doesn't allocate, so it can run in
+		 * the I/O loop.
+		 *
+		 * @param point Point to search from
+		 * @param radius Distance beyond which points are ignored
+		 * @param count Largest number of points to find
+		 * @param indices Set to the indices of the points found, at least count long
+		 * @param distances Set to the squared distances of the points found, at least count long
+		 *
+		 * @return Number of points found, at most count
+		 */
+		unsigned int findNearest(const std::array<double, 3>& point, double radius, unsigned int count, unsigned int* indices, double* distances) const;
+	protected:
+		/**
+		 * Tree node. Nodes are stored depth first, so the first child of an inner node always directly
+		 * follows it.
+		 */
+		struct Node
+		{
+			std::array<double, 3> min; /**< Low corner of the box around the node's points */
+			std::array<double, 3> max; /**< High corner of the box around the node's points */
+			uint32_t index; /**< First point for leaves, second child for inner nodes */
+			uint32_t count; /**< Number of points for leaves, 0 for inner nodes */
+		};
+
+		/**
+		 * Returns the number of nodes a subtree over a given number of points takes
+		 *
+		 * @param count Number of points
+		 *
+		 * @return Number of nodes
+		 */
+		static uint32_t subtreeSize(uint32_t count);
+
+		/**
+		 * Builds the subtree over m_points[begin, end) into m_nodes, starting at node
+		 *
+		 * @param node Index of the subtree root
+		 * @param begin First point of the subtree
+		 * @param end One past the last point of the subtree
+		 * @param threads Number of threads this subtree may use
+		 */
+		void buildNode(uint32_t node, uint32_t begin, uint32_t end, unsigned int threads);
+
+		std::vector<Node> m_nodes; /**< Tree, depth first. m_nodes[0] is the root. */
+		std::vector<std::array<double, 3> > m_points; /**< Points, in leaf order */
+	};
+}
+
+#endif
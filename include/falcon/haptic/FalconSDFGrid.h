@@ -0,0 +1,184 @@
+/***
+ * @file FalconSDFGrid.h
+ * @brief Memory mapped, bricked signed distance grid
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#ifndef FALCONSDFGRID_H
+#define FALCONSDFGRID_H
+
+#include <array>
+#include <stdint.h>
+#include <string>
+
+#include "falcon/core/FalconCore.h"
+#include "falcon/core/FalconMappedFile.h"
+
+namespace libnifalcon
+{
+	/**
+	 * File header for signed distance grids. Layout is fixed (64 bytes, no padding, little endian on all
+	 * supported platforms). Followed directly by the bricks, see FalconSDFGrid.
+	 */
+	struct FalconSDFHeader
+	{
+		char magic[8]; /**< Always "NIFSDF01" */
+		uint32_t version; /**< File format version */
+		uint32_t brickSize; /**< Cells along each side of a brick */
+		uint32_t cells[3]; /**< Grid size, in cells. There is one more sample than cells along each axis. */
+		uint32_t reserved; /**< Pads the origin out to 8 bytes */
+		double origin[3]; /**< Position of sample (0, 0, 0), in meters */
+		double spacing; /**< Distance between neighbouring samples, in meters */
+	};
+
+/**
+ * @class FalconSDFGrid
+ * @ingroup HapticClasses
+ *
+ * Signed distance field sampled on a regular grid, stored in a memory mapped file. Distances are negative
+ * inside the shape and positive outside.
+ *
+ * Samples are stored as floats in cubic bricks of BRICK_SIZE cells (BRICK_SIZE + 1 samples) along each
+ * side, one brick after the other, x fastest. Neighbouring bricks share their boundary samples, so all
+ * eight corners of any cell are in the same brick. A lookup touches a 2x2x2 block of one brick, which is
+ * a few cache lines, where a flat grid would touch two planes of the whole grid. Bricks at the far ends
+ * of the grid can stick out past it; their extra samples are stored like any other.
+ *
+ * Grids are opened read only and faulted in completely, so sampling from the I/O thread never touches
+ * the disk. They are built with create(), which maps a new file for writing so bricks can be filled in
+ * from as many threads as needed (see the falcon_sdf_build example).
+ */
+	class FalconSDFGrid : public FalconCore
+	{
+	public:
+		enum {
+			FALCON_SDF_FILE_ERROR = 11000, /**< Returned if the file can't be created, opened or mapped */
+			FALCON_SDF_INVALID_FILE, /**< Returned if the file isn't a grid, or is cut short */
+			FALCON_SDF_INVALID_SIZE /**< Returned if a grid to create has no cells or a bad spacing */
+		};
+
+		static const unsigned int BRICK_SIZE = 8; /**< Cells along each side of a brick */
+		static const unsigned int BRICK_SAMPLES = (BRICK_SIZE + 1) * (BRICK_SIZE + 1) * (BRICK_SIZE + 1); /**< Samples in a brick */
+
+		/**
+		 * Constructor
+		 */
+		FalconSDFGrid();
+
+		/**
+		 * Destructor. Closes the grid if open.
+		 */
+		virtual ~FalconSDFGrid();
+
+		/**
+		 * Opens a grid file read only. Closes any grid already open.
+		 *
+		 * @param filename Grid file
+		 *
+		 * @return True if opened. Error code set if false.
+		 */
+		bool open(const std::string& filename);
+
+		/**
+		 * Creates a grid file and maps it for writing. Closes any grid already open. Samples start at 0;
+		 * fill them in through getBrick().
+		 *
+		 * @param filename File to create
+		 * @param origin Position of sample (0, 0, 0), in meters
+		 * @param spacing Distance between neighbouring samples, in meters
+		 * @param cells Grid size along each axis, in cells
+		 *
+		 * @return True if created. Error code set if false.
+		 */
+		bool create(const std::string& filename, const std::array<double, 3>& origin, double spacing, const std::array<unsigned int, 3>& cells);
+
+		/**
+		 * Closes the grid. Grids opened with create() are flushed to disk.
+		 */
+		void close();
+
+		/**
+		 * Checks whether a grid is open
+		 *
+		 * @return True if open
+		 */
+		bool isOpen() const { return m_header != nullptr; }
+
+		/**
+		 * Returns the position of sample (0, 0, 0)
+		 *
+		 * @return Origin, in meters
+		 */
+		std::array<double, 3> getOrigin() const { return m_origin; }
+
+		/**
+		 * Returns the distance between neighbouring samples
+		 *
+		 * @return Spacing, in meters
+		 */
+		double getSpacing() const { return m_spacing; }
+
+		/**
+		 * Returns the grid size
+		 *
+		 * @return Cells along each axis
+		 */
+		std::array<unsigned int, 3> getCells() const { return m_cells; }
+
+		/**
+		 * Returns the number of bricks
+		 *
+		 * @return Bricks along each axis
+		 */
+		std::array<unsigned int, 3> getBricks() const { return m_bricks; }
+
+		/**
+		 * Returns one brick's samples, for filling in a grid made with create(). Sample (i, j, k) of brick
+		 * (x, y, z) is at index (k * (BRICK_SIZE + 1) + j) * (BRICK_SIZE + 1) + i, and is grid sample
+		 * (x * BRICK_SIZE + i, y * BRICK_SIZE + j, z * BRICK_SIZE + k).
+		 *
+		 * @param x Brick index along x
+		 * @param y Brick index along y
+		 * @param z Brick index along z
+		 *
+		 * @return BRICK_SAMPLES samples. Only writable if the grid was made with create().
+		 */
+		float* getBrick(unsigned int x, unsigned int y, unsigned int z)
+		{
+			return m_samples + ((size_t)(z * m_bricks[1] + y) * m_bricks[0] + x) * BRICK_SAMPLES;
+		}
+
+		/**
+		 * Samples the field with trilinear interpolation
+		 *
+		 * @param position Position to sample at, in meters
+		 * @param distance Set to the signed distance at the position, in meters
+		 * @param gradient Set to the gradient of the interpolated field at the position. Points away from
+		 * the surface, and is close to unit length near it.
+		 *
+		 * @return True if the position is inside the grid, false otherwise (outputs untouched)
+		 */
+		bool sample(const std::array<double, 3>& position, double& distance, std::array<double, 3>& gradient) const;
+	protected:
+		/**
+		 * Copies the grid geometry out of the header and works out the brick layout
+		 */
+		void loadHeader();
+
+		FalconMappedFile m_file; /**< Mapping of the grid file */
+		FalconSDFHeader* m_header; /**< Start of the mapped file */
+		float* m_samples; /**< Bricks, directly after the header */
+		std::array<double, 3> m_origin; /**< Position of sample (0, 0, 0) */
+		double m_spacing; /**< Distance between samples */
+		double m_inverseSpacing; /**< 1 / m_spacing */
+		std::array<unsigned int, 3> m_cells; /**< Grid size, in cells */
+		std::array<unsigned int, 3> m_bricks; /**< Grid size, in bricks */
+	};
+}
+
+#endif
@@ -0,0 +1,215 @@
+/***
+ * @file FalconVirtualCoupling.h
+ * @brief Couples a slow simulation to the I/O loop through a proxy and a local contact model
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#ifndef FALCONVIRTUALCOUPLING_H
+#define FALCONVIRTUALCOUPLING_H
+
+#include <array>
+#include <atomic>
+#include <stdint.h>
+
+#include "falcon/core/FalconForceField.h"
+#include "falcon/core/FalconHapticRenderer.h"
+
+namespace libnifalcon
+{
+/**
+ * @class FalconVirtualCoupling
+ * @ingroup HapticClasses
+ *
+ * Multi-rate coupling between a simulation running at its own rate (typically 60 to 200 Hz) and the
+ * 1 kHz I/O loop. Setting a force from the simulation through FalconDevice::setForce holds it for a whole
+ * simulation step, so forces come out as a staircase at the simulation rate, which is felt as buzz and
+ * limits how stiff contact can be.
+ *
+ * Instead, every simulation step publishes:
+ *
+ * - The pose of the simulated tool (the proxy): position and velocity. The end effector is pulled
+ *   towards it by a damped spring, the virtual coupling, and the proxy is moved along its velocity
+ *   between steps, so the spring doesn't lag a step behind.
+ * - A local model of what the tool is touching, linearized around the current contact: usually a plane
+ *   or two, with their stiffness and damping, as a FalconForceField. It is evaluated against fresh end
+ *   effector positions in every loop, so contact is as stiff as a servo rate wall would be, whatever
+ *   the simulation rate.
+ *
+ * When a step is picked up, the I/O loop fades from the previous step's force to the new one over the
+ * blend time, so what is left of the staircase is smoothed out too. Evaluating a step costs the same as a
+ * force field, whatever the cost of the simulation.
+ *
+ * @code
+ * //Simulation thread, every step
+ * FalconForceField contact;
+ * contact.addPlane(contact_point, contact_normal, 2000.0, 5.0);
+ * coupling->publish(tool_position, tool_velocity, contact);
+ * //Reaction force on the simulated tool
+ * coupling->getCouplingForce(device_position, device_velocity, tool_force);
+ * @endcode
+ *
+ * Only one thread may publish. Nothing is rendered until the first publish.
+ */
+	class FalconVirtualCoupling : public FalconHapticRenderer
+	{
+	public:
+		/**
+		 * Constructor
+		 */
+		FalconVirtualCoupling();
+
+		/**
+		 * Destructor
+		 */
+		virtual ~FalconVirtualCoupling() {}
+
+		/**
+		 * Hands a simulation step to the I/O loop. Doesn't block. The step is timestamped here, so call this
+		 * as soon as the step is computed.
+		 *
+		 * @param proxy_position Position of the simulated tool, in meters
+		 * @param proxy_velocity Velocity of the simulated tool, in m/s
+		 * @param local_model Forces from what the tool is touching, evaluated at the end effector every loop
+		 */
+		void publish(const std::array<double, 3>& proxy_position, const std::array<double, 3>& proxy_velocity, const FalconForceField& local_model);
+
+		/**
+		 * Computes the coupling spring force for the last published proxy, for feeding back into the
+		 * simulation. Only the publishing thread may call this.
+		 *
+		 * @param position End effector position, in meters
+		 * @param velocity End effector velocity, in m/s
+		 * @param force Set to the force the coupling puts on the proxy, in newtons (opposite to the force
+		 * on the end effector)
+		 */
+		void getCouplingForce(const std::array<double, 3>& position, const std::array<double, 3>& velocity, std::array<double, 3>& force) const;
+
+		/**
+		 * Sets the stiffness of the spring between the proxy and the end effector. Set before rendering starts.
+		 *
+		 * @param stiffness Stiffness, in N/m. 0 renders the local model alone.
+		 */
+		void setCouplingStiffness(double stiffness) { m_couplingStiffness = stiffness; }
+
+		/**
+		 * Returns the stiffness of the spring between the proxy and the end effector
+		 *
+		 * @return Stiffness, in N/m
+		 */
+		double getCouplingStiffness() const { return m_couplingStiffness; }
+
+		/**
+		 * Sets the damping of the spring between the proxy and the end effector, acting on their relative
+		 * velocity. Set before rendering starts.
+		 *
+		 * @param damping Damping, in Ns/m
+		 */
+		void setCouplingDamping(double damping) { m_couplingDamping = damping; }
+
+		/**
+		 * Returns the damping of the spring between the proxy and the end effector
+		 *
+		 * @return Damping, in Ns/m
+		 */
+		double getCouplingDamping() const { return m_couplingDamping; }
+
+		/**
+		 * Sets how long the I/O loop takes to fade from one step's force to the next. About one
+		 * simulation step works best. Set before rendering starts.
+		 *
+		 * @param seconds Blend time, in seconds. 0 switches at once.
+		 */
+		void setBlendTime(double seconds) { m_blendTime = seconds; }
+
+		/**
+		 * Returns the blend time
+		 *
+		 * @return Blend time, in seconds
+		 */
+		double getBlendTime() const { return m_blendTime; }
+
+		/**
+		 * Sets how far past its timestamp a step's proxy is moved along its velocity. Stops the proxy
+		 * running off if the simulation stalls. Set before rendering starts.
+		 *
+		 * @param seconds Longest extrapolation, in seconds. 0 holds the proxy still between steps.
+		 */
+		void setMaxExtrapolation(double seconds) { m_maxExtrapolation = seconds; }
+
+		/**
+		 * Returns the longest extrapolation
+		 *
+		 * @return Longest extrapolation, in seconds
+		 */
+		double getMaxExtrapolation() const { return m_maxExtrapolation; }
+
+		/**
+		 * Sets the largest force magnitude the coupling will output. 0 (the default) means no limit. Set
+		 * before rendering starts.
+		 *
+		 * @param max_force Force limit, in newtons
+		 */
+		void setMaxForce(double max_force) { m_maxForce = max_force; }
+
+		/**
+		 * Returns the force limit
+		 *
+		 * @return Force limit, in newtons. 0 if unlimited.
+		 */
+		double getMaxForce() const { return m_maxForce; }
+
+		virtual void render(const std::array<double, 3>& position, const std::array<double, 3>& velocity, std::array<double, 3>& force);
+		virtual void reset();
+	protected:
+		/**
+		 * One simulation step, as handed to the I/O loop
+		 */
+		struct Step
+		{
+			std::array<double, 3> proxyPosition; /**< Proxy position at timestamp */
+			std::array<double, 3> proxyVelocity; /**< Proxy velocity */
+			FalconForceField localModel; /**< Contact model */
+			uint64_t timestamp; /**< Time the step was published, from getFalconTimestamp() */
+			bool isValid; /**< False until something has been published */
+		};
+
+		/**
+		 * Evaluates one step's force on the end effector
+		 *
+		 * @param step Step to evaluate
+		 * @param now Current time, from getFalconTimestamp()
+		 * @param position End effector position
+		 * @param velocity End effector velocity
+		 * @param force Set to the force on the end effector
+		 */
+		void evaluate(const Step& step, uint64_t now, const std::array<double, 3>& position, const std::array<double, 3>& velocity, std::array<double, 3>& force) const;
+
+		enum {
+			STEP_INDEX_MASK = 0x3, /**< Bits of m_middle holding the slot index */
+			STEP_DIRTY = 0x4 /**< Set in m_middle when it holds a step the I/O loop hasn't picked up */
+		};
+
+		//Steps are handed over like a triple buffer (see FalconTripleBuffer), with a fourth slot so the
+		//I/O loop can keep the step it is fading out without copying it
+		std::array<Step, 4> m_steps; /**< Step slots, in no fixed order */
+		uint8_t m_writeIndex; /**< Slot owned by the publishing thread */
+		std::atomic<uint8_t> m_middle; /**< Slot in transit, plus STEP_DIRTY */
+		uint8_t m_currentIndex; /**< Slot holding the step being rendered, owned by the I/O loop */
+		uint8_t m_previousIndex; /**< Slot holding the step being faded out, owned by the I/O loop */
+		std::array<double, 3> m_publishedPosition; /**< Last published proxy position, publishing thread side */
+		std::array<double, 3> m_publishedVelocity; /**< Last published proxy velocity, publishing thread side */
+		uint64_t m_switchTime; /**< Time the current step was picked up */
+		double m_couplingStiffness; /**< Coupling spring stiffness, N/m */
+		double m_couplingDamping; /**< Coupling spring damping, Ns/m */
+		double m_blendTime; /**< Fade time between steps, seconds */
+		double m_maxExtrapolation; /**< Longest proxy extrapolation, seconds */
+		double m_maxForce; /**< Force limit, 0 for none */
+	};
+}
+
+#endif
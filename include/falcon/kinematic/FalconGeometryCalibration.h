@@ -0,0 +1,276 @@
+/***
+ * @file FalconGeometryCalibration.h
+ * @brief Fits the geometry of a falcon to recorded encoder values and position constraints
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#ifndef FALCONGEOMETRYCALIBRATION_H
+#define FALCONGEOMETRYCALIBRATION_H
+
+#include <array>
+#include <stdint.h>
+#include <vector>
+
+#include "falcon/core/FalconCore.h"
+#include "falcon/core/FalconGeometry.h"
+#include "falcon/kinematic/FalconKinematicStamper.h"
+
+namespace libnifalcon
+{
+/**
+ * @class FalconGeometryCalibration
+ * @ingroup KinematicsClasses
+ *
+ * Fits the geometry used by FalconKinematicStamper to a single falcon. Samples are encoder values recorded
+ * while the end effector was held against something of known position, such as the holes or faces of a
+ * calibration fixture:
+ *
+ * - Point samples: the end effector was at a known position
+ * - Plane samples: the end effector was somewhere on a known plane, as when sliding it over a flat face
+ *
+ * fit() adjusts the geometry with Levenberg-Marquardt, minimizing the squared distances between the
+ * positions the kinematics give for the samples and their constraints. Each iteration runs forward
+ * kinematics for every sample, so the samples are split over threads. Each thread works out the positions
+ * and their derivatives for its share, and reduces them to the normal equations of that share, which are
+ * summed in order, so a fit is repeatable for a given thread count. The cost of an iteration is a few
+ * dozen inverse kinematics solutions per sample.
+ *
+ * Only some combinations of the parameters affect the kinematics: d and e only act through d + e, c and r
+ * through c - r, and f and s through f - s. The default parameter mask fits one of each pair, along with
+ * the leg lengths, leg angles and encoder offsets. Plane samples don't pin down movement within their
+ * plane, so the leg angles and the c, f offsets need point samples or planes facing several ways.
+ *
+ * Positions are in meters, in the kinematic's coordinate frame. The fitted geometry can be stored per
+ * device with FalconGeometryStore.
+ */
+	class FalconGeometryCalibration : public FalconCore
+	{
+	public:
+		enum {
+			FALCON_GEOMETRY_CALIBRATION_TOO_FEW_SAMPLES = 16000, /**< Returned if there are fewer constraints than parameters to fit */
+			FALCON_GEOMETRY_CALIBRATION_OUT_OF_RANGE /**< Returned if no sample can be solved with the starting geometry */
+		};
+
+		/**
+		 * Geometry parameters that can be fitted, as indexes into a parameter mask
+		 */
+		enum Parameter {
+			PARAMETER_A = 0, /**< FalconGeometryParameters::a */
+			PARAMETER_B, /**< FalconGeometryParameters::b */
+			PARAMETER_C, /**< FalconGeometryParameters::c */
+			PARAMETER_D, /**< FalconGeometryParameters::d */
+			PARAMETER_E, /**< FalconGeometryParameters::e */
+			PARAMETER_F, /**< FalconGeometryParameters::f */
+			PARAMETER_R, /**< FalconGeometryParameters::r */
+			PARAMETER_S, /**< FalconGeometryParameters::s */
+			PARAMETER_PHY_1, /**< FalconGeometryParameters::phy, leg 1 */
+			PARAMETER_PHY_2, /**< FalconGeometryParameters::phy, leg 2 */
+			PARAMETER_PHY_3, /**< FalconGeometryParameters::phy, leg 3 */
+			PARAMETER_THETA_OFFSET_1, /**< FalconGeometryParameters::theta_offset, leg 1 */
+			PARAMETER_THETA_OFFSET_2, /**< FalconGeometryParameters::theta_offset, leg 2 */
+			PARAMETER_THETA_OFFSET_3, /**< FalconGeometryParameters::theta_offset, leg 3 */
+			PARAMETER_COUNT /**< Number of parameters */
+		};
+
+		/**
+		 * Kinds of sample
+		 */
+		enum SampleType {
+			SAMPLE_POINT, /**< End effector at a known position */
+			SAMPLE_PLANE /**< End effector on a known plane */
+		};
+
+		/**
+		 * Encoder values recorded against a position constraint
+		 */
+		struct Sample
+		{
+			std::array<int, 3> encoders; /**< Raw encoder values */
+			SampleType type; /**< Kind of constraint */
+			std::array<double, 3> target; /**< Position for point samples, unit plane normal for plane samples */
+			double offset; /**< Plane samples only, distance of the plane from the origin along its normal */
+		};
+
+		static const uint32_t DEFAULT_PARAMETER_MASK =
+			(1 << PARAMETER_A) | (1 << PARAMETER_B) | (1 << PARAMETER_C) | (1 << PARAMETER_D) | (1 << PARAMETER_F) |
+			(1 << PARAMETER_PHY_1) | (1 << PARAMETER_PHY_2) | (1 << PARAMETER_PHY_3) |
+			(1 << PARAMETER_THETA_OFFSET_1) | (1 << PARAMETER_THETA_OFFSET_2) | (1 << PARAMETER_THETA_OFFSET_3); /**< Parameters fitted by default */
+
+		/**
+		 * Constructor. Starts with no samples, fitting the default parameters.
+		 */
+		FalconGeometryCalibration();
+
+		/**
+		 * Destructor
+		 */
+		virtual ~FalconGeometryCalibration() {}
+
+		/**
+		 * Drops every sample
+		 */
+		void clear() { m_samples.clear(); }
+
+		/**
+		 * Adds a sample taken with the end effector at a known position
+		 *
+		 * @param encoders Raw encoder values
+		 * @param position Position of the end effector
+		 */
+		void addPoint(const std::array<int, 3>& encoders, const std::array<double, 3>& position);
+
+		/**
+		 * Adds a sample taken with the end effector somewhere on a known plane, the points x where
+		 * dot(normal, x) == offset
+		 *
+		 * @param encoders Raw encoder values
+		 * @param normal Normal of the plane. Normalized when added.
+		 * @param offset Distance of the plane from the origin along the normal
+		 */
+		void addPlane(const std::array<int, 3>& encoders, const std::array<double, 3>& normal, double offset);
+
+		/**
+		 * Returns the samples added
+		 *
+		 * @return Samples, in the order added
+		 */
+		const std::vector<Sample>& getSamples() const { return m_samples; }
+
+		/**
+		 * Sets which parameters fit() adjusts
+		 *
+		 * @param mask Bitfield of 1 << Parameter values
+		 */
+		void setParameterMask(uint32_t mask) { m_parameterMask = mask & ((1 << PARAMETER_COUNT) - 1); }
+
+		/**
+		 * Returns which parameters fit() adjusts
+		 *
+		 * @return Bitfield of 1 << Parameter values
+		 */
+		uint32_t getParameterMask() const { return m_parameterMask; }
+
+		/**
+		 * Sets the number of threads to spread the samples over
+		 *
+		 * @param threads Number of threads. 0 uses one per core. Small sample sets use one.
+		 */
+		void setThreadCount(unsigned int threads) { m_threadCount = threads; }
+
+		/**
+		 * Sets the most iterations fit() runs
+		 *
+		 * @param iterations Iteration limit
+		 */
+		void setMaxIterations(unsigned int iterations) { m_maxIterations = iterations; }
+
+		/**
+		 * Fits the geometry to the samples
+		 *
+		 * @param initial Geometry to start from, usually the nominal geometry
+		 * @param fitted Set to the fitted geometry. Parameters outside the mask are copied from initial.
+		 *
+		 * @return true if fitted, false otherwise. Error code set if false.
+		 */
+		bool fit(const FalconGeometryParameters& initial, FalconGeometryParameters& fitted);
+
+		/**
+		 * Works out how well a geometry fits the samples
+		 *
+		 * @param geometry Geometry to check
+		 * @param rms Set to the RMS distance of the samples from their constraints, in meters
+		 *
+		 * @return Number of samples the kinematics could solve with the geometry
+		 */
+		size_t getError(const FalconGeometryParameters& geometry, double& rms);
+
+		/**
+		 * Returns the number of iterations the last fit() ran
+		 *
+		 * @return Iteration count
+		 */
+		unsigned int getIterationCount() const { return m_iterationCount; }
+
+		/**
+		 * Returns the number of samples the last fit() couldn't solve with its starting geometry, and left out
+		 *
+		 * @return Number of samples left out
+		 */
+		size_t getSkippedCount() const { return m_skippedCount; }
+
+		/**
+		 * Accessor for a geometry parameter by index
+		 *
+		 * @param geometry Geometry to access
+		 * @param parameter Parameter to access
+		 *
+		 * @return Reference to the parameter
+		 */
+		static double& getParameter(FalconGeometryParameters& geometry, Parameter parameter);
+
+		/**
+		 * Works out the position of the end effector from leg angles, solving inverse kinematics by
+		 * Newton's method to full precision (FalconKinematicStamper::FK stops at a tolerance meant for
+		 * the I/O loop)
+		 *
+		 * @param kinematic Kinematics, set to the geometry to use
+		 * @param theta Leg angles, in radians
+		 * @param position Position to start from, set to the solution
+		 * @param jacobian Set to the derivative of the position with respect to the leg angles
+		 *
+		 * @return true if solved, false if the angles are out of the workspace
+		 */
+		static bool solvePosition(FalconKinematicStamper& kinematic, const gmtl::Vec3d& theta, gmtl::Vec3d& position, gmtl::Matrix33d& jacobian);
+	protected:
+		/**
+		 * Normal equations of the least squares problem for a set of samples
+		 */
+		struct NormalEquations
+		{
+			double jtj[PARAMETER_COUNT * PARAMETER_COUNT]; /**< J'J, over the fitted parameters */
+			double jtr[PARAMETER_COUNT]; /**< J'r, over the fitted parameters */
+			double cost; /**< Sum of squared residuals */
+			size_t residuals; /**< Number of residuals */
+			size_t solved; /**< Number of samples that could be solved */
+		};
+
+		/**
+		 * Works out the residuals of a run of samples, on the calling thread
+		 *
+		 * @param samples First sample
+		 * @param count Number of samples
+		 * @param geometry Geometry to evaluate
+		 * @param parameters Fitted parameters. With none, only the cost is worked out.
+		 * @param parameter_count Number of fitted parameters
+		 * @param solvable Per sample flags, 0 to skip the sample. Cleared for samples that can't be solved.
+		 * @param equations Set to the normal equations of the samples
+		 */
+		static void evaluate(const Sample* samples, size_t count, const FalconGeometryParameters& geometry, const Parameter* parameters, unsigned int parameter_count, char* solvable, NormalEquations& equations);
+
+		/**
+		 * Works out the residuals of every sample, spread over threads
+		 *
+		 * @param geometry Geometry to evaluate
+		 * @param parameter_count Number of fitted parameters. With none, only the cost is worked out.
+		 * @param solvable Per sample flags, 0 to skip the sample. Cleared for samples that can't be solved.
+		 * @param equations Set to the normal equations of the samples
+		 */
+		void evaluateAll(const FalconGeometryParameters& geometry, unsigned int parameter_count, std::vector<char>& solvable, NormalEquations& equations);
+
+		std::vector<Sample> m_samples; /**< Samples added */
+		std::vector<char> m_solvable; /**< Per sample flags, 0 for samples left out of the fit */
+		Parameter m_parameters[PARAMETER_COUNT]; /**< Fitted parameters, from the mask */
+		uint32_t m_parameterMask; /**< Bitfield of fitted parameters */
+		unsigned int m_threadCount; /**< Threads to spread samples over, 0 for one per core */
+		unsigned int m_maxIterations; /**< Iteration limit for fit() */
+		unsigned int m_iterationCount; /**< Iterations run by the last fit() */
+		size_t m_skippedCount; /**< Samples left out of the last fit() */
+	};
+}
+
+#endif
@@ -48,9 +48,9 @@ namespace libnifalcon
 		 */		
 		struct Angle
 		{
-			float theta1[3]; /**< Euler for thigh angle */
-			float theta2[3]; /**< Euler for knee angle */
-			float theta3[3]; /**< Euler for shin angle */
+			double theta1[3]; /**< Euler for thigh angle */
+			double theta2[3]; /**< Euler for knee angle */
+			double theta3[3]; /**< Euler for shin angle */
 		};
 	}
 }
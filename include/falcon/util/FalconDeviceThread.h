@@ -13,6 +13,7 @@
 #define FALCONDEVICETHREADS_H
 #include <thread>
 #include "falcon/core/FalconDevice.h"
+#include "falcon/util/FalconSessionRecorder.h"
 
 namespace libnifalcon
 {
@@ -65,6 +66,14 @@ namespace libnifalcon
 		 * Thread safe position return
 		 */
 		void getPosition(std::array<double, 3>& pos);
+
+		/**
+		 * Sets a session recorder to be fed after every successful I/O loop. Set before
+		 * startThread(); pass nullptr to stop recording.
+		 *
+		 * @param recorder Open session recorder
+		 */
+		void setSessionRecorder(std::shared_ptr<FalconSessionRecorder> recorder) { m_sessionRecorder = recorder; }
 	protected:
 		/**
 		 * Wrapper function for dealing with device communication
@@ -82,6 +91,8 @@ namespace libnifalcon
 		std::array<double, 3> m_localPosition;
 
 		bool m_runThreadLoop; /**< Internal thread execution state. Thread loop exits if this is false. */
+
+		std::shared_ptr<FalconSessionRecorder> m_sessionRecorder; /**< Recorder fed by the I/O thread, if set */
 	};
 }
 #endif
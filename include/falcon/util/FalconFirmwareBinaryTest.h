@@ -2,6 +2,10 @@
  * @file FalconFirmwareBinaryTest.h
  * @brief Utility class for packing novint falcon firmware into shipped executables. Binary from NOVINT.BIN file in falcon driver distribution.
  *
+ * @deprecated The firmware images are now built into the library, see FalconFirmwareImages. Load this
+ * one with FalconDevice::loadFirmwareImage(skip_checksum, "test"). This header is no longer used in-tree,
+ * and is only kept for existing code. It will be removed in a later release.
+ *
  * Project info at http://libnifalcon.nonpolynomial.com/
  *
  */
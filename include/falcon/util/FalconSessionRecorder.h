@@ -0,0 +1,212 @@
+/***
+ * @file FalconSessionRecorder.h
+ * @brief Memory-mapped, fixed record size session recording of device state at servo rate
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#ifndef FALCONSESSIONRECORDER_H
+#define FALCONSESSIONRECORDER_H
+
+#include <stdint.h>
+#include <string>
+#include "falcon/core/FalconCore.h"
+#include "falcon/core/FalconLogger.h"
+#include "falcon/core/FalconMappedFile.h"
+
+namespace libnifalcon
+{
+	class FalconDevice;
+
+	/**
+	 * Single sample of device state, as stored in a session file. Layout is fixed (80 bytes,
+	 * no padding, little endian on all supported platforms) so files can be read without
+	 * libnifalcon, e.g. with numpy.fromfile.
+	 */
+	struct FalconSessionRecord
+	{
+		uint64_t timestamp; /**< Packet receive time, from getFalconTimestamp() (nanoseconds) */
+		uint64_t loopCount; /**< Firmware loop count at the time of the sample */
+		double position[3]; /**< End effector position, in meters */
+		double force[3]; /**< Force being commanded, in newtons */
+		int32_t encoders[3]; /**< Raw encoder values */
+		uint32_t buttons; /**< Grip digital input bitfield */
+	};
+
+	/**
+	 * File header for session recordings. Followed directly by capacity records.
+	 */
+	struct FalconSessionHeader
+	{
+		char magic[8]; /**< Always "NIFSESS1" */
+		uint32_t version; /**< File format version */
+		uint32_t recordSize; /**< sizeof(FalconSessionRecord) at time of writing */
+		uint64_t capacity; /**< Number of record slots in the file */
+		uint64_t recordsWritten; /**< Total records ever written. Slot for record n is n % capacity */
+		uint64_t startTimestamp; /**< Timestamp of the first record */
+		uint8_t reserved[24]; /**< Pads header out to 64 bytes */
+	};
+
+/**
+ * @class FalconSessionRecorder
+ * @ingroup UtilityClasses
+ *
+ * FalconSessionRecorder writes FalconSessionRecord samples into a pre-allocated, memory-mapped file.
+ * The file is sized once in open(), so recording a sample is a copy into mapped memory and never
+ * hits the kernel on the I/O thread. When the file fills up, recording rolls over and overwrites
+ * the oldest samples, so a session file always holds the most recent capacity samples.
+ *
+ * The recorder is meant to be fed from the thread running FalconDevice::runIOLoop, either by
+ * handing it to FalconDeviceThread::setSessionRecorder, or by calling record() after each
+ * successful loop in your own I/O loop.
+ *
+ * Recorded files are read back with FalconSessionReader, or converted with the falcon_session_export
+ * example.
+ */
+	class FalconSessionRecorder : public FalconCore
+	{
+	public:
+		enum {
+			FALCON_SESSION_FILE_ERROR = 6000, /**< Session file could not be created, sized or opened */
+			FALCON_SESSION_MAP_ERROR, /**< Session file could not be memory mapped */
+			FALCON_SESSION_NOT_OPEN, /**< Operation requires an open session file */
+			FALCON_SESSION_INVALID_FILE /**< File is not a session file, or has a different record layout */
+		};
+
+		/**
+		 * Constructor
+		 */
+		FalconSessionRecorder();
+
+		/**
+		 * Destructor. Closes the session file if open.
+		 */
+		~FalconSessionRecorder();
+
+		/**
+		 * Creates (or truncates) a session file, sizes it to hold capacity records and maps it.
+		 *
+		 * @param filename Path of the session file
+		 * @param capacity Number of records to keep before rolling over (1kHz for an hour is 3600000)
+		 *
+		 * @return true if file is ready for recording, false otherwise. Error code set if false.
+		 */
+		bool open(const std::string& filename, uint64_t capacity);
+
+		/**
+		 * Flushes and unmaps the session file, if open
+		 */
+		void close();
+
+		/**
+		 * Checks whether a session file is open for recording
+		 *
+		 * @return true if open, false otherwise
+		 */
+		bool isOpen() const { return m_header != nullptr; }
+
+		/**
+		 * Stores one record. Does no allocation and no system calls.
+		 *
+		 * @param record Record to store
+		 */
+		void record(const FalconSessionRecord& record);
+
+		/**
+		 * Samples the current state of a device and stores it. Should be called from the I/O thread,
+		 * right after a successful FalconDevice::runIOLoop.
+		 *
+		 * @param device Device to sample
+		 */
+		void record(FalconDevice& device);
+
+		/**
+		 * Returns the total number of records written since open, including overwritten ones
+		 *
+		 * @return Number of records written
+		 */
+		uint64_t getRecordsWritten() const;
+	protected:
+		FalconSessionHeader* m_header; /**< Start of the mapped file */
+		FalconSessionRecord* m_records; /**< Record slots, directly after the header */
+		FalconMappedFile m_file; /**< Mapping of the session file */
+	private:
+		DECLARE_LOGGER();
+	};
+
+/**
+ * @class FalconSessionReader
+ * @ingroup UtilityClasses
+ *
+ * Read-only view of a session file written by FalconSessionRecorder. Records are returned oldest
+ * first, with rollover already accounted for. Files can be read while a recorder is still writing
+ * to them; getRecordCount() reflects what was committed when it was called.
+ */
+	class FalconSessionReader : public FalconCore
+	{
+	public:
+		/**
+		 * Constructor
+		 */
+		FalconSessionReader();
+
+		/**
+		 * Destructor. Closes the session file if open.
+		 */
+		~FalconSessionReader();
+
+		/**
+		 * Maps an existing session file for reading
+		 *
+		 * @param filename Path of the session file
+		 *
+		 * @return true if file is a valid session file, false otherwise. Error code set if false.
+		 */
+		bool open(const std::string& filename);
+
+		/**
+		 * Unmaps the session file, if open
+		 */
+		void close();
+
+		/**
+		 * Returns the number of records that can be read (at most the file capacity)
+		 *
+		 * @return Number of readable records
+		 */
+		uint64_t getRecordCount() const;
+
+		/**
+		 * Returns the number of records lost to rollover
+		 *
+		 * @return Number of records overwritten before they could be read
+		 */
+		uint64_t getDroppedCount() const;
+
+		/**
+		 * Accessor for a record, in recording order
+		 *
+		 * @param index Index of the record, 0 being the oldest record still in the file
+		 *
+		 * @return Reference to the mapped record
+		 */
+		const FalconSessionRecord& getRecord(uint64_t index) const;
+
+		/**
+		 * Accessor for the file header
+		 *
+		 * @return Pointer to the mapped header, nullptr if not open
+		 */
+		const FalconSessionHeader* getHeader() const { return m_header; }
+	protected:
+		const FalconSessionHeader* m_header; /**< Start of the mapped file */
+		const FalconSessionRecord* m_records; /**< Record slots, directly after the header */
+		FalconMappedFile m_file; /**< Mapping of the session file */
+	};
+}
+
+#endif
@@ -0,0 +1,319 @@
+/***
+ * @file FalconSharedMemory.h
+ * @brief POSIX shared memory publishing of device state, and command queues back to the device owner
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#ifndef FALCONSHAREDMEMORY_H
+#define FALCONSHAREDMEMORY_H
+
+#include <stdint.h>
+#include <string>
+#include <array>
+#include <atomic>
+#include "falcon/core/FalconCore.h"
+#include "falcon/core/FalconLogger.h"
+
+namespace libnifalcon
+{
+	class FalconDevice;
+
+	/**
+	 * Maximum number of devices a single shared memory region can publish
+	 */
+	const unsigned int FALCON_SHARED_MAX_DEVICES = 8;
+
+	/**
+	 * Number of slots in each device command queue. Must be a power of 2.
+	 */
+	const unsigned int FALCON_SHARED_QUEUE_SIZE = 64;
+
+	/**
+	 * Snapshot of device state, as published by the server after every I/O loop
+	 */
+	struct FalconSharedState
+	{
+		uint64_t timestamp; /**< Packet receive time, from getFalconTimestamp() (nanoseconds) */
+		uint64_t loopCount; /**< Firmware loop count */
+		double position[3]; /**< End effector position, in meters */
+		double force[3]; /**< Force being rendered, in newtons */
+		int32_t encoders[3]; /**< Raw encoder values */
+		uint32_t buttons; /**< Grip digital input bitfield */
+		uint32_t homingStatus; /**< Homing bits, see FalconFirmware::FalconFirmwareHomingValues */
+		uint32_t errorCount; /**< I/O loop error count, see FalconDevice::getErrorCount */
+	};
+
+	/**
+	 * Command types clients can queue for a device
+	 */
+	enum FalconSharedCommandType
+	{
+		FALCON_SHARED_SET_FORCE = 1, /**< values[0-2]: force in newtons. Expires unless refreshed (see server options) */
+		FALCON_SHARED_SET_SPRING, /**< values[0-2]: anchor in meters, values[3]: stiffness (N/m), values[4]: damping (Ns/m) */
+		FALCON_SHARED_CLEAR_SPRING, /**< Removes the spring field */
+		FALCON_SHARED_SET_LEDS /**< values[0]: LED bitfield, see FalconFirmware::FalconFirmwareLEDValues */
+	};
+
+	/**
+	 * Single command sent from a client to the server
+	 */
+	struct FalconSharedCommand
+	{
+		uint32_t type; /**< One of FalconSharedCommandType */
+		uint32_t clientId; /**< Id of the sending client, see FalconSharedMemoryClient::getClientId */
+		double values[6]; /**< Command parameters, meaning depends on type */
+	};
+
+	/**
+	 * Slot in a command queue. The sequence number tells producers and the consumer who owns the slot.
+	 */
+	struct FalconSharedQueueCell
+	{
+		std::atomic<uint64_t> sequence; /**< Slot ownership sequence */
+		FalconSharedCommand command; /**< Queued command */
+	};
+
+	/**
+	 * Bounded multiple producer, single consumer queue of commands. Lives in shared memory, so it
+	 * only uses lock-free atomics and no pointers.
+	 */
+	struct FalconSharedQueue
+	{
+		alignas(64) std::atomic<uint64_t> enqueuePos; /**< Next position producers claim */
+		alignas(64) std::atomic<uint64_t> dequeuePos; /**< Next position the server reads */
+		FalconSharedQueueCell cells[FALCON_SHARED_QUEUE_SIZE]; /**< Slots */
+	};
+
+	/**
+	 * Per-device section of the shared memory region
+	 */
+	struct FalconSharedDeviceSlot
+	{
+		alignas(64) std::atomic<uint32_t> sequence; /**< Seqlock sequence, odd while the server is writing state */
+		FalconSharedState state; /**< Latest device state */
+		FalconSharedQueue commands; /**< Commands queued for this device */
+	};
+
+	/**
+	 * Layout of the whole shared memory region
+	 */
+	struct FalconSharedRegion
+	{
+		char magic[8]; /**< Always "NIFSHM01" */
+		uint32_t version; /**< Layout version */
+		uint32_t deviceCount; /**< Number of devices the server publishes */
+		std::atomic<uint64_t> heartbeat; /**< Incremented by the server every servo loop */
+		std::atomic<uint32_t> nextClientId; /**< Next client id to hand out */
+		FalconSharedDeviceSlot devices[FALCON_SHARED_MAX_DEVICES]; /**< Device slots */
+	};
+
+/**
+ * @class FalconSharedMemoryServer
+ * @ingroup UtilityClasses
+ *
+ * FalconSharedMemoryServer creates a POSIX shared memory region that publishes device state to any
+ * number of local processes, and collects commands they send back. Only one process can claim a
+ * falcon's USB interface, so the process owning the devices and the servo loop (see the falcon_server
+ * example) uses this class, and everyone else uses FalconSharedMemoryClient.
+ *
+ * State is published through a per-device seqlock: publish() never blocks, and readers retry if they
+ * raced with a write. Commands come in through bounded lock-free queues, which the server drains with
+ * popCommand() once per loop. Neither side ever takes a lock or makes a system call after setup.
+ */
+	class FalconSharedMemoryServer : public FalconCore
+	{
+	public:
+		enum {
+			FALCON_SHARED_OPEN_ERROR = 7000, /**< Shared memory object could not be created or opened */
+			FALCON_SHARED_MAP_ERROR, /**< Shared memory object could not be mapped */
+			FALCON_SHARED_NOT_OPEN, /**< Operation requires an open region */
+			FALCON_SHARED_INVALID_REGION, /**< Region was not created by a compatible server */
+			FALCON_SHARED_DEVICE_OUT_OF_RANGE, /**< Device index is out of range for the region */
+			FALCON_SHARED_QUEUE_FULL, /**< Command queue is full, server is not draining it */
+			FALCON_SHARED_STATE_BUSY /**< State could not be read consistently (server died while writing?) */
+		};
+
+		/**
+		 * Constructor
+		 */
+		FalconSharedMemoryServer();
+
+		/**
+		 * Destructor. Destroys the region if created.
+		 */
+		~FalconSharedMemoryServer();
+
+		/**
+		 * Creates the shared memory region, replacing any stale region of the same name.
+		 *
+		 * Anyone who can write the region can command forces on the devices, so by default only the
+		 * user running the server can open it. Pass 0660 to let a group of clients in.
+		 *
+		 * @param name Name of the shared memory object (e.g. "/libnifalcon")
+		 * @param device_count Number of devices to publish, at most FALCON_SHARED_MAX_DEVICES
+		 * @param mode Permission bits of the shared memory object. Set as given, regardless of the umask.
+		 *
+		 * @return true if region is ready, false otherwise. Error code set if false.
+		 */
+		bool create(const std::string& name, unsigned int device_count, unsigned int mode = 0600);
+
+		/**
+		 * Unmaps and unlinks the region, if created
+		 */
+		void destroy();
+
+		/**
+		 * Publishes the current state of a device. Should be called from the servo loop, right after
+		 * a successful FalconDevice::runIOLoop.
+		 *
+		 * @param index Index of the device slot
+		 * @param device Device to sample
+		 */
+		void publish(unsigned int index, FalconDevice& device);
+
+		/**
+		 * Publishes a state snapshot for a device
+		 *
+		 * @param index Index of the device slot
+		 * @param state State to publish
+		 */
+		void publish(unsigned int index, const FalconSharedState& state);
+
+		/**
+		 * Takes the oldest queued command for a device, if any
+		 *
+		 * @param index Index of the device slot
+		 * @param[out] command Command that was dequeued
+		 *
+		 * @return true if a command was dequeued, false if the queue is empty
+		 */
+		bool popCommand(unsigned int index, FalconSharedCommand& command);
+
+		/**
+		 * Marks the server as alive. Call once per servo loop.
+		 */
+		void heartbeat();
+	protected:
+		FalconSharedRegion* m_region; /**< Mapped region */
+		std::string m_name; /**< Name of the shared memory object */
+	private:
+		DECLARE_LOGGER();
+	};
+
+/**
+ * @class FalconSharedMemoryClient
+ * @ingroup UtilityClasses
+ *
+ * FalconSharedMemoryClient attaches to a region created by FalconSharedMemoryServer. Reading state is a
+ * copy out of shared memory (well under a microsecond), and sending commands is a lock-free enqueue.
+ */
+	class FalconSharedMemoryClient : public FalconCore
+	{
+	public:
+		/**
+		 * Constructor
+		 */
+		FalconSharedMemoryClient();
+
+		/**
+		 * Destructor. Detaches from the region if open.
+		 */
+		~FalconSharedMemoryClient();
+
+		/**
+		 * Attaches to an existing region
+		 *
+		 * @param name Name of the shared memory object (e.g. "/libnifalcon")
+		 *
+		 * @return true if attached, false otherwise. Error code set if false.
+		 */
+		bool open(const std::string& name);
+
+		/**
+		 * Detaches from the region, if open
+		 */
+		void close();
+
+		/**
+		 * Returns the number of devices published by the server
+		 *
+		 * @return Number of devices, 0 if not open
+		 */
+		unsigned int getDeviceCount() const;
+
+		/**
+		 * Returns the id this client stamps on its commands
+		 *
+		 * @return Client id
+		 */
+		uint32_t getClientId() const { return m_clientId; }
+
+		/**
+		 * Returns the server heartbeat. If this stops changing, the server is gone.
+		 *
+		 * @return Heartbeat counter
+		 */
+		uint64_t getHeartbeat() const;
+
+		/**
+		 * Copies out a consistent snapshot of device state
+		 *
+		 * @param index Index of the device
+		 * @param[out] state State snapshot
+		 *
+		 * @return true if state was read, false otherwise. Error code set if false.
+		 */
+		bool getState(unsigned int index, FalconSharedState& state);
+
+		/**
+		 * Queues a command for a device. The client id is filled in automatically.
+		 *
+		 * @param index Index of the device
+		 * @param command Command to queue
+		 *
+		 * @return true if queued, false otherwise. Error code set if false.
+		 */
+		bool sendCommand(unsigned int index, const FalconSharedCommand& command);
+
+		/**
+		 * Conveinence function, queues a FALCON_SHARED_SET_FORCE command
+		 *
+		 * @param index Index of the device
+		 * @param force Force vector, in newtons
+		 *
+		 * @return true if queued, false otherwise. Error code set if false.
+		 */
+		bool setForce(unsigned int index, const std::array<double, 3>& force);
+
+		/**
+		 * Conveinence function, queues a FALCON_SHARED_SET_SPRING command
+		 *
+		 * @param index Index of the device
+		 * @param anchor Spring anchor, in meters
+		 * @param stiffness Spring stiffness, in N/m
+		 * @param damping Damping, in Ns/m
+		 *
+		 * @return true if queued, false otherwise. Error code set if false.
+		 */
+		bool setSpring(unsigned int index, const std::array<double, 3>& anchor, double stiffness, double damping);
+
+		/**
+		 * Conveinence function, queues a FALCON_SHARED_CLEAR_SPRING command
+		 *
+		 * @param index Index of the device
+		 *
+		 * @return true if queued, false otherwise. Error code set if false.
+		 */
+		bool clearSpring(unsigned int index);
+	protected:
+		FalconSharedRegion* m_region; /**< Mapped region */
+		uint32_t m_clientId; /**< Id stamped on outgoing commands */
+	};
+}
+
+#endif
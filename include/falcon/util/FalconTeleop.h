@@ -0,0 +1,371 @@
+/***
+ * @file FalconTeleop.h
+ * @brief UDP teleoperation transport with jitter buffering, prediction and passive force coupling
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#ifndef FALCONTELEOP_H
+#define FALCONTELEOP_H
+
+#include <stdint.h>
+#include <string>
+#include <array>
+#include "falcon/core/FalconCore.h"
+#include "falcon/core/FalconLogger.h"
+
+namespace libnifalcon
+{
+	class FalconDevice;
+
+#pragma pack(push, 1)
+	/**
+	 * Wire format for teleoperation packets (72 bytes, little endian). Both sides send the same
+	 * packet every servo loop; what the wave field means depends on the sender's role.
+	 */
+	struct FalconTeleopPacket
+	{
+		uint32_t magic; /**< Always FALCON_TELEOP_MAGIC */
+		uint32_t sequence; /**< Incremented on every packet sent */
+		uint64_t timestamp; /**< Sender's packet-level clock when the state was sampled (nanoseconds) */
+		uint64_t echoTimestamp; /**< timestamp of the newest packet the sender has received from us */
+		uint64_t echoDelay; /**< Nanoseconds between receiving that packet and sending this one */
+		uint32_t buttons; /**< Grip digital inputs */
+		float position[3]; /**< Sender's end effector position, in meters */
+		float velocity[3]; /**< Sender's end effector velocity, in m/s */
+		float wave[3]; /**< Wave variable (u from the master, v from the slave) */
+	};
+#pragma pack(pop)
+
+	/**
+	 * Magic number at the start of every teleoperation packet ("NFTP")
+	 */
+	const uint32_t FALCON_TELEOP_MAGIC = 0x5054464e;
+
+/**
+ * @class FalconTeleopJitterBuffer
+ * @ingroup UtilityClasses
+ *
+ * Reorders incoming teleoperation packets and plays them out at a fixed delay, so the force loop sees a
+ * constant latency instead of network jitter. Samples are interpolated between packets, and dead reckoned
+ * from the newest packet (position + velocity * dt) for up to a fixed horizon when packets are late or lost.
+ *
+ * All times are in the local clock; packets are mapped into it with an offset estimated by FalconTeleop.
+ */
+	class FalconTeleopJitterBuffer
+	{
+	public:
+		/**
+		 * Number of packets held by the buffer
+		 */
+		static const unsigned int BUFFER_SIZE = 64;
+
+		/**
+		 * Result of sampling the buffer
+		 */
+		enum {
+			SAMPLE_EMPTY = 0, /**< Nothing has been received yet */
+			SAMPLE_INTERPOLATED, /**< Sample lies between two received packets */
+			SAMPLE_PREDICTED, /**< Sample lies after the newest packet, and was dead reckoned */
+			SAMPLE_STALE /**< Newest packet is older than the prediction horizon, sample held at its position */
+		};
+
+		/**
+		 * Constructor
+		 */
+		FalconTeleopJitterBuffer();
+
+		/**
+		 * Drops all buffered packets
+		 */
+		void clear();
+
+		/**
+		 * Adds a packet to the buffer
+		 *
+		 * @param packet Packet received
+		 * @param local_time Packet timestamp converted to the local clock
+		 *
+		 * @return false if the packet was a duplicate or too old to be played out, true otherwise
+		 */
+		bool insert(const FalconTeleopPacket& packet, uint64_t local_time);
+
+		/**
+		 * Samples remote state at a given local time
+		 *
+		 * @param time Local time to sample at
+		 * @param max_prediction Longest time (nanoseconds) to dead reckon past the newest packet
+		 * @param[out] position Remote position
+		 * @param[out] velocity Remote velocity
+		 * @param[out] wave Remote wave variable. Zero while predicting, since holding wave values isn't passive.
+		 *
+		 * @return One of the SAMPLE_ values
+		 */
+		int sample(uint64_t time, uint64_t max_prediction, std::array<double, 3>& position, std::array<double, 3>& velocity, std::array<double, 3>& wave);
+
+		/**
+		 * Returns the newest packet received
+		 *
+		 * @return Reference to newest packet. Only valid if something has been received.
+		 */
+		const FalconTeleopPacket& getNewest() const { return m_packets[m_newest % BUFFER_SIZE]; }
+
+		/**
+		 * Returns the number of packets lost (sequence gaps that never filled in)
+		 *
+		 * @return Number of lost packets
+		 */
+		uint64_t getLostCount() const { return m_lostCount; }
+
+		/**
+		 * Returns the number of packets that arrived too late to be played out
+		 *
+		 * @return Number of late packets
+		 */
+		uint64_t getLateCount() const { return m_lateCount; }
+	protected:
+		FalconTeleopPacket m_packets[BUFFER_SIZE]; /**< Packets, indexed by sequence % BUFFER_SIZE */
+		uint64_t m_times[BUFFER_SIZE]; /**< Local times of the packets */
+		bool m_valid[BUFFER_SIZE]; /**< True if slot holds the packet for its sequence */
+		uint32_t m_newest; /**< Sequence of newest packet */
+		uint32_t m_played; /**< Oldest sequence still needed for playout */
+		bool m_hasPackets; /**< True once a packet has been received */
+		uint64_t m_lostCount; /**< Packets never received */
+		uint64_t m_lateCount; /**< Packets received after they were needed */
+	};
+
+/**
+ * @class FalconTeleop
+ * @ingroup UtilityClasses
+ *
+ * FalconTeleop connects two falcons (or a falcon and anything speaking FalconTeleopPacket) over UDP, one as
+ * the master and one as the slave. Call update() on the servo thread after every successful
+ * FalconDevice::runIOLoop; it sends local state, drains received packets into the jitter buffer, and sets
+ * the device force for the next loop. Sockets are non-blocking, so update() never waits on the network.
+ *
+ * Two force modes are available:
+ * - FALCON_TELEOP_COUPLING: symmetric position-position coupling (spring/damper) to the remote position,
+ *   dead reckoned to the current time. A time domain passivity observer tracks the energy the coupling puts
+ *   into the device, and adds damping whenever it would become active.
+ * - FALCON_TELEOP_WAVE: wave variable coupling, which stays passive for any constant delay. The jitter
+ *   buffer's playout delay turns network jitter into that constant delay. A small position drift correction
+ *   is applied on the slave, which runs a velocity controller (see setSlaveVelocityGain).
+ *
+ * Packet timestamps come from the firmware packet clock (FalconFirmware::getLastPacketTimestamp), and the
+ * round trip time and remote clock offset are estimated from timestamp echoes, so the two sides do not need
+ * synchronized clocks.
+ */
+	class FalconTeleop : public FalconCore
+	{
+	public:
+		enum {
+			FALCON_TELEOP_SOCKET_ERROR = 8000, /**< Socket could not be created or bound */
+			FALCON_TELEOP_ADDRESS_ERROR, /**< Remote address could not be resolved */
+			FALCON_TELEOP_NOT_OPEN, /**< Operation requires an open link */
+			FALCON_TELEOP_SEND_ERROR /**< Packet could not be sent */
+		};
+
+		/**
+		 * Which end of the link this object is
+		 */
+		enum FalconTeleopRole {
+			FALCON_TELEOP_MASTER, /**< Device held by the operator */
+			FALCON_TELEOP_SLAVE /**< Device (or manipulator) following the master */
+		};
+
+		/**
+		 * How remote state is turned into force
+		 */
+		enum FalconTeleopMode {
+			FALCON_TELEOP_COUPLING, /**< Position-position coupling with passivity controller */
+			FALCON_TELEOP_WAVE /**< Wave variables */
+		};
+
+		/**
+		 * Constructor
+		 */
+		FalconTeleop();
+
+		/**
+		 * Destructor. Closes the link if open.
+		 */
+		~FalconTeleop();
+
+		/**
+		 * Opens a UDP socket and sets the peer to send to
+		 *
+		 * @param role Master or slave
+		 * @param local_port UDP port to receive on
+		 * @param remote_host Host name or address of the peer
+		 * @param remote_port UDP port of the peer
+		 *
+		 * @return true if link is open, false otherwise. Error code set if false.
+		 */
+		bool open(FalconTeleopRole role, unsigned short local_port, const std::string& remote_host, unsigned short remote_port);
+
+		/**
+		 * Closes the socket, if open
+		 */
+		void close();
+
+		/**
+		 * Runs one teleoperation step: receive, compute and set force on the device, send local state.
+		 *
+		 * @param device Local device. Kinematics must be set.
+		 *
+		 * @return true if a packet was sent, false otherwise. Error code set if false.
+		 */
+		bool update(FalconDevice& device);
+
+		/**
+		 * Sets the force mode (FALCON_TELEOP_COUPLING by default)
+		 *
+		 * @param mode Force mode
+		 */
+		void setMode(FalconTeleopMode mode) { m_mode = mode; }
+
+		/**
+		 * Sets gains for FALCON_TELEOP_COUPLING
+		 *
+		 * @param stiffness Coupling stiffness, in N/m
+		 * @param damping Coupling damping, in Ns/m
+		 */
+		void setCouplingGains(double stiffness, double damping) { m_stiffness = stiffness; m_damping = damping; }
+
+		/**
+		 * Sets the gain of the slave velocity controller for FALCON_TELEOP_WAVE. Has to be high enough
+		 * for the slave to actually follow the velocity the waves ask for.
+		 *
+		 * @param gain Velocity gain, in Ns/m
+		 */
+		void setSlaveVelocityGain(double gain) { m_slaveGain = gain; }
+
+		/**
+		 * Sets the wave impedance for FALCON_TELEOP_WAVE
+		 *
+		 * @param impedance Wave impedance b, in Ns/m
+		 */
+		void setWaveImpedance(double impedance) { m_waveImpedance = impedance; }
+
+		/**
+		 * Sets how far behind the newest packet remote state is played out
+		 *
+		 * @param delay Playout delay, in nanoseconds
+		 */
+		void setPlayoutDelay(uint64_t delay) { m_playoutDelay = delay; }
+
+		/**
+		 * Sets how long remote state is dead reckoned before it is held
+		 *
+		 * @param horizon Maximum prediction, in nanoseconds
+		 */
+		void setMaxPrediction(uint64_t horizon) { m_maxPrediction = horizon; }
+
+		/**
+		 * Sets the clamp applied to each force axis
+		 *
+		 * @param force Maximum force, in newtons
+		 */
+		void setMaxForce(double force) { m_maxForce = force; }
+
+		/**
+		 * Returns the smoothed round trip time
+		 *
+		 * @return Round trip time, in nanoseconds. 0 until an echo has been received.
+		 */
+		uint64_t getRoundTripTime() const { return m_roundTripTime; }
+
+		/**
+		 * Returns the number of valid packets received
+		 *
+		 * @return Packets received
+		 */
+		uint64_t getPacketsReceived() const { return m_packetsReceived; }
+
+		/**
+		 * Returns the number of packets sent
+		 *
+		 * @return Packets sent
+		 */
+		uint64_t getPacketsSent() const { return m_packetsSent; }
+
+		/**
+		 * Accessor for the jitter buffer, for loss and lateness statistics
+		 *
+		 * @return Jitter buffer
+		 */
+		const FalconTeleopJitterBuffer& getJitterBuffer() const { return m_jitterBuffer; }
+
+		/**
+		 * Returns the most recent sampled remote position
+		 *
+		 * @return Remote position, in meters
+		 */
+		std::array<double, 3> getRemotePosition() const { return m_remotePosition; }
+
+		/**
+		 * Returns the energy the passivity observer has seen flow out of the coupling
+		 *
+		 * @return Observed energy, in joules
+		 */
+		double getObservedEnergy() const { return m_energy; }
+	protected:
+		/**
+		 * Drains the socket into the jitter buffer, updating round trip and clock offset estimates
+		 *
+		 * @param now Current local time
+		 */
+		void receivePackets(uint64_t now);
+
+		/**
+		 * Computes position-position coupling force with passivity control
+		 */
+		void computeCouplingForce(const std::array<double, 3>& pos, const std::array<double, 3>& vel, double dt, std::array<double, 3>& force);
+
+		/**
+		 * Computes wave variable force, and the wave variable to send back
+		 */
+		void computeWaveForce(const std::array<double, 3>& pos, const std::array<double, 3>& vel, std::array<double, 3>& force);
+
+		FalconTeleopRole m_role; /**< Master or slave */
+		FalconTeleopMode m_mode; /**< Force mode */
+		int m_socket; /**< UDP socket, -1 if closed */
+		uint8_t m_remoteAddress[128]; /**< Peer address (sockaddr storage) */
+		unsigned int m_remoteAddressSize; /**< Size of peer address */
+
+		double m_stiffness; /**< Coupling stiffness */
+		double m_damping; /**< Coupling damping */
+		double m_slaveGain; /**< Slave velocity controller gain */
+		double m_waveImpedance; /**< Wave impedance */
+		uint64_t m_playoutDelay; /**< Playout delay */
+		uint64_t m_maxPrediction; /**< Dead reckoning horizon */
+		double m_maxForce; /**< Per axis force clamp */
+
+		FalconTeleopJitterBuffer m_jitterBuffer; /**< Received packets */
+		uint32_t m_sequence; /**< Sequence for next outgoing packet */
+		uint64_t m_packetsSent; /**< Packets sent */
+		uint64_t m_packetsReceived; /**< Packets received */
+		uint64_t m_echoTimestamp; /**< Newest remote timestamp received */
+		uint64_t m_echoReceived; /**< Local time that packet arrived */
+		uint64_t m_roundTripTime; /**< Smoothed round trip time */
+		int64_t m_clockOffset; /**< Remote clock + offset = local clock */
+		bool m_hasClockOffset; /**< True once m_clockOffset is valid */
+
+		uint64_t m_lastTime; /**< Local time of previous update */
+		std::array<double, 3> m_lastPosition; /**< Local position at previous update */
+		std::array<double, 3> m_velocity; /**< Filtered local velocity */
+		std::array<double, 3> m_remotePosition; /**< Remote position at last update */
+		std::array<double, 3> m_remoteVelocity; /**< Remote velocity at last update */
+		std::array<double, 3> m_remoteWave; /**< Remote wave variable at last update */
+		std::array<double, 3> m_outgoingWave; /**< Wave variable to send */
+		double m_energy; /**< Passivity observer energy */
+	private:
+		DECLARE_LOGGER();
+	};
+}
+
+#endif
@@ -22,7 +22,7 @@
 #include "falcon/firmware/FalconFirmwareNovintSDK.h"
 #include "falcon/kinematic/FalconKinematicStamper.h"
 #include "falcon/grip/FalconGripFourButton.h"
-#include "falcon/util/FalconFirmwareBinaryNvent.h"
+#include "falcon/firmware/FalconFirmwareImages.h"
 
 using namespace libnifalcon;
 
@@ -63,7 +63,7 @@ using namespace libnifalcon;
 			std::cout << "Loading firmware" << std::endl;
 			for(int i = 0; i < 10; ++i)
 			{
-				if(!getFalconFirmware()->loadFirmware(true, NOVINT_FALCON_NVENT_FIRMWARE_SIZE, const_cast<uint8_t*>(NOVINT_FALCON_NVENT_FIRMWARE)))
+				if(!getFalconFirmware()->loadFirmwareImage(true, FalconFirmwareImages::DEFAULT_IMAGE))
 				{
 					std::cout << "Could not load firmware" << std::endl;
 					return false;
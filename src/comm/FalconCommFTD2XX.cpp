@@ -10,20 +10,53 @@
  */
 
 #include "falcon/comm/FalconCommFTD2XX.h"
+#include "falcon/core/FalconClock.h"
 
 #ifdef WIN32
 #include <windows.h>
 #else
 #include <WinTypes.h>
+#include <pthread.h>
+#include <time.h>
 #endif
 #include "ftd2xx.h"
 
+#include <algorithm>
 #include <cstring>
 #include <iostream>
 
 namespace libnifalcon
 {
  	const char* FalconCommFTD2XX::FALCON_DESCRIPTION = "FALCON HAPTIC";
+	const unsigned int FalconCommFTD2XX::RING_SIZE;
+
+	static void* createEvent()
+	{
+#ifdef WIN32
+		//Auto reset, so each wait consumes one signal
+		return CreateEvent(NULL, FALSE, FALSE, NULL);
+#else
+		EVENT_HANDLE* event = new EVENT_HANDLE;
+		pthread_mutex_init(&event->eMutex, NULL);
+		pthread_cond_init(&event->eCondVar, NULL);
+		return event;
+#endif
+	}
+
+	static void destroyEvent(void* event)
+	{
+		if(event == NULL)
+		{
+			return;
+		}
+#ifdef WIN32
+		CloseHandle((HANDLE)event);
+#else
+		pthread_cond_destroy(&((EVENT_HANDLE*)event)->eCondVar);
+		pthread_mutex_destroy(&((EVENT_HANDLE*)event)->eMutex);
+		delete (EVENT_HANDLE*)event;
+#endif
+	}
 
 	FalconCommFTD2XX::~FalconCommFTD2XX()
 	{
@@ -85,6 +118,17 @@ namespace libnifalcon
 		//Open and reset device using serial number
 		if((m_deviceErrorCode = FT_OpenEx(serial, FT_OPEN_BY_SERIAL_NUMBER, &m_falconDevice)) != FT_OK) return -1;
 
+		//Have the driver tell us when bytes come in, instead of asking it every loop
+		m_event = createEvent();
+		if((m_deviceErrorCode = FT_SetEventNotification(m_falconDevice, FT_EVENT_RXCHAR, (PVOID)m_event)) != FT_OK)
+		{
+			FT_Close(m_falconDevice);
+			destroyEvent(m_event);
+			m_event = NULL;
+			return -1;
+		}
+		reset();
+
 		m_errorCode = 0;
 		m_isCommOpen = true;
 		return 0;
@@ -98,29 +142,106 @@ namespace libnifalcon
 			return false;
 		}
 		m_isCommOpen = false;
+		//Close first, so the driver is done with the event before it goes away
 		FT_Close(m_falconDevice);
+		destroyEvent(m_event);
+		m_event = NULL;
 		return true;
 	}
 
-	bool FalconCommFTD2XX::read(uint8_t* str, unsigned int size)
+	void FalconCommFTD2XX::reset()
+	{
+		m_ringHead = m_ringTail = 0;
+		m_isDriverPending = false;
+		m_bytesAvailable = 0;
+		m_hasBytesAvailable = false;
+	}
+
+	bool FalconCommFTD2XX::waitForEvent(unsigned int usec)
+	{
+#ifdef WIN32
+		return WaitForSingleObject((HANDLE)m_event, (usec + 999) / 1000) == WAIT_OBJECT_0;
+#else
+		EVENT_HANDLE* event = (EVENT_HANDLE*)m_event;
+		struct timespec deadline;
+		clock_gettime(CLOCK_REALTIME, &deadline);
+		deadline.tv_sec += usec / 1000000;
+		deadline.tv_nsec += (usec % 1000000) * 1000;
+		if(deadline.tv_nsec >= 1000000000)
+		{
+			deadline.tv_sec += 1;
+			deadline.tv_nsec -= 1000000000;
+		}
+		pthread_mutex_lock(&event->eMutex);
+		int result = pthread_cond_timedwait(&event->eCondVar, &event->eMutex, &deadline);
+		pthread_mutex_unlock(&event->eMutex);
+		return result == 0;
+#endif
+	}
+
+	bool FalconCommFTD2XX::fillRing()
+	{
+		DWORD queued = 0;
+		if((m_deviceErrorCode = FT_GetQueueStatus(m_falconDevice, &queued)) != FT_OK)
+		{
+			m_errorCode = FALCON_COMM_DEVICE_ERROR;
+			return false;
+		}
+		if(queued == 0)
+		{
+			return true;
+		}
+		unsigned int free_space = RING_SIZE - getRingCount();
+		unsigned int to_read = std::min((unsigned int)queued, free_space);
+		m_isDriverPending = (queued > free_space);
+		//At most two reads, one up to the end of the ring and one from the start
+		while(to_read > 0)
+		{
+			unsigned int index = m_ringHead & (RING_SIZE - 1);
+			unsigned int chunk = std::min(to_read, RING_SIZE - index);
+			DWORD bytes_read = 0;
+			if((m_deviceErrorCode = FT_Read(m_falconDevice, m_ring + index, chunk, &bytes_read)) != FT_OK)
+			{
+				m_errorCode = FALCON_COMM_DEVICE_ERROR;
+				return false;
+			}
+			m_ringHead += bytes_read;
+			if(bytes_read < chunk)
+			{
+				break;
+			}
+			to_read -= chunk;
+		}
+		m_lastReadTimestamp = getFalconTimestamp();
+		return true;
+	}
+
+	unsigned int FalconCommFTD2XX::drainRing(uint8_t* str, unsigned int size)
 	{
-		unsigned long bytes_rx = 0, b_read = 0, bytes_read = 0;
+		unsigned int count = std::min(size, getRingCount());
+		for(unsigned int copied = 0; copied < count; )
+		{
+			unsigned int index = m_ringTail & (RING_SIZE - 1);
+			unsigned int chunk = std::min(count - copied, RING_SIZE - index);
+			memcpy(str + copied, m_ring + index, chunk);
+			m_ringTail += chunk;
+			copied += chunk;
+		}
+		m_bytesAvailable = getRingCount();
+		m_hasBytesAvailable = (m_bytesAvailable > 0);
+		return count;
+	}
 
+	bool FalconCommFTD2XX::read(uint8_t* str, unsigned int size)
+	{
 		m_lastBytesRead = 0;
 		if(!m_isCommOpen)
 		{
 			m_errorCode = FALCON_COMM_DEVICE_NOT_VALID_ERROR;
 			return false;
 		}
-		m_errorCode = FALCON_COMM_DEVICE_ERROR;
-		if(size <= m_bytesAvailable) bytes_read = size;
-		else bytes_read = m_bytesAvailable;
-
-		if((m_deviceErrorCode = FT_Read(m_falconDevice, str, bytes_read, &b_read)) != FT_OK) return false;
-
-		m_lastBytesRead = b_read;
-		m_bytesAvailable -= b_read;
-		if(m_bytesAvailable == 0) m_hasBytesAvailable = false;
+		//Everything poll() saw is already in the ring, so this never touches the driver
+		m_lastBytesRead = drainRing(str, size);
 		m_errorCode = 0;
 		return true;
 	}
@@ -154,10 +275,17 @@ namespace libnifalcon
             return false;
         }
 
-        unsigned long b_read;
-        if ((m_deviceErrorCode = FT_Read(m_falconDevice, buffer, size, &b_read)) != FT_OK) return false;
-        m_lastBytesRead = b_read;
-        return b_read == size;
+        //Anything poll() already picked up comes first
+        unsigned int from_ring = drainRing(buffer, size);
+        DWORD b_read = 0;
+        m_lastBytesRead = from_ring;
+        if (from_ring < size)
+        {
+            if ((m_deviceErrorCode = FT_Read(m_falconDevice, buffer + from_ring, size - from_ring, &b_read)) != FT_OK) return false;
+            m_lastReadTimestamp = getFalconTimestamp();
+        }
+        m_lastBytesRead = from_ring + b_read;
+        return from_ring + b_read == size;
 	}
 
 	void FalconCommFTD2XX::poll()
@@ -167,7 +295,19 @@ namespace libnifalcon
 			m_errorCode = FALCON_COMM_DEVICE_NOT_VALID_ERROR;
 			return;
 		}
-		if((m_deviceErrorCode = FT_GetQueueStatus(m_falconDevice, (DWORD*)&m_bytesAvailable)) != FT_OK) return;
+		//Only wait if there's nothing to hand out already
+		if(getRingCount() == 0 && !m_isDriverPending && !waitForEvent(m_pollTimeout))
+		{
+#ifdef WIN32
+			return;
+#else
+			//Condition variables don't latch, so a signal sent while we weren't waiting is lost.
+			//Look at the queue once per timeout, so bytes that came in then are late by at most
+			//one timeout instead of stuck until the next packet.
+#endif
+		}
+		fillRing();
+		m_bytesAvailable = getRingCount();
 		m_hasBytesAvailable = (m_bytesAvailable > 0);
 	}
 
@@ -183,6 +323,7 @@ namespace libnifalcon
 			m_errorCode = FALCON_COMM_DEVICE_NOT_FOUND_ERROR;
 			return false;
 		}
+		reset();
 		m_errorCode = FALCON_COMM_DEVICE_ERROR;
 		if((m_deviceErrorCode = FT_SetLatencyTimer(m_falconDevice, 16)) != FT_OK)
 		{
@@ -242,6 +383,7 @@ namespace libnifalcon
 
 	bool FalconCommFTD2XX::setNormalMode()
 	{
+		reset();
 		m_errorCode = FALCON_COMM_DEVICE_ERROR;
 		if((m_deviceErrorCode = FT_SetBaudRate(m_falconDevice, 1456312)) != FT_OK)
 		{
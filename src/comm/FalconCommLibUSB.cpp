@@ -10,7 +10,10 @@
  */
 
 #include "falcon/comm/FalconCommLibUSB.h"
+#include "falcon/core/FalconClock.h"
 #include <iostream>
+#include <sstream>
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
 #include "libusb-1.0/libusb.h"
@@ -65,10 +68,104 @@
 
 namespace libnifalcon
 {
+	const unsigned int FalconCommLibUSB::MAX_UPLOAD_WINDOW;
+
+	//Shared between writeBlockingWithEcho and its transfer callbacks
+	struct EchoUpload
+	{
+		const uint8_t* data;
+		unsigned int size;
+		bool verify;
+		unsigned int written; //Bytes the device has accepted
+		unsigned int echoed; //Bytes echoed back (and checked)
+		unsigned int inFlight; //Transfers libusb still owns
+		bool failed;
+		bool mismatch;
+		bool lost;
+		uint64_t lastProgress;
+	};
+
+	//One upload transfer, handed to its callback as user_data
+	struct EchoTransfer
+	{
+		libusb_transfer* transfer;
+		EchoUpload* upload;
+		bool busy;
+	};
+
+	static void cb_upload_write(libusb_transfer* transfer)
+	{
+		EchoTransfer* t = (EchoTransfer*)transfer->user_data;
+		EchoUpload* upload = t->upload;
+		t->busy = false;
+		--upload->inFlight;
+		if(transfer->status == LIBUSB_TRANSFER_COMPLETED && transfer->actual_length == transfer->length)
+		{
+			upload->written += transfer->actual_length;
+		}
+		else if(transfer->status != LIBUSB_TRANSFER_CANCELLED)
+		{
+			upload->lost |= (transfer->status == LIBUSB_TRANSFER_NO_DEVICE);
+			upload->failed = true;
+		}
+	}
+
+	static void cb_upload_read(libusb_transfer* transfer)
+	{
+		EchoTransfer* t = (EchoTransfer*)transfer->user_data;
+		EchoUpload* upload = t->upload;
+		t->busy = false;
+		--upload->inFlight;
+		if(transfer->status == LIBUSB_TRANSFER_COMPLETED)
+		{
+			//Every packet starts with 2 FTDI modem status bytes
+			unsigned int length = (transfer->actual_length > 2) ? (transfer->actual_length - 2) : 0;
+			if(length == 0)
+			{
+				return;
+			}
+			if(upload->echoed + length > upload->size ||
+			   (upload->verify && memcmp(upload->data + upload->echoed, transfer->buffer + 2, length) != 0))
+			{
+				upload->mismatch = true;
+				upload->failed = true;
+				return;
+			}
+			upload->echoed += length;
+			upload->lastProgress = getFalconTimestamp();
+		}
+		//Timed out reads just get queued again
+		else if(transfer->status != LIBUSB_TRANSFER_CANCELLED && transfer->status != LIBUSB_TRANSFER_TIMED_OUT)
+		{
+			upload->lost |= (transfer->status == LIBUSB_TRANSFER_NO_DEVICE);
+			upload->failed = true;
+		}
+	}
+
+	//Hotplug events are only delivered from inside libusb_handle_events, so this
+	//runs on the thread calling poll()
+	static int cb_hotplug(libusb_context*, libusb_device* device, libusb_hotplug_event event, void* user_data)
+	{
+		((FalconCommLibUSB*)user_data)->onHotplug(device, event == LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED);
+		return 0;
+	}
 
 	FalconCommLibUSB::FalconCommLibUSB() :
 		m_isWriteAllocated(false),
 		m_isReadAllocated(false),
+		m_transfersInFlight(0),
+		m_falconDevice(nullptr),
+		m_stagedWriteSize(0),
+		m_writesSent(0),
+		m_writesCoalesced(0),
+		m_usbContext(nullptr),
+		m_hotplugHandle(0),
+		m_hasHotplug(false),
+		m_busNumber(0),
+		m_portDepth(0),
+		m_lastScanTimestamp(0),
+		m_uploadWindow(4),
+		m_isDeviceCacheValid(false),
 		INIT_LOGGER("FalconCommLibUSB")
 	{
 		LOG_INFO("Constructing object");
@@ -85,6 +182,11 @@ namespace libnifalcon
 			close();
 		}
 		reset();
+		if(m_hasHotplug)
+		{
+			libusb_hotplug_deregister_callback(m_usbContext, m_hotplugHandle);
+		}
+		clearDeviceCache();
 		//libusb_exit(m_usbContext);
 		delete m_tv;
 		LOG_INFO("Destructing object");
@@ -107,61 +209,58 @@ namespace libnifalcon
 		LOG_INFO("Setting libusb debug level to 0");
 		libusb_set_debug(m_usbContext, 0);
 #endif
+		if(libusb_has_capability(LIBUSB_CAP_HAS_HOTPLUG))
+		{
+			m_hasHotplug = (libusb_hotplug_register_callback(m_usbContext,
+															 (libusb_hotplug_event)(LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED | LIBUSB_HOTPLUG_EVENT_DEVICE_LEFT),
+															 LIBUSB_HOTPLUG_NO_FLAGS, FALCON_VENDOR_ID, FALCON_PRODUCT_ID,
+															 LIBUSB_HOTPLUG_MATCH_ANY, cb_hotplug, this, &m_hotplugHandle) == LIBUSB_SUCCESS);
+		}
+		if(!m_hasHotplug)
+		{
+			LOG_INFO("Hotplug not available, falling back to transfer errors for device removal");
+		}
 		return true;
 	}
 
-	//Ripped out of libusb_open_device_with_vid_pid
-	bool FalconCommLibUSB::getDeviceCount(unsigned int& count)
+	//Sorts devices by where they're plugged in, so indexes survive reboots
+	static bool compareLocation(const std::pair<FalconDeviceInfo, libusb_device*>& a, const std::pair<FalconDeviceInfo, libusb_device*>& b)
 	{
-		LOG_INFO("Getting device count");
-		struct libusb_device **devs;
-		struct libusb_device *dev;
-		size_t i = 0;
-		count = 0;
-
-		if (libusb_get_device_list(m_usbContext, &devs) < 0)
+		if(a.first.bus != b.first.bus)
 		{
-			LOG_ERROR("Device list not retrievable");
-			return false;
+			return a.first.bus < b.first.bus;
 		}
+		return a.first.ports < b.first.ports;
+	}
 
-		while ((dev = devs[i++]) != NULL)
+	void FalconCommLibUSB::clearDeviceCache()
+	{
+		for(std::vector<libusb_device*>::iterator i = m_deviceCache.begin(); i != m_deviceCache.end(); ++i)
 		{
-			struct libusb_device_descriptor desc;
-			m_deviceErrorCode = libusb_get_device_descriptor(dev, &desc);
-			if (m_deviceErrorCode < 0)
-			{
-				LOG_ERROR("Device descriptor not retrievable - Device error code " << m_deviceErrorCode);
-				break;
-			}
-			if (desc.idVendor == FALCON_VENDOR_ID && desc.idProduct == FALCON_PRODUCT_ID)
-			{
-				++count;
-			}
+			libusb_unref_device(*i);
 		}
-
-		libusb_free_device_list(devs, 1);
-		return true;
+		m_deviceCache.clear();
+		m_deviceInfoCache.clear();
+		m_isDeviceCacheValid = false;
 	}
 
-	//Ripped out of libusb_open_device_with_vid_pid
-	bool FalconCommLibUSB::open(unsigned int index)
+	bool FalconCommLibUSB::refreshDeviceCache()
 	{
-		LOG_INFO("Opening device");
+		LOG_INFO("Scanning devices");
 		struct libusb_device **devs;
-		struct libusb_device *found = NULL;
 		struct libusb_device *dev;
 		size_t i = 0;
-		unsigned int count = 0;
-
+		ssize_t list_size;
 
-		if ((m_deviceErrorCode = libusb_get_device_list(m_usbContext, &devs)) < 0)
+		if ((list_size = libusb_get_device_list(m_usbContext, &devs)) < 0)
 		{
+			m_deviceErrorCode = (int)list_size;
 			LOG_ERROR("Device list not retrievable - Device error code " << m_deviceErrorCode);
 			m_errorCode = FALCON_COMM_DEVICE_ERROR;
 			return false;
 		}
 
+		std::vector<std::pair<FalconDeviceInfo, libusb_device*> > found;
 		while ((dev = devs[i++]) != NULL)
 		{
 			struct libusb_device_descriptor desc;
@@ -169,40 +268,152 @@ namespace libnifalcon
 			if (m_deviceErrorCode < 0)
 			{
 				LOG_ERROR("Device descriptor not retrievable - Device error code " << m_deviceErrorCode);
-				m_errorCode = FALCON_COMM_DEVICE_ERROR;
-				libusb_free_device_list(devs, 1);
-				return false;
+				continue;
 			}
-			if (desc.idVendor == FALCON_VENDOR_ID && desc.idProduct == FALCON_PRODUCT_ID)
+			if (desc.idVendor != FALCON_VENDOR_ID || desc.idProduct != FALCON_PRODUCT_ID)
 			{
-				if(count == index)
+				continue;
+			}
+
+			FalconDeviceInfo info;
+			uint8_t ports[7];
+			int depth = libusb_get_port_numbers(dev, ports, sizeof(ports));
+			info.bus = libusb_get_bus_number(dev);
+			if(depth > 0)
+			{
+				info.ports.assign(ports, ports + depth);
+				std::ostringstream location;
+				location << info.bus << "-";
+				for(int p = 0; p < depth; ++p)
 				{
-					found = dev;
-					break;
+					location << (p ? "." : "") << (int)ports[p];
 				}
-				++count;
+				info.location = location.str();
 			}
-		}
 
-		if (found)
-		{
-			m_deviceErrorCode = libusb_open(found, &m_falconDevice);
-			if (m_deviceErrorCode < 0)
+			//libusb keeps the same device object for as long as the device stays
+			//attached, so only newly arrived devices need their serial read
+			std::vector<libusb_device*>::iterator cached = std::find(m_deviceCache.begin(), m_deviceCache.end(), dev);
+			if(cached != m_deviceCache.end())
 			{
-				LOG_ERROR("Cannot open device - Device error code " << m_deviceErrorCode);
-				m_falconDevice = nullptr;
-				m_errorCode = FALCON_COMM_DEVICE_ERROR;
-				libusb_free_device_list(devs, 1);
-				return false;
+				info.serial = m_deviceInfoCache[cached - m_deviceCache.begin()].serial;
 			}
+			else if(desc.iSerialNumber != 0)
+			{
+				libusb_device_handle* handle = nullptr;
+				bool opened = false;
+				if(m_falconDevice != nullptr && libusb_get_device(m_falconDevice) == dev)
+				{
+					handle = m_falconDevice;
+				}
+				else if(libusb_open(dev, &handle) == 0)
+				{
+					opened = true;
+				}
+				if(handle != nullptr)
+				{
+					unsigned char serial[64];
+					int length = libusb_get_string_descriptor_ascii(handle, desc.iSerialNumber, serial, sizeof(serial));
+					if(length > 0)
+					{
+						info.serial.assign((const char*)serial, length);
+					}
+				}
+				if(opened)
+				{
+					libusb_close(handle);
+				}
+			}
+			found.push_back(std::make_pair(info, libusb_ref_device(dev)));
 		}
-		else
+		libusb_free_device_list(devs, 1);
+
+		std::stable_sort(found.begin(), found.end(), compareLocation);
+		clearDeviceCache();
+		for(i = 0; i < found.size(); ++i)
+		{
+			found[i].first.index = i;
+			m_deviceInfoCache.push_back(found[i].first);
+			m_deviceCache.push_back(found[i].second);
+		}
+		m_isDeviceCacheValid = true;
+		return true;
+	}
+
+	bool FalconCommLibUSB::updateDeviceCache(bool always_rescan_without_hotplug)
+	{
+		if(m_hasHotplug)
+		{
+			//Pick up any arrivals/removals that haven't been handled yet
+			struct timeval zero = {0, 0};
+			libusb_handle_events_timeout(m_usbContext, &zero);
+		}
+		//Without hotplug we can't tell when the cache goes stale
+		if(!m_isDeviceCacheValid || (always_rescan_without_hotplug && !m_hasHotplug))
+		{
+			return refreshDeviceCache();
+		}
+		return true;
+	}
+
+	bool FalconCommLibUSB::getDeviceCount(unsigned int& count)
+	{
+		LOG_INFO("Getting device count");
+		count = 0;
+		if(!updateDeviceCache(true))
+		{
+			return false;
+		}
+		count = m_deviceCache.size();
+		return true;
+	}
+
+	bool FalconCommLibUSB::getDeviceInfo(std::vector<FalconDeviceInfo>& devices)
+	{
+		LOG_INFO("Getting device info");
+		if(!updateDeviceCache(true))
+		{
+			return false;
+		}
+		devices = m_deviceInfoCache;
+		return true;
+	}
+
+	bool FalconCommLibUSB::open(unsigned int index)
+	{
+		LOG_INFO("Opening device");
+		if(!updateDeviceCache(false))
+		{
+			return false;
+		}
+		if(index >= m_deviceCache.size())
 		{
 			LOG_ERROR("Device index " << index << " out of range");
 			m_errorCode = FALCON_COMM_DEVICE_INDEX_OUT_OF_RANGE_ERROR;
 			return false;
 		}
+		if(!openDevice(m_deviceCache[index]))
+		{
+			//Device went away since the last scan, rescan next time
+			if(m_deviceErrorCode == LIBUSB_ERROR_NO_DEVICE)
+			{
+				m_isDeviceCacheValid = false;
+			}
+			return false;
+		}
+		return true;
+	}
 
+	bool FalconCommLibUSB::openDevice(libusb_device* device)
+	{
+		m_deviceErrorCode = libusb_open(device, &m_falconDevice);
+		if (m_deviceErrorCode < 0)
+		{
+			LOG_ERROR("Cannot open device - Device error code " << m_deviceErrorCode);
+			m_falconDevice = nullptr;
+			m_errorCode = FALCON_COMM_DEVICE_ERROR;
+			return false;
+		}
 
 		if ((m_deviceErrorCode = libusb_claim_interface(m_falconDevice, 0)) < 0)
 		{
@@ -222,6 +433,16 @@ namespace libnifalcon
 			LOG_ERROR("Cannot tx purge - Device error code " << m_deviceErrorCode);
 			return false;
 		}
+
+		m_busNumber = libusb_get_bus_number(device);
+		m_portDepth = libusb_get_port_numbers(device, m_portNumbers, sizeof(m_portNumbers));
+		if(m_portDepth < 0)
+		{
+			m_portDepth = 0;
+		}
+		m_isDeviceConnected = true;
+		m_hasDeviceReturned = false;
+
 		reset();
 		m_isCommOpen = true;
 		setNormalMode();
@@ -229,6 +450,124 @@ namespace libnifalcon
 		return true;
 	}
 
+	bool FalconCommLibUSB::isAtOpenedLocation(libusb_device* device)
+	{
+		if(m_portDepth == 0 || libusb_get_bus_number(device) != m_busNumber)
+		{
+			return false;
+		}
+		uint8_t ports[7];
+		int depth = libusb_get_port_numbers(device, ports, sizeof(ports));
+		return depth == m_portDepth && memcmp(ports, m_portNumbers, depth) == 0;
+	}
+
+	struct libusb_device* FalconCommLibUSB::findOpenedLocation(struct libusb_device** devs)
+	{
+		struct libusb_device *dev;
+		size_t i = 0;
+		while ((dev = devs[i++]) != NULL)
+		{
+			struct libusb_device_descriptor desc;
+			if (libusb_get_device_descriptor(dev, &desc) < 0)
+			{
+				continue;
+			}
+			if (desc.idVendor == FALCON_VENDOR_ID && desc.idProduct == FALCON_PRODUCT_ID && isAtOpenedLocation(dev))
+			{
+				return dev;
+			}
+		}
+		return NULL;
+	}
+
+	void FalconCommLibUSB::setDeviceLost()
+	{
+		if(!m_isDeviceConnected)
+		{
+			return;
+		}
+		LOG_WARN("Device lost");
+		m_isDeviceConnected = false;
+		m_hasDeviceReturned = false;
+		m_hasBytesAvailable = false;
+		m_bytesAvailable = 0;
+		m_stagedWriteSize = 0;
+	}
+
+	void FalconCommLibUSB::onHotplug(libusb_device* device, bool arrived)
+	{
+		m_isDeviceCacheValid = false;
+		if(!m_isCommOpen)
+		{
+			return;
+		}
+		if(!arrived && m_isDeviceConnected && m_falconDevice != nullptr && libusb_get_device(m_falconDevice) == device)
+		{
+			setDeviceLost();
+		}
+		else if(arrived && !m_isDeviceConnected && isAtOpenedLocation(device))
+		{
+			LOG_INFO("Device returned");
+			m_hasDeviceReturned = true;
+		}
+	}
+
+	bool FalconCommLibUSB::reconnect()
+	{
+		LOG_INFO("Reconnecting device");
+		if(!m_isCommOpen)
+		{
+			LOG_ERROR("Device not open");
+			m_errorCode = FALCON_COMM_DEVICE_NOT_VALID_ERROR;
+			return false;
+		}
+
+		//Drop the stale handle, once nothing queued on it is left
+		drainTransfers();
+		if(m_falconDevice != nullptr)
+		{
+			libusb_release_interface(m_falconDevice, 0);
+			libusb_close(m_falconDevice);
+			m_falconDevice = nullptr;
+		}
+		m_isCommOpen = false;
+
+		struct libusb_device **devs;
+		if ((m_deviceErrorCode = libusb_get_device_list(m_usbContext, &devs)) < 0)
+		{
+			LOG_ERROR("Device list not retrievable - Device error code " << m_deviceErrorCode);
+			m_errorCode = FALCON_COMM_DEVICE_ERROR;
+			m_isCommOpen = true;
+			return false;
+		}
+		struct libusb_device *found = findOpenedLocation(devs);
+
+		bool opened = false;
+		if(found)
+		{
+			opened = openDevice(found);
+		}
+		else
+		{
+			LOG_ERROR("Device not present");
+			m_errorCode = FALCON_COMM_DEVICE_NOT_FOUND_ERROR;
+		}
+		libusb_free_device_list(devs, 1);
+		if(!opened)
+		{
+			//Stay "open" so the device can keep trying
+			if(m_falconDevice != nullptr)
+			{
+				libusb_close(m_falconDevice);
+				m_falconDevice = nullptr;
+			}
+			m_isCommOpen = true;
+			m_isDeviceConnected = false;
+			m_hasDeviceReturned = false;
+		}
+		return opened;
+	}
+
 	bool FalconCommLibUSB::close()
 	{
 		LOG_INFO("Closing device communications");
@@ -240,14 +579,18 @@ namespace libnifalcon
 		}
 		m_isCommOpen = false;
 
-		if ((m_deviceErrorCode = libusb_release_interface(m_falconDevice, 0)) < 0)
+		if(m_falconDevice == nullptr)
+		{
+			return true;
+		}
+		drainTransfers();
+		if ((m_deviceErrorCode = libusb_release_interface(m_falconDevice, 0)) < 0 && m_isDeviceConnected)
 		{
 			m_errorCode = FALCON_COMM_DEVICE_ERROR;
 			LOG_ERROR("Cannot release device interface - Device error code " << m_deviceErrorCode);
 			return false;
 		}
 
-		reset();
 		libusb_close(m_falconDevice);
 		m_falconDevice = nullptr;
 		return true;
@@ -267,6 +610,11 @@ namespace libnifalcon
 			m_errorCode = FALCON_COMM_DEVICE_NOT_VALID_ERROR;
 			return false;
 		}
+		if(!m_isDeviceConnected)
+		{
+			m_errorCode = FALCON_COMM_DEVICE_DISCONNECTED_ERROR;
+			return false;
+		}
         if (m_isReadAllocated) std::cout << "Ouch!\n";
 		if(m_hasBytesAvailable && m_bytesAvailable == 0)
 		{
@@ -304,8 +652,46 @@ namespace libnifalcon
 			m_errorCode = FALCON_COMM_DEVICE_NOT_VALID_ERROR;
 			return false;
 		}
+		if(!m_isDeviceConnected)
+		{
+			m_errorCode = FALCON_COMM_DEVICE_DISCONNECTED_ERROR;
+			return false;
+		}
+
+		if(size > sizeof(input))
+		{
+			LOG_ERROR("Write of " << size << " bytes is larger than the write buffer");
+			m_errorCode = FALCON_COMM_WRITE_ERROR;
+			return false;
+		}
 
 		m_lastBytesWritten = size;
+		if(m_isWriteAllocated)
+		{
+			//Previous write still in flight. Stage this one, replacing anything
+			//staged that hasn't gone out yet.
+			if(m_stagedWriteSize > 0)
+			{
+				++m_writesCoalesced;
+			}
+			memcpy(m_stagedWrite, buffer, size);
+			m_stagedWriteSize = size;
+		}
+		else
+		{
+			memcpy(input, buffer, size);
+			if(!submitWrite(size))
+			{
+				return false;
+			}
+		}
+		m_hasBytesAvailable = false;
+		issueRead();
+		return true;
+	}
+
+	bool FalconCommLibUSB::submitWrite(unsigned int size)
+	{
 		in_transfer = libusb_alloc_transfer(0);
 		if (!in_transfer)
 		{
@@ -314,15 +700,33 @@ namespace libnifalcon
 			return false;
 		}
 
-		libusb_fill_bulk_transfer(in_transfer, m_falconDevice, 0x02, buffer,
+		libusb_fill_bulk_transfer(in_transfer, m_falconDevice, 0x02, input,
 								  size, FalconCommLibUSB::cb_in, this, 0);
-		libusb_submit_transfer(in_transfer);
+		if((m_deviceErrorCode = libusb_submit_transfer(in_transfer)) != 0)
+		{
+			LOG_ERROR("Cannot submit write - Device error " << m_deviceErrorCode);
+			libusb_free_transfer(in_transfer);
+			m_errorCode = FALCON_COMM_WRITE_ERROR;
+			return false;
+		}
 		m_isWriteAllocated = true;
-		m_hasBytesAvailable = false;
-		issueRead();
+		++m_transfersInFlight;
+		++m_writesSent;
 		return true;
 	}
 
+	void FalconCommLibUSB::setSent()
+	{
+		m_isWriteAllocated = false;
+		if(m_stagedWriteSize > 0 && m_isCommOpen && m_isDeviceConnected)
+		{
+			unsigned int size = m_stagedWriteSize;
+			m_stagedWriteSize = 0;
+			memcpy(input, m_stagedWrite, size);
+			submitWrite(size);
+		}
+	}
+
 	bool FalconCommLibUSB::readBlocking(uint8_t* buffer, unsigned int size)
 	{
 		LOG_DEBUG("Reading " << size << " bytes blocking");
@@ -364,6 +768,161 @@ namespace libnifalcon
 		return true;
 	}
 
+	void FalconCommLibUSB::setUploadWindow(unsigned int chunks)
+	{
+		m_uploadWindow = (chunks < 1) ? 1 : ((chunks > MAX_UPLOAD_WINDOW) ? MAX_UPLOAD_WINDOW : chunks);
+	}
+
+	bool FalconCommLibUSB::writeBlockingWithEcho(uint8_t* buffer, unsigned int size, bool verify)
+	{
+		LOG_DEBUG("Writing " << size << " bytes with echo, window " << m_uploadWindow);
+		if(!m_isCommOpen)
+		{
+			LOG_ERROR("Device not open");
+			m_errorCode = FALCON_COMM_DEVICE_NOT_VALID_ERROR;
+			return false;
+		}
+
+		//Two reads queued at all times, so one is always waiting while the other's
+		//callback runs. The echo has to be pulled off the FTDI as fast as it comes in,
+		//or its receive buffer overflows and bytes get dropped.
+		const unsigned int READ_COUNT = 2;
+		const uint64_t STALL_TIMEOUT = 1000000000ULL;
+		EchoUpload upload;
+		EchoTransfer writes[MAX_UPLOAD_WINDOW];
+		EchoTransfer reads[READ_COUNT];
+		unsigned char read_buffers[READ_COUNT][64];
+		unsigned int submitted = 0;
+
+		upload.data = buffer;
+		upload.size = size;
+		upload.verify = verify;
+		upload.written = 0;
+		upload.echoed = 0;
+		upload.inFlight = 0;
+		upload.failed = false;
+		upload.mismatch = false;
+		upload.lost = false;
+		upload.lastProgress = getFalconTimestamp();
+
+		for(unsigned int i = 0; i < m_uploadWindow; ++i)
+		{
+			writes[i].upload = &upload;
+			writes[i].busy = false;
+			upload.failed |= ((writes[i].transfer = libusb_alloc_transfer(0)) == NULL);
+		}
+		for(unsigned int i = 0; i < READ_COUNT; ++i)
+		{
+			reads[i].upload = &upload;
+			reads[i].busy = false;
+			upload.failed |= ((reads[i].transfer = libusb_alloc_transfer(0)) == NULL);
+		}
+		if(upload.failed)
+		{
+			LOG_ERROR("Cannot allocate upload transfers");
+		}
+
+		struct timeval tv = {0, 1000};
+		while(!upload.failed && upload.echoed < size)
+		{
+			//Keep the window full, but never get more than a window ahead of the
+			//echo, so a device that stops answering doesn't have the whole image queued at it
+			for(unsigned int i = 0; i < m_uploadWindow && submitted < size && submitted - upload.echoed < m_uploadWindow * ECHO_CHUNK_SIZE; ++i)
+			{
+				if(writes[i].busy)
+				{
+					continue;
+				}
+				unsigned int chunk = (size - submitted < ECHO_CHUNK_SIZE) ? (size - submitted) : ECHO_CHUNK_SIZE;
+				libusb_fill_bulk_transfer(writes[i].transfer, m_falconDevice, 0x02, buffer + submitted, chunk, cb_upload_write, &writes[i], 1000);
+				if((m_deviceErrorCode = libusb_submit_transfer(writes[i].transfer)) != 0)
+				{
+					LOG_ERROR("Cannot submit upload write - Device error " << m_deviceErrorCode);
+					upload.failed = true;
+					break;
+				}
+				writes[i].busy = true;
+				++upload.inFlight;
+				submitted += chunk;
+			}
+			for(unsigned int i = 0; i < READ_COUNT && !upload.failed; ++i)
+			{
+				if(reads[i].busy)
+				{
+					continue;
+				}
+				libusb_fill_bulk_transfer(reads[i].transfer, m_falconDevice, 0x81, read_buffers[i], 64, cb_upload_read, &reads[i], 100);
+				if((m_deviceErrorCode = libusb_submit_transfer(reads[i].transfer)) != 0)
+				{
+					LOG_ERROR("Cannot submit upload read - Device error " << m_deviceErrorCode);
+					upload.failed = true;
+					break;
+				}
+				reads[i].busy = true;
+				++upload.inFlight;
+			}
+			if(upload.failed)
+			{
+				break;
+			}
+
+			libusb_handle_events_timeout(m_usbContext, &tv);
+
+			if(getFalconTimestamp() - upload.lastProgress > STALL_TIMEOUT)
+			{
+				LOG_ERROR("Firmware echo stalled at " << upload.echoed << " of " << size << " bytes");
+				upload.failed = true;
+			}
+		}
+
+		//Nothing can be freed while libusb still owns it
+		for(unsigned int i = 0; i < m_uploadWindow; ++i)
+		{
+			if(writes[i].busy)
+			{
+				libusb_cancel_transfer(writes[i].transfer);
+			}
+		}
+		for(unsigned int i = 0; i < READ_COUNT; ++i)
+		{
+			if(reads[i].busy)
+			{
+				libusb_cancel_transfer(reads[i].transfer);
+			}
+		}
+		while(upload.inFlight > 0)
+		{
+			libusb_handle_events_timeout(m_usbContext, &tv);
+		}
+		for(unsigned int i = 0; i < m_uploadWindow; ++i)
+		{
+			libusb_free_transfer(writes[i].transfer);
+		}
+		for(unsigned int i = 0; i < READ_COUNT; ++i)
+		{
+			libusb_free_transfer(reads[i].transfer);
+		}
+
+		m_lastBytesWritten = upload.written;
+		m_lastBytesRead = upload.echoed;
+		if(upload.lost)
+		{
+			setDeviceLost();
+		}
+		if(upload.mismatch)
+		{
+			LOG_ERROR("Firmware echo mismatch at " << upload.echoed << " of " << size << " bytes");
+			m_errorCode = FALCON_COMM_ECHO_MISMATCH_ERROR;
+			return false;
+		}
+		if(upload.failed)
+		{
+			m_errorCode = upload.lost ? FALCON_COMM_DEVICE_DISCONNECTED_ERROR : FALCON_COMM_WRITE_ERROR;
+			return false;
+		}
+		return true;
+	}
+
 	bool FalconCommLibUSB::setFirmwareMode()
 	{
     const int receive_buf_size(512);
@@ -585,10 +1144,26 @@ namespace libnifalcon
 	void FalconCommLibUSB::poll()
 	{
 		libusb_handle_events_timeout(m_usbContext, m_tv);
+		//Without hotplug, look for a lost device coming back a couple of times a second
+		if(!m_hasHotplug && m_isCommOpen && !m_isDeviceConnected && !m_hasDeviceReturned)
+		{
+			uint64_t now = getFalconTimestamp();
+			if(now - m_lastScanTimestamp > 500000000ULL)
+			{
+				m_lastScanTimestamp = now;
+				struct libusb_device **devs;
+				if (libusb_get_device_list(m_usbContext, &devs) >= 0)
+				{
+					m_hasDeviceReturned = (findOpenedLocation(devs) != NULL);
+					libusb_free_device_list(devs, 1);
+				}
+			}
+		}
 	}
 
 	void FalconCommLibUSB::reset()
 	{
+		m_stagedWriteSize = 0;
 		if(m_isWriteAllocated)
 		{
 			libusb_cancel_transfer(in_transfer);
@@ -620,10 +1195,31 @@ namespace libnifalcon
 			return;
 		}
 
-        m_isReadAllocated = true;
 		libusb_fill_bulk_transfer(out_transfer, m_falconDevice, 0x81, output,
 								  64, FalconCommLibUSB::cb_out, this, 1000);
-		libusb_submit_transfer(out_transfer);
+		if((m_deviceErrorCode = libusb_submit_transfer(out_transfer)) != 0)
+		{
+			LOG_ERROR("Cannot submit read - Device error " << m_deviceErrorCode);
+			libusb_free_transfer(out_transfer);
+			m_errorCode = FALCON_COMM_READ_ERROR;
+			return;
+		}
+		m_isReadAllocated = true;
+		++m_transfersInFlight;
+	}
+
+	void FalconCommLibUSB::drainTransfers()
+	{
+		reset();
+		//Cancelling only asks libusb to stop the transfers. They complete, and their callbacks run, from
+		//inside libusb_handle_events, so keep handling events until the last one is back.
+		struct timeval tv = {0, 10000};
+		while(m_transfersInFlight > 0)
+		{
+			libusb_handle_events_timeout(m_usbContext, &tv);
+		}
+		m_hasBytesAvailable = false;
+		m_bytesAvailable = 0;
 	}
 
 	void FalconCommLibUSB::setBytesAvailable(uint32_t b)
@@ -639,26 +1235,47 @@ namespace libnifalcon
 
 	void FalconCommLibUSB::cb_in(struct libusb_transfer *transfer)
 	{
-		((FalconCommLibUSB*)transfer->user_data)->setSent();
+		--((FalconCommLibUSB*)transfer->user_data)->m_transfersInFlight;
+		//Cancelled transfers have already been accounted for in reset(), and
+		//another write may be in flight by now
+		if(transfer->status == LIBUSB_TRANSFER_NO_DEVICE)
+		{
+			((FalconCommLibUSB*)transfer->user_data)->setDeviceLost();
+		}
+		if(transfer->status != LIBUSB_TRANSFER_CANCELLED)
+		{
+			((FalconCommLibUSB*)transfer->user_data)->setSent();
+		}
 		libusb_free_transfer(transfer);
 	}
 
 	void FalconCommLibUSB::cb_out(struct libusb_transfer *transfer)
 	{
+		--((FalconCommLibUSB*)transfer->user_data)->m_transfersInFlight;
 		if(transfer->status == LIBUSB_TRANSFER_COMPLETED && transfer->actual_length >= 2)
 		{
+			((FalconCommLibUSB*)transfer->user_data)->setLastReadTimestamp(getFalconTimestamp());
 			((FalconCommLibUSB*)transfer->user_data)->setBytesAvailable(transfer->actual_length);
 			((FalconCommLibUSB*)transfer->user_data)->setHasBytesAvailable(true);
 			((FalconCommLibUSB*)transfer->user_data)->setReceived();
 		}
 		else
 		{
-			// We can't assume 0 bytes back = disconnected on linux, as it causes massive problems
-			// with other applications (mainly Pd). So, just set that we got nothing back and try to figure out
-			// some other way to detect unplugs
-			((FalconCommLibUSB*)transfer->user_data)->setBytesAvailable(0);
-			((FalconCommLibUSB*)transfer->user_data)->setHasBytesAvailable(false);
-			((FalconCommLibUSB*)transfer->user_data)->setReceived();
+			if(transfer->status == LIBUSB_TRANSFER_NO_DEVICE)
+			{
+				((FalconCommLibUSB*)transfer->user_data)->setDeviceLost();
+			}
+			//As with writes, cancelled reads have already been accounted for in reset(), and
+			//another read may be in flight by now
+			if(transfer->status != LIBUSB_TRANSFER_CANCELLED)
+			{
+				// We can't assume 0 bytes back = disconnected on linux, as it causes massive problems
+				// with other applications (mainly Pd). So, just set that we got nothing back and try to figure out
+				// some other way to detect unplugs
+				((FalconCommLibUSB*)transfer->user_data)->setBytesAvailable(0);
+				((FalconCommLibUSB*)transfer->user_data)->setHasBytesAvailable(false);
+				((FalconCommLibUSB*)transfer->user_data)->setReceived();
+			}
 		}
 		libusb_free_transfer(transfer);
 	}
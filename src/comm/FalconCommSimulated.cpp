@@ -0,0 +1,328 @@
+/***
+ * @file FalconCommSimulated.cpp
+ * @brief Hardware-free communications core that behaves like a falcon running the Novint SDK firmware
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#include "falcon/comm/FalconCommSimulated.h"
+#include "falcon/core/FalconGeometry.h"
+#include "falcon/core/FalconClock.h"
+#include <cstring>
+#include <sstream>
+#include <cmath>
+
+namespace libnifalcon
+{
+	unsigned int FalconCommSimulated::s_deviceCount = 1;
+
+	FalconCommSimulated::FalconCommSimulated() :
+		m_firmwareMode(false),
+		m_firmwareLoaded(true),
+		m_firmwareBytes(0),
+		m_gripInfo(0),
+		m_homingStatus(0),
+		m_ledStatus(0),
+		m_autoHome(true),
+		m_echoSize(0),
+		INIT_LOGGER("FalconCommSimulated")
+	{
+		for(int i = 0; i < 3; ++i)
+		{
+			m_encoderValues[i] = 0;
+			m_motorValues[i] = 0;
+		}
+		memset(m_reply, 0, 16);
+	}
+
+	FalconCommSimulated::~FalconCommSimulated()
+	{
+		if(m_isCommOpen)
+		{
+			close();
+		}
+	}
+
+	bool FalconCommSimulated::getDeviceCount(unsigned int& count)
+	{
+		count = s_deviceCount;
+		return true;
+	}
+
+	bool FalconCommSimulated::getDeviceInfo(std::vector<FalconDeviceInfo>& devices)
+	{
+		devices.clear();
+		for(unsigned int i = 0; i < s_deviceCount; ++i)
+		{
+			FalconDeviceInfo info;
+			std::ostringstream serial, location;
+			serial << "SIMULATED" << i;
+			location << "0-" << (i + 1);
+			info.index = i;
+			info.serial = serial.str();
+			info.location = location.str();
+			info.bus = 0;
+			info.ports.push_back(i + 1);
+			devices.push_back(info);
+		}
+		return true;
+	}
+
+	bool FalconCommSimulated::open(unsigned int index)
+	{
+		LOG_INFO("Opening simulated device " << index);
+		if(index >= s_deviceCount)
+		{
+			LOG_ERROR("Device index " << index << " out of range");
+			m_errorCode = FALCON_COMM_DEVICE_INDEX_OUT_OF_RANGE_ERROR;
+			return false;
+		}
+		reset();
+		m_isCommOpen = true;
+		setNormalMode();
+		return true;
+	}
+
+	bool FalconCommSimulated::close()
+	{
+		if(!m_isCommOpen)
+		{
+			LOG_ERROR("Device not open");
+			m_errorCode = FALCON_COMM_DEVICE_NOT_VALID_ERROR;
+			return false;
+		}
+		m_isCommOpen = false;
+		reset();
+		return true;
+	}
+
+	bool FalconCommSimulated::reconnect()
+	{
+		if(!m_isCommOpen)
+		{
+			LOG_ERROR("Device not open");
+			m_errorCode = FALCON_COMM_DEVICE_NOT_VALID_ERROR;
+			return false;
+		}
+		if(!m_hasDeviceReturned)
+		{
+			m_errorCode = FALCON_COMM_DEVICE_NOT_FOUND_ERROR;
+			return false;
+		}
+		m_isDeviceConnected = true;
+		m_hasDeviceReturned = false;
+		setNormalMode();
+		return true;
+	}
+
+	void FalconCommSimulated::setConnected(bool connected)
+	{
+		if(!connected)
+		{
+			m_isDeviceConnected = false;
+			m_hasDeviceReturned = false;
+			m_homingStatus = 0;
+			reset();
+		}
+		else if(!m_isDeviceConnected)
+		{
+			m_hasDeviceReturned = true;
+		}
+	}
+
+	void FalconCommSimulated::reset()
+	{
+		m_hasBytesAvailable = false;
+		m_bytesAvailable = 0;
+		m_lastBytesRead = 0;
+		m_lastBytesWritten = 0;
+		m_echoSize = 0;
+	}
+
+	bool FalconCommSimulated::read(uint8_t* str, unsigned int size)
+	{
+		if(!m_isCommOpen)
+		{
+			LOG_ERROR("Device not open");
+			m_errorCode = FALCON_COMM_DEVICE_NOT_VALID_ERROR;
+			return false;
+		}
+		if(!m_isDeviceConnected)
+		{
+			m_errorCode = FALCON_COMM_DEVICE_DISCONNECTED_ERROR;
+			return false;
+		}
+		if(size > (unsigned int)m_bytesAvailable)
+		{
+			size = m_bytesAvailable;
+		}
+		memcpy(str, m_reply + (16 - m_bytesAvailable), size);
+		m_bytesAvailable -= size;
+		m_lastBytesRead = size;
+		m_hasBytesAvailable = (m_bytesAvailable > 0);
+		m_lastReadTimestamp = getFalconTimestamp();
+		return true;
+	}
+
+	bool FalconCommSimulated::write(uint8_t* str, unsigned int size)
+	{
+		if(!m_isCommOpen)
+		{
+			LOG_ERROR("Device not open");
+			m_errorCode = FALCON_COMM_DEVICE_NOT_VALID_ERROR;
+			return false;
+		}
+		if(!m_isDeviceConnected)
+		{
+			m_errorCode = FALCON_COMM_DEVICE_DISCONNECTED_ERROR;
+			return false;
+		}
+		m_lastBytesWritten = size;
+		//The firmware only ever answers whole packets
+		if(!m_firmwareLoaded || size != 16 || str[0] != '<' || str[15] != '>')
+		{
+			return true;
+		}
+		for(int i = 0; i < 3; ++i)
+		{
+			int idx = 1 + (i*4);
+			int16_t val =
+				((str[idx] - 0x41) & 0xf) |
+				(((str[idx+1] - 0x41) & 0xf) << 4) |
+				(((str[idx+2] - 0x41) & 0xf) << 8) |
+				(((str[idx+3] - 0x41) & 0xf) << 12);
+			m_motorValues[i] = val;
+		}
+		uint8_t control = str[13] - 0x41;
+		m_ledStatus = control & 0xe;
+		if((control & 0x1) && m_autoHome)
+		{
+			m_homingStatus = 0x7;
+		}
+		buildReply();
+		m_bytesAvailable = 16;
+		m_hasBytesAvailable = true;
+		return true;
+	}
+
+	void FalconCommSimulated::buildReply()
+	{
+		m_reply[0] = '<';
+		m_reply[15] = '>';
+		for(int i = 0; i < 3; ++i)
+		{
+			int idx = 1 + (i*4);
+			int val = m_encoderValues[i];
+			m_reply[idx]   = (val & 0x000f);
+			m_reply[idx+1] = (val & 0x00f0) >> 4;
+			m_reply[idx+2] = (val & 0x0f00) >> 8;
+			m_reply[idx+3] = (val & 0xf000) >> 12;
+		}
+		m_reply[13] = ((m_homingStatus & 0x7) << 4) | (m_gripInfo & 0xf);
+		m_reply[14] = 0;
+		for(int i = 1; i < 15; ++i)
+		{
+			m_reply[i] += 0x41;
+		}
+	}
+
+	bool FalconCommSimulated::readBlocking(uint8_t* str, unsigned int size)
+	{
+		if(!m_isCommOpen)
+		{
+			LOG_ERROR("Device not open");
+			m_errorCode = FALCON_COMM_DEVICE_NOT_VALID_ERROR;
+			return false;
+		}
+		if(size > m_echoSize)
+		{
+			size = m_echoSize;
+		}
+		memcpy(str, m_echo, size);
+		memmove(m_echo, m_echo + size, m_echoSize - size);
+		m_echoSize -= size;
+		m_lastBytesRead = size;
+		return true;
+	}
+
+	bool FalconCommSimulated::writeBlocking(uint8_t* str, unsigned int size)
+	{
+		if(!m_isCommOpen)
+		{
+			LOG_ERROR("Device not open");
+			m_errorCode = FALCON_COMM_DEVICE_NOT_VALID_ERROR;
+			return false;
+		}
+		if(size > sizeof(m_echo) - m_echoSize)
+		{
+			m_errorCode = FALCON_COMM_WRITE_ERROR;
+			return false;
+		}
+		memcpy(m_echo + m_echoSize, str, size);
+		m_echoSize += size;
+		m_firmwareBytes += size;
+		m_lastBytesWritten = size;
+		return true;
+	}
+
+	bool FalconCommSimulated::setFirmwareMode()
+	{
+		if(!m_isCommOpen)
+		{
+			LOG_ERROR("Device not open");
+			m_errorCode = FALCON_COMM_DEVICE_NOT_VALID_ERROR;
+			return false;
+		}
+		reset();
+		m_firmwareMode = true;
+		m_firmwareLoaded = false;
+		m_firmwareBytes = 0;
+		return true;
+	}
+
+	bool FalconCommSimulated::setNormalMode()
+	{
+		if(!m_isCommOpen)
+		{
+			LOG_ERROR("Device not open");
+			m_errorCode = FALCON_COMM_DEVICE_NOT_VALID_ERROR;
+			return false;
+		}
+		reset();
+		if(m_firmwareMode && m_firmwareBytes > 0)
+		{
+			m_firmwareLoaded = true;
+		}
+		m_firmwareMode = false;
+		return true;
+	}
+
+	void FalconCommSimulated::setEncoderValues(const std::array<int, 3>& encoders)
+	{
+		for(int i = 0; i < 3; ++i)
+		{
+			m_encoderValues[i] = encoders[i];
+		}
+	}
+
+	void FalconCommSimulated::setAngles(const std::array<double, 3>& angles, const FalconGeometryParameters& geometry)
+	{
+		//Inverse of FalconKinematic::getTheta(int, unsigned int), after the radian conversion getPosition does
+		const double enc_to_arc = (SHAFT_DIAMETER*PI) / (WHEEL_SLOTS_NUMBER*4);
+		const double arc_per_degree = (PI*SMALL_ARM_DIAMETER) / 360.0;
+		for(int i = 0; i < 3; ++i)
+		{
+			m_encoderValues[i] = (int)std::floor(((angles[i] * (180.0 / PI) - geometry.theta_offset[i]) * arc_per_degree) / enc_to_arc + 0.5);
+		}
+	}
+
+	std::array<int, 3> FalconCommSimulated::getMotorValues()
+	{
+		std::array<int, 3> motors = {{m_motorValues[0], m_motorValues[1], m_motorValues[2]}};
+		return motors;
+	}
+}
@@ -0,0 +1,61 @@
+/***
+ * @file FalconComm.cpp
+ * @brief Base class for falcon communications policy classes
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#include "falcon/core/FalconComm.h"
+#include <cstring>
+
+namespace libnifalcon
+{
+	bool FalconComm::writeBlockingWithEcho(uint8_t* str, unsigned int size, bool verify)
+	{
+		//A device that's stopped echoing only hands back status bytes, so don't
+		//wait on it forever
+		const unsigned int MAX_EMPTY_READS = 10;
+		uint8_t receive_buf[128];
+		unsigned int total = 0;
+
+		while(total < size)
+		{
+			unsigned int chunk = (size - total < ECHO_CHUNK_SIZE) ? (size - total) : ECHO_CHUNK_SIZE;
+			if(!writeBlocking(str + total, chunk))
+			{
+				return false;
+			}
+			unsigned int echoed = 0;
+			unsigned int empty_reads = 0;
+			while(echoed < chunk)
+			{
+				if(!readBlocking(receive_buf, chunk - echoed))
+				{
+					m_errorCode = FALCON_COMM_READ_ERROR;
+					return false;
+				}
+				if(m_lastBytesRead <= 0)
+				{
+					if(++empty_reads == MAX_EMPTY_READS)
+					{
+						m_errorCode = FALCON_COMM_READ_ERROR;
+						return false;
+					}
+					continue;
+				}
+				if((unsigned int)m_lastBytesRead > chunk - echoed || (verify && memcmp(str + total + echoed, receive_buf, m_lastBytesRead) != 0))
+				{
+					m_errorCode = FALCON_COMM_ECHO_MISMATCH_ERROR;
+					return false;
+				}
+				echoed += m_lastBytesRead;
+			}
+			total += chunk;
+		}
+		return true;
+	}
+}
@@ -17,6 +17,7 @@
 #else
 #error "Cannot build FalconDevice class without default comm core"
 #endif
+#include "falcon/core/FalconClock.h"
 #include <iostream>
 
 namespace libnifalcon
@@ -24,6 +25,10 @@ namespace libnifalcon
 
     FalconDevice::FalconDevice() :
 		m_errorCount(0),
+		m_autoReconnect(true),
+		m_reconnectCount(0),
+		m_lastReconnectTime(0),
+		m_lastEstimatorTimestamp(0),
 		INIT_LOGGER("FalconDevice")
 	{
         m_forceVec[0] = 0.0;
@@ -32,6 +37,10 @@ namespace libnifalcon
         m_position[0] = 0.0;
         m_position[1] = 0.0;
         m_position[2] = 0.0;
+		m_velocity.fill(0.0);
+		m_acceleration.fill(0.0);
+		m_forceFieldVec.fill(0.0);
+		m_hapticForceVec.fill(0.0);
 
 #if defined(LIBNIFALCON_USE_LIBUSB)
 		setFalconComm<FalconCommLibUSB>();
@@ -68,13 +77,90 @@ namespace libnifalcon
 			m_errorCode = m_falconComm->getErrorCode();
 			return false;
 		}
+		if(m_geometryStore != nullptr)
+		{
+			loadGeometry(index);
+		}
 		if(m_falconFirmware != nullptr)
 		{
 			m_falconFirmware->resetFirmwareState();
 		}
+		if(m_falconVelocityEstimator != nullptr)
+		{
+			m_falconVelocityEstimator->reset();
+		}
+		if(m_forceInterpolator != nullptr)
+		{
+			m_forceInterpolator->reset();
+		}
+		if(m_hapticRenderer != nullptr)
+		{
+			m_hapticRenderer->reset();
+		}
+		return true;
+	}
+
+	void FalconDevice::loadGeometry(unsigned int index)
+	{
+		//Each unit is calibrated separately, so a unit without a stored geometry
+		//mustn't keep the last one's
+		FalconGeometryParameters geometry;
+		std::vector<FalconDeviceInfo> devices;
+		if(m_falconComm->getDeviceInfo(devices))
+		{
+			for(std::vector<FalconDeviceInfo>::const_iterator i = devices.begin(); i != devices.end(); ++i)
+			{
+				if(i->index != index)
+				{
+					continue;
+				}
+				if(m_geometryStore->load(i->serial, geometry))
+				{
+					LOG_INFO("Loaded geometry for serial " << i->serial);
+				}
+				else
+				{
+					LOG_INFO("No stored geometry for serial " << i->serial << ", using nominal geometry");
+				}
+				break;
+			}
+		}
+		setGeometry(geometry);
+	}
+
+	bool FalconDevice::getDeviceInfo(std::vector<FalconDeviceInfo>& devices)
+	{
+		if(m_falconComm == nullptr)
+		{
+			LOG_ERROR("Cannot get device info - Communications not established");
+			m_errorCode = FALCON_DEVICE_NO_COMM_SET;
+			return false;
+		}
+		if(!m_falconComm->getDeviceInfo(devices))
+		{
+			m_errorCode = m_falconComm->getErrorCode();
+			return false;
+		}
 		return true;
 	}
 
+	bool FalconDevice::open(const std::string& id)
+	{
+		if(m_falconComm == nullptr)
+		{
+			m_errorCode = FALCON_DEVICE_NO_COMM_SET;
+			return false;
+		}
+		unsigned int index;
+		if(!m_falconComm->findDevice(id, index))
+		{
+			LOG_ERROR("No device with serial or location " << id);
+			m_errorCode = m_falconComm->getErrorCode();
+			return false;
+		}
+		return open(index);
+	}
+
 	void FalconDevice::close()
     {
 		if(m_falconComm == nullptr)
@@ -119,6 +205,21 @@ namespace libnifalcon
 		return m_falconFirmware->loadFirmware(skip_checksum);
 	}
 
+	bool FalconDevice::loadFirmwareImage(bool skip_checksum, const std::string& name)
+	{
+		if(m_falconFirmware == nullptr)
+		{
+			m_errorCode = FALCON_DEVICE_NO_FIRMWARE_SET;
+			return false;
+		}
+		if(!m_falconFirmware->loadFirmwareImage(skip_checksum, name))
+		{
+			m_errorCode = m_falconFirmware->getErrorCode();
+			return false;
+		}
+		return true;
+	}
+
 	bool FalconDevice::isFirmwareLoaded()
 	{
 		if(m_falconFirmware == nullptr)
@@ -129,6 +230,53 @@ namespace libnifalcon
 		return m_falconFirmware->isFirmwareLoaded();
 	}
 
+	bool FalconDevice::reconnect()
+	{
+		if(m_falconComm == nullptr)
+		{
+			m_errorCode = FALCON_DEVICE_NO_COMM_SET;
+			return false;
+		}
+		uint64_t start = getFalconTimestamp();
+		if(!m_falconComm->reconnect())
+		{
+			m_errorCode = m_falconComm->getErrorCode();
+			return false;
+		}
+		//LED and homing mode settings live in the firmware object, so they go out
+		//again with the first packet. Only the firmware itself may need restoring.
+		if(m_falconFirmware != nullptr)
+		{
+			if(!m_falconFirmware->isFirmwareLoaded())
+			{
+				LOG_INFO("Firmware lost, reloading");
+				if(!m_falconFirmware->reloadFirmware(10))
+				{
+					LOG_ERROR("Cannot reload firmware after reconnect");
+					m_errorCode = m_falconFirmware->getErrorCode();
+					return false;
+				}
+			}
+			m_falconFirmware->resetFirmwareState();
+		}
+		if(m_falconVelocityEstimator != nullptr)
+		{
+			m_falconVelocityEstimator->reset();
+		}
+		if(m_forceInterpolator != nullptr)
+		{
+			m_forceInterpolator->reset();
+		}
+		if(m_hapticRenderer != nullptr)
+		{
+			m_hapticRenderer->reset();
+		}
+		m_lastReconnectTime = getFalconTimestamp() - start;
+		++m_reconnectCount;
+		LOG_INFO("Reconnected in " << (m_lastReconnectTime / 1000000.0) << "ms");
+		return true;
+	}
+
 	bool FalconDevice::runIOLoop(unsigned int exe_flags)
 	{
 		if(m_falconFirmware == nullptr)
@@ -136,10 +284,47 @@ namespace libnifalcon
 			m_errorCode = FALCON_DEVICE_NO_FIRMWARE_SET;
 			return false;
 		}
+		if(m_falconComm != nullptr && !m_falconComm->isDeviceConnected())
+		{
+			//Not an I/O error, the device just isn't there. Keep polling so the
+			//comm object hears about it coming back.
+			m_errorCode = FALCON_DEVICE_DISCONNECTED;
+			m_falconComm->poll();
+			if(m_autoReconnect && m_falconComm->hasDeviceReturned())
+			{
+				return reconnect();
+			}
+			return false;
+		}
 		if(m_falconKinematic != nullptr && (exe_flags & FALCON_LOOP_KINEMATIC))
 		{
 			std::array<int, 3> enc_vec;
-			m_falconKinematic->getForces(m_position, m_forceVec, enc_vec);
+			std::array<double, 3> force = m_forceVec;
+			if(m_forceInterpolator != nullptr)
+			{
+				m_forceInterpolator->getForce(getFalconTimestamp(), force);
+			}
+			m_forceFields.update();
+			const FalconForceField& field = m_forceFields.getReadBuffer();
+			if(!field.isEmpty())
+			{
+				field.evaluate(m_position, m_velocity, m_forceFieldVec);
+				force[0] += m_forceFieldVec[0];
+				force[1] += m_forceFieldVec[1];
+				force[2] += m_forceFieldVec[2];
+			}
+			else
+			{
+				m_forceFieldVec.fill(0.0);
+			}
+			if(m_hapticRenderer != nullptr)
+			{
+				m_hapticRenderer->render(m_position, m_velocity, m_hapticForceVec);
+				force[0] += m_hapticForceVec[0];
+				force[1] += m_hapticForceVec[1];
+				force[2] += m_hapticForceVec[2];
+			}
+			m_falconKinematic->getForces(m_position, force, enc_vec);
 			m_falconFirmware->setForces(enc_vec);
 		}
 		if(!m_falconFirmware->runIOLoop() && (exe_flags & FALCON_LOOP_FIRMWARE))
@@ -165,7 +350,46 @@ namespace libnifalcon
 				m_errorCode = m_falconKinematic->getErrorCode();
 				return false;
 			}
+			if(m_falconVelocityEstimator != nullptr)
+			{
+				updateVelocity(p);
+			}
+		}
+		//Done last, so edges carry the position from the same packet
+		if(m_falconGrip != nullptr && (exe_flags & FALCON_LOOP_GRIP))
+		{
+			uint64_t timestamp = m_falconFirmware->getLastPacketTimestamp();
+			m_falconGrip->queueEdges(timestamp != 0 ? timestamp : getFalconTimestamp(), m_position);
 		}
 		return true;
 	}
+
+	void FalconDevice::updateVelocity(const std::array<int, 3>& encoders)
+	{
+		uint64_t timestamp = m_falconFirmware->getLastPacketTimestamp();
+		if(timestamp == 0)
+		{
+			timestamp = getFalconTimestamp();
+		}
+		//Encoder values only change when a new packet has come in
+		else if(timestamp == m_lastEstimatorTimestamp)
+		{
+			return;
+		}
+		m_lastEstimatorTimestamp = timestamp;
+		m_falconVelocityEstimator->addSample(encoders, timestamp);
+
+		std::array<double, 9> J;
+		if(!m_falconKinematic->getJacobian(m_position, J))
+		{
+			return;
+		}
+		const std::array<double, 3>& joint_velocity = m_falconVelocityEstimator->getJointVelocity();
+		const std::array<double, 3>& joint_acceleration = m_falconVelocityEstimator->getJointAcceleration();
+		for(int i = 0; i < 3; ++i)
+		{
+			m_velocity[i] = J[(i*3)]*joint_velocity[0] + J[(i*3)+1]*joint_velocity[1] + J[(i*3)+2]*joint_velocity[2];
+			m_acceleration[i] = J[(i*3)]*joint_acceleration[0] + J[(i*3)+1]*joint_acceleration[1] + J[(i*3)+2]*joint_acceleration[2];
+		}
+	}
 };
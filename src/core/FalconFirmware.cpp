@@ -10,6 +10,8 @@
  */
 
 #include "falcon/core/FalconFirmware.h"
+#include "falcon/core/FalconClock.h"
+#include "falcon/firmware/FalconFirmwareImages.h"
 #include <iostream>
 #include <fstream>
 #include <cstring>
@@ -18,9 +20,12 @@ namespace libnifalcon
 {
 	FalconFirmware::FalconFirmware() :
 		m_isFirmwareLoaded(false),
+		m_lastSkipChecksum(false),
 		m_homingMode(false),
 		m_loopCount(0),
 		m_outputCount(0),
+		m_lastPacketTimestamp(0),
+		m_lastProbeLatency(0),
 		m_hasWritten(false),
 		INIT_LOGGER("FalconFirmware")
 		//m_packetBufferSize(1)
@@ -32,6 +37,7 @@ namespace libnifalcon
 		m_encoderValues[0] = 0;
 		m_encoderValues[1] = 0;
 		m_encoderValues[2] = 0;
+		m_lastLoadStats = FalconFirmwareLoadStats();
 	}
 
 	bool FalconFirmware::setFirmwareFile(const std::string& filename)
@@ -86,6 +92,24 @@ namespace libnifalcon
 		return success;
 	}
 
+	bool FalconFirmware::loadFirmwareImage(bool skip_checksum, const std::string& name)
+	{
+		const FalconFirmwareImage* image = FalconFirmwareImages::findImage(name);
+		if(image == NULL)
+		{
+			LOG_ERROR("No built in firmware image named " << name);
+			m_errorCode = FALCON_FIRMWARE_IMAGE_NOT_VALID;
+			return false;
+		}
+		if(!FalconFirmwareImages::decode(*image, m_imageBuffer))
+		{
+			LOG_ERROR("Built in firmware image " << name << " is corrupt");
+			m_errorCode = FALCON_FIRMWARE_IMAGE_NOT_VALID;
+			return false;
+		}
+		return loadFirmware(skip_checksum, m_imageBuffer.size(), m_imageBuffer.data());
+	}
+
 	bool FalconFirmware::loadFirmware(bool skip_checksum, const unsigned int& firmware_size, uint8_t* buffer)
 	{
 		if(m_falconComm == nullptr)
@@ -98,94 +122,149 @@ namespace libnifalcon
 			m_errorCode = FalconComm::FALCON_COMM_DEVICE_NOT_VALID_ERROR;
 			return false;
 		}
+		m_lastLoadStats.size = firmware_size;
+		m_lastLoadStats.setupTime = 0;
+		m_lastLoadStats.uploadTime = 0;
+		m_lastLoadStats.throughput = 0.0;
+		m_lastLoadStats.verified = !skip_checksum;
+		m_lastLoadStats.success = false;
+
+		uint64_t start = getFalconTimestamp();
 		if(!m_falconComm->setFirmwareMode())
 		{
 			m_errorCode = m_falconComm->getErrorCode();
 			return false;
 		}
-		uint8_t receive_buf[128];
-		int bytes_read, total_read = 0;
+		uint64_t upload_start = getFalconTimestamp();
+		m_lastLoadStats.setupTime = upload_start - start;
 
-		//58 is an odd number to use for this, isn't it?
-		//Well, full speed USB packets can only take 64 bytes
-		//The FTDI tacks 2 bytes onto that for its status
-		//If you send 60-62, libusb-1.0 freaks out
-		//So, 58 it is. Happy medium
-
-		const int READ_SIZE = 62;
-
-		while(total_read != (int)firmware_size)
+		//The bootloader echoes everything it's sent, which is what we check the
+		//upload against. The comm object streams it and checks as the echo comes in.
+		bool uploaded = m_falconComm->writeBlockingWithEcho(buffer, firmware_size, !skip_checksum);
+		m_lastLoadStats.uploadTime = getFalconTimestamp() - upload_start;
+		if(m_lastLoadStats.uploadTime > 0)
 		{
-
-			if(total_read + READ_SIZE > (int)firmware_size)
+			m_lastLoadStats.throughput = (firmware_size * 1000000000.0) / m_lastLoadStats.uploadTime;
+		}
+		if(!uploaded)
+		{
+			if(m_falconComm->getErrorCode() == FalconComm::FALCON_COMM_ECHO_MISMATCH_ERROR)
 			{
-				bytes_read = firmware_size-total_read;
-				//bytes_read = READ_SIZE;
+				LOG_ERROR("Firmware echo mismatch");
+				m_errorCode = FALCON_FIRMWARE_CHECKSUM_MISMATCH;
 			}
 			else
 			{
-				bytes_read = READ_SIZE;
-			}
-			if(!m_falconComm->writeBlocking(buffer+total_read, bytes_read))
-			{
+				LOG_DEBUG("Firmware upload failed, only returned " << m_falconComm->getLastBytesRead() << " bytes");
 				m_errorCode = m_falconComm->getErrorCode();
-				return false;
-			}
-			int bytes_check = 0;
-			while(bytes_check < bytes_read)
-			{
-				if(!m_falconComm->readBlocking(receive_buf, bytes_read))
-				{
-					LOG_DEBUG("Firmware read failed, only returned " << m_falconComm->getLastBytesRead() << " bytes");
-					m_errorCode = m_falconComm->getErrorCode();
-
-					return false;
-				}
-				if(!skip_checksum)
-				{
-					for(unsigned int i = 0; i < m_falconComm->getLastBytesRead(); ++i)
-					{
-						if((buffer[total_read+i]) != receive_buf[i])
-						{
-							m_errorCode = FALCON_FIRMWARE_CHECKSUM_MISMATCH;
-							return false;
-						}
-					}
-				}
-				else
-				{
-					LOG_DEBUG("Skipping checksum for firmware");
-				}
-				bytes_check += m_falconComm->getLastBytesRead();
-				total_read += m_falconComm->getLastBytesRead();
 			}
+			return false;
 		}
+		LOG_INFO("Firmware uploaded in " << (m_lastLoadStats.uploadTime / 1000000.0) << "ms (" << m_lastLoadStats.throughput << " bytes/s)");
+		m_lastLoadStats.success = true;
 		m_falconComm->setNormalMode();
 		m_hasWritten = false;
 		m_isFirmwareLoaded = true;
+		if(buffer != m_lastFirmware.data())
+		{
+			m_lastFirmware.assign(buffer, buffer + firmware_size);
+		}
+		m_lastSkipChecksum = skip_checksum;
 		return true;
 	}
 
+	bool FalconFirmware::reloadFirmware(unsigned int retries)
+	{
+		if(m_lastFirmware.empty())
+		{
+			m_errorCode = FALCON_FIRMWARE_NO_FIRMWARE_LOADED;
+			return false;
+		}
+		for(unsigned int i = 0; i < retries; ++i)
+		{
+			if(loadFirmware(m_lastSkipChecksum, m_lastFirmware.size(), m_lastFirmware.data()))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
 	bool FalconFirmware::isFirmwareLoaded()
 	{
+		for(unsigned int i = 0; i < 3; ++i)
+		{
+			FalconFirmwareProbeResult result = probeFirmware();
+			if(result == FIRMWARE_PROBE_LOADED)
+			{
+				return true;
+			}
+			if(result == FIRMWARE_PROBE_UNKNOWN)
+			{
+				break;
+			}
+		}
+		m_isFirmwareLoaded = false;
+		m_errorCode = FALCON_FIRMWARE_NO_FIRMWARE_LOADED;
+		return false;
+	}
+
+	FalconFirmware::FalconFirmwareProbeResult FalconFirmware::probeFirmware(unsigned int deadline)
+	{
+		uint64_t start = getFalconTimestamp();
+		uint64_t end = start + (uint64_t)deadline * 1000;
+		FalconFirmwareProbeResult result = FIRMWARE_PROBE_NOT_LOADED;
+
+		if(m_falconComm == nullptr)
+		{
+			m_errorCode = FALCON_FIRMWARE_NO_COMM_SET;
+			return FIRMWARE_PROBE_UNKNOWN;
+		}
 		resetFirmwareState();
 		m_outputCount = 0;
-		for(unsigned int j = 0; j < 10; ++j)
+
+		//Drop anything already received, so only an answer to the probe counts
+		if(m_falconComm->isCommOpen())
 		{
-			for(unsigned int i = 0; i < 100; ++i)
+			uint8_t discard[64];
+			m_falconComm->poll();
+			while(m_falconComm->hasBytesAvailable() && m_falconComm->getBytesAvailable() > 0)
+			{
+				m_falconComm->read(discard, sizeof(discard));
+			}
+		}
+
+		//First loop sends the probe packet. The ones after that only poll for the
+		//answer, since nothing more is written until a packet has come back.
+		runIOLoop();
+		if(!m_hasWritten)
+		{
+			LOG_ERROR("Cannot send firmware probe packet");
+			result = FIRMWARE_PROBE_UNKNOWN;
+		}
+		else
+		{
+			while(m_outputCount == 0 && getFalconTimestamp() < end)
 			{
 				runIOLoop();
-				if(m_outputCount > 0)
+				if(!m_falconComm->isDeviceConnected())
 				{
-					m_isFirmwareLoaded = true;
-					return true;
+					result = FIRMWARE_PROBE_UNKNOWN;
+					break;
 				}
 			}
-			//Sometimes we need to kick out another write to get a proper return
-			resetFirmwareState();
+			if(m_outputCount > 0)
+			{
+				result = FIRMWARE_PROBE_LOADED;
+			}
 		}
-		m_isFirmwareLoaded = false;
-		m_errorCode = FALCON_FIRMWARE_NO_FIRMWARE_LOADED;
-		return false;
+
+		m_lastProbeLatency = getFalconTimestamp() - start;
+		if(result != FIRMWARE_PROBE_UNKNOWN)
+		{
+			m_isFirmwareLoaded = (result == FIRMWARE_PROBE_LOADED);
+		}
+		LOG_INFO("Firmware probe result " << result << " in " << (m_lastProbeLatency / 1000) << "us");
+		return result;
 	}
 }
@@ -0,0 +1,227 @@
+/***
+ * @file FalconForceField.cpp
+ * @brief Composable haptic primitives (planes, boxes, spheres, springs, viscous zones, detents) evaluated in the I/O loop
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#include "falcon/core/FalconForceField.h"
+#include <algorithm>
+#include <cmath>
+
+namespace libnifalcon
+{
+	const unsigned int FalconForceField::MAX_PRIMITIVES;
+
+	FalconForceField::FalconForceField() :
+		m_maxForce(0.0)
+	{
+		clear();
+	}
+
+	void FalconForceField::clear()
+	{
+		m_planes.count = 0;
+		m_boxes.count = 0;
+		m_spheres.count = 0;
+		m_springs.count = 0;
+		m_viscousZones.count = 0;
+		m_detents.count = 0;
+	}
+
+	bool FalconForceField::isEmpty() const
+	{
+		return (m_planes.count + m_boxes.count + m_spheres.count + m_springs.count + m_viscousZones.count + m_detents.count) == 0;
+	}
+
+	bool FalconForceField::append(Block& block, const std::array<double, 3>& position, const std::array<double, 3>& shape, double stiffness, double damping)
+	{
+		if(block.count >= MAX_PRIMITIVES)
+		{
+			m_errorCode = FALCON_FORCE_FIELD_FULL;
+			return false;
+		}
+		unsigned int i = block.count++;
+		block.x[i] = position[0];
+		block.y[i] = position[1];
+		block.z[i] = position[2];
+		block.u[i] = shape[0];
+		block.v[i] = shape[1];
+		block.w[i] = shape[2];
+		block.stiffness[i] = stiffness;
+		block.damping[i] = damping;
+		return true;
+	}
+
+	bool FalconForceField::addPlane(const std::array<double, 3>& point, const std::array<double, 3>& normal, double stiffness, double damping)
+	{
+		double length = std::sqrt(normal[0]*normal[0] + normal[1]*normal[1] + normal[2]*normal[2]);
+		std::array<double, 3> n = {{0.0, 0.0, 0.0}};
+		if(length > 0.0)
+		{
+			n[0] = normal[0] / length;
+			n[1] = normal[1] / length;
+			n[2] = normal[2] / length;
+		}
+		return append(m_planes, point, n, stiffness, damping);
+	}
+
+	bool FalconForceField::addBox(const std::array<double, 3>& center, const std::array<double, 3>& half_extents, double stiffness, double damping)
+	{
+		return append(m_boxes, center, half_extents, stiffness, damping);
+	}
+
+	bool FalconForceField::addSphere(const std::array<double, 3>& center, double radius, double stiffness, double damping)
+	{
+		std::array<double, 3> shape = {{radius, 0.0, 0.0}};
+		return append(m_spheres, center, shape, stiffness, damping);
+	}
+
+	bool FalconForceField::addSpring(const std::array<double, 3>& anchor, double stiffness)
+	{
+		return addDampedSpring(anchor, stiffness, 0.0);
+	}
+
+	bool FalconForceField::addDampedSpring(const std::array<double, 3>& anchor, double stiffness, double damping)
+	{
+		std::array<double, 3> shape = {{0.0, 0.0, 0.0}};
+		return append(m_springs, anchor, shape, stiffness, damping);
+	}
+
+	bool FalconForceField::addViscousZone(const std::array<double, 3>& center, double radius, double damping)
+	{
+		std::array<double, 3> shape = {{radius, 0.0, 0.0}};
+		return append(m_viscousZones, center, shape, 0.0, damping);
+	}
+
+	bool FalconForceField::addDetent(const std::array<double, 3>& center, double radius, double stiffness)
+	{
+		std::array<double, 3> shape = {{radius, 0.0, 0.0}};
+		return append(m_detents, center, shape, stiffness, 0.0);
+	}
+
+	bool FalconForceField::add(const FalconForceField& field)
+	{
+		const Block* from[6] = {&field.m_planes, &field.m_boxes, &field.m_spheres, &field.m_springs, &field.m_viscousZones, &field.m_detents};
+		Block* to[6] = {&m_planes, &m_boxes, &m_spheres, &m_springs, &m_viscousZones, &m_detents};
+		bool added = true;
+		for(int b = 0; b < 6; ++b)
+		{
+			for(unsigned int i = 0; i < from[b]->count; ++i)
+			{
+				std::array<double, 3> position = {{from[b]->x[i], from[b]->y[i], from[b]->z[i]}};
+				std::array<double, 3> shape = {{from[b]->u[i], from[b]->v[i], from[b]->w[i]}};
+				added &= append(*to[b], position, shape, from[b]->stiffness[i], from[b]->damping[i]);
+			}
+		}
+		return added;
+	}
+
+	//All of the loops below are written without branches (selects only) over structure of arrays storage,
+	//so they can be vectorized
+	void FalconForceField::evaluate(const std::array<double, 3>& position, const std::array<double, 3>& velocity, std::array<double, 3>& force) const
+	{
+		const double px = position[0], py = position[1], pz = position[2];
+		const double vx = velocity[0], vy = velocity[1], vz = velocity[2];
+		double fx = 0.0, fy = 0.0, fz = 0.0;
+
+		//Planes: push out along the normal while behind the plane
+		for(unsigned int i = 0; i < m_planes.count; ++i)
+		{
+			double d = (px - m_planes.x[i])*m_planes.u[i] + (py - m_planes.y[i])*m_planes.v[i] + (pz - m_planes.z[i])*m_planes.w[i];
+			double pen = std::max(-d, 0.0);
+			double contact = (pen > 0.0) ? 1.0 : 0.0;
+			double vn = vx*m_planes.u[i] + vy*m_planes.v[i] + vz*m_planes.w[i];
+			double mag = std::max(m_planes.stiffness[i]*pen - m_planes.damping[i]*vn*contact, 0.0);
+			fx += mag * m_planes.u[i];
+			fy += mag * m_planes.v[i];
+			fz += mag * m_planes.w[i];
+		}
+
+		//Boxes: push out through the face with the least penetration
+		for(unsigned int i = 0; i < m_boxes.count; ++i)
+		{
+			double dx = px - m_boxes.x[i], dy = py - m_boxes.y[i], dz = pz - m_boxes.z[i];
+			double ax = m_boxes.u[i] - std::fabs(dx), ay = m_boxes.v[i] - std::fabs(dy), az = m_boxes.w[i] - std::fabs(dz);
+			double inside = (ax > 0.0 && ay > 0.0 && az > 0.0) ? 1.0 : 0.0;
+			bool use_x = (ax <= ay) && (ax <= az);
+			bool use_y = !use_x && (ay <= az);
+			bool use_z = !use_x && !use_y;
+			double nx = use_x ? ((dx >= 0.0) ? 1.0 : -1.0) : 0.0;
+			double ny = use_y ? ((dy >= 0.0) ? 1.0 : -1.0) : 0.0;
+			double nz = use_z ? ((dz >= 0.0) ? 1.0 : -1.0) : 0.0;
+			double pen = std::min(ax, std::min(ay, az)) * inside;
+			double vn = vx*nx + vy*ny + vz*nz;
+			double mag = std::max(m_boxes.stiffness[i]*pen - m_boxes.damping[i]*vn*inside, 0.0);
+			fx += mag * nx;
+			fy += mag * ny;
+			fz += mag * nz;
+		}
+
+		//Spheres: push out along the radius
+		for(unsigned int i = 0; i < m_spheres.count; ++i)
+		{
+			double dx = px - m_spheres.x[i], dy = py - m_spheres.y[i], dz = pz - m_spheres.z[i];
+			double dist = std::sqrt(dx*dx + dy*dy + dz*dz);
+			double inv = 1.0 / std::max(dist, 1e-9);
+			double nx = dx*inv, ny = dy*inv, nz = dz*inv;
+			double pen = std::max(m_spheres.u[i] - dist, 0.0);
+			double contact = (pen > 0.0) ? 1.0 : 0.0;
+			double vn = vx*nx + vy*ny + vz*nz;
+			double mag = std::max(m_spheres.stiffness[i]*pen - m_spheres.damping[i]*vn*contact, 0.0);
+			fx += mag * nx;
+			fy += mag * ny;
+			fz += mag * nz;
+		}
+
+		//Springs
+		for(unsigned int i = 0; i < m_springs.count; ++i)
+		{
+			fx -= m_springs.stiffness[i]*(px - m_springs.x[i]) + m_springs.damping[i]*vx;
+			fy -= m_springs.stiffness[i]*(py - m_springs.y[i]) + m_springs.damping[i]*vy;
+			fz -= m_springs.stiffness[i]*(pz - m_springs.z[i]) + m_springs.damping[i]*vz;
+		}
+
+		//Viscous zones
+		for(unsigned int i = 0; i < m_viscousZones.count; ++i)
+		{
+			double dx = px - m_viscousZones.x[i], dy = py - m_viscousZones.y[i], dz = pz - m_viscousZones.z[i];
+			double inside = ((dx*dx + dy*dy + dz*dz) < (m_viscousZones.u[i]*m_viscousZones.u[i])) ? 1.0 : 0.0;
+			double b = m_viscousZones.damping[i] * inside;
+			fx -= b * vx;
+			fy -= b * vy;
+			fz -= b * vz;
+		}
+
+		//Detents: triangular pull towards the center, zero at the center and at the capture radius
+		for(unsigned int i = 0; i < m_detents.count; ++i)
+		{
+			double dx = px - m_detents.x[i], dy = py - m_detents.y[i], dz = pz - m_detents.z[i];
+			double dist = std::sqrt(dx*dx + dy*dy + dz*dz);
+			double inv = 1.0 / std::max(dist, 1e-9);
+			double mag = m_detents.stiffness[i] * std::min(dist, std::max(m_detents.u[i] - dist, 0.0));
+			fx -= mag * dx * inv;
+			fy -= mag * dy * inv;
+			fz -= mag * dz * inv;
+		}
+
+		if(m_maxForce > 0.0)
+		{
+			double magnitude = std::sqrt(fx*fx + fy*fy + fz*fz);
+			if(magnitude > m_maxForce)
+			{
+				double scale = m_maxForce / magnitude;
+				fx *= scale;
+				fy *= scale;
+				fz *= scale;
+			}
+		}
+		force[0] = fx;
+		force[1] = fy;
+		force[2] = fz;
+	}
+}
@@ -0,0 +1,176 @@
+/***
+ * @file FalconForceInterpolator.cpp
+ * @brief Upsamples timestamped force commands to the I/O loop rate
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#include "falcon/core/FalconForceInterpolator.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace libnifalcon
+{
+	const unsigned int FalconForceInterpolator::QUEUE_SIZE;
+	const unsigned int FalconForceInterpolator::HISTORY_SIZE;
+
+	FalconForceInterpolator::FalconForceInterpolator(Mode mode, double delay) :
+		m_historyStart(0),
+		m_historyCount(0),
+		m_lastTime(0),
+		m_mode(mode),
+		m_delay(delay),
+		m_maxExtrapolation(0.02),
+		m_maxSlewRate(0.0)
+	{
+		m_lastForce.fill(0.0);
+	}
+
+	bool FalconForceInterpolator::pushForce(const std::array<double, 3>& force, uint64_t timestamp)
+	{
+		Command command;
+		command.force = force;
+		command.timestamp = timestamp;
+		if(!m_queue.push(command))
+		{
+			m_errorCode = FALCON_FORCE_QUEUE_FULL;
+			return false;
+		}
+		return true;
+	}
+
+	void FalconForceInterpolator::reset()
+	{
+		m_queue.clear();
+		m_historyStart = 0;
+		m_historyCount = 0;
+		m_lastForce.fill(0.0);
+		m_lastTime = 0;
+	}
+
+	void FalconForceInterpolator::getForce(uint64_t now, std::array<double, 3>& force)
+	{
+		Command command;
+		while(m_queue.pop(command))
+		{
+			//Out of order commands can't be interpolated between
+			if(m_historyCount > 0 && command.timestamp <= getHistory(m_historyCount - 1).timestamp)
+			{
+				continue;
+			}
+			if(m_historyCount == HISTORY_SIZE)
+			{
+				m_historyStart = (m_historyStart + 1) % HISTORY_SIZE;
+				--m_historyCount;
+			}
+			m_history[(m_historyStart + m_historyCount) % HISTORY_SIZE] = command;
+			++m_historyCount;
+		}
+
+		if(m_historyCount == 0)
+		{
+			force.fill(0.0);
+		}
+		else if(m_mode == EXTRAPOLATE_LINEAR)
+		{
+			extrapolate(now, force);
+		}
+		else
+		{
+			uint64_t delay = (uint64_t)(m_delay * 1e9);
+			interpolate(now > delay ? now - delay : 0, force);
+		}
+
+		if(m_maxSlewRate > 0.0)
+		{
+			//The first loop has no time step to limit over, so holds the last output
+			double dt = (m_lastTime != 0 && now > m_lastTime) ? (now - m_lastTime) / 1e9 : 0.0;
+			double max_step = m_maxSlewRate * dt;
+			double step[3] = { force[0] - m_lastForce[0], force[1] - m_lastForce[1], force[2] - m_lastForce[2] };
+			double magnitude = std::sqrt(step[0] * step[0] + step[1] * step[1] + step[2] * step[2]);
+			if(magnitude > max_step)
+			{
+				double scale = max_step / magnitude;
+				for(int i = 0; i < 3; ++i)
+				{
+					force[i] = m_lastForce[i] + step[i] * scale;
+				}
+			}
+		}
+		m_lastForce = force;
+		m_lastTime = now;
+	}
+
+	void FalconForceInterpolator::interpolate(uint64_t time, std::array<double, 3>& force) const
+	{
+		//Hold the ends: before the oldest command, and while waiting for one after the newest
+		if(time <= getHistory(0).timestamp)
+		{
+			force = getHistory(0).force;
+			return;
+		}
+		if(time >= getHistory(m_historyCount - 1).timestamp)
+		{
+			force = getHistory(m_historyCount - 1).force;
+			return;
+		}
+		unsigned int i = m_historyCount - 2;
+		while(getHistory(i).timestamp > time)
+		{
+			--i;
+		}
+		const Command& a = getHistory(i);
+		const Command& b = getHistory(i + 1);
+		double h = (b.timestamp - a.timestamp) / 1e9;
+		double s = (time - a.timestamp) / 1e9 / h;
+		if(m_mode == INTERPOLATE_LINEAR)
+		{
+			for(int j = 0; j < 3; ++j)
+			{
+				force[j] = a.force[j] + (b.force[j] - a.force[j]) * s;
+			}
+			return;
+		}
+
+		//Catmull-Rom tangents over uneven spacing, one sided at the ends of the history. Each is in N per
+		//segment, so scaled by h for the Hermite basis.
+		const Command& before = getHistory(i > 0 ? i - 1 : i);
+		const Command& after = getHistory(i + 2 < m_historyCount ? i + 2 : i + 1);
+		double t_a = (b.timestamp - before.timestamp) / 1e9;
+		double t_b = (after.timestamp - a.timestamp) / 1e9;
+		double s2 = s * s;
+		double s3 = s2 * s;
+		double h00 = 2.0 * s3 - 3.0 * s2 + 1.0;
+		double h10 = s3 - 2.0 * s2 + s;
+		double h01 = -2.0 * s3 + 3.0 * s2;
+		double h11 = s3 - s2;
+		for(int j = 0; j < 3; ++j)
+		{
+			double m_a = (b.force[j] - before.force[j]) / t_a * h;
+			double m_b = (after.force[j] - a.force[j]) / t_b * h;
+			force[j] = h00 * a.force[j] + h10 * m_a + h01 * b.force[j] + h11 * m_b;
+		}
+	}
+
+	void FalconForceInterpolator::extrapolate(uint64_t time, std::array<double, 3>& force) const
+	{
+		const Command& last = getHistory(m_historyCount - 1);
+		if(m_historyCount < 2 || time <= last.timestamp)
+		{
+			force = last.force;
+			return;
+		}
+		const Command& previous = getHistory(m_historyCount - 2);
+		double h = (last.timestamp - previous.timestamp) / 1e9;
+		double dt = std::min((time - last.timestamp) / 1e9, m_maxExtrapolation);
+		for(int j = 0; j < 3; ++j)
+		{
+			force[j] = last.force[j] + (last.force[j] - previous.force[j]) / h * dt;
+		}
+	}
+}
@@ -0,0 +1,160 @@
+/***
+ * @file FalconGeometryStore.cpp
+ * @brief Per device storage of calibrated falcon geometry
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#include "falcon/core/FalconGeometryStore.h"
+
+#include <cctype>
+#include <cstddef>
+#include <fstream>
+#include <sstream>
+
+namespace libnifalcon
+{
+	namespace
+	{
+		//Name and location of each parameter in a geometry file
+		struct GeometryField
+		{
+			const char* name;
+			size_t offset;
+			int count;
+		};
+
+		static const GeometryField GEOMETRY_FIELDS[] = {
+			{"a", offsetof(FalconGeometryParameters, a), 1},
+			{"b", offsetof(FalconGeometryParameters, b), 1},
+			{"c", offsetof(FalconGeometryParameters, c), 1},
+			{"d", offsetof(FalconGeometryParameters, d), 1},
+			{"e", offsetof(FalconGeometryParameters, e), 1},
+			{"f", offsetof(FalconGeometryParameters, f), 1},
+			{"r", offsetof(FalconGeometryParameters, r), 1},
+			{"s", offsetof(FalconGeometryParameters, s), 1},
+			{"phy", offsetof(FalconGeometryParameters, phy), 3},
+			{"theta_offset", offsetof(FalconGeometryParameters, theta_offset), 3}
+		};
+		static const int GEOMETRY_FIELD_COUNT = sizeof(GEOMETRY_FIELDS) / sizeof(GEOMETRY_FIELDS[0]);
+
+		static double* getValues(FalconGeometryParameters& geometry, const GeometryField& field)
+		{
+			return reinterpret_cast<double*>(reinterpret_cast<char*>(&geometry) + field.offset);
+		}
+	}
+
+	FalconGeometryStore::FalconGeometryStore(const std::string& directory) :
+		m_directory(directory)
+	{
+	}
+
+	std::string FalconGeometryStore::getFilename(const std::string& serial) const
+	{
+		std::string name(serial);
+		for(size_t i = 0; i < name.size(); ++i)
+		{
+			if(!std::isalnum((unsigned char)name[i]) && name[i] != '-' && name[i] != '_')
+			{
+				name[i] = '_';
+			}
+		}
+		return m_directory + "/" + name + ".geometry";
+	}
+
+	bool FalconGeometryStore::load(const std::string& serial, FalconGeometryParameters& geometry)
+	{
+		if(serial.empty())
+		{
+			m_errorCode = FALCON_GEOMETRY_NO_SERIAL;
+			return false;
+		}
+		return readFile(getFilename(serial), geometry);
+	}
+
+	bool FalconGeometryStore::save(const std::string& serial, const FalconGeometryParameters& geometry)
+	{
+		if(serial.empty())
+		{
+			m_errorCode = FALCON_GEOMETRY_NO_SERIAL;
+			return false;
+		}
+		return writeFile(getFilename(serial), geometry);
+	}
+
+	bool FalconGeometryStore::readFile(const std::string& filename, FalconGeometryParameters& geometry)
+	{
+		std::ifstream in(filename.c_str());
+		if(!in.is_open())
+		{
+			m_errorCode = FALCON_GEOMETRY_NOT_FOUND;
+			return false;
+		}
+		//Read into a copy, so a bad file leaves the geometry alone
+		FalconGeometryParameters read;
+		std::string line;
+		while(std::getline(in, line))
+		{
+			std::istringstream values(line);
+			std::string name;
+			if(!(values >> name) || name[0] == '#')
+			{
+				continue;
+			}
+			int i = 0;
+			while(i < GEOMETRY_FIELD_COUNT && name != GEOMETRY_FIELDS[i].name)
+			{
+				++i;
+			}
+			if(i == GEOMETRY_FIELD_COUNT)
+			{
+				m_errorCode = FALCON_GEOMETRY_FILE_INVALID;
+				return false;
+			}
+			double* field = getValues(read, GEOMETRY_FIELDS[i]);
+			for(int j = 0; j < GEOMETRY_FIELDS[i].count; ++j)
+			{
+				if(!(values >> field[j]))
+				{
+					m_errorCode = FALCON_GEOMETRY_FILE_INVALID;
+					return false;
+				}
+			}
+		}
+		geometry = read;
+		return true;
+	}
+
+	bool FalconGeometryStore::writeFile(const std::string& filename, const FalconGeometryParameters& geometry)
+	{
+		std::ofstream out(filename.c_str());
+		if(!out.is_open())
+		{
+			m_errorCode = FALCON_GEOMETRY_FILE_ERROR;
+			return false;
+		}
+		FalconGeometryParameters written(geometry);
+		out << "# libnifalcon falcon geometry. Lengths in meters, phy in radians, theta_offset in degrees." << std::endl;
+		out.precision(17);
+		for(int i = 0; i < GEOMETRY_FIELD_COUNT; ++i)
+		{
+			const double* field = getValues(written, GEOMETRY_FIELDS[i]);
+			out << GEOMETRY_FIELDS[i].name;
+			for(int j = 0; j < GEOMETRY_FIELDS[i].count; ++j)
+			{
+				out << " " << field[j];
+			}
+			out << std::endl;
+		}
+		if(!out.good())
+		{
+			m_errorCode = FALCON_GEOMETRY_FILE_ERROR;
+			return false;
+		}
+		return true;
+	}
+}
@@ -0,0 +1,178 @@
+/***
+ * @file FalconMappedFile.cpp
+ * @brief Cross platform memory mapped file
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#include "falcon/core/FalconMappedFile.h"
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace libnifalcon
+{
+	FalconMappedFile::FalconMappedFile() :
+		m_data(nullptr),
+		m_size(0),
+		m_writable(false),
+		m_fileHandle(nullptr),
+		m_mapHandle(nullptr)
+	{
+	}
+
+	FalconMappedFile::~FalconMappedFile()
+	{
+		close();
+	}
+
+	bool FalconMappedFile::create(const std::string& filename, uint64_t size, bool populate)
+	{
+		close();
+		m_size = size;
+		m_writable = true;
+		return map(filename, true, populate);
+	}
+
+	bool FalconMappedFile::open(const std::string& filename, bool populate)
+	{
+		close();
+		m_writable = false;
+		return map(filename, false, populate);
+	}
+
+	bool FalconMappedFile::map(const std::string& filename, bool create, bool populate)
+	{
+#ifdef WIN32
+		HANDLE f = CreateFileA(filename.c_str(), create ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, create ? CREATE_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+		if(f == INVALID_HANDLE_VALUE)
+		{
+			close();
+			return false;
+		}
+		m_fileHandle = f;
+		if(!create)
+		{
+			LARGE_INTEGER size;
+			if(!GetFileSizeEx(f, &size))
+			{
+				close();
+				return false;
+			}
+			m_size = size.QuadPart;
+		}
+		HANDLE m = CreateFileMappingA(f, NULL, create ? PAGE_READWRITE : PAGE_READONLY, (DWORD)(m_size >> 32), (DWORD)(m_size & 0xffffffff), NULL);
+		if(m == NULL)
+		{
+			close();
+			return false;
+		}
+		m_mapHandle = m;
+		m_data = MapViewOfFile(m, create ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, (SIZE_T)m_size);
+		if(m_data == nullptr)
+		{
+			close();
+			return false;
+		}
+		if(populate)
+		{
+			//No MAP_POPULATE here, so touch every page instead
+			volatile const char* p = static_cast<const char*>(m_data);
+			for(uint64_t i = 0; i < m_size; i += 4096)
+			{
+				(void)p[i];
+			}
+		}
+		return true;
+#else
+		int fd = ::open(filename.c_str(), create ? (O_RDWR | O_CREAT | O_TRUNC) : O_RDONLY, 0644);
+		if(fd < 0)
+		{
+			close();
+			return false;
+		}
+		if(create)
+		{
+			if(ftruncate(fd, m_size) != 0)
+			{
+				::close(fd);
+				close();
+				return false;
+			}
+		}
+		else
+		{
+			struct stat st;
+			if(fstat(fd, &st) != 0)
+			{
+				::close(fd);
+				close();
+				return false;
+			}
+			m_size = st.st_size;
+		}
+		int flags = MAP_SHARED;
+#ifdef MAP_POPULATE
+		if(populate)
+		{
+			flags |= MAP_POPULATE;
+		}
+#endif
+		void* addr = m_size > 0 ? mmap(NULL, m_size, create ? (PROT_READ | PROT_WRITE) : PROT_READ, flags, fd, 0) : MAP_FAILED;
+		//The mapping keeps the file alive, we don't need the descriptor anymore
+		::close(fd);
+		if(addr == MAP_FAILED)
+		{
+			close();
+			return false;
+		}
+		m_data = addr;
+		return true;
+#endif
+	}
+
+	void FalconMappedFile::close()
+	{
+#ifdef WIN32
+		if(m_data != nullptr)
+		{
+			if(m_writable)
+			{
+				FlushViewOfFile(m_data, 0);
+			}
+			UnmapViewOfFile(m_data);
+		}
+		if(m_mapHandle != nullptr)
+		{
+			CloseHandle((HANDLE)m_mapHandle);
+		}
+		if(m_fileHandle != nullptr)
+		{
+			CloseHandle((HANDLE)m_fileHandle);
+		}
+#else
+		if(m_data != nullptr)
+		{
+			if(m_writable)
+			{
+				msync(m_data, m_size, MS_SYNC);
+			}
+			munmap(m_data, m_size);
+		}
+#endif
+		m_data = nullptr;
+		m_size = 0;
+		m_fileHandle = nullptr;
+		m_mapHandle = nullptr;
+	}
+}
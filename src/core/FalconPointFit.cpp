@@ -0,0 +1,226 @@
+/***
+ * @file FalconPointFit.cpp
+ * @brief Plane and ellipsoid fitting to large sets of positions
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#include "falcon/core/FalconPointFit.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <thread>
+
+#include "falcon/gmtl/SimdOps.h"
+#include "falcon/gmtl/Numerics/SymmetricEigen3.h"
+
+namespace libnifalcon
+{
+	//Batches are split so every thread gets at least this many points
+	static const size_t MIN_THREADED_POINTS = 1 << 16;
+
+	FalconPointFit::FalconPointFit()
+	{
+		clear();
+	}
+
+	void FalconPointFit::clear()
+	{
+		m_moments.count = 0;
+		std::fill(m_moments.mean, m_moments.mean + 3, 0.0);
+		std::fill(m_moments.scatter, m_moments.scatter + 6, 0.0);
+	}
+
+	void FalconPointFit::addPoint(const std::array<double, 3>& point)
+	{
+		Moments moments;
+		accumulate(&point, 1, moments);
+		mergeMoments(m_moments, moments);
+	}
+
+	void FalconPointFit::addPoints(const std::vector<std::array<double, 3> >& points, unsigned int threads)
+	{
+		if(points.empty())
+		{
+			return;
+		}
+		if(threads == 0)
+		{
+			threads = std::max(std::thread::hardware_concurrency(), 1u);
+		}
+		size_t chunks = std::min((size_t)threads, std::max(points.size() / MIN_THREADED_POINTS, (size_t)1));
+		std::vector<Moments> partial(chunks);
+		std::vector<std::thread> workers;
+		for(size_t i = 1; i < chunks; ++i)
+		{
+			size_t begin = points.size() * i / chunks, end = points.size() * (i + 1) / chunks;
+			workers.push_back(std::thread(&FalconPointFit::accumulate, &points[begin], end - begin, std::ref(partial[i])));
+		}
+		accumulate(&points[0], points.size() / chunks, partial[0]);
+		for(size_t i = 0; i < workers.size(); ++i)
+		{
+			workers[i].join();
+		}
+		//Merged in order, so results only depend on the thread count
+		for(size_t i = 0; i < chunks; ++i)
+		{
+			mergeMoments(m_moments, partial[i]);
+		}
+	}
+
+	void FalconPointFit::merge(const FalconPointFit& other)
+	{
+		mergeMoments(m_moments, other.m_moments);
+	}
+
+	void FalconPointFit::accumulate(const std::array<double, 3>* points, size_t count, Moments& moments)
+	{
+		//Sums of d, d*d and d*rotate(d) (xy yz zx), for d the offset from the first point
+		double sum[3], square[3], product[3];
+#ifdef GMTL_SIMD
+		typedef gmtl::simd::Packed3<double> Packed;
+		static const double zero[3] = {0.0, 0.0, 0.0};
+		const Packed pivot = Packed::load(points[0].data());
+		Packed s = Packed::load(zero), sq = s, pr = s;
+		for(size_t i = 1; i < count; ++i)
+		{
+			Packed d = Packed::load(points[i].data()) - pivot;
+			s = s + d;
+			sq = sq + d * d;
+			pr = pr + d * d.rotate();
+		}
+		s.store(sum);
+		sq.store(square);
+		pr.store(product);
+#else
+		std::fill(sum, sum + 3, 0.0);
+		std::fill(square, square + 3, 0.0);
+		std::fill(product, product + 3, 0.0);
+		const std::array<double, 3>& pivot = points[0];
+		for(size_t i = 1; i < count; ++i)
+		{
+			double d[3] = {points[i][0] - pivot[0], points[i][1] - pivot[1], points[i][2] - pivot[2]};
+			for(int j = 0; j < 3; ++j)
+			{
+				sum[j] += d[j];
+				square[j] += d[j] * d[j];
+				product[j] += d[j] * d[(j + 1) % 3];
+			}
+		}
+#endif
+		moments.count = count;
+		double offset[3];
+		for(int j = 0; j < 3; ++j)
+		{
+			offset[j] = sum[j] / count;
+			moments.mean[j] = points[0][j] + offset[j];
+		}
+		for(int j = 0; j < 3; ++j)
+		{
+			moments.scatter[j] = square[j] - sum[j] * offset[j];
+			moments.scatter[3 + j] = product[j] - sum[j] * offset[(j + 1) % 3];
+		}
+	}
+
+	void FalconPointFit::mergeMoments(Moments& moments, const Moments& other)
+	{
+		if(other.count == 0)
+		{
+			return;
+		}
+		if(moments.count == 0)
+		{
+			moments = other;
+			return;
+		}
+		double count = (double)(moments.count + other.count);
+		double weight = (double)other.count / count;
+		double scale = (double)moments.count * weight;
+		double delta[3];
+		for(int j = 0; j < 3; ++j)
+		{
+			delta[j] = other.mean[j] - moments.mean[j];
+			moments.mean[j] += delta[j] * weight;
+		}
+		for(int j = 0; j < 3; ++j)
+		{
+			moments.scatter[j] += other.scatter[j] + delta[j] * delta[j] * scale;
+			moments.scatter[3 + j] += other.scatter[3 + j] + delta[j] * delta[(j + 1) % 3] * scale;
+		}
+		moments.count += other.count;
+	}
+
+	void FalconPointFit::getCenter(std::array<double, 3>& center) const
+	{
+		std::copy(m_moments.mean, m_moments.mean + 3, center.begin());
+	}
+
+	void FalconPointFit::getCovariance(gmtl::Matrix33d& covariance) const
+	{
+		double inv_count = m_moments.count > 0 ? 1.0 / m_moments.count : 0.0;
+		const double* s = m_moments.scatter;
+		covariance.set(s[0] * inv_count, s[3] * inv_count, s[5] * inv_count,
+					   s[3] * inv_count, s[1] * inv_count, s[4] * inv_count,
+					   s[5] * inv_count, s[4] * inv_count, s[2] * inv_count);
+	}
+
+	bool FalconPointFit::solve(gmtl::Vec3d& values, gmtl::Matrix33d& vectors)
+	{
+		if(m_moments.count < 3)
+		{
+			m_errorCode = FALCON_POINT_FIT_TOO_FEW_POINTS;
+			return false;
+		}
+		gmtl::Matrix33d covariance;
+		getCovariance(covariance);
+		gmtl::eigenSymmetric(values, vectors, covariance);
+		//Rounding can leave the smallest a hair below zero for points that lie exactly in a plane
+		for(int i = 0; i < 3; ++i)
+		{
+			values[i] = std::max(values[i], 0.0);
+		}
+		return true;
+	}
+
+	bool FalconPointFit::fitPlane(std::array<double, 3>& center, std::array<double, 3>& normal, double& rms)
+	{
+		gmtl::Vec3d values;
+		gmtl::Matrix33d vectors;
+		if(!solve(values, vectors))
+		{
+			return false;
+		}
+		getCenter(center);
+		for(int i = 0; i < 3; ++i)
+		{
+			normal[i] = vectors(i, 0);
+		}
+		rms = std::sqrt(values[0]);
+		return true;
+	}
+
+	bool FalconPointFit::fitEllipsoid(std::array<double, 3>& center, std::array<std::array<double, 3>, 3>& axes, std::array<double, 3>& deviations)
+	{
+		gmtl::Vec3d values;
+		gmtl::Matrix33d vectors;
+		if(!solve(values, vectors))
+		{
+			return false;
+		}
+		getCenter(center);
+		for(int i = 0; i < 3; ++i)
+		{
+			for(int j = 0; j < 3; ++j)
+			{
+				axes[i][j] = vectors(j, i);
+			}
+			deviations[i] = std::sqrt(values[i]);
+		}
+		return true;
+	}
+}
@@ -0,0 +1,104 @@
+/***
+ * @file FalconVelocityEstimatorFOAW.cpp
+ * @brief First-order adaptive windowing velocity estimator
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#include "falcon/estimator/FalconVelocityEstimatorFOAW.h"
+#include <cmath>
+
+namespace libnifalcon
+{
+	const unsigned int FalconVelocityEstimatorFOAW::MAX_WINDOW;
+
+	FalconVelocityEstimatorFOAW::FalconVelocityEstimatorFOAW() :
+		m_head(0),
+		m_count(0),
+		m_maxWindow(16),
+		m_positionBound(getEncoderResolution()),
+		m_velocityBound(2.0)
+	{
+	}
+
+	void FalconVelocityEstimatorFOAW::setMaxWindow(unsigned int window)
+	{
+		if(window < 2)
+		{
+			window = 2;
+		}
+		else if(window > MAX_WINDOW)
+		{
+			window = MAX_WINDOW;
+		}
+		m_maxWindow = window;
+	}
+
+	void FalconVelocityEstimatorFOAW::resetHistory()
+	{
+		m_head = 0;
+		m_count = 0;
+	}
+
+	double FalconVelocityEstimatorFOAW::fit(const std::array<std::array<double, 3>, MAX_WINDOW>& history, int axis, double bound)
+	{
+		const double t_k = m_times[m_head];
+		const double y_k = history[m_head][axis];
+		double slope = 0.0;
+		//Running sums for the least squares line, in time and value relative to the newest sample
+		double st = 0.0, sy = 0.0, stt = 0.0, sty = 0.0;
+		unsigned int limit = (m_count < m_maxWindow) ? m_count : m_maxWindow;
+		for(unsigned int n = 1; n < limit; ++n)
+		{
+			unsigned int idx = (m_head + MAX_WINDOW - n) % MAX_WINDOW;
+			double t = m_times[idx] - t_k;
+			double y = history[idx][axis] - y_k;
+			st += t;
+			sy += y;
+			stt += t * t;
+			sty += t * y;
+			double count = n + 1;
+			double b = (count * sty - st * sy) / (count * stt - st * st);
+			double a = (sy - b * st) / count;
+			//Every sample inside the window has to be within the bound of the line
+			for(unsigned int j = 0; j <= n; ++j)
+			{
+				unsigned int jdx = (m_head + MAX_WINDOW - j) % MAX_WINDOW;
+				if(std::fabs(history[jdx][axis] - y_k - (a + b * (m_times[jdx] - t_k))) > bound)
+				{
+					return slope;
+				}
+			}
+			slope = b;
+		}
+		return slope;
+	}
+
+	void FalconVelocityEstimatorFOAW::update(const std::array<double, 3>& angles, double time)
+	{
+		if(m_count > 0 && time <= m_times[m_head])
+		{
+			return;
+		}
+		m_head = (m_head + 1) % MAX_WINDOW;
+		m_times[m_head] = time;
+		m_angles[m_head] = angles;
+		if(m_count < MAX_WINDOW)
+		{
+			++m_count;
+		}
+		for(int i = 0; i < 3; ++i)
+		{
+			m_velocity[i] = fit(m_angles, i, m_positionBound);
+		}
+		m_velocities[m_head] = m_velocity;
+		for(int i = 0; i < 3; ++i)
+		{
+			m_acceleration[i] = fit(m_velocities, i, m_velocityBound);
+		}
+	}
+}
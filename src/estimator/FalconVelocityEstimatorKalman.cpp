@@ -0,0 +1,114 @@
+/***
+ * @file FalconVelocityEstimatorKalman.cpp
+ * @brief Fixed-gain (steady state) Kalman filter velocity and acceleration estimator
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#include "falcon/estimator/FalconVelocityEstimatorKalman.h"
+#include <cmath>
+
+namespace libnifalcon
+{
+	FalconVelocityEstimatorKalman::FalconVelocityEstimatorKalman() :
+		m_lastTime(0.0),
+		m_initialized(false)
+	{
+		const double resolution = getEncoderResolution();
+		setNoise(1000.0, resolution * resolution / 12.0);
+	}
+
+	void FalconVelocityEstimatorKalman::setNoise(double process_noise, double measurement_noise, double period)
+	{
+		const double dt = period;
+		const double dt2 = dt * dt;
+		const double F[3][3] = {{1.0, dt, dt2 / 2.0}, {0.0, 1.0, dt}, {0.0, 0.0, 1.0}};
+		const double Q[3][3] = {
+			{process_noise * dt2 * dt2 * dt / 20.0, process_noise * dt2 * dt2 / 8.0, process_noise * dt2 * dt / 6.0},
+			{process_noise * dt2 * dt2 / 8.0, process_noise * dt2 * dt / 3.0, process_noise * dt2 / 2.0},
+			{process_noise * dt2 * dt / 6.0, process_noise * dt2 / 2.0, process_noise * dt}
+		};
+		double P[3][3] = {{measurement_noise, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}};
+		double K[3] = {0.0, 0.0, 0.0};
+
+		//Iterate predict/update on the covariance until the gains settle
+		for(int iter = 0; iter < 100000; ++iter)
+		{
+			double FP[3][3];
+			for(int i = 0; i < 3; ++i)
+			{
+				for(int j = 0; j < 3; ++j)
+				{
+					FP[i][j] = F[i][0]*P[0][j] + F[i][1]*P[1][j] + F[i][2]*P[2][j];
+				}
+			}
+			for(int i = 0; i < 3; ++i)
+			{
+				for(int j = 0; j < 3; ++j)
+				{
+					P[i][j] = FP[i][0]*F[j][0] + FP[i][1]*F[j][1] + FP[i][2]*F[j][2] + Q[i][j];
+				}
+			}
+			double S = P[0][0] + measurement_noise;
+			double change = 0.0;
+			for(int i = 0; i < 3; ++i)
+			{
+				double k = P[i][0] / S;
+				change += std::fabs(k - K[i]);
+				K[i] = k;
+			}
+			double row[3] = {P[0][0], P[0][1], P[0][2]};
+			for(int i = 0; i < 3; ++i)
+			{
+				for(int j = 0; j < 3; ++j)
+				{
+					P[i][j] -= K[i] * row[j];
+				}
+			}
+			if(iter > 10 && change < 1e-12)
+			{
+				break;
+			}
+		}
+		m_gains[0] = K[0];
+		m_gains[1] = K[1] * dt;
+		m_gains[2] = K[2] * 2.0 * dt2;
+	}
+
+	void FalconVelocityEstimatorKalman::resetHistory()
+	{
+		m_initialized = false;
+	}
+
+	void FalconVelocityEstimatorKalman::update(const std::array<double, 3>& angles, double time)
+	{
+		if(!m_initialized)
+		{
+			m_angles = angles;
+			m_lastTime = time;
+			m_initialized = true;
+			return;
+		}
+		const double dt = time - m_lastTime;
+		if(dt <= 0.0)
+		{
+			return;
+		}
+		m_lastTime = time;
+		for(int i = 0; i < 3; ++i)
+		{
+			//Predict
+			double theta = m_angles[i] + m_velocity[i] * dt + m_acceleration[i] * dt * dt / 2.0;
+			double omega = m_velocity[i] + m_acceleration[i] * dt;
+			//Correct, scaling the gains to this sample's period
+			double residual = angles[i] - theta;
+			m_angles[i] = theta + m_gains[0] * residual;
+			m_velocity[i] = omega + (m_gains[1] / dt) * residual;
+			m_acceleration[i] += (m_gains[2] / (2.0 * dt * dt)) * residual;
+		}
+	}
+}
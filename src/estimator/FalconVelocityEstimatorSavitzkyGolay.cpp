@@ -0,0 +1,104 @@
+/***
+ * @file FalconVelocityEstimatorSavitzkyGolay.cpp
+ * @brief Savitzky-Golay (local quadratic fit) velocity and acceleration estimator
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#include "falcon/estimator/FalconVelocityEstimatorSavitzkyGolay.h"
+#include <cmath>
+
+namespace libnifalcon
+{
+	const unsigned int FalconVelocityEstimatorSavitzkyGolay::MAX_WINDOW;
+
+	FalconVelocityEstimatorSavitzkyGolay::FalconVelocityEstimatorSavitzkyGolay() :
+		m_head(0),
+		m_count(0),
+		m_window(15)
+	{
+	}
+
+	void FalconVelocityEstimatorSavitzkyGolay::setWindow(unsigned int window)
+	{
+		if(window < 3)
+		{
+			window = 3;
+		}
+		else if(window > MAX_WINDOW)
+		{
+			window = MAX_WINDOW;
+		}
+		m_window = window;
+	}
+
+	void FalconVelocityEstimatorSavitzkyGolay::resetHistory()
+	{
+		m_head = 0;
+		m_count = 0;
+	}
+
+	void FalconVelocityEstimatorSavitzkyGolay::update(const std::array<double, 3>& angles, double time)
+	{
+		if(m_count > 0 && time <= m_times[m_head])
+		{
+			return;
+		}
+		m_head = (m_head + 1) % MAX_WINDOW;
+		m_times[m_head] = time;
+		m_angles[m_head] = angles;
+		if(m_count < MAX_WINDOW)
+		{
+			++m_count;
+		}
+		unsigned int n = (m_count < m_window) ? m_count : m_window;
+		if(n < 3)
+		{
+			return;
+		}
+
+		//Fit y = c0 + c1*u + c2*u^2, with u the time before the newest sample scaled by the window
+		//span to keep the normal equations well conditioned
+		unsigned int oldest = (m_head + MAX_WINDOW - (n - 1)) % MAX_WINDOW;
+		const double span = time - m_times[oldest];
+		double s[5] = {0.0, 0.0, 0.0, 0.0, 0.0};
+		double r[3][3] = {{0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}};
+		for(unsigned int j = 0; j < n; ++j)
+		{
+			unsigned int idx = (m_head + MAX_WINDOW - j) % MAX_WINDOW;
+			double u = (m_times[idx] - time) / span;
+			double u2 = u * u;
+			s[0] += 1.0;
+			s[1] += u;
+			s[2] += u2;
+			s[3] += u2 * u;
+			s[4] += u2 * u2;
+			for(int i = 0; i < 3; ++i)
+			{
+				//Fit relative to the newest sample, so large encoder offsets don't eat precision
+				double y = m_angles[idx][i] - angles[i];
+				r[i][0] += y;
+				r[i][1] += y * u;
+				r[i][2] += y * u2;
+			}
+		}
+
+		//Solve the 3x3 normal equations by Cramer's rule. Only c1 and c2 are needed.
+		double det = s[0]*(s[2]*s[4] - s[3]*s[3]) - s[1]*(s[1]*s[4] - s[3]*s[2]) + s[2]*(s[1]*s[3] - s[2]*s[2]);
+		if(std::fabs(det) < 1e-12)
+		{
+			return;
+		}
+		for(int i = 0; i < 3; ++i)
+		{
+			double det1 = s[0]*(r[i][1]*s[4] - s[3]*r[i][2]) - r[i][0]*(s[1]*s[4] - s[3]*s[2]) + s[2]*(s[1]*r[i][2] - r[i][1]*s[2]);
+			double det2 = s[0]*(s[2]*r[i][2] - r[i][1]*s[3]) - s[1]*(s[1]*r[i][2] - r[i][1]*s[2]) + r[i][0]*(s[1]*s[3] - s[2]*s[2]);
+			m_velocity[i] = (det1 / det) / span;
+			m_acceleration[i] = 2.0 * (det2 / det) / (span * span);
+		}
+	}
+}
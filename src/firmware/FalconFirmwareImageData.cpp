@@ -0,0 +1,1200 @@
+/***
+ * @file FalconFirmwareImageData.cpp
+ * @brief Compressed firmware images for FalconFirmwareImages
+ *
+ * Generated by util/firmware2cpp.py from the .bin files in firmware/. Do not edit, rerun the script instead.
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#include "falcon/firmware/FalconFirmwareImages.h"
+
+namespace libnifalcon
+{
+	//nvent_firmware.bin, 8492 bytes packed to 5065
+	static const uint8_t IMAGE_DATA_0[] = {
+		0xf7,0xaa,0x08,0x00,0x00,0x0c,0x3f,0x00,0x02,0x80,0xfb,0x3b,0x0e,0x00,0x51,0xad,
+		0x28,0x00,0x80,0x69,0xff,0xff,0x1f,0x56,0x16,0x56,0x1a,0x56,0x40,0xff,0x29,0x1f,
+		0x76,0x00,0x00,0x02,0x29,0x1b,0xff,0x76,0x22,0x76,0xa9,0x28,0x3d,0x8e,0xa8,0xff,
+		0x28,0x3f,0x00,0x01,0x09,0x1b,0x61,0xff,0xff,0x76,0x3d,0x8e,0x04,0x29,0x0f,0x6f,
+		0x00,0xff,0x9b,0xa9,0x24,0x01,0xdf,0x04,0x6c,0x04,0xfb,0x29,0xa8,0x00,0x70,0xa6,
+		0x1e,0xa1,0xf7,0x86,0xff,0x24,0xa7,0x06,0xa1,0x81,0x01,0x09,0xa7,0xff,0x1e,0xa9,
+		0x24,0x03,0x63,0x5c,0xff,0x04,0xff,0x3b,0xa9,0x59,0x01,0xdf,0x09,0x00,0xec,0xbb,
+		0xff,0x1a,0x04,0x10,0xff,0xff,0xa8,0x00,0x30,0x01,0xfb,0x09,0x0e,0x04,0x10,0xff,
+		0xff,0x06,0x6f,0x01,0xff,0xdf,0xbd,0xc3,0xa7,0x1e,0x67,0x3e,0xbe,0xfd,0xc5,0x04,
+		0x71,0xa8,0x24,0x58,0xff,0xf7,0x60,0xff,0x7f,0x76,0x99,0x80,0x7f,0x76,0x46,0x80,
+		0xff,0xbd,0xb2,0x1f,0x76,0x4a,0x02,0xbd,0xaa,0xff,0x28,0xc5,0x67,0x3e,0x1f,0x76,
+		0x4b,0x02,0xff,0x00,0x59,0xa1,0x92,0x10,0xec,0x01,0x3b,0xff,0x00,0x8f,0x00,0x93,
+		0x03,0x56,0xa1,0x01,0xff,0x01,0x56,0xa4,0x00,0xa4,0x86,0x82,0xda,0xfd,0xc2,0x01,
+		0xf0,0xa1,0x92,0xff,0x9c,0xa9,0x59,0x7b,0xfa,0xed,0x02,0x71,0x02,0x06,0x03,0xec,
+		0x05,0x31,0x7a,0x00,0xb1,0x04,0x00,0xb4,0x00,0x77,0x00,0x6f,0x04,0xd2,0xdf,0xb2,
+		0x28,0xc5,0xa4,0x8b,0x04,0xf4,0x92,0x20,0xd7,0x52,0x07,0x64,0x01,0x51,0x26,0x04,
+		0x10,0x01,0x9a,0xeb,0x0f,0x6f,0x05,0xb5,0x00,0x05,0xb2,0xc4,0xb2,0x00,0xfd,0x0a,
+		0x01,0xd5,0x00,0x9a,0xbe,0x8b,0x06,0x00,0x6f,0x00,0x6f,0x06,0x00,0x01,0x11,0x28,
+		0xa8,0x00,0x73,0x7d,0x26,0x00,0x70,0x3f,0x8f,0xff,0xff,0x7f,0x00,0x30,0xff,0xa9,
+		0xa8,0xa5,0x0f,0x04,0xed,0x00,0xd4,0xef,0x00,0xbe,0x07,0x6f,0x01,0x31,0xc4,0x88,
+		0x02,0xff,0x02,0xa4,0x07,0xa9,0x8a,0xa6,0x92,0x7f,0xff,0x76,0x6d,0x87,0x06,0x00,
+		0x02,0xfe,0x41,0x7f,0x2b,0x41,0x92,0x06,0x52,0x14,0x63,0x06,0x51,0xf5,0x60,0x06,
+		0x50,0x41,0x06,0x52,0x00,0x02,0xc4,0x1e,0xbf,0x41,0x85,0x00,0x8f,0x5a,0x93,0x07,
+		0x32,0x2b,0xeb,0x41,0x0a,0x02,0x51,0xee,0x09,0x70,0xc4,0x01,0x00,0xff,0x1a,0x00,
+		0x40,0x14,0xf6,0x00,0x77,0x69,0xff,0xff,0xa9,0x28,0xb0,0x36,0x18,0x28,0xc2,0xdf,
+		0x00,0x7f,0x76,0x3f,0x86,0x01,0x91,0x18,0x1a,0xef,0x20,0x00,0x28,0x9a,0x00,0xd5,
+		0x02,0x28,0x05,0xff,0x00,0x03,0x18,0xf0,0xff,0x03,0xcc,0x0f,0xff,0xff,0x10,0x50,
+		0x03,0x96,0x03,0xcc,0xff,0x5f,0xf0,0xa9,0x1a,0x00,0x02,0x00,0x92,0x0f,0x00,0x90,
+		0xff,0x30,0x03,0x96,0x04,0xcc,0xf0,0xff,0x04,0xbb,0x50,0x04,0x00,0x70,0x0f,0xff,
+		0x50,0x00,0x70,0x00,0xff,0x28,0x90,0x0f,0x01,0x28,0x00,0x88,0x1f,0xef,0x76,0x33,
+		0x00,0x22,0x04,0xd0,0x23,0x76,0x01,0xff,0x00,0x82,0xfe,0x06,0x00,0x22,0x76,0xc0,
+		0xff,0xb9,0x29,0x28,0x68,0x00,0x1a,0x76,0x7f,0xfe,0x20,0xb0,0x04,0xfe,0x43,0x7c,
+		0x42,0x97,0x41,0xff,0x96,0x44,0x96,0x43,0x92,0x44,0x54,0x02,0xef,0x63,0x44,0x96,
+		0x42,0x00,0x71,0x65,0x44,0x96,0xf7,0x44,0x92,0x84,0x02,0xd0,0x1b,0x76,0x42,0x29,
+		0x3f,0x16,0x56,0x25,0x76,0x00,0x6f,0x00,0x9f,0x00,0x9f,0x00,0x00,0x9f,0x00,0x9f,
+		0x00,0x9f,0x00,0x9f,0x00,0x9f,0x00,0x9f,0x00,0x9f,0x00,0x9f,0x3c,0x00,0x93,0x10,
+		0x11,0x21,0x28,0x01,0x00,0x01,0x1f,0x01,0x13,0xff,0x05,0x00,0x69,0xff,0xbd,0xa8,
+		0xbd,0xa0,0xbf,0xbd,0xc2,0xbd,0xc3,0xbd,0xab,0x01,0xf9,0x7f,0xff,0x76,0x02,0x88,
+		0xbe,0x87,0xbe,0xc5,0xbe,0xff,0xc4,0xbe,0x83,0xbe,0x8a,0x03,0x00,0x17,0x87,0x76,
+		0x02,0x76,0x02,0xff,0x02,0xff,0x02,0xff,0x02,0xf7,0x04,0xfd,0xfe,0x03,0x19,0x1f,
+		0x76,0xd4,0x01,0x04,0x18,0xeb,0xbf,0xff,0x1e,0x51,0x01,0x20,0xd0,0x19,0x1a,0x10,
+		0xef,0x00,0x08,0x92,0xc3,0x00,0xf0,0x4d,0x02,0x1a,0x55,0x96,0x01,0x51,0x09,0x00,
+		0xd4,0x1b,0x00,0xd2,0x0a,0x00,0xd4,0x55,0x1c,0x00,0xd2,0x0b,0x00,0xd4,0x1d,0x00,
+		0xd2,0x0c,0x00,0xd4,0xd5,0x1e,0x00,0xd2,0x0d,0x00,0xd4,0x1f,0x00,0xd0,0x40,0x02,
+		0xff,0x01,0x02,0x1a,0x07,0xa6,0x1e,0x1a,0x1e,0xff,0x20,0xff,0xe8,0x03,0xa6,0x0f,
+		0x07,0x66,0xaf,0x00,0x02,0x1a,0x1e,0x01,0x71,0x04,0x08,0x32,0x4e,0xdf,0x02,0x0d,
+		0x92,0x0f,0xec,0x00,0x71,0x0c,0x28,0x9b,0xd0,0x07,0x00,0x71,0x0a,0x2b,0x01,0x52,
+		0x00,0x50,0x40,0xcf,0x02,0x08,0x2b,0x0c,0x35,0xb0,0x01,0xb0,0x0b,0x08,0xa7,0xed,
+		0x01,0x9a,0x01,0xd2,0x05,0x32,0x08,0x00,0x50,0x4d,0xfe,0x36,0x50,0x1a,0xec,0x43,
+		0x2b,0x43,0x92,0x00,0xaf,0x2b,0x06,0x52,0x15,0x2f,0xb6,0x43,0x2f,0xb2,0x40,0xbf,
+		0x8f,0x00,0x08,0xc4,0xa0,0x43,0x2f,0xd0,0x54,0xae,0x2f,0xd4,0x43,0x0a,0x43,0x2f,
+		0xd0,0xed,0x2f,0xd0,0x4d,0xff,0x02,0x05,0x92,0x7b,0xec,0x09,0x0a,0x09,0xff,0x92,
+		0x14,0x52,0x77,0xed,0x09,0x2b,0x07,0xbe,0x38,0xb0,0x4e,0x02,0x12,0x92,0x68,0x3e,
+		0x30,0x4e,0xef,0x02,0x14,0x92,0x64,0x00,0x72,0x13,0x92,0x60,0xbd,0xed,0x05,0xd1,
+		0x06,0x52,0x25,0x65,0x05,0xb1,0x54,0xef,0x93,0x43,0x85,0x40,0x34,0xb4,0x43,0x85,
+		0x01,0xff,0x56,0xa5,0x00,0xc5,0x92,0xc4,0x9e,0xa9,0x7f,0x85,0x56,0xff,0x02,0x52,
+		0x10,0x65,0x06,0x91,0xbc,0x01,0xb3,0x05,0xf1,0x07,0x2b,0xc4,0x88,0x07,0xb8,0x7e,
+		0xb6,0x07,0xb3,0xdd,0x62,0x01,0xb2,0x92,0x37,0x0e,0xf2,0x19,0xd7,0x92,0x01,0x3b,
+		0x00,0xf1,0x08,0x04,0x34,0x08,0x65,0xb8,0x01,0x53,0x03,0xf3,0x0e,0x11,0x4e,0x02,
+		0x18,0x00,0xd2,0x02,0x5c,0x02,0x1a,0x01,0x33,0x07,0x2b,0x02,0x02,0x12,0x1b,0x00,
+		0xd2,0xc5,0x01,0x02,0x14,0x0a,0x02,0x12,0x01,0x34,0x12,0x32,0x07,0x2b,0xff,0x07,
+		0x92,0x50,0x52,0x04,0x64,0x05,0x2b,0x9d,0x06,0x16,0xf0,0x06,0x92,0x3a,0x13,0x12,
+		0x42,0xb9,0x43,0x99,0x01,0x0d,0x5c,0x00,0x50,0xc4,0x00,0x0b,0x13,0x42,0xb1,0x4d,
+		0xff,0x02,0x0d,0x0a,0x0d,0x92,0x80,0x52,0x23,0xf9,0x64,0x03,0x93,0x16,0x9d,0xc4,
+		0xc4,0xac,0x28,0x19,0xff,0x00,0xa6,0x06,0x45,0xff,0x22,0x56,0xa6,0xdf,0x07,0x46,
+		0xff,0xc4,0x1e,0x16,0x99,0x06,0x2b,0xff,0x07,0x6f,0x7f,0x76,0x73,0x88,0x7f,0x76,
+		0x3d,0xdd,0x00,0x30,0x47,0x89,0x84,0xfe,0x2a,0x5f,0x31,0x7f,0x84,0x01,0x1f,0x01,
+		0x17,0x02,0x01,0x1f,0x01,0x1f,0x35,0xff,0x32,0xf6,0xd0,0x8f,0x01,0x2f,0x28,0x80,
+		0x1a,0x50,0x02,0x73,0x30,0x51,0x01,0xef,0x2b,0x04,0x1a,0x40,0x00,0x90,0xd0,0x01,
+		0x05,0x5c,0x13,0x90,0x18,0x30,0x54,0x09,0x63,0x00,0x71,0x06,0x28,0x92,0x9f,0x0b,
+		0x18,0xfe,0xff,0x62,0x28,0x50,0x01,0xd7,0x61,0xe8,0x16,0x52,0x14,0xf1,0x00,0x71,
+		0x0e,0x23,0xd2,0x0b,0x40,0x19,0xff,0xee,0x1f,0x76,0xc3,0x01,0x24,0xcc,0x10,0xef,
+		0x00,0xc3,0xff,0x50,0x1e,0x12,0x01,0x92,0x4c,0x3e,0x24,0x92,0x0e,0x92,0x32,0x52,
+		0x44,0x10,0xd0,0x02,0x50,0x95,0x1a,0x03,0x33,0x01,0x03,0xb0,0x3b,0x05,0x30,0x02,
+		0xf5,0x2e,0xd2,0x02,0xf4,0xf2,0x00,0x72,0x02,0xf1,0x2f,0x13,0xd2,0x0c,0x92,0xdf,
+		0x2b,0xec,0x0c,0x2b,0x00,0x58,0xd0,0xb1,0x89,0x97,0x00,0x52,0x09,0x01,0xd2,0x02,
+		0x08,0xf0,0x01,0xb1,0x03,0xf3,0x2b,0x0b,0x09,0x56,0x00,0xd0,0x94,0xce,0x9c,0x03,
+		0x3f,0x96,0x00,0x02,0x10,0x1e,0x32,0x32,0x70,0x01,0x50,0x46,0x21,0xd2,0x19,0x96,
+		0x02,0x31,0x04,0x70,0x0a,0xb4,0x01,0x0d,0x12,0xf9,0x0e,0x00,0x50,0x0c,0xd5,0x00,
+		0x8f,0x40,0x06,0x19,0xfa,0x22,0x92,0x03,0x0d,0xd3,0x94,0xa8,0x28,0xc0,0xf9,0xaf,
+		0x7f,0x76,0x08,0x81,0x00,0xd1,0x16,0x01,0x92,0x01,0xff,0x02,0x01,0x56,0x10,0x00,
+		0x10,0xa3,0x00,0xff,0x02,0x1f,0x76,0x53,0x02,0x1f,0xf6,0x17,0x3f,0x56,0x28,0x00,
+		0x58,0xff,0x0a,0x0d,0xb0,0x03,0x51,0xff,0x03,0x63,0x03,0x0a,0x04,0x6f,0x00,0x52,
+		0x4f,0x02,0x65,0x03,0x0b,0x14,0xd1,0x05,0x73,0x18,0x14,0x34,0x45,0x07,0x14,0x34,
+		0xfd,0x14,0x32,0x01,0xd7,0x14,0x33,0x07,0x09,0x74,0x75,0x11,0x14,0x33,0x41,0x14,
+		0x35,0x04,0x00,0xc1,0x14,0x34,0x05,0x00,0x14,0x34,0x11,0x14,0x38,0x1b,0x51,0x01,
+		0x90,0x14,0x38,0x02,0xf1,0xa2,0x14,0x33,0x00,0x14,0x34,0x02,0xf1,0x14,0x33,0x0a,
+		0x14,0x30,0x0a,0x2b,0x2b,0x01,0x14,0x3c,0xfd,0x14,0x32,0x04,0x14,0x32,0x09,0x53,
+		0x80,0x00,0xd0,0x14,0x30,0x6b,0xd0,0x14,0x34,0x01,0x50,0x38,0x33,0x14,0x34,0x0a,
+		0x8a,0x0a,0xb4,0x00,0x0d,0x12,0x11,0x00,0x50,0x0c,0xd5,0x14,0x31,0x18,0xd2,0x12,
+		0x92,0x04,0x0d,0xd3,0x14,0x3a,0x17,0x14,0x36,0x0e,0x00,0xb9,0x0e,0x14,0x3f,0x03,
+		0x52,0x03,0x63,0x04,0x14,0x34,0x04,0xf3,0x0b,0x01,0x02,0x10,0x02,0xf0,0x56,0x12,
+		0x00,0x12,0xd4,0x02,0xdf,0x01,0x90,0x0b,0x02,0xd0,0x0b,0x02,0xd4,0x0b,0x0b,0x20,
+		0x34,0xdf,0x30,0x5f,0x01,0x1f,0x01,0x1f,0x01,0x17,0x04,0x01,0x1f,0x01,0x1f,0x20,
+		0x01,0x1f,0x01,0x1f,0x01,0x1f,0x01,0x1f,0x01,0x1e,0x08,0x01,0x1f,0x01,0x1f,0x20,
+		0x01,0x1f,0x01,0x1f,0x01,0x1f,0x01,0x1f,0x01,0x1e,0x10,0x01,0x1f,0x01,0x1f,0x20,
+		0x01,0x1f,0x01,0x1f,0x01,0x1f,0x01,0x1f,0x01,0x1e,0x20,0x01,0x1f,0x01,0x1f,0xf8,
+		0x01,0x1f,0x4e,0xbf,0x81,0xba,0x00,0x01,0x1f,0x76,0xc1,0xff,0x01,0x15,0xcc,0x80,
+		0x00,0xc6,0xff,0x0a,0xbf,0xec,0x11,0x18,0xdf,0xff,0x11,0x99,0x30,0x1b,0xff,0x18,
+		0xff,0xdf,0x1b,0x1a,0x00,0x20,0x03,0x66,0x59,0xd0,0x6a,0x8a,0x02,0x11,0x00,0xd0,
+		0x40,0x1b,0x50,0x70,0x1c,0x25,0x1f,0x04,0xb3,0xc1,0x01,0x1a,0x52,0x52,0x05,0x33,
+		0x85,0xff,0x32,0x07,0x3d,0xdd,0x07,0x3f,0x07,0x38,0x8e,0x8c,0x02,0x11,0x07,0x3f,
+		0x32,0x07,0x3b,0xdd,0x07,0x3f,0x0f,0x98,0x00,0x01,0x10,0xbd,0x01,0x19,0xee,0x00,
+		0x9b,0x00,0x9b,0x8f,0xae,0xd0,0x01,0x19,0xc2,0xdf,0x56,0xfd,0xff,0x06,0x00,0x84,
+		0xb1,0xd0,0x01,0xf5,0x09,0x39,0x90,0xd4,0x00,0x52,0xd0,0x01,0x2c,0x2b,0x5f,0x2d,
+		0x2b,0x2e,0x2b,0x2f,0xc4,0x10,0x30,0x00,0x30,0xc1,0x31,0x00,0x30,0x01,0xb1,0x01,
+		0x5f,0x02,0xb1,0x40,0x11,0xd4,0x01,0xfd,0x00,0x0e,0x52,0xd0,0x01,0x04,0x2b,0x01,
+		0x2b,0x7f,0x03,0x28,0xc8,0x19,0x15,0x2b,0x15,0x0e,0x30,0x7d,0x15,0x0a,0xf0,0x15,
+		0x1a,0x80,0x00,0x15,0xb2,0x73,0xff,0x08,0x15,0x96,0x15,0xcc,0xe3,0xff,0x08,0xff,
+		0x50,0x15,0x96,0x17,0x2b,0x18,0x2b,0x19,0xfc,0x03,0x92,0x00,0x95,0xd0,0x01,0x13,
+		0x28,0xaa,0x0a,0xff,0x11,0x28,0xe0,0x82,0x04,0x28,0x42,0xd0,0x69,0x2c,0x03,0x50,
+		0x0c,0x51,0x24,0x29,0x70,0x23,0x76,0x4e,0x31,0x7f,0xd0,0x01,0x08,0x2b,0x05,0x2b,
+		0x07,0x07,0x50,0xcf,0x08,0x28,0x70,0xd8,0x9a,0xf2,0x06,0xb2,0x78,0x0f,0xef,0x04,
+		0x28,0x00,0xd0,0x01,0xbb,0xd0,0x01,0x20,0xe3,0x2b,0x20,0xd5,0xd0,0xb6,0x51,0x51,
+		0x31,0x02,0x2b,0x01,0x7f,0x28,0xff,0x7c,0x00,0x18,0xff,0x7f,0x00,0x30,0x55,0xbf,
+		0x00,0x30,0xdf,0x00,0x30,0xef,0x00,0x30,0xf7,0x00,0x30,0xf5,0xfb,0xbf,0xd0,0x02,
+		0x00,0x30,0x01,0x00,0x18,0x7f,0xab,0xff,0x00,0xa0,0x30,0x00,0x0b,0x90,0x00,0x9f,
+		0xf0,0x00,0x2d,0x1a,0xdb,0xc0,0x1a,0x04,0x00,0x30,0x02,0x00,0x30,0x4e,0xf1,0xbf,
+		0xc3,0x01,0x21,0x1a,0x00,0x04,0x00,0x30,0x08,0x5a,0x00,0x30,0x10,0x00,0x30,0x20,
+		0x21,0x02,0xf0,0x21,0x03,0x70,0x29,0x21,0x05,0x70,0x01,0xf1,0x06,0x08,0x70,0x05,
+		0x03,0xf0,0x58,0x92,0x04,0x1e,0x90,0x00,0x71,0x05,0x1b,0x52,0x00,0xf1,0xa5,0xf1,
+		0x00,0xf1,0x0d,0xb1,0x4a,0x00,0xf1,0x7f,0x00,0xf2,0x04,0x09,0x70,0x00,0x30,0xbf,
+		0x00,0x30,0xd5,0xdf,0x00,0x30,0xef,0x00,0x30,0xf7,0x00,0x30,0xfb,0x04,0x58,0x09,
+		0x70,0x00,0x30,0x01,0xf0,0x7f,0xff,0xa9,0xb1,0x04,0x04,0xf0,0x57,0x04,0x18,0xef,
+		0x00,0x30,0xf7,0x00,0x30,0xfb,0x00,0x30,0xfd,0xfd,0x00,0x30,0xfe,0xff,0x0e,0x2b,
+		0x0d,0x2b,0x55,0x0c,0x01,0xf0,0x0c,0x01,0xf0,0x0c,0x01,0x30,0x0c,0x01,0x30,0x5f,
+		0x12,0x2b,0x11,0x2b,0x10,0x02,0x30,0x10,0x00,0xf0,0x9d,0x10,0x00,0xf0,0x15,0x2b,
+		0x14,0x06,0x10,0x00,0x30,0xdf,0xaa,0x00,0x30,0xef,0x00,0x30,0xf7,0x00,0x30,0xfb,
+		0x00,0x30,0xfd,0x56,0x00,0x30,0xfe,0x14,0x06,0x10,0x14,0x04,0x10,0x14,0x0b,0x90,
+		0x55,0x14,0x0f,0x90,0x14,0x0f,0x90,0x14,0x0f,0x90,0x14,0x0f,0x90,0xd1,0x14,0x0f,
+		0x90,0x1c,0x31,0x0a,0x91,0x34,0x0b,0x14,0x19,0x2b,0x4a,0xd1,0x71,0x18,0x08,0xb0,
+		0x19,0x00,0x30,0x01,0x11,0x38,0x03,0x50,0xf7,0x1a,0x76,0x69,0x24,0xd0,0x7f,0x76,
+		0x9d,0x8d,0xff,0x7f,0x76,0xb4,0x86,0x7f,0x76,0xc1,0x89,0xf4,0xe5,0xd0,0x00,0x70,
+		0xad,0xe6,0x50,0x44,0x8a,0x7f,0x76,0xff,0x6e,0x8c,0x7f,0x76,0xe5,0x87,0xa9,0x20,
+		0xff,0x7f,0x76,0x9a,0x8d,0x30,0x29,0x69,0xff,0xd7,0x7f,0x76,0x51,0x01,0x10,0x15,
+		0x02,0xd0,0x22,0x8d,0xef,0xf9,0x6f,0x02,0xfe,0x04,0x71,0x30,0x40,0x41,0x57,0x2b,
+		0x08,0xef,0x35,0xf1,0x41,0x07,0x70,0x30,0x0c,0x10,0x9d,0x05,0x66,0xf0,0xc1,0x01,
+		0x30,0x08,0xd0,0x01,0xf2,0xcc,0xdf,0x02,0x00,0xc0,0xff,0x08,0x6b,0x70,0xc1,0x01,
+		0xa5,0x31,0x01,0xd0,0x41,0x0a,0x10,0x02,0x13,0x31,0x02,0x10,0x41,0xed,0x92,0xd5,
+		0x91,0x02,0xfe,0x99,0x31,0xee,0x94,0x41,0xf3,0x96,0x41,0x9b,0xd0,0xa8,0x31,0x4e,
+		0x02,0xc4,0x92,0xbd,0x08,0x00,0xd0,0x00,0x8f,0xea,0x94,0x9a,0x52,0x92,0x03,0x05,
+		0x96,0x02,0x91,0x87,0x37,0x80,0xf2,0x2f,0xb0,0x73,0xf5,0x6c,0x92,0xee,0x00,0xf4,
+		0x08,0x00,0xc2,0x00,0xf2,0x03,0x96,0x01,0xbf,0x9a,0x04,0x96,0x0f,0x96,0x0e,0x15,
+		0xb1,0x2b,0x3f,0x02,0x28,0x07,0x00,0x0b,0x2b,0x04,0x31,0xba,0xd3,0xfd,0x0a,0x18,
+		0x50,0x7f,0x76,0x89,0x87,0x7f,0x76,0x3b,0xae,0x87,0x0b,0x13,0x01,0x00,0x31,0x23,
+		0x52,0xdf,0x71,0xe5,0x08,0x00,0x30,0x10,0x02,0xb2,0x03,0x71,0x04,0x2b,0x0f,0xe6,
+		0x03,0x90,0x02,0xfe,0x02,0xf1,0x01,0x31,0x41,0x96,0x08,0xff,0x92,0x41,0x54,0x4c,
+		0xed,0x1b,0x0a,0x10,0x3b,0x0a,0x09,0x75,0x90,0x0b,0x42,0x13,0x7f,0xb4,0x07,0xb1,
+		0x7d,0x49,0x7a,0x52,0x03,0x92,0x45,0xed,0x10,0x7c,0x70,0x57,0x41,0x64,0x0b,0x0e,
+		0x90,0x03,0x02,0x50,0x3c,0x7e,0xf4,0xda,0x02,0x31,0x29,0x02,0x34,0xf4,0xec,0x02,
+		0x31,0x30,0x64,0x7f,0x15,0x92,0x2e,0xec,0x15,0x2b,0x02,0x7e,0x7c,0x9d,0xfb,0x7e,
+		0x72,0x0b,0x2b,0x0d,0xc4,0x72,0xb1,0x93,0x0b,0x92,0x7e,0x70,0x0b,0x7e,0x70,0x00,
+		0xb1,0x12,0xc8,0xb0,0x01,0x70,0x28,0xd7,0x32,0x00,0x0f,0x02,0x12,0x15,0x06,0x50,
+		0x08,0x6f,0xdd,0x05,0x09,0xb0,0x07,0xed,0x0b,0x03,0xd0,0x09,0x2b,0x07,0x1b,0x0b,
+		0x03,0x0f,0xb0,0x77,0x93,0x7e,0x91,0x02,0xf2,0x7e,0x1a,0x37,0x1a,0x96,0x41,0xf8,
+		0x90,0xae,0x87,0x15,0xf3,0xa1,0x90,0x8f,0xfe,0x0a,0x92,0x07,0x7a,0xb0,0x1b,0xb1,
+		0x15,0x91,0x08,0xfe,0x8c,0x12,0x00,0x02,0x12,0x2b,0x46,0x1e,0x44,0xff,0x1e,0x52,
+		0x6f,0x20,0xcc,0x00,0x04,0xc9,0x37,0xff,0x0c,0xec,0xbf,0xf3,0x1b,0x85,0xc7,0xd2,
+		0x04,0x90,0x3f,0x4d,0x02,0x22,0x03,0x0b,0x6f,0x01,0x51,0x00,0xf0,0x74,0x01,0x50,
+		0xd8,0x70,0xae,0x00,0x51,0x20,0x07,0x42,0x0a,0x52,0xff,0x00,0x8f,0x00,0xfa,0x42,
+		0x06,0x01,0x56,0xff,0x1e,0x00,0xa9,0xa8,0x1e,0x0f,0x03,0x63,0xff,0x1e,0xa8,0x0a,
+		0x6f,0x29,0xff,0x83,0xff,0xdf,0x1e,0x0f,0x06,0x65,0xaa,0x40,0x90,0xab,0x28,0xff,
+		0x00,0x06,0x1e,0xa9,0x1e,0x06,0x30,0xff,0xff,0x6c,0xff,0x46,0x1e,0x42,0x06,0x46,
+		0xa3,0xff,0x31,0xff,0xac,0x10,0x44,0x1e,0x44,0x06,0x71,0x06,0x98,0xb0,0x3c,0x93,
+		0x23,0x91,0xc3,0x01,0x22,0x00,0x90,0xed,0x44,0xc3,0x10,0xa9,0x85,0x01,0xd1,0x03,
+		0x63,0x00,0xff,0x02,0xb4,0x6f,0x00,0x8f,0x78,0x0f,0xa9,0xf7,0xa8,0x44,0x0f,0xf8,
+		0x90,0xa8,0x44,0x92,0x69,0x4e,0x4e,0x92,0x17,0x96,0x86,0x0d,0x3f,0x0d,0x3a,0x14,
+		0x0d,0x37,0xab,0x08,0xca,0x0d,0x36,0x1d,0x0d,0x32,0x14,0x0d,0x32,0x26,0xaa,0x0d,
+		0x36,0x14,0x0d,0x32,0x1c,0x0d,0x32,0x24,0x0d,0x3c,0x1c,0xaa,0x0d,0x30,0x1c,0x0d,
+		0x30,0x1c,0x0d,0x34,0x1c,0x0d,0x38,0x1c,0x53,0xa9,0x1c,0x0d,0x3f,0x0d,0x37,0x08,
+		0x0d,0x36,0x08,0x0d,0x3f,0xd2,0x0d,0x3f,0x18,0x0d,0x3f,0x0d,0x3c,0x13,0x0d,0x37,
+		0x10,0xcb,0xaa,0x0d,0x36,0x1f,0x0d,0x32,0x13,0x0d,0x32,0x2a,0x0d,0x36,0x13,0xaa,
+		0x0d,0x32,0x1e,0x0d,0x32,0x28,0x0d,0x3c,0x20,0x0d,0x30,0x20,0xea,0x0d,0x30,0x20,
+		0x0d,0x34,0x20,0x0d,0x38,0x20,0xa9,0x20,0x94,0x0d,0x3f,0x0d,0x37,0x10,0x0d,0x36,
+		0x10,0x0d,0x3f,0x0d,0x3f,0x19,0xf8,0x0d,0x32,0x44,0xf1,0x35,0x91,0x04,0x92,0x08,
+		0xec,0x41,0xff,0x2d,0x01,0x9a,0x66,0xff,0x02,0xce,0x03,0x7f,0xec,0x01,0x9a,0x02,
+		0x6f,0x00,0x9a,0x29,0xb1,0x5d,0x30,0x0b,0x10,0x33,0x00,0x20,0x51,0xb0,0x22,0x4b,
+		0x70,0xef,0x40,0x8f,0xa2,0x93,0x0a,0x90,0x0d,0x28,0xff,0x9d,0x01,0x4c,0x10,0x05,
+		0x8e,0x1a,0x63,0x70,0x3b,0x70,0x2b,0xff,0x24,0x2b,0x26,0x2b,0x28,0x2b,0x2a,0x2b,
+		0xfd,0x2c,0x6f,0x90,0x30,0x2b,0x32,0x2b,0x34,0x2b,0xff,0x36,0x2b,0x38,0x2b,0x23,
+		0x2b,0x25,0x2b,0xdf,0x27,0x2b,0x29,0x2b,0x2b,0x71,0x10,0x2f,0x2b,0xff,0x69,0xff,
+		0x31,0x2b,0x33,0x2b,0x35,0x2b,0x5f,0x37,0x2b,0x39,0x2b,0x21,0x0d,0x10,0x20,0x3f,
+		0x50,0xf7,0x06,0x00,0x06,0x07,0xf0,0x40,0x02,0x44,0x97,0xff,0x43,0x96,0x42,0xa8,
+		0x00,0x8f,0xc0,0x90,0xff,0x14,0x92,0x46,0xa8,0x03,0xec,0x00,0x9a,0xff,0x2d,0x6f,
+		0x46,0x8a,0x01,0x02,0xa4,0x07,0xbf,0x46,0x1e,0xc4,0x28,0x3c,0x00,0x00,0xb5,0x43,
+		0x9f,0x92,0xc7,0xff,0xc4,0x96,0x00,0xd7,0x00,0xb7,0x44,0x7e,0x00,0xb0,0x42,0x83,
+		0x46,0x8a,0x43,0x0e,0x09,0x71,0xdf,0x43,0x0e,0x01,0x56,0x46,0x03,0x50,0xc4,0x28,
+		0xf7,0x3e,0x00,0x43,0x3b,0xf0,0x40,0x02,0x05,0x9c,0xbd,0x0c,0x49,0x70,0x14,0x96,
+		0x0d,0x2b,0x0f,0x55,0x40,0xfe,0xfb,0x50,0x41,0x2b,0x0f,0xec,0x0c,0x92,0x0d,0xfb,
+		0x54,0x0b,0xfa,0xd2,0xc0,0x90,0x0d,0x85,0x0d,0xfd,0x0a,0x4f,0x93,0x41,0x96,0x02,
+		0x6f,0x14,0x2b,0xd3,0x41,0x2b,0x52,0xb3,0x4a,0x91,0x10,0x49,0x10,0x11,0x28,0xf9,
+		0x43,0x5e,0x92,0x5f,0x11,0x12,0x2b,0x13,0x28,0x0a,0xff,0x00,0x1a,0x28,0x50,0xc0,
+		0x1b,0x28,0x70,0x17,0x40,0x1c,0x2b,0x8a,0xd1,0x1a,0x6e,0xb0,0x8a,0xd1,0x11,0x51,
+		0xb5,0x32,0x02,0x70,0x32,0x02,0x70,0x23,0x76,0x7f,0x31,0x40,0xcf,0x02,0x16,0x2b,
+		0x08,0xf4,0xd1,0x04,0xb2,0x02,0xfe,0xff,0x1b,0xcc,0x00,0x1f,0x01,0x3b,0xc7,0xff,
+		0xbf,0x42,0x96,0x41,0x2b,0x09,0x6f,0x57,0x31,0x40,0xfd,0x92,0x07,0x91,0x17,0xc6,
+		0xc4,0x96,0x41,0x0a,0x85,0x42,0x44,0xb0,0xf6,0xff,0x90,0x03,0x50,0x03,0x30,0x08,
+		0x11,0xbd,0xeb,0xb2,0x04,0x0b,0x30,0x49,0xca,0xb0,0x3c,0x52,0x41,0xfe,0x01,0x30,
+		0xc0,0x56,0xcb,0x00,0x0f,0x92,0x3e,0xef,0x52,0xc0,0x56,0xc7,0x89,0x90,0x0f,0x52,
+		0x44,0xbb,0x96,0x0d,0xf6,0x32,0x40,0x92,0x44,0x5c,0xd2,0x41,0xff,0x9a,0xc4,0x74,
+		0x44,0x0a,0x44,0x92,0x0f,0xff,0x52,0xf5,0x64,0x41,0x92,0x01,0x9c,0xa9,0xfb,0x58,
+		0x40,0x01,0xb0,0x41,0x59,0x03,0x56,0x95,0x7f,0x04,0x41,0x93,0x02,0x9d,0xa8,0x58,
+		0x02,0xb1,0xff,0x9c,0xca,0xa9,0x88,0x03,0x56,0x94,0x08,0xff,0xa9,0x93,0xa6,0xcb,
+		0xa8,0x80,0x41,0x93,0xb9,0x03,0x01,0x70,0x00,0xf0,0x0c,0xa7,0xca,0x09,0x70,0x08,
+		0xff,0x04,0x00,0x42,0x92,0x5c,0xff,0xa9,0x93,0xff,0xce,0xff,0xa8,0x94,0x00,0x8f,
+		0x10,0x27,0xbf,0xa0,0xff,0xa8,0x28,0xf0,0xd8,0x4c,0x15,0x12,0x18,0x4c,0x10,0x05,
+		0x75,0x05,0x53,0x41,0x59,0x05,0x7f,0x05,0x7f,0x05,0x7f,0x82,0x05,0x7b,0x13,0x05,
+		0x7f,0x05,0x7f,0x05,0x7f,0x05,0x7f,0x05,0x7c,0x14,0xc6,0x05,0x74,0x41,0x59,0x05,
+		0x91,0x04,0xd1,0x05,0xd1,0x9c,0xca,0xef,0x43,0x96,0x43,0x40,0x74,0xb1,0x4e,0x02,
+		0x0f,0xbe,0x3d,0x90,0x7f,0x76,0xc3,0x87,0x04,0x5d,0x52,0x0f,0x4f,0x2b,0x43,0x41,
+		0x06,0x01,0x70,0x35,0xb1,0x40,0x73,0xd2,0xfe,0x35,0xb1,0x40,0x00,0x43,0x42,0x04,
+		0xef,0x21,0x6e,0x7e,0x90,0x03,0x6f,0x22,0x00,0x50,0x43,0x43,0x00,0xd1,0xfb,0x00,
+		0x40,0x00,0xd1,0x00,0x40,0x84,0xfe,0xbe,0xb9,0x8b,0x25,0xd1,0x23,0x71,0x10,0x52,
+		0x0f,0x19,0x13,0x91,0xb6,0x75,0xf5,0xc1,0x01,0x25,0x70,0x0a,0x19,0x08,0x70,0x10,
+		0xf7,0x52,0xf3,0x64,0x1d,0x51,0x08,0xfe,0x46,0xa0,0xf7,0x44,0xa8,0x41,0x2c,0x51,
+		0x9b,0xc4,0x92,0xa9,0xff,0x95,0x47,0x96,0x47,0x97,0x44,0x8a,0x01,0xf3,0x3b,0xa9,
+		0x1c,0x33,0x2d,0x30,0x47,0x92,0x14,0x52,0xbf,0x02,0xed,0x47,0x2b,0x47,0x92,0x2c,
+		0xd0,0x96,0xfd,0x88,0x03,0x30,0x06,0xfe,0x42,0xa8,0xc4,0x92,0xfe,0x32,0xf0,0x8a,
+		0xc4,0x92,0x44,0x96,0x46,0x2b,0x5d,0x46,0x02,0x10,0x16,0x63,0x42,0x03,0x50,0x46,
+		0x03,0x52,0xff,0xc4,0x92,0x45,0x96,0x43,0x92,0x45,0x54,0xd7,0x03,0x65,0x45,0x02,
+		0x50,0x44,0x00,0x91,0x63,0x45,0xfa,0x02,0x91,0x0a,0x02,0x91,0xec,0x64,0x00,0x9a,
+		0x44,0xff,0x93,0x43,0x9f,0x02,0x53,0x02,0x62,0x01,0x35,0x9a,0x4d,0x53,0x45,0xf1,
+		0x70,0x3c,0x00,0x25,0xf1,0xe9,0x72,0xf7,0x91,0x16,0x92,0x26,0x11,0x5c,0xff,0x42,
+		0x2b,0xff,0x43,0x96,0x41,0x58,0x41,0x0a,0x43,0x92,0xdf,0x0f,0x90,0x41,0x9c,0x94,
+		0x00,0xb4,0xa3,0xff,0x48,0x00,0xd1,0x02,0xb1,0x01,0x15,0xa7,0x01,0x12,0x00,0xd5,
+		0xab,0x00,0xd4,0x01,0x1a,0x18,0xb0,0x03,0xff,0x03,0xf5,0x03,0xbf,0x03,0xb5,0x48,
+		0xf2,0x01,0x10,0xa1,0x17,0x03,0xff,0x03,0xff,0x03,0xff,0x09,0xb2,0x40,0x09,0xb0,
+		0x10,0xfe,0xf5,0x72,0x02,0x40,0x42,0x96,0x03,0xee,0x42,0xf6,0x85,0x50,0x02,0x41,
+		0x00,0x71,0x40,0x00,0x02,0x42,0xc6,0x00,0x71,0x20,0x00,0x03,0x11,0x36,0x70,0x03,
+		0xb4,0x94,0x28,0xf5,0x41,0x01,0x10,0x94,0x42,0xf0,0x7f,0x76,0x5b,0x8b,0xfc,0xcb,
+		0x92,0x3a,0x10,0xc7,0xff,0xfb,0xed,0x14,0xcc,0xdf,0x40,0x00,0xc5,0xff,0xfd,0x81,
+		0xb0,0xc3,0x01,0x75,0x35,0x1f,0x10,0x32,0xc1,0x30,0x69,0xff,0x36,0x00,0x90,0xf9,
+		0x84,0x13,0xd2,0x3a,0x30,0x92,0x19,0xec,0x08,0x92,0xff,0x0c,0xec,0x14,0x2b,0x00,
+		0x8f,0xae,0x94,0xbf,0x7f,0x76,0x25,0x8e,0x00,0x9b,0x00,0x93,0xf1,0x2b,0x89,0x05,
+		0x8e,0xd0,0x85,0x9d,0x50,0xb2,0x05,0x30,0x40,0x31,0xaa,0x09,0x31,0x0d,0x40,0x74,
+		0xdd,0x45,0x34,0x41,0x44,0xf3,0x28,0x5f,0x06,0x00,0x13,0x28,0xb6,0x45,0x14,0x61,
+		0x45,0x1f,0x2c,0x44,0xd0,0x9d,0xd1,0x40,0x02,0x44,0x75,0xdd,0x44,0x74,0x4b,0x90,
+		0xf5,0x91,0x44,0x93,0x11,0x2a,0x50,0x40,0x02,0x0b,0x58,0xde,0x01,0xb1,0x64,0x9b,
+		0x17,0xc6,0x10,0x93,0x0b,0x0a,0x7f,0x0b,0x92,0xff,0x00,0x37,0x8e,0x0b,0x45,0x94,
+		0xf5,0xee,0x45,0x92,0x0a,0x45,0x94,0x02,0xfe,0x20,0x52,0xff,0x41,0x96,0x03,0xed,
+		0x00,0x9a,0x06,0x6f,0xff,0x39,0x52,0x03,0x69,0xc9,0x9c,0x02,0x6f,0xbb,0xd0,0x9c,
+		0x01,0x93,0x42,0xa8,0xcc,0x8a,0x50,0xb2,0xbf,0x8c,0x42,0x8a,0xa9,0x88,0xc4,0x00,
+		0x92,0x03,0xdf,0x56,0xa9,0x04,0xa6,0x94,0x01,0xd3,0x2b,0x6f,0xdd,0x06,0x39,0x50,
+		0xc0,0x91,0x94,0x52,0xd0,0x06,0x0a,0xef,0x06,0x92,0x64,0x9b,0x06,0x51,0x06,0x96,
+		0x19,0xef,0x6f,0x07,0x2b,0x12,0x05,0xd0,0x1b,0x6f,0x12,0xdc,0x11,0x90,0x9a,0x91,
+		0x12,0x2b,0x15,0x00,0xb0,0x13,0xec,0xf7,0x07,0x58,0x41,0x37,0x90,0x1c,0x90,0x14,
+		0x9b,0xdf,0x94,0x96,0x07,0x0a,0x07,0x09,0x52,0x07,0x96,0xff,0x07,0x6f,0x41,0x92,
+		0x0a,0x52,0xe6,0xec,0xdf,0x0d,0x52,0xe8,0xec,0xed,0x0c,0x13,0x92,0x06,0x7f,0x54,
+		0x03,0xec,0x09,0x92,0xd0,0xec,0x57,0xd3,0xdd,0x40,0x2a,0x10,0x01,0x00,0x09,0x6c,
+		0x70,0x1d,0x90,0xff,0x7f,0x76,0xbf,0x8c,0x10,0x96,0x1c,0x92,0xff,0x11,0x96,0x05,
+		0x6f,0x1c,0x92,0xbf,0x9c,0xef,0x02,0x52,0xf5,0x69,0x02,0x33,0x0a,0x92,0x09,0xfb,
+		0xec,0x0a,0x16,0xf0,0xce,0x8c,0x09,0x92,0x04,0x3f,0xec,0x7f,0x76,0x03,0x8d,0x09,
+		0xa7,0x92,0x5f,0xd0,0x0f,0x92,0x0e,0xed,0x18,0x18,0x50,0x19,0x91,0x00,0xf1,0x00,
+		0xb1,0xdd,0xf1,0x9f,0x10,0x69,0xec,0x05,0x05,0x70,0x04,0x92,0xc7,0x41,0xec,0x04,
+		0x19,0x90,0x7d,0x33,0x01,0xf1,0xc1,0xff,0xff,0x03,0x96,0x05,0x92,0x36,0xec,0x03,
+		0x92,0xff,0x0a,0xec,0x15,0x92,0x02,0x52,0x07,0xec,0xdf,0x03,0x52,0x05,0xec,0x02,
+		0x02,0xb0,0x15,0x28,0xf7,0x02,0x00,0x03,0x42,0x70,0x15,0x92,0x01,0x52,0xfd,0x04,
+		0x72,0x70,0x15,0x96,0x02,0x96,0x00,0x92,0xff,0x21,0xec,0x11,0x92,0x15,0x28,0x03,
+		0x00,0xff,0x00,0x2b,0x41,0x52,0x07,0xed,0x18,0xc4,0xff,0x00,0x8f,0xb8,0x94,0xa9,
+		0xa8,0xa6,0x0f,0x5f,0x13,0xed,0x11,0x92,0x42,0x01,0x14,0xc4,0x01,0x12,0x5d,0x0a,
+		0x01,0x10,0x43,0x52,0x09,0x01,0x12,0xd0,0x01,0x12,0xfd,0x03,0x05,0x72,0x02,0x92,
+		0x23,0xec,0x02,0x2b,0xdd,0x18,0x0e,0x10,0xdc,0x94,0x13,0x00,0x50,0xb8,0x94,0xdd,
+		0x10,0x00,0x50,0xc4,0x94,0x0d,0x00,0x50,0xd0,0x94,0xff,0x0a,0x6f,0x11,0x92,0x41,
+		0x52,0xf5,0xec,0xff,0x42,0x52,0xf6,0xec,0x43,0x52,0xf7,0xec,0xff,0x00,0x8f,0xa2,
+		0x94,0x18,0xa8,0x09,0x6f,0xbe,0x08,0x51,0xe7,0xec,0x02,0x52,0xf8,0x09,0xf0,0xef,
+		0xef,0xec,0xf5,0x6f,0x05,0x0e,0xf0,0xbd,0x96,0x12,0x39,0x76,0x19,0xd1,0xdd,0x31,
+		0x22,0x00,0x06,0xe7,0x10,0xdf,0x10,0xfe,0x0d,0x50,0xff,0xfd,0x38,0x92,0x42,0x96,
+		0x39,0xaa,0x00,0x30,0x3a,0x00,0x30,0x3b,0x00,0x30,0x3c,0x00,0x30,0x3d,0xea,0x00,
+		0x30,0x3e,0x00,0x30,0x3f,0x32,0xd0,0xc0,0x01,0x42,0xbf,0x96,0x29,0x28,0xe8,0x00,
+		0x22,0x0e,0x30,0x21,0xfd,0x28,0xc2,0x70,0x2b,0x41,0x1b,0x00,0x04,0x07,0xdb,0x67,
+		0xff,0x2f,0x10,0x41,0x0a,0x00,0xb1,0xfb,0x68,0x3e,0x02,0x51,0x1a,0x2b,0x1b,0x2b,
+		0x1c,0x4e,0xd0,0x00,0x30,0xd5,0x10,0x00,0x30,0x08,0x00,0x30,0x04,0x00,0x30,0x01,
+		0x1c,0xea,0xbb,0xf0,0x1c,0x2c,0x90,0x1c,0x6f,0x90,0x1e,0x28,0xfc,0xc7,0x00,0x1f,
+		0x2b,0xce,0xb1,0x1c,0x11,0x79,0x31,0x06,0x00,0xff,0x00,0x52,0xa4,0xc5,0x07,0xec,
+		0xff,0x9c,0xff,0xa9,0x88,0x85,0x92,0x87,0x96,0x0e,0x00,0xe1,0xfe,0xd0,0x70,0x01,
+		0x3f,0x01,0x3f,0x01,0x31,0x5a,0xff,0xa4,0xdf,0xc5,0xa4,0x8e,0xab,0x92,0x01,0x7b,
+		0xab,0x92,0xff,0xa9,0x88,0xa9,0xa9,0xa6,0x0f,0x0f,0xec,0xff,0xaa,0x93,0x0d,0xec,
+		0xff,0x9d,0xa8,0x5c,0xcf,0xbf,0x76,0xfe,0xff,0x01,0xd5,0x00,0x71,0x0c,0x00,0xef,
+		0xf8,0xff,0xa0,0x8a,0x05,0x30,0x02,0x01,0xd5,0xff,0x01,0x19,0xa6,0x1e,0x81,0xdc,
+		0xa9,0xa8,0xff,0xa5,0x0d,0xa9,0x8a,0x01,0xde,0xc4,0x92,0xff,0xfb,0xed,0xa6,0x06,
+		0x06,0x00,0xa6,0x97,0xff,0x00,0x9b,0x0f,0xf6,0xa6,0x1f,0x20,0x76,0xfe,0x00,0x95,
+		0xa8,0x92,0x20,0x76,0xf1,0x00,0x3f,0xff,0x00,0x3d,0x8e,0xff,0xff,0xc0,0x92,0x00,
+		0x4e,0x00,0x00,0xfe,0xff,0xc2,0x00,0x72,0x00,0x91,0xc4,0x00,0x96,0x5d,0xa6,0x00,
+		0x90,0x90,0x80,0x3f,0x00,0x90,0xa8,0x00,0x94,0xdf,0xff,0xff,0x40,0x93,0x00,0xf2,
+		0x20,0xff,0xff,0x55,0x41,0x00,0x70,0x00,0x00,0x70,0x42,0x00,0x74,0x43,0x00,0x74,
+		0x55,0x44,0x00,0x74,0x45,0x02,0x74,0x46,0x00,0xf4,0x47,0x00,0x74,0x55,0x48,0x00,
+		0x74,0x49,0x00,0x74,0x4a,0x02,0x74,0x4b,0x00,0xf4,0x75,0x4c,0x00,0xf4,0x4d,0x00,
+		0xf2,0xfe,0xff,0x4e,0x00,0x72,0xea,0x00,0x91,0x50,0x00,0x96,0x52,0x00,0x94,0xff,
+		0xff,0x92,0xaa,0x03,0x54,0x93,0x00,0x74,0x94,0x00,0x74,0x95,0x04,0x54,0x96,0xaa,
+		0x00,0xf4,0x97,0x00,0x74,0x98,0x00,0x74,0x99,0x00,0x74,0x9a,0xaa,0x00,0x74,0x9b,
+		0x06,0xd4,0x9c,0x06,0x36,0x9e,0x00,0x96,0xa0,0x96,0x06,0xd6,0x00,0x90,0x00,0x73,
+		0x01,0x00,0x70,0x05,0xd1,0x02,0xaa,0x00,0xf4,0x04,0x00,0x74,0x05,0x01,0x74,0x06,
+		0x00,0xf4,0x07,0xaa,0x00,0x74,0x09,0x00,0x74,0x0a,0x00,0x74,0x0b,0x00,0x74,0x0c,
+		0xaa,0x00,0x74,0x0d,0x00,0x74,0x0e,0x00,0x74,0x0f,0x00,0x74,0x10,0xaa,0x00,0x74,
+		0x11,0x00,0x74,0x12,0x00,0x74,0x13,0x00,0x74,0x14,0xba,0x00,0x74,0x15,0x00,0x72,
+		0xfe,0xff,0x18,0x00,0x70,0xa2,0x65,0x94,0x00,0x91,0x1a,0x01,0x12,0x00,0x01,0x50,
+		0x01,0x01,0x30,0x1f,0x93,0x35,0x86,0x3f,0x00,0x00,0x3f,0x00,0x3f,0x00,0x39,0x5f,
+		0x18,0x81,0x3f,0x00,0x1d,0x00,0x30,0x22,0x00,0x30,0x55,0x27,0x00,0x30,0x2c,0x00,
+		0x30,0x31,0x00,0x30,0x36,0x00,0x30,0x55,0x3b,0x00,0x30,0x40,0x00,0x30,0x45,0x00,
+		0x30,0x4a,0x00,0x30,0x55,0x4f,0x00,0x30,0x54,0x00,0x30,0x59,0x00,0x30,0x5e,0x00,
+		0x30,0x55,0x63,0x00,0x30,0x68,0x00,0x30,0x6d,0x00,0x30,0x72,0x00,0x30,0x55,0x77,
+		0x00,0x30,0x80,0x00,0x30,0x3a,0x05,0x70,0x89,0x00,0x70,0xf5,0xa1,0x00,0x30,0xb9,
+		0x00,0x30,0x0c,0x83,0x3f,0x00,0x55,0x15,0x00,0x30,0x1e,0x00,0x30,0x27,0x00,0x30,
+		0x30,0x00,0x30,0x7d,0x39,0x00,0x30,0xb3,0x84,0x3f,0x00,0xbc,0x00,0x30,0xa9,0xc5,
+		0x00,0x30,0x03,0x31,0xce,0x00,0x70,0xd7,0x00,0x30,0xe0,0xaa,0x00,0x30,0xe9,0x00,
+		0x30,0xf2,0x00,0x30,0xfb,0x00,0x30,0x04,0x55,0x85,0x01,0xf3,0x0d,0x00,0x70,0x16,
+		0x00,0x30,0x1f,0x00,0x30,0xa5,0x28,0x00,0x30,0x31,0x01,0x71,0x00,0x30,0x43,0x01,
+		0xf4,0x4c,0xaa,0x00,0x70,0x55,0x00,0x30,0x5e,0x00,0x30,0x67,0x00,0x30,0x70,0xaa,
+		0x00,0x30,0x79,0x00,0x30,0x82,0x01,0xf4,0x8b,0x00,0x70,0x94,0x14,0x00,0xb4,0x00,
+		0x31,0x9d,0x00,0xb0,0xa6,0x00,0xf8,0x00,0x3f,0x00,0x3f,0x54,0x00,0x3f,0x00,0x37,
+		0xaf,0x04,0xb0,0xdc,0x00,0x30,0xe9,0x0a,0x71,0x0a,0x00,0xf0,0x23,0x00,0x30,0x2c,
+		0x02,0x7f,0x00,0x3f,0x00,0x3f,0x00,0x3f,0xfc,0x00,0x3f,0x00,0x3e,0x47,0x00,0x52,
+		0x00,0x49,0x00,0x7f,0x50,0x00,0x5f,0x00,0x31,0x00,0x2e,0x00,0x32,0x5d,0x30,0x21,
+		0xd2,0x4f,0x00,0x53,0x01,0x38,0x31,0x01,0x32,0x48,0x02,0xbf,0x01,0x7f,0x01,0x73,
+		0x32,0x01,0x7f,0x00,0x32,0x33,0x01,0x7c,0xa9,0x30,0x06,0xf2,0x07,0x35,0x64,0x00,
+		0x30,0x02,0x00,0x30,0x03,0xd2,0x32,0xb0,0x01,0x00,0x50,0x00,0xd1,0x02,0x48,0xd0,
+		0x00,0x80,0x3f,0x7f,0x00,0x01,0x81,0x00,0x00,
+	};
+
+	//test_firmware.bin, 7324 bytes packed to 4284
+	static const uint8_t IMAGE_DATA_1[] = {
+		0xf7,0xaa,0x08,0x00,0x00,0x0c,0x3f,0x00,0x02,0x80,0xfb,0x8a,0x0c,0x00,0x51,0xad,
+		0x28,0x00,0x04,0x69,0xff,0xff,0x1f,0x56,0x16,0x56,0x1a,0x56,0x40,0xff,0x29,0x1f,
+		0x76,0x00,0x00,0x02,0x29,0x1b,0xff,0x76,0x22,0x76,0xa9,0x28,0x8c,0x8c,0xa8,0xff,
+		0x28,0x3f,0x00,0x01,0x09,0x1b,0x61,0xff,0xff,0x76,0x8c,0x8c,0x04,0x29,0x0f,0x6f,
+		0x00,0xff,0x9b,0xa9,0x24,0x01,0xdf,0x04,0x6c,0x04,0xfb,0x29,0xa8,0x00,0x70,0xa6,
+		0x1e,0xa1,0xf7,0x86,0xff,0x24,0xa7,0x06,0xa1,0x81,0x01,0x09,0xa7,0xff,0x1e,0xa9,
+		0x24,0x03,0x63,0x5c,0xff,0x04,0xff,0x3b,0xa9,0x59,0x01,0xdf,0x09,0x00,0xec,0xbb,
+		0xff,0x1a,0x04,0x10,0xff,0xff,0xa8,0x00,0x30,0x01,0xfb,0x09,0x0e,0x04,0x10,0xff,
+		0xff,0x06,0x6f,0x01,0xff,0xdf,0xbd,0xc3,0xa7,0x1e,0x67,0x3e,0xbe,0xfd,0xc5,0x04,
+		0x71,0xa8,0x24,0x58,0xff,0xf7,0x60,0xff,0x7f,0x76,0x99,0x80,0x7f,0x76,0x46,0x80,
+		0xff,0xbd,0xb2,0x1f,0x76,0x02,0x00,0xbd,0xaa,0xef,0x34,0xc5,0x67,0x3e,0x08,0x51,
+		0x00,0x59,0xa1,0xff,0x92,0x10,0xec,0x01,0x3b,0x00,0x8f,0x40,0xff,0x00,0x03,0x56,
+		0xa1,0x01,0x01,0x56,0xa4,0xbf,0x00,0xa4,0x86,0x82,0xda,0xc2,0x01,0xf0,0xa1,0x7f,
+		0x92,0xff,0x9c,0xa9,0x59,0xfa,0xed,0x0a,0xd2,0xa7,0x06,0x03,0xec,0x05,0x31,0x00,
+		0xb1,0x04,0x00,0xb4,0x00,0xf7,0x77,0x00,0x6f,0x04,0xd2,0xb2,0x34,0xc5,0xa4,0x7d,
+		0x8b,0x04,0xf4,0x92,0x20,0x52,0x07,0x64,0x01,0x51,0xbd,0x32,0x04,0x10,0x01,0x9a,
+		0x0f,0x6f,0x05,0xb5,0x00,0xde,0x05,0xb2,0xc4,0xb2,0x00,0x0a,0x01,0xd5,0x00,0x9a,
+		0xff,0xbe,0x8b,0x06,0x00,0x00,0x6f,0x06,0x00,0xd6,0x01,0x11,0x34,0xa8,0x00,0x73,
+		0x32,0x00,0x70,0x3f,0x8f,0xf7,0xff,0xff,0x7f,0x00,0x30,0xa9,0xa8,0xa5,0x0f,0xff,
+		0x04,0xed,0x00,0xd4,0x00,0xbe,0x07,0x6f,0xfe,0x01,0x31,0xc4,0x88,0x02,0x02,0xa4,
+		0x07,0xa9,0xff,0x8a,0xa6,0x92,0x7f,0x76,0x65,0x86,0x06,0xff,0x00,0x02,0xfe,0x41,
+		0x2b,0x41,0x92,0x06,0x57,0x52,0x14,0x63,0x06,0x51,0xa6,0x06,0x50,0x41,0x06,0x52,
+		0xff,0x00,0x02,0xc4,0x1e,0x41,0x85,0x00,0x8f,0xbb,0xa0,0x00,0x07,0x32,0x2b,0x41,
+		0x0a,0x02,0x51,0xee,0xfe,0x09,0x70,0xc4,0x01,0x00,0x1a,0x00,0x40,0x14,0xff,0xf6,
+		0x00,0x77,0x18,0x28,0xc2,0x00,0x69,0xff,0xff,0xa9,0x28,0xb0,0x36,0x7f,0x76,0x37,
+		0xfd,0x85,0x01,0x91,0x18,0x1a,0x20,0x00,0x28,0x9a,0xfe,0x00,0xd5,0x02,0x28,0x05,
+		0x00,0x03,0x18,0xf0,0xff,0xff,0x03,0xcc,0x0f,0xff,0x10,0x50,0x03,0xff,0x96,0x03,
+		0xcc,0xff,0xf0,0xa9,0x1a,0x00,0xf5,0x02,0x00,0x92,0x0f,0x00,0x90,0x30,0x03,0x96,
+		0x04,0xbf,0xcc,0xf0,0xff,0x04,0x50,0x04,0x00,0x70,0x0f,0xfb,0xff,0x50,0x00,0x70,
+		0x00,0x28,0x90,0x0f,0x01,0xff,0x28,0x00,0x88,0x1f,0x76,0x33,0x00,0x22,0xfe,0x04,
+		0xd0,0x23,0x76,0x01,0x00,0x82,0xfe,0x06,0xff,0x00,0x22,0x76,0xc0,0xb9,0x29,0x28,
+		0x68,0xef,0x00,0x1a,0x76,0x7f,0x20,0xb0,0x1b,0x76,0x42,0x7f,0x29,0x16,0x56,0x25,
+		0x76,0x00,0x6f,0x00,0x9f,0x00,0x00,0x9f,0x00,0x9f,0x00,0x9f,0x00,0x9f,0x00,0x9f,
+		0x00,0x9f,0x00,0x9f,0x00,0x9f,0x78,0x00,0x9f,0x00,0x93,0x0e,0x11,0x21,0x28,0x01,
+		0x00,0x01,0x1f,0xfe,0x01,0x13,0x05,0x00,0xbd,0xa8,0xbd,0xa0,0xbd,0x7f,0xc2,0xbd,
+		0xc3,0xbd,0xab,0x69,0xff,0x01,0xf9,0xff,0x7f,0x76,0x06,0x87,0xbe,0x87,0xbe,0xc5,
+		0xff,0xbe,0xc4,0xbe,0x83,0xbe,0x8a,0x03,0x00,0x0f,0x17,0x76,0x02,0x76,0x02,0xff,
+		0x02,0xff,0x02,0xff,0x02,0xf5,0xfb,0x04,0xfe,0x03,0x1b,0x1f,0x76,0xd4,0x01,0x04,
+		0xd7,0x18,0xbf,0xff,0x1c,0x51,0x01,0x1e,0xd0,0x19,0x1a,0xdf,0x10,0x00,0x08,0x92,
+		0xc3,0x00,0xf0,0x02,0x00,0xab,0x20,0x96,0x01,0x51,0x09,0x00,0xd4,0x21,0x00,0xd2,
+		0x0a,0xaa,0x00,0xd4,0x22,0x00,0xd2,0x0b,0x00,0xd4,0x23,0x00,0xd2,0x0c,0xda,0x00,
+		0xd4,0x24,0x00,0xd2,0x0d,0x92,0x00,0xb1,0xc3,0xff,0xfd,0x25,0x00,0xd0,0x02,0x00,
+		0x0a,0x92,0x26,0xec,0xde,0x00,0x71,0x14,0x28,0xd0,0x07,0x00,0x71,0x0b,0x2b,0xfc,
+		0x01,0x52,0x00,0x50,0x03,0x00,0x04,0x92,0x23,0xec,0x5f,0x04,0x2b,0x43,0x2b,0x43,
+		0x27,0x70,0x0f,0x29,0xd6,0xfd,0x43,0x29,0xd2,0x40,0x8f,0x00,0x08,0xc4,0xa0,0xeb,
+		0x43,0x0a,0x01,0xb1,0xf3,0x32,0xb2,0x1e,0x2b,0x0c,0x7e,0x34,0x92,0x14,0x0b,0x08,
+		0xed,0x01,0x9a,0x04,0xb2,0x78,0x06,0x10,0x04,0x50,0x06,0x72,0x1f,0x92,0x3a,0xec,
+		0x04,0x93,0xee,0x2e,0x77,0x43,0x01,0x40,0x2d,0xd4,0x43,0x85,0x01,0x6f,0x56,0xa5,
+		0x00,0xc5,0x00,0x50,0xc4,0x00,0x05,0x33,0xfc,0x2e,0x71,0x05,0x30,0x0a,0x1e,0x92,
+		0x80,0x52,0x23,0xf5,0x64,0x03,0x93,0x15,0x08,0x3c,0xc4,0xc4,0xac,0x28,0xff,0x19,
+		0x00,0xa6,0x06,0x45,0xff,0x22,0x56,0xbf,0xa6,0x07,0x46,0xff,0xc4,0x1e,0x03,0xb3,
+		0xed,0xfe,0x03,0xb2,0x1f,0x2b,0x07,0x6f,0x7f,0x76,0x61,0xef,0x87,0x7f,0x76,0xca,
+		0x00,0x30,0x33,0x88,0x84,0x21,0xfe,0x18,0x1f,0x1f,0x3f,0x01,0x1f,0x01,0x17,0x02,
+		0x01,0x1f,0x01,0x1f,0x7c,0x23,0xbf,0x20,0xb6,0xd0,0x01,0x2f,0x28,0x80,0x1d,0x90,
+		0x7c,0x02,0x73,0x1e,0x11,0x01,0x2b,0x04,0x1a,0x40,0x00,0x90,0xf7,0xd0,0x01,0x05,
+		0x19,0x52,0x16,0x54,0x14,0x63,0xee,0x00,0x71,0x05,0x2b,0x00,0x3c,0x30,0x9c,0x88,
+		0x00,0xeb,0x52,0x67,0x19,0xd2,0x0f,0x19,0x52,0x08,0x18,0xfe,0xce,0x1c,0x72,0x01,
+		0x2b,0x5c,0x16,0x90,0x03,0x37,0x55,0x65,0xc8,0x03,0x32,0x0b,0x10,0x03,0x55,0x4c,
+		0x03,0x53,0x4a,0x52,0x08,0x40,0xff,0x1e,0xee,0x1f,0x76,0xc3,0x01,0x24,0xcc,0x75,
+		0x10,0x1f,0x50,0x3f,0x01,0x92,0x01,0x92,0x3b,0x51,0x10,0xfe,0x02,0x10,0x92,0x32,
+		0x52,0x03,0x63,0x0f,0x2b,0xe5,0x34,0x1b,0x92,0x01,0x27,0x72,0x06,0xd6,0x1a,0x01,
+		0x00,0x69,0x28,0x01,0x70,0x03,0x95,0x1c,0x03,0x94,0x07,0xed,0x02,0x77,0x39,0x18,
+		0x03,0x72,0x04,0x51,0x13,0x64,0x32,0x1f,0x30,0x09,0x30,0x2a,0x1e,0xd2,0x16,0x00,
+		0x52,0x02,0x0a,0xf0,0x07,0x02,0x13,0x05,0x12,0x51,0x01,0x00,0x50,0x0b,0x56,0x02,
+		0x10,0xd4,0x00,0xb4,0x17,0x0f,0x54,0x57,0x07,0x2b,0x01,0x0b,0xf4,0x66,0x06,0xb2,
+		0x0e,0x0f,0x54,0x9d,0xfd,0x0f,0x52,0x00,0x2b,0x5b,0x04,0xb0,0x03,0x37,0x54,0xad,
+		0x65,0x26,0x53,0x07,0x96,0x0f,0x39,0x0e,0x0f,0x33,0x41,0xae,0x0f,0x35,0x04,0x00,
+		0xc1,0x0f,0x34,0x00,0x0f,0x34,0x0e,0xca,0x0f,0x32,0x0e,0x0f,0x34,0x00,0x0c,0xb4,
+		0x06,0xb4,0x1a,0x02,0x08,0x0f,0x36,0x03,0x91,0x0f,0x33,0x00,0x0f,0x30,0x02,0x77,
+		0x0f,0x33,0x04,0x51,0x28,0x0f,0x33,0x09,0x10,0x0e,0xd2,0x17,0x0f,0x34,0xfd,0x0f,
+		0x34,0x05,0x13,0x09,0x00,0x00,0x50,0x0b,0x36,0x96,0x28,0x1f,0x23,0x9f,0x01,0x1f,
+		0x01,0x1f,0x02,0x01,0x17,0x04,0x01,0x1f,0x01,0x1f,0x01,0x1f,0x01,0x1f,0x01,0x1f,
+		0x01,0x1f,0x02,0x01,0x1e,0x08,0x01,0x1f,0x01,0x1f,0x01,0x1f,0x01,0x1f,0x01,0x1f,
+		0x01,0x1f,0x02,0x01,0x1e,0x10,0x01,0x1f,0x01,0x1f,0x01,0x1f,0x01,0x1f,0x01,0x1f,
+		0x01,0x1f,0x82,0x01,0x1e,0x20,0x01,0x1f,0x01,0x1f,0x01,0x1f,0x41,0xff,0x62,0xba,
+		0x00,0xff,0x01,0x1f,0x76,0xc1,0x01,0x15,0xcc,0x80,0xff,0x00,0xc6,0xff,0x0a,0xec,
+		0x11,0x18,0xdf,0xfb,0xff,0x11,0x78,0x30,0x1b,0x18,0xff,0xdf,0x1b,0x6f,0x1a,0x00,
+		0x20,0x03,0x4d,0x10,0x02,0x89,0x02,0x11,0xc6,0x00,0xd0,0x40,0x1b,0x43,0xb0,0x25,
+		0x1f,0x04,0xb3,0xc1,0x01,0x21,0x1a,0x45,0x92,0x05,0x33,0x66,0xff,0x07,0x3d,0xdd,
+		0x07,0x3f,0x07,0x38,0x23,0x5b,0x8b,0x02,0x11,0x07,0x3f,0x07,0x3b,0xdd,0x07,0x3f,
+		0x0f,0x98,0xe3,0x00,0x01,0x10,0xbd,0x01,0x19,0x00,0x9b,0x00,0x9b,0x8f,0xfe,0x8d,
+		0xd0,0x01,0x19,0xc2,0x56,0xfd,0xff,0x06,0x9d,0x00,0x3e,0x71,0xd0,0x01,0x09,0x43,
+		0x12,0x00,0x51,0xd0,0xff,0x01,0x2c,0x2b,0x2d,0x2b,0x2e,0x2b,0x2f,0x0a,0xa3,0x10,
+		0x30,0x00,0x30,0x31,0x00,0x30,0x01,0xb1,0x01,0x5f,0x02,0xb1,0xfa,0x38,0x13,0x00,
+		0x0e,0x52,0xd0,0x01,0x04,0x2b,0x01,0xff,0x2b,0x03,0x28,0xc8,0x19,0x15,0x2b,0x15,
+		0xfa,0x0e,0x30,0x15,0x0a,0xf0,0x15,0x1a,0x80,0x00,0x15,0xfe,0x91,0x73,0x08,0x15,
+		0x96,0x15,0xcc,0xe3,0xff,0xff,0x08,0x50,0x15,0x96,0x17,0x2b,0x18,0x2b,0xf9,0x19,
+		0x03,0x92,0x00,0x95,0xd0,0x01,0x13,0x28,0xaa,0xff,0x0a,0x11,0x28,0xe0,0x82,0x04,
+		0x28,0x42,0x53,0xd0,0x2c,0x03,0x50,0x0c,0x51,0x24,0x29,0x70,0x23,0x66,0xd1,0xbe,
+		0x01,0xf0,0x08,0x2b,0x05,0x2b,0x07,0x07,0x50,0x08,0xe7,0x28,0x70,0xd8,0x7b,0xf2,
+		0x06,0xb2,0x78,0x0f,0x04,0xf7,0x28,0x00,0xd0,0x01,0xbb,0xd0,0x01,0x20,0x2b,0xcf,
+		0x20,0x28,0x00,0x80,0x95,0x51,0x46,0xd1,0x02,0x2b,0xff,0x01,0x28,0xff,0x7c,0x00,
+		0x18,0xff,0x7f,0xaa,0x00,0x30,0xbf,0x00,0x30,0xdf,0x00,0x30,0xef,0x00,0x30,0xf7,
+		0xea,0x00,0x30,0xfb,0x9e,0xd0,0x02,0x00,0x30,0x01,0x00,0x18,0x57,0x7f,0xff,0x00,
+		0x81,0x30,0x00,0x0b,0x90,0x00,0x80,0xf0,0x1b,0x00,0x1a,0xba,0xc0,0x1a,0x04,0x00,
+		0x30,0x46,0x70,0x5a,0xd0,0x5e,0x04,0x91,0x21,0x1a,0x00,0x04,0x00,0x30,0x08,0x00,
+		0x30,0xad,0x10,0x00,0x30,0x20,0x21,0x02,0xf0,0x21,0x03,0x70,0x21,0x14,0x05,0x70,
+		0x01,0xf1,0x06,0x08,0x70,0x05,0x03,0xf0,0x4e,0x32,0x1e,0x90,0x02,0x00,0x71,0x05,
+		0x1b,0x52,0x00,0xf1,0x86,0xf1,0x00,0xf1,0x0d,0xb1,0x00,0xf1,0xa5,0x7f,0x00,0xf2,
+		0x04,0x09,0x70,0x00,0x30,0xbf,0x00,0x30,0xdf,0x6a,0x00,0x30,0xef,0x00,0x30,0xf7,
+		0x00,0x30,0xfb,0x04,0x09,0x70,0xac,0x00,0x30,0x01,0xf0,0x7f,0xff,0x8a,0xb1,0x04,
+		0x04,0xf0,0x04,0xab,0x18,0xef,0x00,0x30,0xf7,0x00,0x30,0xfb,0x00,0x30,0xfd,0xfe,
+		0x00,0x30,0xfe,0xff,0x0e,0x2b,0x0d,0x2b,0x0c,0xaa,0x01,0xf0,0x0c,0x01,0xf0,0x0c,
+		0x01,0x30,0x0c,0x01,0x30,0x12,0xaf,0x2b,0x11,0x2b,0x10,0x02,0x30,0x10,0x00,0xf0,
+		0x10,0x4e,0x00,0xf0,0x15,0x2b,0x14,0x06,0x10,0x00,0x30,0xdf,0x00,0x30,0x55,0xef,
+		0x00,0x30,0xf7,0x00,0x30,0xfb,0x00,0x30,0xfd,0x00,0x30,0xab,0xfe,0x14,0x06,0x10,
+		0x14,0x04,0x10,0x14,0x0b,0x90,0x14,0xaa,0x0f,0x90,0x14,0x0f,0x90,0x14,0x0f,0x90,
+		0x14,0x0f,0x90,0x14,0x68,0x0f,0x90,0x1c,0x31,0x0a,0x91,0x34,0x0b,0x14,0x19,0x2b,
+		0xb0,0x71,0xa5,0x18,0x08,0xb0,0x19,0x00,0x30,0x01,0x11,0x38,0x03,0x50,0x1a,0xfb,
+		0x76,0x69,0x24,0xd0,0x7f,0x76,0xf9,0x8b,0x7f,0xf7,0x76,0xac,0x85,0x00,0x30,0x88,
+		0x7f,0x8f,0x0c,0xff,0x8d,0x3f,0x8f,0x2b,0x8d,0xa9,0xa0,0x41,0xbe,0x84,0xf0,0xa9,
+		0xa8,0x00,0x8f,0x00,0xc6,0x10,0x61,0x57,0x8c,0x40,0x76,0x00,0x71,0x3e,0x02,0x30,
+		0xad,0x00,0x70,0xdf,0xdc,0x88,0x7f,0x76,0x3f,0x03,0x30,0xe9,0x86,0xff,0xa9,0x20,
+		0x7f,0x76,0xf6,0x8b,0x30,0x29,0xdf,0x69,0xff,0x7f,0x76,0x2f,0x01,0x10,0xe7,0x8b,
+		0xf3,0xfb,0x6f,0xbb,0xf1,0x06,0x11,0x30,0x40,0x08,0xef,0x2a,0x37,0x71,0x30,0x0d,
+		0x50,0x41,0x09,0x30,0x05,0x60,0x50,0x00,0xd0,0xfc,0x0a,0x50,0x01,0xd2,0xcc,0x02,
+		0x00,0xc0,0xff,0x08,0x8e,0x64,0xf0,0xc1,0x01,0x31,0x02,0x12,0x7b,0x10,0x02,0x12,
+		0x31,0xa6,0x02,0x10,0x41,0x92,0xb6,0x11,0x04,0x90,0x96,0x8e,0x11,0xaa,0xeb,0x03,
+		0x41,0x90,0x90,0xa4,0x66,0xf2,0xc4,0x92,0x13,0xed,0x96,0xc0,0x51,0xa6,0x03,0x8f,
+		0x12,0x92,0x04,0x96,0x80,0x02,0x91,0x79,0x57,0x75,0x72,0x31,0x30,0x6b,0x15,0x67,
+		0x32,0x00,0xf4,0x08,0xfb,0x00,0xc2,0x00,0xf2,0x03,0x96,0x0f,0x2b,0x0e,0xff,0x2b,
+		0x09,0x2b,0x02,0x28,0x07,0x00,0x08,0x9e,0x76,0x30,0x0d,0x96,0x0c,0x96,0xca,0x73,
+		0x9f,0x51,0x0b,0xff,0x2b,0x0a,0x2b,0x7f,0x76,0x8d,0x86,0x7f,0x77,0x76,0xb2,0x86,
+		0x0b,0x13,0x01,0x00,0x31,0x24,0xd2,0x8a,0xbf,0xf1,0x08,0x00,0x30,0x10,0x02,0xb2,
+		0x03,0xd1,0x1c,0x70,0x2b,0xf4,0x0a,0x71,0x02,0xf1,0x41,0x6e,0xf2,0x13,0x92,0x41,
+		0x54,0x5f,0x3e,0xed,0x15,0x0a,0x06,0x71,0xf0,0x02,0x7b,0xd4,0x7d,0x46,0x73,0x52,
+		0x09,0x0a,0x08,0x42,0x16,0x78,0x54,0xfa,0x08,0x91,0x3b,0x01,0x52,0x03,0x92,0x37,
+		0xed,0x09,0xbe,0x78,0x12,0x09,0x2b,0x32,0x6f,0x03,0x03,0x50,0x09,0x4b,0x2b,0x08,
+		0x10,0x10,0x2c,0x77,0x54,0x02,0x91,0x11,0x02,0x94,0xdb,0x05,0xed,0x01,0xf3,0x1e,
+		0x6f,0x03,0x11,0x1b,0x64,0x77,0x15,0x28,0x32,0x75,0xf0,0xfb,0xff,0x16,0x75,0xf2,
+		0x7f,0x09,0x2b,0x03,0x2b,0x11,0x6f,0x04,0x07,0xf0,0xbf,0x0e,0xed,0x15,0x0b,0x06,
+		0x2b,0x07,0xd5,0x07,0x16,0x07,0xd3,0x2b,0x08,0x02,0x90,0x03,0xd5,0x90,0x0d,0x71,
+		0x13,0x31,0xc3,0x06,0xfe,0xa9,0x32,0x7c,0xb0,0x18,0xf3,0x12,0xd1,0x05,0xed,0xff,
+		0x00,0x02,0x46,0x1e,0x44,0x1e,0x54,0x6f,0x7f,0x20,0xcc,0x00,0x04,0xc9,0xff,0x0d,
+		0xe4,0x50,0xbc,0xb5,0x32,0xd3,0xd0,0x02,0x00,0x12,0x81,0x00,0x51,0x28,0x8f,0x03,
+		0x42,0x1e,0x0c,0xe0,0x10,0x01,0x12,0x01,0x72,0x20,0xfd,0xae,0x00,0x51,0x26,0x07,
+		0x42,0x1e,0x42,0x06,0xee,0x17,0xf2,0x56,0x18,0x00,0x23,0x90,0xfa,0xa9,0xa8,0xff,
+		0x18,0x0f,0x03,0x63,0x18,0xa8,0x0a,0x6f,0xff,0x29,0xff,0x83,0xff,0x18,0x0f,0x06,
+		0x65,0xfd,0xaa,0x3f,0x10,0xab,0x28,0x00,0x06,0x18,0xa9,0xff,0x18,0x06,0x30,0xff,
+		0x46,0x1e,0x6c,0xff,0xff,0x42,0x06,0x46,0xa3,0x31,0xff,0xac,0x10,0x1f,0x44,0x1e,
+		0x44,0x06,0x06,0x8f,0x50,0x3b,0x13,0x20,0x91,0xf7,0xc3,0x01,0x22,0x00,0x90,0x44,
+		0x85,0x56,0xff,0xfb,0xa9,0x85,0x01,0xd1,0x04,0x63,0x00,0x02,0x44,0xff,0x1e,0x07,
+		0x6f,0x00,0x8f,0x78,0x0f,0xa9,0xff,0xa8,0x44,0x0f,0x02,0x63,0x44,0xa8,0x44,0x3e,
+		0x84,0x70,0xd0,0x01,0x17,0x96,0x86,0xc2,0xd0,0x0d,0x1f,0x56,0x0d,0x1e,0x08,0xca,
+		0x0d,0x16,0x23,0x0b,0x92,0x10,0x0d,0x12,0x55,0x2c,0x0d,0x18,0x10,0x01,0x72,0x22,
+		0x0d,0x12,0x2a,0x0d,0x18,0x55,0x1a,0x0d,0x14,0x1a,0x0d,0x10,0x1a,0x0d,0x14,0x1a,
+		0x0d,0x18,0xa7,0x1a,0xa9,0x1a,0x0d,0x1f,0x0d,0x17,0x08,0x0d,0x16,0x08,0xc4,0x0d,
+		0x1f,0x0d,0x1f,0x18,0x0d,0x1f,0x0d,0x1f,0x0d,0x11,0x10,0xcb,0xaa,0x0d,0x16,0x25,
+		0x0b,0x92,0x11,0x0d,0x12,0x30,0x0d,0x18,0x11,0xaa,0x01,0x72,0x24,0x0d,0x12,0x2e,
+		0x0d,0x18,0x1c,0x0d,0x14,0x1c,0xea,0x0d,0x10,0x1c,0x0d,0x14,0x1c,0x0d,0x18,0x1c,
+		0xa9,0x1c,0x94,0x0d,0x1f,0x0d,0x17,0x10,0x0d,0x16,0x10,0x0d,0x1f,0x0d,0x1f,0x19,
+		0xf8,0x0d,0x14,0x3d,0x31,0x07,0xf1,0x0d,0x92,0x08,0xec,0x41,0xff,0x2d,0x01,0x9a,
+		0x66,0xff,0x02,0xce,0x03,0x7f,0xec,0x01,0x9a,0x02,0x6f,0x00,0x9a,0x29,0x51,0x5d,
+		0x30,0x0b,0x30,0x33,0x00,0x20,0x50,0x10,0x22,0x49,0xd0,0xef,0x40,0x8f,0xa6,0x02,
+		0x0a,0x50,0x0d,0x28,0xff,0xce,0xe3,0x31,0x61,0x8c,0x1a,0x61,0xd0,0x38,0x50,0x2b,
+		0x24,0xff,0x2b,0x26,0x2b,0x28,0x2b,0x2a,0x2b,0x2c,0xfe,0x6d,0xf0,0x30,0x2b,0x32,
+		0x2b,0x34,0x2b,0x36,0xff,0x2b,0x38,0x2b,0x23,0x2b,0x25,0x2b,0x27,0xef,0x2b,0x29,
+		0x2b,0x2b,0x6f,0x70,0x2f,0x2b,0x31,0xff,0x2b,0x33,0x2b,0x35,0x2b,0x37,0x2b,0x39,
+		0x8b,0x2b,0x21,0x0d,0x10,0x20,0x3c,0x10,0x07,0xf1,0x3d,0x11,0x10,0xce,0x3b,0x90,
+		0x11,0x28,0x43,0x52,0x92,0x53,0x11,0x12,0x2b,0xff,0x13,0x28,0x0a,0x00,0x1a,0x28,
+		0x50,0xc0,0xbf,0x1b,0x28,0x70,0x40,0x1c,0x2b,0x7e,0xd1,0x1a,0xa8,0x62,0xb0,0x7e,
+		0xd1,0x06,0xf1,0x32,0x02,0x70,0x32,0x02,0x70,0x23,0x15,0x76,0x73,0x31,0x03,0xc8,
+		0xd0,0x04,0x38,0x70,0x0c,0xb1,0x87,0x92,0xbf,0xcc,0x00,0x1f,0xc7,0xff,0x42,0x4a,
+		0x90,0x41,0xb7,0x2b,0x09,0x6f,0x49,0xb1,0x40,0x02,0x49,0xb1,0x17,0xbf,0xc6,0xc4,
+		0x96,0x41,0x0a,0x42,0x38,0xf0,0xf6,0xf1,0x62,0x03,0x52,0x03,0x30,0x0e,0x11,0xbd,
+		0xb2,0x04,0xfe,0xf5,0x41,0xb3,0xd2,0x09,0xb4,0x90,0x3c,0x52,0xc0,0x56,0xd5,0xad,
+		0xc3,0x10,0x3e,0x00,0x70,0xa9,0x7d,0x90,0x44,0x96,0x77,0x0f,0x52,0x0d,0xdd,0x72,
+		0x40,0x02,0x44,0x4f,0x52,0xff,0x41,0x9a,0xc4,0x74,0x44,0x0a,0x44,0x92,0xff,0x0f,
+		0x52,0xf5,0x64,0x41,0x92,0x01,0x9c,0xf7,0xa9,0x58,0x40,0x01,0xb0,0x41,0x59,0x03,
+		0x56,0xff,0x95,0x04,0x41,0x93,0x02,0x9d,0xa8,0x58,0xfe,0x02,0xb1,0x9c,0xca,0xa9,
+		0x88,0x03,0x56,0x94,0xff,0x08,0xa9,0x93,0xa6,0xcb,0xa8,0x80,0x41,0xf3,0x93,0x03,
+		0x01,0x70,0x00,0xf0,0x0c,0xa7,0xca,0x42,0xff,0x96,0x41,0x08,0x04,0x00,0x42,0x92,
+		0x5c,0x7f,0xff,0xa9,0x93,0xde,0xff,0xa9,0x95,0x17,0xd1,0x4f,0xb0,0xff,0x12,0x97,
+		0x04,0xb3,0x04,0x52,0x59,0x04,0x73,0x08,0x04,0x3f,0x04,0x3f,0x04,0x39,0x11,0x04,
+		0x3f,0x04,0x3f,0x04,0x3f,0x04,0x3a,0xf9,0x10,0x04,0x34,0x0c,0xf3,0x9c,0xca,0x43,
+		0x96,0x43,0xee,0x63,0x72,0x02,0x00,0x0c,0x2f,0x50,0x7f,0x76,0xc7,0xfb,0x86,0x04,
+		0x4d,0xd2,0x0c,0x2b,0x43,0x41,0x06,0xe4,0x01,0x70,0x27,0xb1,0x40,0x62,0x92,0x27,
+		0xb1,0x40,0x00,0x43,0xef,0x42,0x04,0xef,0x21,0x6e,0xd0,0x03,0x6f,0x22,0xb6,0x00,
+		0x50,0x43,0x43,0x00,0xd1,0x00,0x40,0x00,0xd1,0x00,0xa5,0x40,0xee,0x10,0x8b,0x27,
+		0x12,0x4f,0x50,0x10,0xfb,0x14,0x40,0x7d,0x01,0x64,0xb5,0xc1,0x01,0xc4,0x92,0x19,
+		0x1a,0x10,0xf6,0x01,0xb1,0xf3,0x64,0x19,0x91,0x08,0xfe,0x46,0xa0,0xff,0x44,0xa8,
+		0x41,0x96,0x46,0x8a,0xc4,0x92,0xff,0x47,0x96,0x01,0x9b,0xa9,0x95,0x47,0x97,0xdf,
+		0x44,0x8a,0x01,0x3b,0xa9,0x18,0x73,0x92,0xc4,0xff,0x96,0x47,0x92,0x14,0x52,0x02,
+		0xed,0x47,0xb7,0x2b,0x47,0x92,0x02,0x30,0x96,0x88,0x54,0x52,0x42,0xdb,0xa8,0x42,
+		0x02,0xf0,0x43,0x96,0x00,0x51,0x44,0x96,0x77,0x46,0x2b,0x46,0x02,0x30,0x16,0x63,
+		0x42,0x03,0x70,0xfd,0x46,0x03,0x72,0xc4,0x92,0x45,0x96,0x43,0x92,0x5f,0x45,0x54,
+		0x03,0x65,0x45,0x02,0x50,0x44,0x00,0x91,0xeb,0x63,0x45,0x02,0x91,0x0a,0x02,0x91,
+		0xec,0x64,0x00,0xff,0x9a,0x44,0x93,0x43,0x9f,0x02,0x53,0x02,0xcf,0x62,0x01,0x9a,
+		0x86,0x08,0x52,0x21,0xd1,0x42,0x2b,0x5f,0x44,0x2b,0x45,0x2b,0x46,0x74,0x90,0x05,
+		0xd9,0x30,0xf5,0x3c,0x67,0x12,0x16,0x13,0xb0,0x43,0x96,0x41,0x58,0x6d,0x41,0xfd,
+		0x50,0x0f,0x90,0x0c,0xb2,0x9c,0x94,0x00,0xf4,0xaf,0xa3,0xff,0x0f,0x90,0x00,0xd7,
+		0xa7,0x00,0xda,0xab,0x84,0x00,0xd4,0x04,0x31,0x15,0x04,0x3a,0x03,0xff,0x03,0xff,
+		0x03,0xfb,0x17,0x50,0x03,0xff,0x03,0xff,0x03,0xff,0x03,0xf4,0x03,0x4c,0xb0,0x42,
+		0xe1,0x73,0x6f,0x40,0x03,0xee,0x42,0x74,0x90,0x02,0x41,0x00,0x71,0x6f,0x40,0x00,
+		0x02,0x42,0x00,0x71,0x20,0x00,0x03,0x11,0xdc,0x33,0x30,0x03,0xb4,0x94,0x28,0x41,
+		0x01,0x10,0x94,0x28,0xf5,0x3e,0x3f,0xd0,0xd5,0xbe,0x70,0x03,0x00,0x09,0x92,0xbb,
+		0x1f,0xec,0x17,0xf1,0x14,0x52,0x18,0x1c,0xf2,0x00,0x5b,0x01,0x47,0x16,0x53,0x2b,
+		0x47,0x37,0x90,0xd0,0x4d,0x70,0x6a,0x00,0xb5,0xe4,0x00,0xb5,0x0a,0x02,0xd1,0xea,
+		0x64,0x03,0xd2,0xff,0x2b,0x0f,0x92,0x3d,0xec,0x0a,0x92,0x0a,0xbf,0x0a,0x04,0x52,
+		0x39,0xed,0x0a,0xe9,0x12,0x40,0xdb,0x8f,0xcd,0x50,0x91,0x01,0x16,0x71,0x90,0xea,
+		0x89,0xbe,0x00,0x91,0x7f,0x76,0x04,0x8a,0x44,0x0a,0x52,0x40,0x4b,0x8f,0xc8,0x01,
+		0xb0,0xd0,0x0f,0x50,0x01,0xb3,0xd0,0x08,0x70,0x57,0x04,0x8a,0x45,0x01,0xb4,0xc7,
+		0x01,0xb0,0xe4,0x15,0x10,0xea,0x01,0xb3,0xe4,0x01,0xb2,0x46,0x1e,0x10,0x0c,0xec,
+		0x45,0x4f,0x92,0x0a,0xec,0x46,0x4e,0x10,0x02,0x71,0x1f,0x3e,0xb2,0xf1,0x03,0xff,
+		0x32,0xc8,0x50,0x42,0xd2,0xfb,0xed,0x14,0xcc,0xdf,0x40,0x00,0xc5,0xff,0xfd,0x02,
+		0x10,0xc3,0x01,0x55,0x35,0x2b,0x90,0x32,0xbd,0xf0,0x36,0x00,0x70,0x88,0x52,0x52,
+		0xfc,0x42,0xf2,0x04,0x70,0x7f,0x76,0x1d,0x89,0x7f,0x76,0x13,0x2d,0x8a,0x47,0x53,
+		0x04,0xd1,0x0a,0x47,0x92,0xc5,0xb1,0x4c,0x53,0xfd,0x41,0x4c,0x13,0x28,0x06,0x00,
+		0x13,0x28,0xb6,0x12,0x4c,0x34,0x61,0x4c,0x3f,0x4b,0xf0,0x04,0x4b,0x14,0xcb,0x70,
+		0x4b,0x14,0x9f,0x00,0x8f,0xc0,0x01,0x41,0x83,0x30,0x05,0xd1,0x06,0xed,0x58,0x01,
+		0x91,0x17,0xc6,0x1a,0x53,0x06,0x0a,0x64,0xff,0x9b,0x06,0x92,0xff,0x00,0x86,0x8c,
+		0x06,0xe2,0x4c,0x34,0xee,0x4c,0x32,0x87,0xf1,0x99,0x95,0x20,0x52,0x03,0xff,0xed,
+		0x00,0x9a,0x06,0x6f,0x39,0x52,0x03,0x7f,0x69,0xc9,0x9c,0x02,0x6f,0xd0,0x9c,0x01,
+		0x93,0xfa,0x30,0xf1,0xcc,0x11,0x30,0x7f,0x8b,0x42,0x8a,0xa9,0xfb,0x88,0xc4,0x00,
+		0x92,0x03,0x56,0xa9,0x04,0xa6,0xdd,0x94,0x01,0xf3,0x2b,0x6f,0x01,0x4b,0x10,0xc0,
+		0x01,0xfb,0x94,0x92,0x9d,0xd0,0x0a,0x01,0x92,0x64,0x9b,0xbe,0x06,0x71,0x01,0x96,
+		0x19,0x6f,0x0c,0x05,0xd0,0x00,0xff,0x2b,0x1b,0x6f,0x0c,0x92,0x19,0xec,0x0c,0xf8,
+		0x99,0xd0,0xac,0x70,0x00,0xb0,0x13,0xec,0x00,0x58,0x41,0xff,0x92,0x00,0x8f,0x14,
+		0x01,0x94,0x96,0x00,0xef,0x0a,0x14,0x9b,0x00,0x09,0x72,0x00,0x96,0x07,0xff,0x6f,
+		0x41,0x92,0x0a,0x52,0xe6,0xec,0x0d,0xef,0x52,0xe8,0xec,0xed,0x0c,0x33,0x92,0x01,
+		0x54,0xbf,0x03,0xec,0x02,0x92,0xd0,0xec,0x06,0x91,0x0f,0x0a,0x68,0x50,0x15,0x1c,
+		0xb0,0x8c,0xda,0xb0,0x27,0x70,0x0d,0x70,0xb1,0xf0,0xce,0x68,0xb0,0x03,0x00,0x0e,
+		0x03,0xb0,0x00,0xd3,0xbf,0x9c,0xef,0x01,0x52,0xed,0x69,0x16,0xf3,0x03,0x92,0x0b,
+		0xfb,0xec,0x03,0x9f,0x90,0x9c,0x8b,0x02,0x92,0x06,0xea,0x17,0x90,0xd1,0x03,0x72,
+		0x02,0x9d,0xf0,0xbd,0x96,0x12,0x39,0x76,0x0b,0x91,0xc9,0xb1,0x22,0x00,0x06,0xd3,
+		0x90,0xcb,0x90,0xae,0x03,0x30,0xff,0xfd,0x38,0x2c,0xd0,0x39,0x00,0x30,0x3a,0xaa,
+		0x00,0x30,0x3b,0x00,0x30,0x3c,0x00,0x30,0x3d,0x00,0x30,0x3e,0xfa,0x00,0x30,0x3f,
+		0x2e,0x92,0xc0,0x01,0x29,0x28,0xe8,0xd7,0x00,0x22,0x28,0x94,0x30,0x28,0xad,0x70,
+		0x2b,0x41,0x3f,0x1b,0x00,0x04,0x07,0x67,0xff,0x1e,0xd0,0x47,0x90,0xf6,0x00,0xb0,
+		0xfb,0x68,0x02,0x31,0x1a,0x2b,0x1b,0x2b,0xa9,0x1c,0x4b,0x10,0x00,0x30,0x10,0x00,
+		0x30,0x08,0x00,0x30,0x04,0x56,0x00,0x30,0x01,0x1c,0xa6,0xf0,0x1c,0x1d,0xf0,0x1c,
+		0x68,0x10,0xff,0x1e,0x28,0xfc,0x00,0x1f,0x2b,0x1a,0x76,0xf9,0x82,0x22,0x12,0x70,
+		0xd1,0x06,0x00,0x00,0x52,0xa4,0xff,0xc5,0x07,0xec,0xff,0x9c,0xa9,0x88,0x85,0x3f,
+		0x92,0x87,0x96,0x0e,0x00,0xfe,0x01,0x90,0x01,0x3f,0xfc,0x01,0x3f,0x01,0x31,0x5a,
+		0xff,0xa4,0xc5,0xa4,0x8e,0xfb,0xab,0x92,0x01,0x7b,0xab,0x92,0xa9,0x88,0xa9,0xff,
+		0xa9,0xa6,0x0f,0x0f,0xec,0xaa,0x93,0x0d,0xff,0xec,0xff,0x9d,0xa8,0x5c,0xbf,0x76,
+		0xfe,0xf9,0xff,0x01,0xd5,0x00,0x71,0x0c,0x00,0xf8,0xff,0xa0,0xff,0x8a,0x06,0x00,
+		0xa6,0x97,0x00,0x9b,0x0f,0xdf,0xf6,0xa6,0x1f,0x20,0x76,0x00,0x95,0xa8,0x92,0xff,
+		0x20,0x76,0x80,0x00,0x3f,0x00,0x8c,0x8c,0x37,0xff,0xff,0x00,0x00,0x02,0xfe,0xff,
+		0xb7,0xd0,0x00,0x94,0x74,0xd9,0x70,0x00,0x94,0xb2,0x00,0x50,0x90,0x80,0x3f,0x00,
+		0x90,0xdd,0xb4,0x00,0x94,0xff,0xff,0x9e,0x01,0xb2,0xff,0xff,0x55,0x9f,0x00,0x74,
+		0x90,0x00,0x74,0x91,0x00,0x74,0x92,0x00,0x74,0x55,0x95,0x00,0x74,0x96,0x00,0x74,
+		0x97,0x05,0x34,0x98,0x05,0xd6,0x75,0x9a,0x00,0x96,0x9c,0x00,0x94,0xff,0xff,0xc0,
+		0x00,0x74,0x55,0xc1,0x00,0x74,0xc2,0x00,0x74,0xc3,0x00,0x74,0xc6,0x00,0x74,0x50,
+		0x3d,0x10,0x00,0x72,0x3f,0x50,0x00,0x72,0xc9,0x00,0x50,0x01,0x00,0x70,0x15,0xca,
+		0x00,0xf4,0xcb,0x00,0x74,0xcc,0x00,0x74,0x43,0x90,0x00,0x72,0x75,0xce,0x00,0x74,
+		0xcf,0x02,0xf2,0x00,0x00,0x08,0x00,0x40,0x3f,0xa6,0x02,0x2d,0x85,0x3f,0x00,0x00,
+		0x3f,0x00,0x3f,0xbe,0x00,0x39,0x08,0x81,0x3f,0x00,0x0d,0x00,0x30,0x12,0xaa,0x00,
+		0x30,0x17,0x00,0x30,0x1c,0x00,0x30,0x21,0x00,0x30,0x26,0xaa,0x00,0x30,0x2b,0x00,
+		0x30,0x30,0x00,0x30,0x35,0x00,0x30,0x3a,0xaa,0x00,0x30,0x3f,0x00,0x30,0x44,0x00,
+		0x30,0x49,0x00,0x30,0x4e,0xaa,0x00,0x30,0x53,0x00,0x30,0x58,0x00,0x30,0x5d,0x00,
+		0x30,0x62,0xaa,0x00,0x30,0x67,0x00,0x30,0x70,0x00,0x30,0x32,0x05,0x70,0x79,0xea,
+		0x00,0x70,0x91,0x00,0x30,0xa9,0x00,0x30,0x6a,0x82,0x3f,0xab,0x00,0x73,0x00,0x30,
+		0x7c,0x00,0x30,0x85,0x00,0x30,0x8e,0xfa,0x00,0x30,0x97,0x00,0x30,0xab,0x83,0x3f,
+		0x00,0xb4,0x52,0x00,0x30,0xbd,0x00,0x30,0x03,0x31,0xc6,0x00,0x70,0xcf,0x00,0x30,
+		0x55,0xd8,0x00,0x30,0xe1,0x00,0x30,0xea,0x00,0x30,0xf3,0x00,0x30,0x7d,0xfc,0x01,
+		0xf4,0x05,0x84,0x3f,0x00,0x0e,0x00,0x30,0x55,0x17,0x00,0x30,0x20,0x00,0x30,0x29,
+		0x00,0x30,0x32,0x00,0x30,0xa9,0x3b,0x00,0x71,0x01,0xf0,0x44,0x00,0x70,0x4d,0x00,
+		0x30,0x56,0xaa,0x00,0x30,0x5f,0x00,0x30,0x68,0x00,0x30,0x71,0x00,0x30,0x7a,0x4a,
+		0x01,0xf4,0x83,0x00,0x70,0x8c,0x00,0xb4,0x00,0x31,0x95,0x00,0xb0,0x41,0x9e,0x00,
+		0xf8,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x37,0xa7,0x04,0xb0,0xa5,0xd4,0x00,0x30,
+		0xe1,0x0a,0x71,0x00,0xf0,0x1b,0x00,0x30,0x24,0x80,0x02,0x7f,0x00,0x3f,0x00,0x3f,
+		0x00,0x3f,0x00,0x3f,0x00,0x3e,0x2f,0xb1,0x03,0x2a,0x20,0xf0,0x01,0x00,0x50,0x00,
+		0x00,0xd0,0x02,0x31,0xb0,0xf4,0x70,0x6f,0x00,0x01,0x81,0x1f,0x00,0x90,0x0c,0x8d,
+		0x44,0xf1,0xcf,0x2a,0x00,0x02,0x1a,0x47,0xb0,0x3e,0xb0,0x04,0x1a,0xf7,0xff,0x00,
+		0x05,0x00,0x30,0x06,0xcc,0xf0,0xff,0xff,0x05,0x50,0x06,0x96,0x06,0xcc,0xff,0xf0,
+		0xff,0xa9,0x1a,0x00,0x05,0x06,0x96,0x07,0xcc,0xdd,0xe0,0x01,0x10,0x07,0x96,0x00,
+		0x40,0x50,0x1a,0x76,0x19,0x0c,0x43,0xb0,0x40,0x11,0x00,0x00,
+	};
+
+	//novint_T0.bin, 7914 bytes packed to 4599
+	static const uint8_t IMAGE_DATA_2[] = {
+		0xf7,0xaa,0x08,0x00,0x00,0x0c,0x3f,0x00,0x02,0x80,0xfb,0x78,0x0d,0x00,0x51,0xad,
+		0x28,0x00,0x04,0x69,0xff,0xff,0x1f,0x56,0x16,0x56,0x1a,0x56,0x40,0xff,0x29,0x1f,
+		0x76,0x00,0x00,0x02,0x29,0x1b,0xff,0x76,0x22,0x76,0xa9,0x28,0x7a,0x8d,0xa8,0xff,
+		0x28,0x3f,0x00,0x01,0x09,0x1b,0x61,0xff,0xff,0x76,0x7a,0x8d,0x04,0x29,0x0f,0x6f,
+		0x00,0xff,0x9b,0xa9,0x24,0x01,0xdf,0x04,0x6c,0x04,0xfb,0x29,0xa8,0x00,0x70,0xa6,
+		0x1e,0xa1,0xf7,0x86,0xff,0x24,0xa7,0x06,0xa1,0x81,0x01,0x09,0xa7,0xff,0x1e,0xa9,
+		0x24,0x03,0x63,0x5c,0xff,0x04,0xff,0x3b,0xa9,0x59,0x01,0xdf,0x09,0x00,0xec,0xbb,
+		0xff,0x1a,0x04,0x10,0xff,0xff,0xa8,0x00,0x30,0x01,0xfb,0x09,0x0e,0x04,0x10,0xff,
+		0xff,0x06,0x6f,0x01,0xff,0xdf,0xbd,0xc3,0xa7,0x1e,0x67,0x3e,0xbe,0xfd,0xc5,0x04,
+		0x71,0xa8,0x24,0x58,0xff,0xf7,0x60,0xff,0x7f,0x76,0x99,0x80,0x7f,0x76,0x46,0x80,
+		0xff,0xbd,0xb2,0x1f,0x76,0x02,0x00,0xbd,0xaa,0xef,0x2e,0xc5,0x67,0x3e,0x08,0x51,
+		0x00,0x59,0xa1,0xff,0x92,0x10,0xec,0x01,0x3b,0x00,0x8f,0x40,0xff,0x00,0x03,0x56,
+		0xa1,0x01,0x01,0x56,0xa4,0xbf,0x00,0xa4,0x86,0x82,0xda,0xc2,0x01,0xf0,0xa1,0x7f,
+		0x92,0xff,0x9c,0xa9,0x59,0xfa,0xed,0x0a,0xd2,0xa7,0x06,0x03,0xec,0x05,0x31,0x00,
+		0xb1,0x04,0x00,0xb4,0x00,0xf7,0x77,0x00,0x6f,0x04,0xd2,0xb2,0x2e,0xc5,0xa4,0x7d,
+		0x8b,0x04,0xf4,0x92,0x20,0x52,0x07,0x64,0x01,0x51,0xbd,0x2c,0x04,0x10,0x01,0x9a,
+		0x0f,0x6f,0x05,0xb5,0x00,0xde,0x05,0xb2,0xc4,0xb2,0x00,0x0a,0x01,0xd5,0x00,0x9a,
+		0xff,0xbe,0x8b,0x06,0x00,0x00,0x6f,0x06,0x00,0xd6,0x01,0x11,0x2e,0xa8,0x00,0x73,
+		0x2c,0x00,0x70,0x3f,0x8f,0xf7,0xff,0xff,0x7f,0x00,0x30,0xa9,0xa8,0xa5,0x0f,0xff,
+		0x04,0xed,0x00,0xd4,0x00,0xbe,0x07,0x6f,0xfe,0x01,0x31,0xc4,0x88,0x02,0x02,0xa4,
+		0x07,0xa9,0xff,0x8a,0xa6,0x92,0x7f,0x76,0x8f,0x87,0x06,0xff,0x00,0x02,0xfe,0x41,
+		0x2b,0x41,0x92,0x06,0x57,0x52,0x14,0x63,0x06,0x51,0xa0,0x06,0x50,0x41,0x06,0x52,
+		0xff,0x00,0x02,0xc4,0x1e,0x41,0x85,0x00,0x8f,0xbb,0x94,0x00,0x07,0x32,0x2b,0x41,
+		0x0a,0x02,0x51,0xee,0xfe,0x09,0x70,0xc4,0x01,0x00,0x1a,0x00,0x40,0x14,0xff,0xf6,
+		0x00,0x77,0x18,0x28,0xc2,0x00,0x69,0xff,0xff,0xa9,0x28,0xb0,0x36,0x7f,0x76,0x61,
+		0xfd,0x86,0x01,0x91,0x18,0x1a,0x20,0x00,0x28,0x9a,0xfe,0x00,0xd5,0x02,0x28,0x05,
+		0x00,0x03,0x18,0xf0,0xff,0xff,0x03,0xcc,0x0f,0xff,0x10,0x50,0x03,0xff,0x96,0x03,
+		0xcc,0xff,0xf0,0xa9,0x1a,0x00,0xf5,0x02,0x00,0x92,0x0f,0x00,0x90,0x30,0x03,0x96,
+		0x04,0xbf,0xcc,0xf0,0xff,0x04,0x50,0x04,0x00,0x70,0x0f,0xfb,0xff,0x50,0x00,0x70,
+		0x00,0x28,0x90,0x0f,0x01,0xff,0x28,0x00,0x88,0x1f,0x76,0x33,0x00,0x22,0xfe,0x04,
+		0xd0,0x23,0x76,0x01,0x00,0x82,0xfe,0x06,0xff,0x00,0x22,0x76,0xc0,0xb9,0x29,0x28,
+		0x68,0xef,0x00,0x1a,0x76,0x7f,0x20,0xb0,0x04,0xfe,0x43,0xff,0x7c,0x42,0x97,0x41,
+		0x96,0x44,0x96,0x43,0xff,0x92,0x44,0x54,0x02,0x63,0x44,0x96,0x42,0x7e,0x00,0x71,
+		0x65,0x44,0x96,0x44,0x92,0x84,0x02,0xd0,0xff,0x1b,0x76,0x42,0x29,0x16,0x56,0x25,
+		0x76,0x03,0x00,0x6f,0x00,0x9f,0x00,0x9f,0x00,0x9f,0x00,0x9f,0x00,0x9f,0x00,0x9f,
+		0xc0,0x00,0x9f,0x00,0x9f,0x00,0x9f,0x00,0x9f,0x00,0x93,0x10,0x11,0x21,0x28,0xf3,
+		0x01,0x00,0x01,0x1f,0x01,0x13,0x05,0x00,0xbd,0xa8,0xff,0xbd,0xa0,0xbd,0xc2,0xbd,
+		0xc3,0xbd,0xab,0xfb,0x69,0xff,0x01,0xf9,0x7f,0x76,0x30,0x88,0xbe,0xff,0x87,0xbe,
+		0xc5,0xbe,0xc4,0xbe,0x83,0xbe,0x7f,0x8a,0x03,0x00,0x17,0x76,0x02,0x76,0x02,0xff,
+		0xd8,0x02,0xff,0x02,0xff,0x02,0xf5,0x04,0xfe,0x03,0x1b,0x1f,0x76,0xbf,0xd4,0x01,
+		0x04,0x18,0xbf,0xff,0x1e,0x51,0x01,0xfe,0x20,0xd0,0x19,0x1a,0x10,0x00,0x08,0x92,
+		0xc3,0x5e,0x00,0xf0,0x02,0x00,0x14,0x96,0x01,0x51,0x09,0x00,0xd4,0x55,0x15,0x00,
+		0xd2,0x0a,0x00,0xd4,0x16,0x00,0xd2,0x0b,0x00,0xd4,0xd5,0x17,0x00,0xd2,0x0c,0x00,
+		0xd4,0x18,0x00,0xd2,0x0d,0x92,0xee,0x00,0xb1,0xc3,0xff,0x19,0x00,0xd0,0x03,0x00,
+		0x0d,0xf7,0x92,0x0f,0xec,0x00,0x71,0x0c,0x28,0xd0,0x07,0xe6,0x00,0x71,0x0a,0x2b,
+		0x01,0x52,0x00,0x50,0x04,0x00,0x01,0xf3,0x2b,0x0c,0x33,0xb0,0x01,0xb0,0x0b,0x08,
+		0xed,0x01,0xe1,0x9a,0x01,0xd2,0x03,0x30,0x01,0x70,0x00,0x50,0x02,0x00,0x02,0xff,
+		0x92,0x1a,0xec,0x02,0x2b,0x43,0x2b,0x43,0xea,0x2b,0x50,0x15,0x2d,0xb6,0x43,0x2d,
+		0xb2,0x40,0x8f,0x00,0xaf,0x08,0xc4,0xa0,0x43,0x2d,0xd0,0x9a,0x2d,0xd4,0x43,0xf5,
+		0x0a,0x02,0x71,0xed,0x37,0x52,0x03,0x92,0x7d,0xec,0xff,0x08,0x0a,0x08,0x92,0x14,
+		0x52,0x79,0xed,0xf7,0x08,0x2b,0x01,0x36,0xb0,0x03,0x00,0x12,0x92,0x7d,0x6a,0x3c,
+		0x30,0x03,0x00,0x14,0x92,0x66,0x00,0x72,0x6f,0x13,0x92,0x62,0xed,0x05,0xb3,0x25,
+		0x65,0x05,0xb1,0xdf,0x9a,0x00,0x43,0x85,0x40,0x32,0xb4,0x43,0x85,0xff,0x01,0x56,
+		0xa5,0x00,0xc5,0x92,0xc4,0x9e,0xff,0xa9,0x85,0x56,0xff,0x02,0x52,0x10,0x65,0xa6,
+		0x05,0x51,0x01,0x2b,0x06,0xf1,0x34,0xd4,0x88,0x07,0xb8,0x7e,0xb6,0x07,0xb3,0xdd,
+		0x62,0x02,0x52,0x92,0x39,0x0e,0xf2,0x19,0x57,0x92,0x01,0x3b,0x00,0xf1,0x07,0x04,
+		0x34,0x08,0x04,0x30,0xac,0x01,0x51,0x01,0x32,0x96,0x01,0x10,0x52,0x18,0x00,0xd2,
+		0x09,0xa8,0x02,0x1a,0x01,0x34,0x02,0x14,0x1b,0x00,0xd2,0x0b,0x02,0x14,0x0c,0xe8,
+		0x02,0x12,0x01,0x34,0x02,0x10,0x04,0x47,0x92,0x01,0x2b,0x01,0xbf,0x92,0x50,0x52,
+		0x04,0x64,0x00,0x1d,0x50,0x03,0x9f,0x2b,0x00,0x92,0x3a,0xec,0x0d,0x73,0x40,0xf7,
+		0x43,0x99,0x01,0x0d,0x9c,0x00,0x50,0xc4,0x00,0x0b,0x53,0x40,0xf1,0x02,0xff,0x00,
+		0x0c,0x0a,0x0c,0x92,0x80,0x52,0x23,0xf9,0x64,0x16,0xdf,0x0e,0x12,0xc4,0xac,0x28,
+		0x19,0x00,0xff,0xa6,0x06,0x45,0xff,0x22,0x56,0xa6,0x07,0xef,0x46,0xff,0xc4,0x1e,
+		0x16,0xd9,0x00,0x2b,0x07,0xff,0x6f,0x7f,0x76,0xae,0x88,0x7f,0x76,0x1a,0x7f,0x89,
+		0x7f,0x76,0x86,0x89,0x84,0xfe,0x28,0x9f,0x08,0x2f,0xbf,0x01,0x1f,0x01,0x17,0x02,
+		0x01,0x1f,0x01,0x1f,0x34,0x3f,0x31,0x36,0x1f,0xd0,0x01,0x2f,0x28,0x80,0x2e,0x10,
+		0x02,0x73,0x2e,0x91,0x76,0x12,0xb0,0x1a,0x40,0x00,0x90,0xd0,0x01,0x05,0x13,0xd0,
+		0xae,0x18,0x70,0x54,0x0f,0x63,0x00,0x71,0x06,0x16,0x52,0x0e,0xae,0x00,0x52,0x0b,
+		0x18,0xfe,0x2c,0x50,0x03,0x14,0xf0,0x7a,0x14,0x15,0x70,0x02,0x97,0x73,0x17,0x52,
+		0x06,0x33,0x32,0x02,0xb0,0x24,0xd2,0xff,0x0b,0x40,0x1e,0xee,0x1f,0x76,0xc3,0x01,
+		0xd7,0x24,0xcc,0x10,0x2e,0x90,0x62,0x1f,0x12,0x01,0x92,0xfd,0x5e,0x25,0x92,0x0e,
+		0x92,0x32,0x52,0x03,0x63,0x97,0x0e,0x2b,0x57,0x2d,0xb2,0x01,0x03,0x75,0x06,0x33,
+		0x1a,0xa7,0x01,0x00,0x4b,0x01,0x70,0x03,0x95,0x3b,0x03,0x94,0x07,0xa5,0xed,0x02,
+		0x77,0x3b,0x03,0x72,0x04,0x51,0x36,0x15,0xf2,0x05,0xbf,0x92,0x32,0xec,0x05,0x2b,
+		0x00,0x59,0x30,0xf2,0xaf,0x89,0x00,0x52,0x10,0x03,0x12,0x02,0x0a,0xb2,0x02,0xe2,
+		0x34,0xd0,0x32,0x33,0x70,0x0a,0xb0,0x36,0xb2,0x19,0x96,0x1d,0xfc,0x0b,0x96,0x01,
+		0xb0,0x94,0xce,0x9c,0x0a,0x96,0x00,0x17,0x02,0x0e,0x1e,0x02,0x3b,0x0b,0x05,0xf3,
+		0x08,0xf2,0x26,0x51,0x90,0x06,0x10,0x07,0xb2,0x0f,0x16,0x37,0xd2,0x0a,0x00,0xb2,
+		0x6b,0x50,0x06,0xff,0x19,0x94,0xa8,0x28,0xc0,0xf9,0x7f,0x76,0xe3,0x08,0x81,0x01,
+		0x11,0x3f,0xf1,0x27,0x30,0x02,0x01,0x56,0xff,0x0e,0x00,0x0e,0xa3,0x00,0x02,0x1f,
+		0x76,0xff,0x0e,0x00,0x1f,0xf6,0x17,0x56,0x26,0x00,0xe7,0x58,0xff,0x0a,0x0f,0xf0,
+		0x03,0x91,0x03,0x63,0x0a,0xff,0x0a,0x04,0x6f,0x00,0x52,0x02,0x65,0x0a,0xa9,0x0b,
+		0x17,0xd1,0x05,0x73,0x18,0x17,0x34,0x07,0x07,0x92,0x11,0x8a,0x17,0x34,0xfd,0x17,
+		0x32,0x00,0x17,0x32,0x02,0x97,0x17,0x33,0x07,0xea,0x11,0x34,0x11,0x17,0x33,0x41,
+		0x17,0x35,0x04,0x00,0xc1,0x2a,0x17,0x34,0x00,0x17,0x34,0x11,0x17,0x32,0x11,0x17,
+		0x34,0x30,0x91,0x46,0x06,0x38,0x1a,0x02,0x17,0x36,0x03,0x91,0x17,0x33,0x00,0x17,
+		0x30,0xd0,0x02,0x77,0x17,0x33,0x04,0x51,0x17,0x33,0x0d,0x17,0x30,0x0d,0x2b,0x39,
+		0x01,0x17,0x3c,0x0a,0xb1,0x02,0x00,0x04,0x17,0x32,0x0a,0xb0,0x02,0x14,0xf2,0x18,
+		0x17,0x32,0x0b,0x93,0x01,0xb0,0x17,0x30,0x70,0x10,0x17,0x34,0x28,0x02,0x37,0x17,
+		0x33,0x08,0xf3,0x00,0x17,0x32,0x0d,0x58,0x34,0x0f,0x14,0x8a,0x15,0x52,0x04,0x17,
+		0x36,0x18,0x17,0x3a,0x56,0x51,0x17,0x33,0x12,0x73,0x00,0x12,0x17,0x3f,0x03,0x92,
+		0x03,0x63,0x04,0x17,0x34,0xe7,0x04,0x0b,0x01,0x02,0x10,0x02,0xf0,0x56,0x10,0x00,
+		0xa9,0x10,0x02,0xdf,0x01,0x90,0x06,0x02,0xd0,0x06,0x02,0xd4,0x06,0x41,0x0b,0x3a,
+		0xdf,0x36,0x5f,0x01,0x1f,0x01,0x1f,0x01,0x17,0x04,0x01,0x1f,0x40,0x01,0x1f,0x01,
+		0x1f,0x01,0x1f,0x01,0x1f,0x01,0x1f,0x01,0x1e,0x08,0x01,0x1f,0x40,0x01,0x1f,0x01,
+		0x1f,0x01,0x1f,0x01,0x1f,0x01,0x1f,0x01,0x1e,0x10,0x01,0x1f,0x40,0x01,0x1f,0x01,
+		0x1f,0x01,0x1f,0x01,0x1f,0x01,0x1f,0x01,0x1e,0x20,0x01,0x1f,0xf0,0x01,0x1f,0x01,
+		0x1f,0x54,0xbf,0x85,0xfa,0x00,0x01,0x1f,0x76,0xff,0xc1,0x01,0x15,0xcc,0x80,0x00,
+		0xc6,0xff,0x7f,0x0a,0xec,0x11,0x18,0xdf,0xff,0x11,0x9d,0x70,0xff,0x1b,0x18,0xff,
+		0xdf,0x1b,0x1a,0x00,0x20,0xcd,0x03,0x5f,0xd0,0x58,0x8a,0x02,0x11,0x00,0xd0,0x40,
+		0x1b,0x38,0x56,0x70,0x25,0x1f,0x04,0xb3,0xc1,0x01,0x1a,0x58,0x52,0x05,0x33,0x64,
+		0x8a,0x3f,0x07,0x3d,0xdd,0x07,0x3f,0x07,0x38,0x51,0x8c,0x02,0x11,0x64,0x07,0x3f,
+		0x07,0x3b,0xdd,0x07,0x3f,0x0f,0x98,0x00,0x01,0x10,0xbd,0xdc,0x01,0x19,0x00,0x9b,
+		0x00,0x9b,0x8f,0xb3,0x10,0x01,0x19,0xbf,0xc2,0x56,0xfd,0xff,0x06,0x00,0x8a,0xf1,
+		0xd0,0xeb,0x01,0x09,0x39,0x90,0xd4,0x00,0x52,0xd0,0x01,0x2c,0xbf,0x2b,0x2d,0x2b,
+		0x2e,0x2b,0x2f,0xc8,0x50,0x30,0x82,0x00,0x30,0x31,0x00,0x30,0x01,0xb1,0x01,0x5f,
+		0x02,0xb1,0x40,0x31,0xd4,0xfb,0x01,0x00,0x0e,0x52,0xd0,0x01,0x04,0x2b,0x01,0xff,
+		0x2b,0x03,0x28,0x20,0x1c,0x15,0x2b,0x15,0xfa,0x0e,0x30,0x15,0x0a,0xf0,0x15,0x1a,
+		0x80,0x00,0x15,0xfe,0xb6,0xb3,0x08,0x15,0x96,0x15,0xcc,0xe3,0xff,0xff,0x08,0x50,
+		0x15,0x96,0x17,0x2b,0x18,0x2b,0xf9,0x19,0x03,0x92,0x00,0x95,0xd0,0x01,0x13,0x28,
+		0xaa,0xff,0x0a,0x11,0x28,0xe0,0x82,0x04,0x28,0x42,0x53,0xd0,0x2c,0x03,0x50,0x0c,
+		0x51,0x24,0x29,0x70,0x23,0x3e,0x70,0xbe,0x01,0xf1,0x08,0x2b,0x05,0x2b,0x07,0x07,
+		0x50,0x08,0xe7,0x28,0x70,0xd8,0x9f,0x32,0x06,0xb2,0xe0,0x10,0x04,0xf7,0x28,0x00,
+		0xd0,0x01,0xbb,0xd0,0x01,0x20,0x2b,0xcf,0x20,0x28,0x00,0x80,0xba,0x91,0x52,0xd1,
+		0x02,0x2b,0xff,0x01,0x28,0xff,0x7c,0x00,0x18,0xff,0x7f,0xaa,0x00,0x30,0xbf,0x00,
+		0x30,0xdf,0x00,0x30,0xef,0x00,0x30,0xf7,0xea,0x00,0x30,0xfb,0xc4,0x10,0x02,0x00,
+		0x30,0x01,0x00,0x18,0x57,0x7f,0xff,0x00,0xa4,0x70,0x00,0x0b,0x90,0x00,0xa4,0x30,
+		0x1b,0x00,0x1a,0xe0,0x00,0x1a,0x04,0x00,0x30,0x81,0x90,0x6e,0xd0,0x5e,0x04,0x91,
+		0x21,0x1a,0x00,0x04,0x00,0x30,0x08,0x00,0x30,0xad,0x10,0x00,0x30,0x20,0x21,0x02,
+		0xf0,0x21,0x03,0x70,0x21,0x14,0x05,0x70,0x01,0xf1,0x06,0x08,0x70,0x05,0x03,0xf0,
+		0x5a,0x32,0x1e,0x90,0x02,0x00,0x71,0x05,0x1b,0x52,0x00,0xf1,0xaa,0x31,0x00,0xf1,
+		0x0d,0xb1,0x00,0xf1,0xa5,0x7f,0x00,0xf2,0x04,0x09,0x70,0x00,0x30,0xbf,0x00,0x30,
+		0xdf,0x6a,0x00,0x30,0xef,0x00,0x30,0xf7,0x00,0x30,0xfb,0x04,0x09,0x70,0xac,0x00,
+		0x30,0x01,0xf0,0x7f,0xff,0xad,0xf1,0x04,0x04,0xf0,0x04,0xab,0x18,0xef,0x00,0x30,
+		0xf7,0x00,0x30,0xfb,0x00,0x30,0xfd,0xfe,0x00,0x30,0xfe,0xff,0x0e,0x2b,0x0d,0x2b,
+		0x0c,0xaa,0x01,0xf0,0x0c,0x01,0xf0,0x0c,0x01,0x30,0x0c,0x01,0x30,0x12,0xaf,0x2b,
+		0x11,0x2b,0x10,0x02,0x30,0x10,0x00,0xf0,0x10,0x4e,0x00,0xf0,0x15,0x2b,0x14,0x06,
+		0x10,0x00,0x30,0xdf,0x00,0x30,0x55,0xef,0x00,0x30,0xf7,0x00,0x30,0xfb,0x00,0x30,
+		0xfd,0x00,0x30,0xab,0xfe,0x14,0x06,0x10,0x14,0x04,0x10,0x14,0x0b,0x90,0x14,0xaa,
+		0x0f,0x90,0x14,0x0f,0x90,0x14,0x0f,0x90,0x14,0x0f,0x90,0x14,0x68,0x0f,0x90,0x1c,
+		0x31,0x0a,0x91,0x34,0x0b,0x14,0x19,0x2b,0xd5,0xb1,0xa5,0x18,0x08,0xb0,0x19,0x00,
+		0x30,0x01,0x11,0x38,0x03,0x50,0x1a,0xfb,0x76,0x69,0x24,0xd0,0x7f,0x76,0xe7,0x8c,
+		0x7f,0xff,0x76,0xd6,0x86,0x7f,0x76,0x02,0x8a,0x7f,0xff,0x8f,0x31,0x8e,0x3f,0x8f,
+		0x50,0x8e,0xa9,0xfb,0xa0,0x41,0x97,0xb0,0xa9,0xa8,0x00,0x8f,0x00,0x5e,0xeb,0x50,
+		0x4f,0x8d,0x40,0x76,0x00,0x71,0x68,0x02,0x30,0x7d,0xad,0x00,0x70,0x32,0x8a,0x7f,
+		0x76,0x35,0x03,0x30,0xff,0x13,0x88,0xa9,0x20,0x7f,0x76,0xe4,0x8c,0x7f,0x30,0x29,
+		0x69,0xff,0x7f,0x76,0x25,0x01,0x10,0xcf,0xd7,0x8c,0xfb,0x6f,0xe1,0x31,0x06,0x11,
+		0x30,0x40,0xab,0x08,0xef,0x37,0x71,0x30,0x0d,0x50,0x41,0x09,0x30,0x05,0xf0,0x68,
+		0x70,0x00,0xd0,0x0a,0x50,0x01,0xd2,0xcc,0x02,0x00,0xc0,0x3b,0xff,0x08,0x6d,0xd0,
+		0xc1,0x01,0x31,0x02,0x12,0x80,0xb0,0x9a,0x02,0x12,0x31,0x02,0x10,0x41,0x92,0xdb,
+		0x51,0x04,0x90,0x96,0xae,0xa0,0xd1,0xac,0x03,0x41,0xa3,0x50,0xa4,0x72,0xf2,0xc4,
+		0xb7,0x92,0x08,0x96,0xe5,0x91,0xa8,0x03,0xa1,0xd2,0x92,0x03,0x05,0x96,0x02,0x91,
+		0x8d,0x57,0x85,0x92,0x31,0x30,0x77,0x15,0x6d,0x52,0xee,0x00,0xf4,0x08,0x00,0xc2,
+		0x00,0xf2,0x03,0x96,0x0e,0x7e,0x16,0xd1,0x2b,0x02,0x28,0x07,0x00,0x0b,0x76,0x90,
+		0x4f,0x04,0x96,0x0f,0x96,0x04,0x31,0xc2,0x93,0x0a,0x19,0xd0,0xff,0x7f,0x76,0xb7,
+		0x87,0x7f,0x76,0xdc,0x87,0x4e,0x0b,0x13,0x01,0x00,0x31,0x24,0xd2,0xe5,0x31,0x08,
+		0x00,0x30,0x79,0x10,0x02,0xb2,0x03,0xd1,0x04,0x2b,0x0f,0x2b,0x0a,0x71,0xfa,0x02,
+		0xf1,0x41,0x76,0xf2,0x08,0x92,0x41,0x54,0x59,0xef,0xed,0x1b,0x0a,0x09,0x76,0x30,
+		0x10,0x0a,0x0b,0xd3,0x42,0x16,0x83,0x74,0x07,0xb1,0x56,0x7c,0xb2,0x03,0x92,0xf7,
+		0x52,0xed,0x10,0x83,0x32,0x10,0x2b,0x4d,0x6f,0x2d,0x03,0x02,0x71,0x2b,0x0b,0x0f,
+		0x30,0x47,0x82,0x74,0x02,0x91,0x6d,0x31,0x02,0x94,0x05,0xed,0x01,0xf3,0x39,0x6f,
+		0x03,0x11,0xff,0x36,0x64,0x15,0x92,0x34,0xec,0x15,0x2b,0x95,0x02,0x81,0xb4,0x0d,
+		0x81,0xb4,0xfb,0x81,0xb2,0xa4,0xf3,0x1b,0x4f,0x28,0x32,0x00,0x22,0x7f,0x12,0xba,
+		0xb3,0x06,0x81,0x50,0x59,0x06,0x81,0x50,0x00,0xb1,0x10,0x1e,0x02,0x15,0x11,0x02,
+		0x12,0xdf,0x10,0x2b,0x03,0x2b,0x15,0x05,0xf0,0x0a,0x6f,0x7d,0x05,0x0b,0x50,0x07,
+		0xed,0x1b,0x0b,0x09,0x11,0x50,0x35,0x0b,0x04,0xf0,0x03,0x82,0x72,0x06,0x92,0x80,
+		0xf1,0x03,0x32,0x6e,0x81,0x3a,0x1a,0x96,0x41,0xff,0xf0,0xdc,0x87,0x17,0x91,0xc3,
+		0x06,0xfe,0xd3,0xb2,0x8d,0x10,0x1d,0x53,0x17,0x31,0x08,0xed,0xdf,0x00,0x02,0x46,
+		0x1e,0x44,0x06,0xd2,0x12,0x2b,0xff,0x54,0x6f,0x20,0xcc,0x00,0x04,0xc9,0xff,0x9b,
+		0x0d,0xec,0xc9,0x53,0x15,0x85,0x01,0x72,0x04,0x90,0x02,0x7f,0x00,0x22,0x03,0x42,
+		0x1e,0x0c,0x6f,0x01,0x71,0xe8,0x01,0x10,0x01,0x70,0x2b,0xd0,0xae,0x00,0x51,0x20,
+		0x07,0x42,0xbb,0x1e,0x42,0x07,0x92,0x01,0x56,0x1e,0x89,0x50,0x00,0xff,0xfa,0xa9,
+		0xa8,0x1e,0x0f,0x03,0x63,0x1e,0xff,0xa8,0x0a,0x6f,0x29,0xff,0x83,0xff,0x1e,0xef,
+		0x0f,0x06,0x65,0xaa,0x43,0xd0,0xab,0x28,0x00,0xff,0x06,0x1e,0xa9,0x1e,0x06,0x30,
+		0xff,0x46,0xff,0x1e,0x6c,0xff,0x42,0x06,0x46,0xa3,0x31,0xff,0xff,0xac,0x10,0x44,
+		0x1e,0x44,0x06,0x06,0xb8,0x9e,0xf0,0x3f,0xd3,0x25,0x51,0xc3,0x01,0x22,0x00,0x90,
+		0x44,0xf6,0xcc,0x90,0xa9,0x85,0x01,0xd1,0x04,0x63,0x00,0x02,0xff,0x44,0x1e,0x07,
+		0x6f,0x00,0x8f,0xe0,0x10,0xff,0xa9,0xa8,0x44,0x0f,0x02,0x63,0x44,0xa8,0x7d,0x44,
+		0x12,0xf0,0xd0,0x01,0x17,0x96,0x86,0xea,0xd0,0xb4,0x0d,0x7f,0x0d,0x7d,0x14,0x0d,
+		0x73,0x08,0xca,0x0d,0x76,0x17,0xaa,0x0d,0x72,0x14,0x0d,0x72,0x26,0x0d,0x78,0x14,
+		0x0d,0x72,0x16,0xaa,0x0d,0x72,0x24,0x0d,0x78,0x1c,0x0d,0x74,0x1c,0x0d,0x70,0x1c,
+		0x3a,0x0d,0x74,0x1c,0x0d,0x78,0x1c,0xa9,0x1c,0x0d,0x7f,0x0d,0x77,0x25,0x08,0x0d,
+		0x76,0x08,0x0d,0x7f,0x0d,0x7f,0x18,0x0d,0x7f,0x0d,0x7f,0xac,0xe9,0xb1,0x0d,0x73,
+		0x10,0xcb,0x0d,0x76,0x19,0x0d,0x72,0x13,0xaa,0x0d,0x72,0x2a,0x0d,0x78,0x13,0x0d,
+		0x72,0x18,0x0d,0x72,0x28,0xa8,0x0d,0x78,0x58,0xb0,0x0d,0x72,0x20,0x0d,0x70,0x20,
+		0x0d,0x74,0x20,0x4e,0x0d,0x78,0x20,0xa9,0x20,0x0d,0x7f,0x0d,0x77,0x10,0x0d,0x76,
+		0x89,0x10,0x0d,0x7f,0x0d,0x7f,0x19,0x0d,0x74,0x42,0xb1,0x07,0xf1,0x04,0xff,0x92,
+		0x08,0xec,0x41,0x2d,0x01,0x9a,0x66,0xff,0xff,0x02,0xce,0x03,0xec,0x01,0x9a,0x02,
+		0xd7,0x6f,0x00,0x9a,0x2a,0x71,0x30,0x0b,0x30,0x33,0x00,0xf5,0x20,0x55,0x90,0x22,
+		0x4f,0x50,0x40,0x8f,0xa6,0x02,0xde,0x0a,0x50,0x0d,0x28,0xff,0x01,0x4f,0xf0,0x4f,
+		0x8d,0xf9,0x1a,0x67,0x50,0x3d,0xd0,0x2b,0x24,0x2b,0x26,0x2b,0xdf,0x28,0x2b,0x2a,
+		0x2b,0x2c,0x73,0x70,0x30,0x2b,0xff,0x32,0x2b,0x34,0x2b,0x36,0x2b,0x38,0x2b,0xff,
+		0x23,0x2b,0x25,0x2b,0x27,0x2b,0x29,0x2b,0xfd,0x2b,0x74,0xf0,0x2f,0x2b,0x31,0x2b,
+		0x33,0x2b,0x7f,0x35,0x2b,0x37,0x2b,0x39,0x2b,0x21,0x0d,0x10,0xd1,0x20,0x41,0x90,
+		0x07,0xf1,0x42,0x91,0x10,0x41,0x10,0x11,0x28,0xf9,0x43,0x58,0x12,0x58,0x91,0x12,
+		0x2b,0x13,0x28,0x0b,0xff,0x00,0x1a,0x28,0x50,0xc0,0x1b,0x28,0x70,0x17,0x40,0x1c,
+		0x2b,0x84,0x51,0x1a,0x68,0x30,0x84,0x51,0x06,0xf1,0xb5,0x32,0x02,0x70,0x32,0x02,
+		0x70,0x23,0x76,0x78,0xb1,0x04,0xf0,0x44,0xd0,0xd8,0x91,0x0c,0xb1,0x8d,0x12,0xcc,
+		0x00,0x1f,0xc7,0x7b,0xff,0x42,0x50,0x10,0x41,0x2b,0x09,0x6f,0x4f,0x31,0xfd,0xc0,
+		0xf1,0x12,0x17,0xc6,0xc4,0x96,0x41,0x0a,0x85,0x42,0x3b,0x10,0xf6,0xff,0x50,0x03,
+		0x50,0x03,0x30,0x0e,0x11,0xbd,0xaf,0xb2,0x04,0xfe,0x41,0xbd,0x92,0x07,0xc6,0x10,
+		0x3c,0xff,0x52,0xc0,0x56,0xad,0x00,0x0f,0x92,0x3e,0xfa,0x00,0x70,0xa9,0x83,0x10,
+		0x44,0x96,0x0f,0x52,0x0d,0xee,0xf5,0xb2,0xc0,0x01,0x44,0x54,0xd2,0x41,0x9a,0xc4,
+		0xff,0x74,0x44,0x0a,0x44,0x92,0x0f,0x52,0xf5,0xff,0x64,0x41,0x92,0x01,0x9c,0xa9,
+		0x58,0x40,0xfe,0x01,0xb0,0x41,0x59,0x03,0x56,0x95,0x04,0x41,0xdf,0x93,0x02,0x9d,
+		0xa8,0x58,0x02,0xb1,0x9c,0xca,0xff,0xa9,0x88,0x03,0x56,0x94,0x08,0xa9,0x93,0x7f,
+		0xa6,0xcb,0xa8,0x80,0x41,0x93,0x03,0x01,0x70,0xfe,0x00,0xf0,0x0c,0xa7,0xca,0x42,
+		0x96,0x41,0x08,0xff,0x04,0x00,0x42,0x92,0x5c,0xff,0xa9,0x93,0xef,0xde,0xff,0xa9,
+		0x95,0x17,0xd1,0xb0,0xff,0x12,0x09,0x97,0x04,0xb3,0x04,0x52,0x59,0x04,0x73,0x04,
+		0x3f,0x04,0x3f,0x04,0x39,0x21,0x13,0x04,0x3f,0x04,0x3f,0x04,0x3f,0x04,0x3a,0x14,
+		0x04,0x34,0x0c,0xf3,0x5f,0x9c,0xca,0x43,0x96,0x43,0x68,0xf2,0x03,0x11,0x30,0x7f,
+		0x07,0xed,0x7f,0x76,0xf1,0x87,0x04,0x50,0x32,0x9f,0x0f,0x2b,0x43,0x41,0x06,0x01,
+		0x70,0x27,0xb1,0x40,0xfc,0x68,0x12,0x27,0xb1,0x40,0x00,0x43,0x42,0x04,0xef,0xdd,
+		0x21,0x74,0x50,0x03,0x6f,0x22,0x00,0x50,0x43,0x43,0xf6,0x00,0xd1,0x00,0x40,0x00,
+		0xd1,0x00,0x40,0x84,0xfe,0xfb,0xbe,0x8b,0x27,0x12,0x2b,0x41,0x92,0x10,0x52,0xed,
+		0x0f,0x15,0x52,0x40,0x02,0x6a,0x35,0xc1,0x01,0xc4,0xb3,0x92,0x19,0x1a,0x10,0x01,
+		0xb1,0xf3,0x64,0x19,0x91,0x08,0xff,0xfe,0x46,0xa0,0x44,0xa8,0x41,0x96,0x46,0xff,
+		0x8a,0xc4,0x92,0x47,0x96,0x01,0x9b,0xa9,0xff,0x95,0x47,0x97,0x44,0x8a,0x01,0x3b,
+		0xa9,0xfe,0x18,0x73,0x92,0xc4,0x96,0x47,0x92,0x14,0x52,0xbf,0x02,0xed,0x47,0x2b,
+		0x47,0x92,0x02,0x30,0x96,0xdd,0x88,0x55,0x72,0x42,0xa8,0x42,0x02,0xf0,0x43,0x96,
+		0xbe,0x00,0x51,0x44,0x96,0x46,0x2b,0x46,0x02,0x30,0x16,0xeb,0x63,0x42,0x03,0x70,
+		0x46,0x03,0x72,0xc4,0x92,0x45,0xff,0x96,0x43,0x92,0x45,0x54,0x03,0x65,0x45,0x5a,
+		0x02,0x50,0x44,0x00,0x91,0x63,0x45,0x02,0x91,0x0a,0x02,0x91,0xff,0xec,0x64,0x00,
+		0x9a,0x44,0x93,0x43,0x9f,0x7f,0x02,0x53,0x02,0x62,0x01,0x9a,0x86,0x05,0x10,0xea,
+		0x21,0xd3,0x42,0x5d,0x90,0x09,0xea,0x50,0x3c,0x00,0x01,0xfa,0x0f,0xf2,0x16,0x13,
+		0x70,0x43,0x96,0x41,0x58,0x41,0xfb,0x0a,0x43,0x5e,0xd1,0x02,0x0f,0x90,0x41,0x9c,
+		0xad,0x94,0x00,0xf4,0xa3,0xff,0x00,0xd9,0xa7,0x00,0xda,0xab,0x84,0x00,0xd4,0x04,
+		0x53,0x1a,0x04,0x58,0x04,0x1f,0x04,0x1f,0x04,0x1f,0x17,0xe0,0x04,0x1f,0x04,0x1f,
+		0x04,0x1f,0x00,0xd2,0x30,0x51,0x08,0x92,0x42,0xbe,0x3f,0xf2,0x02,0x40,0x03,0xee,
+		0x42,0x7a,0x10,0x02,0xbd,0x41,0x00,0x71,0x40,0x00,0x02,0x42,0x00,0x71,0x20,0x71,
+		0x00,0x03,0x11,0x33,0x30,0x03,0xb4,0x94,0x28,0x41,0x01,0x10,0x37,0x94,0x28,0x3e,
+		0x3f,0xd0,0x2b,0x8b,0xc1,0xd2,0x36,0xd2,0xff,0xfb,0xed,0x14,0xcc,0x40,0x00,0xc5,
+		0xff,0x5d,0xfd,0x75,0x90,0xc3,0x01,0x35,0x1f,0x90,0x32,0xb7,0x70,0xe5,0x36,0x00,
+		0x70,0x84,0x46,0x52,0x36,0xf2,0x92,0x0c,0xec,0x17,0x7f,0x76,0x73,0x90,0x30,0x83,
+		0x03,0x90,0x3b,0x51,0x07,0x71,0x94,0xf5,0x31,0x01,0xf1,0xdd,0x40,0x54,0x41,0x40,
+		0x13,0x00,0xb0,0x13,0x4b,0x28,0x47,0x40,0x34,0x61,0x40,0x3f,0x3f,0xf0,0x04,0x3f,
+		0x14,0xb8,0xc4,0xf0,0x3f,0x14,0x18,0x70,0x01,0x41,0x2b,0x7a,0x31,0x04,0xb7,0x00,
+		0x02,0x58,0x01,0x91,0x17,0xc6,0x0e,0x53,0x02,0xff,0x0a,0x64,0x9b,0x02,0x92,0xff,
+		0x00,0x74,0x8b,0x8d,0x02,0x40,0x34,0xee,0x40,0x32,0x86,0xd1,0x93,0x15,0x20,0xff,
+		0x52,0x03,0xed,0x00,0x9a,0x06,0x6f,0x39,0xff,0x52,0x03,0x69,0xc9,0x9c,0x02,0x6f,
+		0xd0,0xe9,0x9c,0x01,0x93,0x24,0xf1,0xcc,0x7b,0x70,0x75,0x8c,0x42,0xef,0x8a,0xa9,
+		0x88,0xc4,0x00,0x92,0x03,0x56,0xa9,0x77,0x04,0xa6,0x94,0x01,0xf3,0x2b,0x6f,0x03,
+		0x3f,0x10,0xff,0x40,0x01,0x94,0x92,0x41,0x96,0x03,0x0a,0xef,0x03,0x92,0x64,0x9b,
+		0x06,0x71,0x03,0x96,0x19,0xfb,0x6f,0x07,0x05,0xd0,0x00,0x2b,0x1b,0x6f,0x07,0xbf,
+		0x92,0x19,0xec,0x07,0x2b,0x06,0x00,0xd0,0x15,0xbe,0x00,0xb0,0x13,0xec,0x00,0x58,
+		0x41,0x23,0x30,0x0a,0xff,0x01,0x94,0x96,0x00,0x0a,0x14,0x9b,0x00,0xfe,0x09,0x72,
+		0x00,0x96,0x07,0x6f,0x41,0x92,0x0a,0xff,0x52,0xe6,0xec,0x0d,0x52,0xe8,0xec,0xed,
+		0xfe,0x0c,0x33,0x92,0x03,0x54,0x03,0xec,0x06,0x92,0xeb,0xd0,0xec,0x06,0x91,0x09,
+		0x5c,0x50,0x0b,0x01,0x7f,0xbf,0x76,0x82,0x8c,0x08,0x96,0x0a,0x9b,0xf0,0x07,0xfe,
+		0x02,0x32,0x0a,0x92,0xbf,0x9c,0x01,0x52,0xf3,0x7d,0x69,0x16,0x33,0x09,0x92,0x09,
+		0xec,0x09,0x98,0x50,0xdf,0x92,0x8c,0x06,0x92,0x04,0x16,0xd0,0xc7,0x8c,0x3d,0x06,
+		0x96,0x70,0xbd,0x96,0x12,0x76,0x0a,0x91,0xc2,0x31,0xc7,0x22,0x00,0x06,0xcc,0x10,
+		0xc4,0x10,0x02,0xf0,0xff,0xfd,0x55,0x38,0x1f,0xd0,0x39,0x00,0x30,0x3a,0x00,0x30,
+		0x3b,0x00,0x30,0x55,0x3c,0x00,0x30,0x3d,0x00,0x30,0x3e,0x00,0x30,0x3f,0x21,0x92,
+		0xff,0xc0,0x01,0x29,0x28,0xe8,0x00,0x22,0x28,0xed,0x02,0xd6,0x70,0x0a,0x00,0x3b,
+		0x90,0x1b,0x00,0x04,0xc7,0x07,0x67,0xff,0x1d,0xd0,0x3a,0x90,0x00,0xb0,0xfb,0x68,
+		0x3e,0x02,0x31,0x1a,0x2b,0x1b,0x2b,0x1c,0x3e,0x10,0x00,0x30,0xd5,0x10,0x00,0x30,
+		0x08,0x00,0x30,0x04,0x00,0x30,0x01,0x1c,0xea,0x9f,0x70,0x1c,0x1c,0xf0,0x1c,0x5b,
+		0x10,0x1e,0x28,0xfc,0x3f,0x00,0x1f,0x2b,0x1a,0x76,0x82,0x21,0x12,0x63,0xd1,0xff,
+		0x06,0x00,0x00,0x52,0xa4,0xc5,0x07,0xec,0xff,0xff,0x9c,0xa9,0x88,0x85,0x92,0x87,
+		0x96,0x87,0x0e,0x00,0xfe,0x01,0x90,0x01,0x3f,0x01,0x3f,0x01,0x31,0x5a,0x7f,0xff,
+		0xa4,0xc5,0xa4,0x8e,0xab,0x92,0x01,0x7b,0xff,0xab,0x92,0xa9,0x88,0xa9,0xa9,0xa6,
+		0x0f,0xff,0x0f,0xec,0xaa,0x93,0x0d,0xec,0xff,0x9d,0x3f,0xa8,0x5c,0xbf,0x76,0xfe,
+		0xff,0x01,0xd5,0x00,0x71,0xff,0x0c,0x00,0xf8,0xff,0xa0,0x8a,0x06,0x00,0xff,0xa6,
+		0x97,0x00,0x9b,0x0f,0xf6,0xa6,0x1f,0xfb,0x20,0x76,0x00,0x95,0xa8,0x92,0x20,0x76,
+		0xb7,0xff,0x00,0x3f,0x00,0x7a,0x8d,0xff,0xff,0x00,0x86,0x00,0x02,0xfe,0xff,0xd1,
+		0x10,0x00,0x94,0xd1,0xf0,0x00,0x94,0xac,0xae,0x00,0x50,0x90,0x80,0x3f,0x00,0x90,
+		0xae,0x00,0x94,0xff,0xbb,0xff,0x80,0x01,0xb2,0xff,0xff,0x81,0x00,0x74,0x82,0xaa,
+		0x00,0x50,0x01,0x00,0x70,0x83,0x00,0x74,0x84,0x01,0x74,0x85,0xaa,0x00,0xf4,0x86,
+		0x00,0xf4,0x87,0x00,0x74,0x88,0x00,0x74,0x89,0xaa,0x00,0x74,0x8a,0x00,0x74,0x8b,
+		0x00,0x74,0x8c,0x00,0x74,0x8d,0xae,0x03,0xf2,0xfe,0xff,0x8e,0x08,0xd6,0x90,0x00,
+		0x96,0x92,0xae,0x00,0x94,0xff,0xff,0xd2,0x00,0x74,0xd3,0x00,0x74,0xd4,0xaa,0x00,
+		0x74,0xd5,0x07,0xd4,0xd6,0x00,0xf4,0xd7,0x00,0x74,0xd8,0xaa,0x00,0x74,0xd9,0x00,
+		0x74,0xda,0x00,0x74,0xdb,0x05,0x94,0xdc,0x8a,0x06,0x36,0xde,0x00,0x96,0xe0,0x06,
+		0xd6,0x05,0x20,0x00,0x72,0x02,0xaa,0x00,0x74,0x03,0x00,0x74,0x05,0x00,0x74,0x06,
+		0x00,0x74,0x07,0xea,0x00,0x74,0x08,0x00,0x74,0x09,0x00,0x72,0x00,0x00,0x0a,0x7e,
+		0x00,0x70,0xa6,0x02,0x57,0x86,0x3f,0x00,0x00,0x3f,0x7c,0x00,0x3f,0x00,0x39,0x18,
+		0x81,0x3f,0x00,0x1d,0x00,0x30,0x55,0x22,0x00,0x30,0x27,0x00,0x30,0x2c,0x00,0x30,
+		0x31,0x00,0x30,0x55,0x36,0x00,0x30,0x3b,0x00,0x30,0x40,0x00,0x30,0x45,0x00,0x30,
+		0x55,0x4a,0x00,0x30,0x4f,0x00,0x30,0x54,0x00,0x30,0x59,0x00,0x30,0x55,0x5e,0x00,
+		0x30,0x63,0x00,0x30,0x68,0x00,0x30,0x6d,0x00,0x30,0x55,0x72,0x00,0x30,0x77,0x00,
+		0x30,0x80,0x00,0x30,0x5c,0x05,0x70,0xd5,0x89,0x00,0x70,0xa1,0x00,0x30,0xb9,0x00,
+		0x30,0xfe,0x82,0x7f,0x3f,0x00,0x07,0x83,0x3f,0x00,0x10,0x00,0x30,0xd5,0x19,0x00,
+		0x30,0x22,0x00,0x30,0x2b,0x00,0x30,0xd5,0x84,0x97,0x3f,0x00,0xde,0x00,0x30,0xe7,
+		0x00,0x30,0x03,0x31,0xf0,0xfa,0x00,0x70,0xf9,0x00,0x30,0x02,0x85,0x3f,0x00,0x0b,
+		0x2a,0x00,0x30,0x14,0x00,0x30,0x1d,0x00,0x30,0x26,0x00,0x30,0x01,0xf1,0x55,0x2f,
+		0x00,0x70,0x38,0x00,0x30,0x41,0x00,0x30,0x4a,0x00,0x30,0xa9,0x53,0x01,0x71,0x00,
+		0x30,0x65,0x01,0xf4,0x6e,0x00,0x70,0x77,0xaa,0x00,0x30,0x80,0x00,0x30,0x89,0x00,
+		0x30,0x92,0x00,0x30,0x9b,0x2a,0x00,0x30,0xa4,0x01,0xf4,0xad,0x00,0x70,0xb6,0x00,
+		0xb4,0x00,0x31,0x05,0xbf,0x00,0xb0,0xc8,0x00,0xf8,0x00,0x3f,0x00,0x3f,0x00,0x3f,
+		0x00,0x37,0xa5,0xd1,0x04,0xb0,0xfe,0x0b,0xb1,0x00,0xb0,0x38,0x00,0x30,0x45,0x02,
+		0x00,0x30,0x4e,0x02,0x7f,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x3e,0x81,
+		0x64,0x20,0x90,0x36,0xd1,0xb0,0xb0,0x00,0x10,0xe7,0xd0,0x00,0xd0,0x02,0xbc,0x38,
+		0xd0,0xf4,0x10,0x00,0x01,0x81,0x1f,0x00,0x90,0x31,0x3d,0x8e,0x4c,0x11,0x2a,0x00,
+		0x02,0x1a,0xde,0x30,0x45,0xd0,0xdf,0x04,0x1a,0xff,0x00,0x05,0x00,0x30,0x06,0xcc,
+		0xff,0xf0,0xff,0x05,0x50,0x06,0x96,0x06,0xcc,0xff,0xff,0xf0,0xa9,0x1a,0x00,0x05,
+		0x06,0x96,0x77,0x07,0xcc,0xe0,0x01,0x10,0x07,0x96,0x00,0x47,0x70,0x67,0x1a,0x76,
+		0x0c,0x4a,0xd0,0x47,0x31,0x00,0x00,
+	};
+
+	//novint_T2.bin, 7914 bytes packed to 4598
+	static const uint8_t IMAGE_DATA_3[] = {
+		0xf7,0xaa,0x08,0x00,0x00,0x0c,0x3f,0x00,0x02,0x80,0xfb,0x78,0x0d,0x00,0x51,0xad,
+		0x28,0x00,0x04,0x69,0xff,0xff,0x1f,0x56,0x16,0x56,0x1a,0x56,0x40,0xff,0x29,0x1f,
+		0x76,0x00,0x00,0x02,0x29,0x1b,0xff,0x76,0x22,0x76,0xa9,0x28,0x7a,0x8d,0xa8,0xff,
+		0x28,0x3f,0x00,0x01,0x09,0x1b,0x61,0xff,0xff,0x76,0x7a,0x8d,0x04,0x29,0x0f,0x6f,
+		0x00,0xff,0x9b,0xa9,0x24,0x01,0xdf,0x04,0x6c,0x04,0xfb,0x29,0xa8,0x00,0x70,0xa6,
+		0x1e,0xa1,0xf7,0x86,0xff,0x24,0xa7,0x06,0xa1,0x81,0x01,0x09,0xa7,0xff,0x1e,0xa9,
+		0x24,0x03,0x63,0x5c,0xff,0x04,0xff,0x3b,0xa9,0x59,0x01,0xdf,0x09,0x00,0xec,0xbb,
+		0xff,0x1a,0x04,0x10,0xff,0xff,0xa8,0x00,0x30,0x01,0xfb,0x09,0x0e,0x04,0x10,0xff,
+		0xff,0x06,0x6f,0x01,0xff,0xdf,0xbd,0xc3,0xa7,0x1e,0x67,0x3e,0xbe,0xfd,0xc5,0x04,
+		0x71,0xa8,0x24,0x58,0xff,0xf7,0x60,0xff,0x7f,0x76,0x99,0x80,0x7f,0x76,0x46,0x80,
+		0xff,0xbd,0xb2,0x1f,0x76,0x02,0x00,0xbd,0xaa,0xef,0x2e,0xc5,0x67,0x3e,0x08,0x51,
+		0x00,0x59,0xa1,0xff,0x92,0x10,0xec,0x01,0x3b,0x00,0x8f,0x40,0xff,0x00,0x03,0x56,
+		0xa1,0x01,0x01,0x56,0xa4,0xbf,0x00,0xa4,0x86,0x82,0xda,0xc2,0x01,0xf0,0xa1,0x7f,
+		0x92,0xff,0x9c,0xa9,0x59,0xfa,0xed,0x0a,0xd2,0xa7,0x06,0x03,0xec,0x05,0x31,0x00,
+		0xb1,0x04,0x00,0xb4,0x00,0xf7,0x77,0x00,0x6f,0x04,0xd2,0xb2,0x2e,0xc5,0xa4,0x7d,
+		0x8b,0x04,0xf4,0x92,0x20,0x52,0x07,0x64,0x01,0x51,0xbd,0x2c,0x04,0x10,0x01,0x9a,
+		0x0f,0x6f,0x05,0xb5,0x00,0xde,0x05,0xb2,0xc4,0xb2,0x00,0x0a,0x01,0xd5,0x00,0x9a,
+		0xff,0xbe,0x8b,0x06,0x00,0x00,0x6f,0x06,0x00,0xd6,0x01,0x11,0x2e,0xa8,0x00,0x73,
+		0x2c,0x00,0x70,0x3f,0x8f,0xf7,0xff,0xff,0x7f,0x00,0x30,0xa9,0xa8,0xa5,0x0f,0xff,
+		0x04,0xed,0x00,0xd4,0x00,0xbe,0x07,0x6f,0xfe,0x01,0x31,0xc4,0x88,0x02,0x02,0xa4,
+		0x07,0xa9,0xff,0x8a,0xa6,0x92,0x7f,0x76,0x8f,0x87,0x06,0xff,0x00,0x02,0xfe,0x41,
+		0x2b,0x41,0x92,0x06,0x57,0x52,0x14,0x63,0x06,0x51,0xa0,0x06,0x50,0x41,0x06,0x52,
+		0xff,0x00,0x02,0xc4,0x1e,0x41,0x85,0x00,0x8f,0xbb,0x94,0x00,0x07,0x32,0x2b,0x41,
+		0x0a,0x02,0x51,0xee,0xfe,0x09,0x70,0xc4,0x01,0x00,0x1a,0x00,0x40,0x14,0xff,0xf6,
+		0x00,0x77,0x18,0x28,0xc2,0x00,0x69,0xff,0xff,0xa9,0x28,0xb0,0x36,0x7f,0x76,0x61,
+		0xfd,0x86,0x01,0x91,0x18,0x1a,0x20,0x00,0x28,0x9a,0xfe,0x00,0xd5,0x02,0x28,0x05,
+		0x00,0x03,0x18,0xf0,0xff,0xff,0x03,0xcc,0x0f,0xff,0x10,0x50,0x03,0xff,0x96,0x03,
+		0xcc,0xff,0xf0,0xa9,0x1a,0x00,0xf5,0x02,0x00,0x92,0x0f,0x00,0x90,0x30,0x03,0x96,
+		0x04,0xbf,0xcc,0xf0,0xff,0x04,0x50,0x04,0x00,0x70,0x0f,0xfb,0xff,0x50,0x00,0x70,
+		0x00,0x28,0x90,0x0f,0x01,0xff,0x28,0x00,0x88,0x1f,0x76,0x33,0x00,0x22,0xfe,0x04,
+		0xd0,0x23,0x76,0x01,0x00,0x82,0xfe,0x06,0xff,0x00,0x22,0x76,0xc0,0xb9,0x29,0x28,
+		0x68,0xef,0x00,0x1a,0x76,0x7f,0x20,0xb0,0x04,0xfe,0x43,0xff,0x7c,0x42,0x97,0x41,
+		0x96,0x44,0x96,0x43,0xff,0x92,0x44,0x54,0x02,0x63,0x44,0x96,0x42,0x7e,0x00,0x71,
+		0x65,0x44,0x96,0x44,0x92,0x84,0x02,0xd0,0xff,0x1b,0x76,0x42,0x29,0x16,0x56,0x25,
+		0x76,0x03,0x00,0x6f,0x00,0x9f,0x00,0x9f,0x00,0x9f,0x00,0x9f,0x00,0x9f,0x00,0x9f,
+		0xc0,0x00,0x9f,0x00,0x9f,0x00,0x9f,0x00,0x9f,0x00,0x93,0x10,0x11,0x21,0x28,0xf3,
+		0x01,0x00,0x01,0x1f,0x01,0x13,0x05,0x00,0xbd,0xa8,0xff,0xbd,0xa0,0xbd,0xc2,0xbd,
+		0xc3,0xbd,0xab,0xfb,0x69,0xff,0x01,0xf9,0x7f,0x76,0x30,0x88,0xbe,0xff,0x87,0xbe,
+		0xc5,0xbe,0xc4,0xbe,0x83,0xbe,0x7f,0x8a,0x03,0x00,0x17,0x76,0x02,0x76,0x02,0xff,
+		0xd8,0x02,0xff,0x02,0xff,0x02,0xf5,0x04,0xfe,0x03,0x1b,0x1f,0x76,0xbf,0xd4,0x01,
+		0x04,0x18,0xbf,0xff,0x1e,0x51,0x01,0xfe,0x20,0xd0,0x19,0x1a,0x10,0x00,0x08,0x92,
+		0xc3,0x5e,0x00,0xf0,0x02,0x00,0x14,0x96,0x01,0x51,0x09,0x00,0xd4,0x55,0x15,0x00,
+		0xd2,0x0a,0x00,0xd4,0x16,0x00,0xd2,0x0b,0x00,0xd4,0xd5,0x17,0x00,0xd2,0x0c,0x00,
+		0xd4,0x18,0x00,0xd2,0x0d,0x92,0xee,0x00,0xb1,0xc3,0xff,0x19,0x00,0xd0,0x03,0x00,
+		0x0d,0xf7,0x92,0x0f,0xec,0x00,0x71,0x0c,0x28,0xd0,0x07,0xe6,0x00,0x71,0x0a,0x2b,
+		0x01,0x52,0x00,0x50,0x04,0x00,0x01,0xf3,0x2b,0x0c,0x33,0xb0,0x01,0xb0,0x0b,0x08,
+		0xed,0x01,0xe1,0x9a,0x01,0xd2,0x03,0x30,0x01,0x70,0x00,0x50,0x02,0x00,0x02,0xff,
+		0x92,0x1a,0xec,0x02,0x2b,0x43,0x2b,0x43,0xea,0x2b,0x50,0x15,0x2d,0xb6,0x43,0x2d,
+		0xb2,0x40,0x8f,0x00,0xaf,0x08,0xc4,0xa0,0x43,0x2d,0xd0,0x9a,0x2d,0xd4,0x43,0xf5,
+		0x0a,0x02,0x71,0xed,0x37,0x52,0x03,0x92,0x7d,0xec,0xff,0x08,0x0a,0x08,0x92,0x14,
+		0x52,0x79,0xed,0xf7,0x08,0x2b,0x01,0x36,0xb0,0x03,0x00,0x12,0x92,0x7d,0x6a,0x3c,
+		0x30,0x03,0x00,0x14,0x92,0x66,0x00,0x72,0x6f,0x13,0x92,0x62,0xed,0x05,0xb3,0x25,
+		0x65,0x05,0xb1,0xdf,0x9a,0x00,0x43,0x85,0x40,0x32,0xb4,0x43,0x85,0xff,0x01,0x56,
+		0xa5,0x00,0xc5,0x92,0xc4,0x9e,0xff,0xa9,0x85,0x56,0xff,0x02,0x52,0x10,0x65,0xa6,
+		0x05,0x51,0x01,0x2b,0x06,0xf1,0x34,0xd4,0x88,0x07,0xb8,0x7e,0xb6,0x07,0xb3,0xdd,
+		0x62,0x02,0x52,0x92,0x39,0x0e,0xf2,0x19,0x57,0x92,0x01,0x3b,0x00,0xf1,0x07,0x04,
+		0x34,0x08,0x04,0x30,0xac,0x01,0x51,0x01,0x32,0x96,0x01,0x10,0x52,0x18,0x00,0xd2,
+		0x09,0xa8,0x02,0x1a,0x01,0x34,0x02,0x14,0x1b,0x00,0xd2,0x0b,0x02,0x14,0x0c,0xe8,
+		0x02,0x12,0x01,0x34,0x02,0x10,0x04,0x47,0x92,0x01,0x2b,0x01,0xbf,0x92,0x50,0x52,
+		0x04,0x64,0x00,0x1d,0x50,0x03,0x9f,0x2b,0x00,0x92,0x3a,0xec,0x0d,0x73,0x40,0xf7,
+		0x43,0x99,0x01,0x0d,0x9c,0x00,0x50,0xc4,0x00,0x0b,0x53,0x40,0xf1,0x02,0xff,0x00,
+		0x0c,0x0a,0x0c,0x92,0x80,0x52,0x23,0xf9,0x64,0x16,0xdf,0x0e,0x12,0xc4,0xac,0x28,
+		0x19,0x00,0xff,0xa6,0x06,0x45,0xff,0x22,0x56,0xa6,0x07,0xef,0x46,0xff,0xc4,0x1e,
+		0x16,0xd9,0x00,0x2b,0x07,0xff,0x6f,0x7f,0x76,0xae,0x88,0x7f,0x76,0x1a,0x7f,0x89,
+		0x7f,0x76,0x86,0x89,0x84,0xfe,0x28,0x9f,0x08,0x2f,0xbf,0x01,0x1f,0x01,0x17,0x02,
+		0x01,0x1f,0x01,0x1f,0x34,0x3f,0x31,0x36,0x1f,0xd0,0x01,0x2f,0x28,0x80,0x2e,0x10,
+		0x02,0x73,0x2e,0x91,0x76,0x12,0xb0,0x1a,0x40,0x00,0x90,0xd0,0x01,0x05,0x13,0xd0,
+		0xae,0x18,0x70,0x54,0x0f,0x63,0x00,0x71,0x06,0x16,0x52,0x0e,0xae,0x00,0x52,0x0b,
+		0x18,0xfe,0x2c,0x50,0x03,0x14,0xf0,0x7a,0x14,0x15,0x70,0x02,0x97,0x73,0x17,0x52,
+		0x06,0x33,0x32,0x02,0xb0,0x24,0xd2,0xff,0x0b,0x40,0x1e,0xee,0x1f,0x76,0xc3,0x01,
+		0xd7,0x24,0xcc,0x10,0x2e,0x90,0x62,0x1f,0x12,0x01,0x92,0xfd,0x5e,0x25,0x92,0x0e,
+		0x92,0x32,0x52,0x03,0x63,0x97,0x0e,0x2b,0x57,0x2d,0xb2,0x01,0x03,0x75,0x06,0x33,
+		0x1a,0xa7,0x01,0x00,0x4b,0x01,0x70,0x03,0x95,0x3b,0x03,0x94,0x07,0xa5,0xed,0x02,
+		0x77,0x3b,0x03,0x72,0x04,0x51,0x36,0x15,0xf2,0x05,0xbf,0x92,0x32,0xec,0x05,0x2b,
+		0x00,0x59,0x30,0xf2,0xaf,0x89,0x00,0x52,0x10,0x03,0x12,0x02,0x0a,0xb2,0x02,0xe2,
+		0x34,0xd0,0x32,0x33,0x70,0x0a,0xb0,0x36,0xb2,0x19,0x96,0x1d,0xfc,0x0b,0x96,0x01,
+		0xb0,0x94,0xce,0x9c,0x0a,0x96,0x00,0x17,0x02,0x0e,0x1e,0x02,0x3b,0x0b,0x05,0xf3,
+		0x08,0xf2,0x26,0x51,0x90,0x06,0x10,0x07,0xb2,0x0f,0x16,0x37,0xd2,0x0a,0x00,0xb2,
+		0x6b,0x50,0x06,0xff,0x19,0x94,0xa8,0x28,0xc0,0xf9,0x7f,0x76,0xe3,0x08,0x81,0x01,
+		0x11,0x3f,0xf1,0x27,0x30,0x02,0x01,0x56,0xff,0x0e,0x00,0x0e,0xa3,0x00,0x02,0x1f,
+		0x76,0xff,0x0e,0x00,0x1f,0xf6,0x17,0x56,0x26,0x00,0xe7,0x58,0xff,0x0a,0x0f,0xf0,
+		0x03,0x91,0x03,0x63,0x0a,0xff,0x0a,0x04,0x6f,0x00,0x52,0x02,0x65,0x0a,0xa9,0x0b,
+		0x17,0xd1,0x05,0x73,0x18,0x17,0x34,0x07,0x07,0x92,0x11,0x8a,0x17,0x34,0xfd,0x17,
+		0x32,0x00,0x17,0x32,0x02,0x97,0x17,0x33,0x07,0xea,0x11,0x34,0x11,0x17,0x33,0x41,
+		0x17,0x35,0x04,0x00,0xc1,0x2a,0x17,0x34,0x00,0x17,0x34,0x11,0x17,0x32,0x11,0x17,
+		0x34,0x30,0x91,0x46,0x06,0x38,0x1a,0x02,0x17,0x36,0x03,0x91,0x17,0x33,0x00,0x17,
+		0x30,0xd0,0x02,0x77,0x17,0x33,0x04,0x51,0x17,0x33,0x0d,0x17,0x30,0x0d,0x2b,0x39,
+		0x01,0x17,0x3c,0x0a,0xb1,0x02,0x00,0x04,0x17,0x32,0x0a,0xb0,0x02,0x14,0xf2,0x18,
+		0x17,0x32,0x0b,0x93,0x01,0xb0,0x17,0x30,0x70,0x10,0x17,0x34,0x28,0x02,0x37,0x17,
+		0x33,0x08,0xf3,0x00,0x17,0x32,0x0d,0x58,0x34,0x0f,0x14,0x8a,0x15,0x52,0x04,0x17,
+		0x36,0x18,0x17,0x3a,0x56,0x51,0x17,0x33,0x12,0x73,0x00,0x12,0x17,0x3f,0x03,0x92,
+		0x03,0x63,0x04,0x17,0x34,0xe7,0x04,0x0b,0x01,0x02,0x10,0x02,0xf0,0x56,0x10,0x00,
+		0xa9,0x10,0x02,0xdf,0x01,0x90,0x06,0x02,0xd0,0x06,0x02,0xd4,0x06,0x41,0x0b,0x3a,
+		0xdf,0x36,0x5f,0x01,0x1f,0x01,0x1f,0x01,0x17,0x04,0x01,0x1f,0x40,0x01,0x1f,0x01,
+		0x1f,0x01,0x1f,0x01,0x1f,0x01,0x1f,0x01,0x1e,0x08,0x01,0x1f,0x40,0x01,0x1f,0x01,
+		0x1f,0x01,0x1f,0x01,0x1f,0x01,0x1f,0x01,0x1e,0x10,0x01,0x1f,0x40,0x01,0x1f,0x01,
+		0x1f,0x01,0x1f,0x01,0x1f,0x01,0x1f,0x01,0x1e,0x20,0x01,0x1f,0xf0,0x01,0x1f,0x01,
+		0x1f,0x54,0xbf,0x85,0xfa,0x00,0x01,0x1f,0x76,0xff,0xc1,0x01,0x15,0xcc,0x80,0x00,
+		0xc6,0xff,0x7f,0x0a,0xec,0x11,0x18,0xdf,0xff,0x11,0x9d,0x70,0xff,0x1b,0x18,0xff,
+		0xdf,0x1b,0x1a,0x00,0x20,0xcd,0x03,0x5f,0xd0,0x58,0x8a,0x02,0x11,0x00,0xd0,0x40,
+		0x1b,0x38,0x56,0x70,0x25,0x1f,0x04,0xb3,0xc1,0x01,0x1a,0x58,0x52,0x05,0x33,0x64,
+		0x8a,0x3f,0x07,0x3d,0xdd,0x07,0x3f,0x07,0x38,0x51,0x8c,0x02,0x11,0x64,0x07,0x3f,
+		0x07,0x3b,0xdd,0x07,0x3f,0x0f,0x98,0x00,0x01,0x10,0xbd,0xdc,0x01,0x19,0x00,0x9b,
+		0x00,0x9b,0x8f,0xb3,0x10,0x01,0x19,0xbf,0xc2,0x56,0xfd,0xff,0x06,0x00,0x8a,0xf1,
+		0xd0,0xeb,0x01,0x09,0x39,0x90,0xd4,0x00,0x52,0xd0,0x01,0x2c,0xbf,0x2b,0x2d,0x2b,
+		0x2e,0x2b,0x2f,0xc8,0x50,0x30,0x82,0x00,0x30,0x31,0x00,0x30,0x01,0xb1,0x01,0x5f,
+		0x02,0xb1,0x40,0x31,0xd4,0xfb,0x01,0x00,0x0e,0x52,0xd0,0x01,0x04,0x2b,0x01,0xff,
+		0x2b,0x03,0x28,0xc8,0x19,0x15,0x2b,0x15,0xfa,0x0e,0x30,0x15,0x0a,0xf0,0x15,0x1a,
+		0x80,0x00,0x15,0xfe,0xb6,0xb3,0x08,0x15,0x96,0x15,0xcc,0xe3,0xff,0xff,0x08,0x50,
+		0x15,0x96,0x17,0x2b,0x18,0x2b,0xf9,0x19,0x03,0x92,0x00,0x95,0xd0,0x01,0x13,0x28,
+		0xaa,0xff,0x0a,0x11,0x28,0xe0,0x82,0x04,0x28,0x42,0x53,0xd0,0x2c,0x03,0x50,0x0c,
+		0x51,0x24,0x29,0x70,0x23,0x3e,0x70,0xbe,0x01,0xf1,0x08,0x2b,0x05,0x2b,0x07,0x07,
+		0x50,0x08,0xe7,0x28,0x70,0xd8,0x9f,0x32,0x06,0xb2,0x78,0x0f,0x04,0xf7,0x28,0x00,
+		0xd0,0x01,0xbb,0xd0,0x01,0x20,0x2b,0xcf,0x20,0x28,0x00,0x80,0xba,0x91,0x52,0xd1,
+		0x02,0x2b,0xff,0x01,0x28,0xff,0x7c,0x00,0x18,0xff,0x7f,0xaa,0x00,0x30,0xbf,0x00,
+		0x30,0xdf,0x00,0x30,0xef,0x00,0x30,0xf7,0xea,0x00,0x30,0xfb,0xc4,0x10,0x02,0x00,
+		0x30,0x01,0x00,0x18,0x57,0x7f,0xff,0x00,0xa4,0x70,0x00,0x0b,0x90,0x00,0xa4,0x30,
+		0x1b,0x00,0x1a,0xe0,0x00,0x1a,0x04,0x00,0x30,0x81,0x90,0x6e,0xd0,0x5e,0x04,0x91,
+		0x21,0x1a,0x00,0x04,0x00,0x30,0x08,0x00,0x30,0xad,0x10,0x00,0x30,0x20,0x21,0x02,
+		0xf0,0x21,0x03,0x70,0x21,0x14,0x05,0x70,0x01,0xf1,0x06,0x08,0x70,0x05,0x03,0xf0,
+		0x5a,0x32,0x1e,0x90,0x02,0x00,0x71,0x05,0x1b,0x52,0x00,0xf1,0xaa,0x31,0x00,0xf1,
+		0x0d,0xb1,0x00,0xf1,0xa5,0x7f,0x00,0xf2,0x04,0x09,0x70,0x00,0x30,0xbf,0x00,0x30,
+		0xdf,0x6a,0x00,0x30,0xef,0x00,0x30,0xf7,0x00,0x30,0xfb,0x04,0x09,0x70,0xac,0x00,
+		0x30,0x01,0xf0,0x7f,0xff,0xad,0xf1,0x04,0x04,0xf0,0x04,0xab,0x18,0xef,0x00,0x30,
+		0xf7,0x00,0x30,0xfb,0x00,0x30,0xfd,0xfe,0x00,0x30,0xfe,0xff,0x0e,0x2b,0x0d,0x2b,
+		0x0c,0xaa,0x01,0xf0,0x0c,0x01,0xf0,0x0c,0x01,0x30,0x0c,0x01,0x30,0x12,0xaf,0x2b,
+		0x11,0x2b,0x10,0x02,0x30,0x10,0x00,0xf0,0x10,0x4e,0x00,0xf0,0x15,0x2b,0x14,0x06,
+		0x10,0x00,0x30,0xdf,0x00,0x30,0x55,0xef,0x00,0x30,0xf7,0x00,0x30,0xfb,0x00,0x30,
+		0xfd,0x00,0x30,0xab,0xfe,0x14,0x06,0x10,0x14,0x04,0x10,0x14,0x0b,0x90,0x14,0xaa,
+		0x0f,0x90,0x14,0x0f,0x90,0x14,0x0f,0x90,0x14,0x0f,0x90,0x14,0x68,0x0f,0x90,0x1c,
+		0x31,0x0a,0x91,0x34,0x0b,0x14,0x19,0x2b,0xd5,0xb1,0xa5,0x18,0x08,0xb0,0x19,0x00,
+		0x30,0x01,0x11,0x38,0x03,0x50,0x1a,0xfb,0x76,0x69,0x24,0xd0,0x7f,0x76,0xe7,0x8c,
+		0x7f,0xff,0x76,0xd6,0x86,0x7f,0x76,0x02,0x8a,0x7f,0xff,0x8f,0x31,0x8e,0x3f,0x8f,
+		0x50,0x8e,0xa9,0xfb,0xa0,0x41,0x97,0xb0,0xa9,0xa8,0x00,0x8f,0x00,0x5e,0xeb,0x50,
+		0x4f,0x8d,0x40,0x76,0x00,0x71,0x68,0x02,0x30,0x7d,0xad,0x00,0x70,0x32,0x8a,0x7f,
+		0x76,0x35,0x03,0x30,0xff,0x13,0x88,0xa9,0x20,0x7f,0x76,0xe4,0x8c,0x7f,0x30,0x29,
+		0x69,0xff,0x7f,0x76,0x25,0x01,0x10,0xcf,0xd7,0x8c,0xfb,0x6f,0xe1,0x31,0x06,0x11,
+		0x30,0x40,0xab,0x08,0xef,0x37,0x71,0x30,0x0d,0x50,0x41,0x09,0x30,0x05,0xf0,0x68,
+		0x70,0x00,0xd0,0x0a,0x50,0x01,0xd2,0xcc,0x02,0x00,0xc0,0x3b,0xff,0x08,0x6d,0xd0,
+		0xc1,0x01,0x31,0x02,0x12,0x80,0xb0,0x9a,0x02,0x12,0x31,0x02,0x10,0x41,0x92,0xdb,
+		0x51,0x04,0x90,0x96,0xae,0xa0,0xd1,0xac,0x03,0x41,0xa3,0x50,0xa4,0x72,0xf2,0xc4,
+		0xb7,0x92,0x08,0x96,0xe5,0x91,0xa8,0x03,0xa1,0xd2,0x92,0x03,0x05,0x96,0x02,0x91,
+		0x8d,0x57,0x85,0x92,0x31,0x30,0x77,0x15,0x6d,0x52,0xee,0x00,0xf4,0x08,0x00,0xc2,
+		0x00,0xf2,0x03,0x96,0x0e,0x7e,0x16,0xd1,0x2b,0x02,0x28,0x07,0x00,0x0b,0x76,0x90,
+		0x4f,0x04,0x96,0x0f,0x96,0x04,0x31,0xc2,0x93,0x0a,0x19,0xd0,0xff,0x7f,0x76,0xb7,
+		0x87,0x7f,0x76,0xdc,0x87,0x4e,0x0b,0x13,0x01,0x00,0x31,0x24,0xd2,0xe5,0x31,0x08,
+		0x00,0x30,0x79,0x10,0x02,0xb2,0x03,0xd1,0x04,0x2b,0x0f,0x2b,0x0a,0x71,0xfa,0x02,
+		0xf1,0x41,0x76,0xf2,0x08,0x92,0x41,0x54,0x59,0xef,0xed,0x1b,0x0a,0x09,0x76,0x30,
+		0x10,0x0a,0x0b,0xd3,0x42,0x16,0x83,0x74,0x07,0xb1,0x56,0x7c,0xb2,0x03,0x92,0xf7,
+		0x52,0xed,0x10,0x83,0x32,0x10,0x2b,0x4d,0x6f,0x2d,0x03,0x02,0x71,0x2b,0x0b,0x0f,
+		0x30,0x47,0x82,0x74,0x02,0x91,0x6d,0x31,0x02,0x94,0x05,0xed,0x01,0xf3,0x39,0x6f,
+		0x03,0x11,0xff,0x36,0x64,0x15,0x92,0x34,0xec,0x15,0x2b,0x95,0x02,0x81,0xb4,0x0d,
+		0x81,0xb4,0xfb,0x81,0xb2,0xa4,0xf3,0x1b,0x4f,0x28,0x32,0x00,0x22,0x7f,0x12,0xba,
+		0xb3,0x06,0x81,0x50,0x59,0x06,0x81,0x50,0x00,0xb1,0x10,0x1e,0x02,0x15,0x11,0x02,
+		0x12,0xdf,0x10,0x2b,0x03,0x2b,0x15,0x05,0xf0,0x0a,0x6f,0x7d,0x05,0x0b,0x50,0x07,
+		0xed,0x1b,0x0b,0x09,0x11,0x50,0x35,0x0b,0x04,0xf0,0x03,0x82,0x72,0x06,0x92,0x80,
+		0xf1,0x03,0x32,0x6e,0x81,0x3a,0x1a,0x96,0x41,0xff,0xf0,0xdc,0x87,0x17,0x91,0xc3,
+		0x06,0xfe,0xd3,0xb2,0x8d,0x10,0x1d,0x53,0x17,0x31,0x08,0xed,0xdf,0x00,0x02,0x46,
+		0x1e,0x44,0x06,0xd2,0x12,0x2b,0xff,0x54,0x6f,0x20,0xcc,0x00,0x04,0xc9,0xff,0x9b,
+		0x0d,0xec,0xc9,0x53,0x15,0x85,0x01,0x72,0x04,0x90,0x02,0x7f,0x00,0x22,0x03,0x42,
+		0x1e,0x0c,0x6f,0x01,0x71,0xe8,0x01,0x10,0x01,0x70,0x2b,0xd0,0xae,0x00,0x51,0x20,
+		0x07,0x42,0xbb,0x1e,0x42,0x07,0x92,0x01,0x56,0x1e,0x89,0x50,0x00,0xff,0xfa,0xa9,
+		0xa8,0x1e,0x0f,0x03,0x63,0x1e,0xff,0xa8,0x0a,0x6f,0x29,0xff,0x83,0xff,0x1e,0xef,
+		0x0f,0x06,0x65,0xaa,0x43,0xd0,0xab,0x28,0x00,0xff,0x06,0x1e,0xa9,0x1e,0x06,0x30,
+		0xff,0x46,0xff,0x1e,0x6c,0xff,0x42,0x06,0x46,0xa3,0x31,0xff,0xff,0xac,0x10,0x44,
+		0x1e,0x44,0x06,0x06,0xb8,0x9e,0xf0,0x3f,0xd3,0x25,0x51,0xc3,0x01,0x22,0x00,0x90,
+		0x44,0xf6,0xcc,0x90,0xa9,0x85,0x01,0xd1,0x04,0x63,0x00,0x02,0xff,0x44,0x1e,0x07,
+		0x6f,0x00,0x8f,0x78,0x0f,0xff,0xa9,0xa8,0x44,0x0f,0x02,0x63,0x44,0xa8,0x7d,0x44,
+		0x12,0xf0,0xd0,0x01,0x17,0x96,0x86,0xea,0xd0,0xb4,0x0d,0x7f,0x0d,0x7d,0x14,0x0d,
+		0x73,0x08,0xca,0x0d,0x76,0x17,0xaa,0x0d,0x72,0x14,0x0d,0x72,0x26,0x0d,0x78,0x14,
+		0x0d,0x72,0x16,0xaa,0x0d,0x72,0x24,0x0d,0x78,0x1c,0x0d,0x74,0x1c,0x0d,0x70,0x1c,
+		0x3a,0x0d,0x74,0x1c,0x0d,0x78,0x1c,0xa9,0x1c,0x0d,0x7f,0x0d,0x77,0x25,0x08,0x0d,
+		0x76,0x08,0x0d,0x7f,0x0d,0x7f,0x18,0x0d,0x7f,0x0d,0x7f,0xac,0xe9,0xb1,0x0d,0x73,
+		0x10,0xcb,0x0d,0x76,0x19,0x0d,0x72,0x13,0xaa,0x0d,0x72,0x2a,0x0d,0x78,0x13,0x0d,
+		0x72,0x18,0x0d,0x72,0x28,0xa8,0x0d,0x78,0x58,0xb0,0x0d,0x72,0x20,0x0d,0x70,0x20,
+		0x0d,0x74,0x20,0x4e,0x0d,0x78,0x20,0xa9,0x20,0x0d,0x7f,0x0d,0x77,0x10,0x0d,0x76,
+		0x89,0x10,0x0d,0x7f,0x0d,0x7f,0x19,0x0d,0x74,0x42,0xb1,0x07,0xf1,0x04,0xff,0x92,
+		0x08,0xec,0x41,0x2d,0x01,0x9a,0x66,0xff,0xff,0x02,0xce,0x03,0xec,0x01,0x9a,0x02,
+		0xd7,0x6f,0x00,0x9a,0x2a,0x71,0x30,0x0b,0x30,0x33,0x00,0xf5,0x20,0x55,0x90,0x22,
+		0x4f,0x50,0x40,0x8f,0xa6,0x02,0xde,0x0a,0x50,0x0d,0x28,0xff,0x01,0x4f,0xf0,0x4f,
+		0x8d,0xf9,0x1a,0x67,0x50,0x3d,0xd0,0x2b,0x24,0x2b,0x26,0x2b,0xdf,0x28,0x2b,0x2a,
+		0x2b,0x2c,0x73,0x70,0x30,0x2b,0xff,0x32,0x2b,0x34,0x2b,0x36,0x2b,0x38,0x2b,0xff,
+		0x23,0x2b,0x25,0x2b,0x27,0x2b,0x29,0x2b,0xfd,0x2b,0x74,0xf0,0x2f,0x2b,0x31,0x2b,
+		0x33,0x2b,0x7f,0x35,0x2b,0x37,0x2b,0x39,0x2b,0x21,0x0d,0x10,0xd1,0x20,0x41,0x90,
+		0x07,0xf1,0x42,0x91,0x10,0x41,0x10,0x11,0x28,0xf9,0x43,0x58,0x12,0x58,0x91,0x12,
+		0x2b,0x13,0x28,0x0a,0xff,0x00,0x1a,0x28,0x50,0xc0,0x1b,0x28,0x70,0x17,0x40,0x1c,
+		0x2b,0x84,0x51,0x1a,0x68,0x30,0x84,0x51,0x06,0xf1,0xb5,0x32,0x02,0x70,0x32,0x02,
+		0x70,0x23,0x76,0x78,0xb1,0x04,0xf0,0x44,0xd0,0xd8,0x91,0x0c,0xb1,0x8d,0x12,0xcc,
+		0x00,0x1f,0xc7,0x7b,0xff,0x42,0x50,0x10,0x41,0x2b,0x09,0x6f,0x4f,0x31,0xfd,0xc0,
+		0xf1,0x12,0x17,0xc6,0xc4,0x96,0x41,0x0a,0x85,0x42,0x3b,0x10,0xf6,0xff,0x50,0x03,
+		0x50,0x03,0x30,0x0e,0x11,0xbd,0xaf,0xb2,0x04,0xfe,0x41,0xbd,0x92,0x07,0xc6,0x10,
+		0x3c,0xff,0x52,0xc0,0x56,0xad,0x00,0x0f,0x92,0x3e,0xfa,0x00,0x70,0xa9,0x83,0x10,
+		0x44,0x96,0x0f,0x52,0x0d,0xee,0xf5,0xb2,0xc0,0x01,0x44,0x54,0xd2,0x41,0x9a,0xc4,
+		0xff,0x74,0x44,0x0a,0x44,0x92,0x0f,0x52,0xf5,0xff,0x64,0x41,0x92,0x01,0x9c,0xa9,
+		0x58,0x40,0xfe,0x01,0xb0,0x41,0x59,0x03,0x56,0x95,0x04,0x41,0xdf,0x93,0x02,0x9d,
+		0xa8,0x58,0x02,0xb1,0x9c,0xca,0xff,0xa9,0x88,0x03,0x56,0x94,0x08,0xa9,0x93,0x7f,
+		0xa6,0xcb,0xa8,0x80,0x41,0x93,0x03,0x01,0x70,0xfe,0x00,0xf0,0x0c,0xa7,0xca,0x42,
+		0x96,0x41,0x08,0xff,0x04,0x00,0x42,0x92,0x5c,0xff,0xa9,0x93,0xef,0xde,0xff,0xa9,
+		0x95,0x17,0xd1,0xb0,0xff,0x12,0x09,0x97,0x04,0xb3,0x04,0x52,0x59,0x04,0x73,0x04,
+		0x3f,0x04,0x3f,0x04,0x39,0x21,0x13,0x04,0x3f,0x04,0x3f,0x04,0x3f,0x04,0x3a,0x14,
+		0x04,0x34,0x0c,0xf3,0x5f,0x9c,0xca,0x43,0x96,0x43,0x68,0xf2,0x03,0x11,0x30,0x7f,
+		0x07,0xed,0x7f,0x76,0xf1,0x87,0x04,0x50,0x32,0x9f,0x0f,0x2b,0x43,0x41,0x06,0x01,
+		0x70,0x27,0xb1,0x40,0xfc,0x68,0x12,0x27,0xb1,0x40,0x00,0x43,0x42,0x04,0xef,0xdd,
+		0x21,0x74,0x50,0x03,0x6f,0x22,0x00,0x50,0x43,0x43,0xf6,0x00,0xd1,0x00,0x40,0x00,
+		0xd1,0x00,0x40,0x84,0xfe,0xfb,0xbe,0x8b,0x27,0x12,0x2b,0x41,0x92,0x10,0x52,0xed,
+		0x0f,0x15,0x52,0x40,0x02,0x6a,0x35,0xc1,0x01,0xc4,0xb3,0x92,0x19,0x1a,0x10,0x01,
+		0xb1,0xf3,0x64,0x19,0x91,0x08,0xff,0xfe,0x46,0xa0,0x44,0xa8,0x41,0x96,0x46,0xff,
+		0x8a,0xc4,0x92,0x47,0x96,0x01,0x9b,0xa9,0xff,0x95,0x47,0x97,0x44,0x8a,0x01,0x3b,
+		0xa9,0xfe,0x18,0x73,0x92,0xc4,0x96,0x47,0x92,0x14,0x52,0xbf,0x02,0xed,0x47,0x2b,
+		0x47,0x92,0x02,0x30,0x96,0xdd,0x88,0x55,0x72,0x42,0xa8,0x42,0x02,0xf0,0x43,0x96,
+		0xbe,0x00,0x51,0x44,0x96,0x46,0x2b,0x46,0x02,0x30,0x16,0xeb,0x63,0x42,0x03,0x70,
+		0x46,0x03,0x72,0xc4,0x92,0x45,0xff,0x96,0x43,0x92,0x45,0x54,0x03,0x65,0x45,0x5a,
+		0x02,0x50,0x44,0x00,0x91,0x63,0x45,0x02,0x91,0x0a,0x02,0x91,0xff,0xec,0x64,0x00,
+		0x9a,0x44,0x93,0x43,0x9f,0x7f,0x02,0x53,0x02,0x62,0x01,0x9a,0x86,0x05,0x10,0xea,
+		0x21,0xd3,0x42,0x5d,0x90,0x09,0xea,0x50,0x3c,0x00,0x01,0xfa,0x0f,0xf2,0x16,0x13,
+		0x70,0x43,0x96,0x41,0x58,0x41,0xfb,0x0a,0x43,0x5e,0xd1,0x02,0x0f,0x90,0x41,0x9c,
+		0xad,0x94,0x00,0xf4,0xa3,0xff,0x00,0xd9,0xa7,0x00,0xda,0xab,0x84,0x00,0xd4,0x04,
+		0x53,0x1a,0x04,0x58,0x04,0x1f,0x04,0x1f,0x04,0x1f,0x17,0xe0,0x04,0x1f,0x04,0x1f,
+		0x04,0x1f,0x00,0xd2,0x30,0x51,0x08,0x92,0x42,0xbe,0x3f,0xf2,0x02,0x40,0x03,0xee,
+		0x42,0x7a,0x10,0x02,0xbd,0x41,0x00,0x71,0x40,0x00,0x02,0x42,0x00,0x71,0x20,0x71,
+		0x00,0x03,0x11,0x33,0x30,0x03,0xb4,0x94,0x28,0x41,0x01,0x10,0x37,0x94,0x28,0x3e,
+		0x3f,0xd0,0x2b,0x8b,0xc1,0xd2,0x36,0xd2,0xff,0xfb,0xed,0x14,0xcc,0x40,0x00,0xc5,
+		0xff,0x5d,0xfd,0x75,0x90,0xc3,0x01,0x35,0x1f,0x90,0x32,0xb7,0x70,0xe5,0x36,0x00,
+		0x70,0x84,0x46,0x52,0x36,0xf2,0x92,0x0c,0xec,0x17,0x7f,0x76,0x73,0x90,0x30,0x83,
+		0x03,0x90,0x3b,0x51,0x07,0x71,0xd4,0xf5,0x31,0x01,0xf1,0xdd,0x40,0x54,0x41,0x40,
+		0x13,0x28,0x06,0x2f,0x00,0x13,0x28,0xb6,0x40,0x34,0x61,0x40,0x3f,0x3f,0xf0,0xe1,
+		0x04,0x3f,0x14,0xc4,0xf0,0x3f,0x14,0x18,0x70,0x01,0x41,0x2b,0xde,0x7a,0x31,0x04,
+		0x00,0x02,0x58,0x01,0x91,0x17,0xc6,0xfe,0x0e,0x53,0x02,0x0a,0x64,0x9b,0x02,0x92,
+		0xff,0x2f,0x00,0x74,0x8d,0x02,0x40,0x34,0xee,0x40,0x32,0x86,0xd1,0xfe,0x93,0x15,
+		0x20,0x52,0x03,0xed,0x00,0x9a,0x06,0xff,0x6f,0x39,0x52,0x03,0x69,0xc9,0x9c,0x02,
+		0xa7,0x6f,0xd0,0x9c,0x01,0x93,0x24,0xf1,0xcc,0x7b,0x70,0x75,0xbf,0x8c,0x42,0x8a,
+		0xa9,0x88,0xc4,0x00,0x92,0x03,0xdf,0x56,0xa9,0x04,0xa6,0x94,0x01,0xf3,0x2b,0x6f,
+		0xfd,0x03,0x3f,0x10,0x40,0x01,0x94,0x92,0x41,0x96,0xbf,0x03,0x0a,0x03,0x92,0x64,
+		0x9b,0x06,0x71,0x03,0xef,0x96,0x19,0x6f,0x07,0x05,0xd0,0x00,0x2b,0x1b,0xff,0x6f,
+		0x07,0x92,0x19,0xec,0x07,0x2b,0x06,0xfa,0x00,0xd0,0x15,0x00,0xb0,0x13,0xec,0x00,
+		0x58,0x41,0xfe,0x23,0x30,0x0a,0x01,0x94,0x96,0x00,0x0a,0x14,0xfb,0x9b,0x00,0x09,
+		0x72,0x00,0x96,0x07,0x6f,0x41,0xff,0x92,0x0a,0x52,0xe6,0xec,0x0d,0x52,0xe8,0xfb,
+		0xec,0xed,0x0c,0x33,0x92,0x03,0x54,0x03,0xec,0xaf,0x06,0x92,0xd0,0xec,0x06,0x91,
+		0x09,0x5c,0x50,0x0b,0xff,0x01,0x7f,0x76,0x82,0x8c,0x08,0x96,0x0a,0xfa,0x9b,0xf0,
+		0x07,0x02,0x32,0x0a,0x92,0xbf,0x9c,0x01,0xf7,0x52,0xf3,0x69,0x16,0x33,0x09,0x92,
+		0x09,0xec,0x7d,0x09,0x98,0x50,0x92,0x8c,0x06,0x92,0x04,0x16,0xd0,0xf7,0xc7,0x8c,
+		0x06,0x96,0x70,0xbd,0x96,0x12,0x76,0x1c,0x0a,0x91,0xc2,0x31,0x22,0x00,0x06,0xcc,
+		0x10,0xc4,0x10,0x02,0xf0,0x57,0xff,0xfd,0x38,0x1f,0xd0,0x39,0x00,0x30,0x3a,0x00,
+		0x30,0x55,0x3b,0x00,0x30,0x3c,0x00,0x30,0x3d,0x00,0x30,0x3e,0x00,0x30,0xfd,0x3f,
+		0x21,0x92,0xc0,0x01,0x29,0x28,0xe8,0x00,0xe7,0x22,0x28,0x02,0xfb,0x72,0x3b,0x90,
+		0x1b,0x00,0x04,0xc7,0x07,0x67,0xff,0x1d,0xd0,0x3a,0x90,0x00,0xb0,0xfb,0x68,0x3e,
+		0x02,0x31,0x1a,0x2b,0x1b,0x2b,0x1c,0x3e,0x10,0x00,0x30,0xd5,0x10,0x00,0x30,0x08,
+		0x00,0x30,0x04,0x00,0x30,0x01,0x1c,0xea,0x9f,0x70,0x1c,0x1c,0xf0,0x1c,0x5b,0x10,
+		0x1e,0x28,0xfc,0x3f,0x00,0x1f,0x2b,0x1a,0x76,0x82,0x21,0x12,0x63,0xd1,0xff,0x06,
+		0x00,0x00,0x52,0xa4,0xc5,0x07,0xec,0xff,0xff,0x9c,0xa9,0x88,0x85,0x92,0x87,0x96,
+		0x87,0x0e,0x00,0xfe,0x01,0x90,0x01,0x3f,0x01,0x3f,0x01,0x31,0x5a,0x7f,0xff,0xa4,
+		0xc5,0xa4,0x8e,0xab,0x92,0x01,0x7b,0xff,0xab,0x92,0xa9,0x88,0xa9,0xa9,0xa6,0x0f,
+		0xff,0x0f,0xec,0xaa,0x93,0x0d,0xec,0xff,0x9d,0x3f,0xa8,0x5c,0xbf,0x76,0xfe,0xff,
+		0x01,0xd5,0x00,0x71,0xff,0x0c,0x00,0xf8,0xff,0xa0,0x8a,0x06,0x00,0xff,0xa6,0x97,
+		0x00,0x9b,0x0f,0xf6,0xa6,0x1f,0xfb,0x20,0x76,0x00,0x95,0xa8,0x92,0x20,0x76,0xb7,
+		0xff,0x00,0x3f,0x00,0x7a,0x8d,0xff,0xff,0x00,0x86,0x00,0x02,0xfe,0xff,0xd1,0x10,
+		0x00,0x94,0xd1,0xf0,0x00,0x94,0xac,0xae,0x00,0x50,0x90,0x80,0x3f,0x00,0x90,0xae,
+		0x00,0x94,0xff,0xbb,0xff,0x80,0x01,0xb2,0xff,0xff,0x81,0x00,0x74,0x82,0xaa,0x00,
+		0x50,0x01,0x00,0x70,0x83,0x00,0x74,0x84,0x01,0x74,0x85,0xaa,0x00,0xf4,0x86,0x00,
+		0xf4,0x87,0x00,0x74,0x88,0x00,0x74,0x89,0xaa,0x00,0x74,0x8a,0x00,0x74,0x8b,0x00,
+		0x74,0x8c,0x00,0x74,0x8d,0xae,0x03,0xf2,0xfe,0xff,0x8e,0x08,0xd6,0x90,0x00,0x96,
+		0x92,0xae,0x00,0x94,0xff,0xff,0xd2,0x00,0x74,0xd3,0x00,0x74,0xd4,0xaa,0x00,0x74,
+		0xd5,0x07,0xd4,0xd6,0x00,0xf4,0xd7,0x00,0x74,0xd8,0xaa,0x00,0x74,0xd9,0x00,0x74,
+		0xda,0x00,0x74,0xdb,0x05,0x94,0xdc,0x8a,0x06,0x36,0xde,0x00,0x96,0xe0,0x06,0xd6,
+		0x05,0x20,0x00,0x72,0x02,0xaa,0x00,0x74,0x03,0x00,0x74,0x05,0x00,0x74,0x06,0x00,
+		0x74,0x07,0xea,0x00,0x74,0x08,0x00,0x74,0x09,0x00,0x72,0x00,0x00,0x0a,0x7e,0x00,
+		0x70,0xa6,0x02,0x57,0x86,0x3f,0x00,0x00,0x3f,0x7c,0x00,0x3f,0x00,0x39,0x18,0x81,
+		0x3f,0x00,0x1d,0x00,0x30,0x55,0x22,0x00,0x30,0x27,0x00,0x30,0x2c,0x00,0x30,0x31,
+		0x00,0x30,0x55,0x36,0x00,0x30,0x3b,0x00,0x30,0x40,0x00,0x30,0x45,0x00,0x30,0x55,
+		0x4a,0x00,0x30,0x4f,0x00,0x30,0x54,0x00,0x30,0x59,0x00,0x30,0x55,0x5e,0x00,0x30,
+		0x63,0x00,0x30,0x68,0x00,0x30,0x6d,0x00,0x30,0x55,0x72,0x00,0x30,0x77,0x00,0x30,
+		0x80,0x00,0x30,0x5c,0x05,0x70,0xd5,0x89,0x00,0x70,0xa1,0x00,0x30,0xb9,0x00,0x30,
+		0xfe,0x82,0x7f,0x3f,0x00,0x07,0x83,0x3f,0x00,0x10,0x00,0x30,0xd5,0x19,0x00,0x30,
+		0x22,0x00,0x30,0x2b,0x00,0x30,0xd5,0x84,0x97,0x3f,0x00,0xde,0x00,0x30,0xe7,0x00,
+		0x30,0x03,0x31,0xf0,0xfa,0x00,0x70,0xf9,0x00,0x30,0x02,0x85,0x3f,0x00,0x0b,0x2a,
+		0x00,0x30,0x14,0x00,0x30,0x1d,0x00,0x30,0x26,0x00,0x30,0x01,0xf1,0x55,0x2f,0x00,
+		0x70,0x38,0x00,0x30,0x41,0x00,0x30,0x4a,0x00,0x30,0xa9,0x53,0x01,0x71,0x00,0x30,
+		0x65,0x01,0xf4,0x6e,0x00,0x70,0x77,0xaa,0x00,0x30,0x80,0x00,0x30,0x89,0x00,0x30,
+		0x92,0x00,0x30,0x9b,0x2a,0x00,0x30,0xa4,0x01,0xf4,0xad,0x00,0x70,0xb6,0x00,0xb4,
+		0x00,0x31,0x05,0xbf,0x00,0xb0,0xc8,0x00,0xf8,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,
+		0x37,0xa5,0xd1,0x04,0xb0,0xfe,0x0b,0xb1,0x00,0xb0,0x38,0x00,0x30,0x45,0x02,0x00,
+		0x30,0x4e,0x02,0x7f,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x3f,0x00,0x3e,0x81,0x64,
+		0x20,0x90,0x36,0xd1,0xb0,0xb0,0x00,0x10,0xe7,0xd0,0x00,0xd0,0x02,0xbc,0x38,0xd0,
+		0xf4,0x10,0x00,0x01,0x81,0x1f,0x00,0x90,0x31,0x3d,0x8e,0x4c,0x11,0x2a,0x00,0x02,
+		0x1a,0xde,0x30,0x45,0xd0,0xdf,0x04,0x1a,0xff,0x00,0x05,0x00,0x30,0x06,0xcc,0xff,
+		0xf0,0xff,0x05,0x50,0x06,0x96,0x06,0xcc,0xff,0xff,0xf0,0xa9,0x1a,0x00,0x05,0x06,
+		0x96,0x77,0x07,0xcc,0xe0,0x01,0x10,0x07,0x96,0x00,0x47,0x70,0x67,0x1a,0x76,0x0c,
+		0x4a,0xd0,0x47,0x31,0x00,0x00,
+	};
+
+	const FalconFirmwareImage FalconFirmwareImages::IMAGES[] = {
+		{"nvent", "Firmware from the latest nVent software release (recommended)", 8492, 5065, 0x0363acfcu, IMAGE_DATA_0},
+		{"test", "Novint test firmware", 7324, 4284, 0x6e9b1d39u, IMAGE_DATA_1},
+		{"novint_T0", "Firmware from the Novint SDK, T0 revision", 7914, 4599, 0x163eb686u, IMAGE_DATA_2},
+		{"novint_T2", "Firmware from the Novint SDK, T2 revision", 7914, 4598, 0xdc37f4a2u, IMAGE_DATA_3}
+	};
+
+	const unsigned int FalconFirmwareImages::IMAGE_COUNT = 4;
+}
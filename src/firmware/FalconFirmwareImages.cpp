@@ -0,0 +1,92 @@
+/***
+ * @file FalconFirmwareImages.cpp
+ * @brief Registry of the firmware images built into the library
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#include "falcon/firmware/FalconFirmwareImages.h"
+
+namespace libnifalcon
+{
+	const char* const FalconFirmwareImages::DEFAULT_IMAGE = "nvent";
+
+	//Bitwise CRC32 (IEEE, as used by zlib). Only run once per decode, so no table.
+	static uint32_t crc32(const uint8_t* data, unsigned int size)
+	{
+		uint32_t crc = 0xffffffff;
+		for(unsigned int i = 0; i < size; ++i)
+		{
+			crc ^= data[i];
+			for(int j = 0; j < 8; ++j)
+			{
+				crc = (crc >> 1) ^ (0xedb88320 & (0 - (crc & 1)));
+			}
+		}
+		return ~crc;
+	}
+
+	const FalconFirmwareImage* FalconFirmwareImages::getImage(unsigned int index)
+	{
+		if(index >= IMAGE_COUNT)
+		{
+			return NULL;
+		}
+		return &IMAGES[index];
+	}
+
+	const FalconFirmwareImage* FalconFirmwareImages::findImage(const std::string& name)
+	{
+		for(unsigned int i = 0; i < IMAGE_COUNT; ++i)
+		{
+			if(name == IMAGES[i].name)
+			{
+				return &IMAGES[i];
+			}
+		}
+		return NULL;
+	}
+
+	//See util/firmware2cpp.py for the stream format
+	bool FalconFirmwareImages::decode(const FalconFirmwareImage& image, std::vector<uint8_t>& buffer)
+	{
+		buffer.resize(image.size);
+		const uint8_t* in = image.data;
+		const uint8_t* in_end = image.data + image.compressedSize;
+		unsigned int out = 0;
+		while(out < image.size && in < in_end)
+		{
+			uint8_t flags = *in++;
+			for(int bit = 0; bit < 8 && out < image.size && in < in_end; ++bit)
+			{
+				if(flags & (1 << bit))
+				{
+					buffer[out++] = *in++;
+					continue;
+				}
+				if(in_end - in < 2)
+				{
+					return false;
+				}
+				unsigned int value = (in[0] << 8) | in[1];
+				in += 2;
+				unsigned int distance = (value >> 4) + 1;
+				unsigned int length = (value & 0xf) + 3;
+				if(distance > out || length > image.size - out)
+				{
+					return false;
+				}
+				//Copies can overlap their own output, so go a byte at a time
+				for(unsigned int i = 0; i < length; ++i, ++out)
+				{
+					buffer[out] = buffer[out - distance];
+				}
+			}
+		}
+		return out == image.size && crc32(buffer.data(), image.size) == image.crc;
+	}
+}
@@ -20,6 +20,7 @@ namespace libnifalcon
 	FalconFirmwareNovintSDK::FalconFirmwareNovintSDK() :
 		m_currentOutputIndex(0),
 		m_rawDataSize(0),
+		m_resyncCount(0),
 		INIT_LOGGER("FalconFirmwareNovintSDK")
 	{
 		//Make sure we're pretty much always safe to print these
@@ -40,7 +41,19 @@ namespace libnifalcon
     bool FalconFirmwareNovintSDK::formatOutput()
     {
         uint8_t* data(m_rawData + m_currentOutputIndex);
-        if (data[0] == '<' && data[15] == '>')
+        if (data[0] != '<' || data[15] != '>')
+        {
+            return false;
+        }
+        //Every decoded byte is a nibble offset by 0x41, except the status byte,
+        //which carries 3 homing bits on top of the grip nibble
+        uint8_t invalid = 0;
+        for(int i(1); i < 13; ++i)
+        {
+            invalid |= ((uint8_t)(data[i] - 0x41) > 0xf);
+        }
+        invalid |= ((uint8_t)(data[13] - 0x41) > 0x7f);
+        if(!invalid)
         {
             memcpy(m_rawOutput, data, 16);
             //Turn motor values into system specific ints
@@ -60,16 +73,28 @@ namespace libnifalcon
             //Shift value down a nibble for homing status
             m_homingStatus = ((m_rawOutput[13] - 0x41) >> 4) & 7;
             m_gripInfo = (m_rawOutput[13] - 0x41) & 0x0f;
+            m_lastPacketTimestamp = m_falconComm->getLastReadTimestamp();
             
             ++m_outputCount;
             return true;
         }
-        else
-        {
-            LOG_WARN("Clearing malformed packet!");
-            return false;
-        }
+        return false;
     }
+
+	void FalconFirmwareNovintSDK::resync(bool skip_current)
+	{
+		//'<' can't show up inside a valid payload, so the next one is the next possible packet start
+		unsigned int start = m_currentOutputIndex + (skip_current ? 1 : 0);
+		uint8_t* next = (start < m_rawDataSize) ? (uint8_t*)memchr(m_rawData + start, '<', m_rawDataSize - start) : nullptr;
+		unsigned int next_index = (next != nullptr) ? (unsigned int)(next - m_rawData) : m_rawDataSize;
+		if(next_index == m_currentOutputIndex)
+		{
+			return;
+		}
+		LOG_WARN("Resynchronizing packet stream, dropping " << (next_index - m_currentOutputIndex) << " bytes");
+		++m_resyncCount;
+		m_currentOutputIndex = next_index;
+	}
     
 	void FalconFirmwareNovintSDK::formatInput()
 	{
@@ -113,6 +138,10 @@ namespace libnifalcon
 		if(m_hasWritten && m_falconComm->hasBytesAvailable())
 		{
 			uint32_t bytes( m_falconComm->getBytesAvailable() );
+			if(bytes > sizeof(m_rawData) - m_rawDataSize)
+			{
+				bytes = sizeof(m_rawData) - m_rawDataSize;
+			}
             if(bytes == 0)
             {
                 //We somehow just got modem bytes back. Kick out another read.
@@ -123,17 +152,40 @@ namespace libnifalcon
             {
                 m_rawDataSize += m_falconComm->getLastBytesRead();
                 m_currentOutputIndex = 0;
+                unsigned int dropped = 0;
                 while (m_currentOutputIndex+16 <= m_rawDataSize)
                 {
-                    read_successful = formatOutput();
+                    //Aligned, well formed packets are parsed in place
+                    if(formatOutput())
+                    {
+                        read_successful = true;
+                        m_hasWritten = false;
+                        ++m_loopCount;
+                        m_currentOutputIndex += 16;
+                        continue;
+                    }
+                    //Otherwise skip ahead to the next start marker and try again from there
+                    unsigned int index = m_currentOutputIndex;
+                    resync(true);
+                    dropped += m_currentOutputIndex - index;
+                }
+                //Don't hold on to a tail that can't be the start of a packet
+                if(m_currentOutputIndex < m_rawDataSize && m_rawData[m_currentOutputIndex] != '<')
+                {
+                    unsigned int index = m_currentOutputIndex;
+                    resync(false);
+                    dropped += m_currentOutputIndex - index;
+                }
+                //The falcon only answers writes, so if the reply to our last write was mangled, don't
+                //wait on it. Anything left of it is cleared out by the framer once the next reply lands.
+                if(dropped > 0)
+                {
                     m_hasWritten = false;
-                    ++m_loopCount;
-                    m_currentOutputIndex += 16;
                 }
                 
                 // Preserve the unprocessed tail of the data for the next cycle
                 m_rawDataSize -= m_currentOutputIndex;
-                if (m_rawDataSize > 0) memcpy(m_rawData, m_rawData + m_currentOutputIndex, m_rawDataSize);
+                if (m_rawDataSize > 0) memmove(m_rawData, m_rawData + m_currentOutputIndex, m_rawDataSize);
             }
             else
             {
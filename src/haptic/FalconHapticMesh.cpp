@@ -0,0 +1,217 @@
+/***
+ * @file FalconHapticMesh.cpp
+ * @brief God-object renderer for triangle mesh scenes
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#include "falcon/haptic/FalconHapticMesh.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "falcon/gmtl/Generate.h"
+#include "falcon/gmtl/PlaneOps.h"
+#include "falcon/gmtl/VecOps.h"
+
+namespace libnifalcon
+{
+	const unsigned int FalconHapticMesh::MAX_CONSTRAINTS;
+	const unsigned int FalconHapticMesh::MAX_ITERATIONS;
+
+	//Constraint planes closer to each other than this are treated as the same plane
+	static const double PLANE_EPSILON = 1e-9;
+
+	FalconHapticMesh::FalconHapticMesh() :
+		m_constraintCount(0),
+		m_hasProxy(false),
+		m_stiffness(1000.0),
+		m_damping(0.0),
+		m_maxForce(0.0),
+		m_surfaceOffset(1e-5)
+	{
+	}
+
+	void FalconHapticMesh::setMesh(std::shared_ptr<const FalconMeshBVH> mesh)
+	{
+		m_meshes.getWriteBuffer() = mesh;
+		m_meshes.publish();
+		//Whatever comes back is no longer visible to the I/O thread, so release it here
+		m_meshes.getWriteBuffer().reset();
+	}
+
+	std::array<double, 3> FalconHapticMesh::getProxyPosition() const
+	{
+		std::array<double, 3> proxy = {{m_proxy[0], m_proxy[1], m_proxy[2]}};
+		return proxy;
+	}
+
+	void FalconHapticMesh::reset()
+	{
+		m_hasProxy = false;
+		m_constraintCount = 0;
+	}
+
+	bool FalconHapticMesh::isFree(const gmtl::Point3d& point) const
+	{
+		for(unsigned int i = 0; i < m_constraintCount; ++i)
+		{
+			if(gmtl::distance(m_constraints[i], point) < -PLANE_EPSILON)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool FalconHapticMesh::solveGoal(const gmtl::Point3d& target, gmtl::Point3d& goal) const
+	{
+		//Closest free point lies on some subset of the planes. With at most 3 of them, trying the
+		//target, each plane, each pair and the triple, and keeping the closest free one, is cheap.
+		double best = std::numeric_limits<double>::max();
+		bool found = false;
+		gmtl::Point3d candidate;
+
+		if(isFree(target))
+		{
+			goal = target;
+			return true;
+		}
+		for(unsigned int i = 0; i < m_constraintCount; ++i)
+		{
+			const gmtl::Planed& a = m_constraints[i];
+			candidate = target - a.getNormal() * gmtl::distance(a, target);
+			double d = gmtl::lengthSquared(gmtl::Vec3d(candidate - target));
+			if(d < best && isFree(candidate))
+			{
+				best = d;
+				goal = candidate;
+				found = true;
+			}
+			for(unsigned int j = i + 1; j < m_constraintCount; ++j)
+			{
+				const gmtl::Planed& b = m_constraints[j];
+				double c = gmtl::dot(a.getNormal(), b.getNormal());
+				double denom = 1.0 - c * c;
+				if(denom < PLANE_EPSILON)
+				{
+					continue;
+				}
+				double ra = gmtl::distance(a, target);
+				double rb = gmtl::distance(b, target);
+				candidate = target - a.getNormal() * ((ra - c * rb) / denom) - b.getNormal() * ((rb - c * ra) / denom);
+				d = gmtl::lengthSquared(gmtl::Vec3d(candidate - target));
+				if(d < best && isFree(candidate))
+				{
+					best = d;
+					goal = candidate;
+					found = true;
+				}
+			}
+		}
+		if(m_constraintCount == 3)
+		{
+			const gmtl::Vec3d& na = m_constraints[0].getNormal();
+			const gmtl::Vec3d& nb = m_constraints[1].getNormal();
+			const gmtl::Vec3d& nc = m_constraints[2].getNormal();
+			gmtl::Vec3d bc = gmtl::makeCross(nb, nc);
+			double det = gmtl::dot(na, bc);
+			if(std::fabs(det) > PLANE_EPSILON)
+			{
+				candidate = (bc * m_constraints[0].getOffset() +
+							 gmtl::makeCross(nc, na) * m_constraints[1].getOffset() +
+							 gmtl::makeCross(na, nb) * m_constraints[2].getOffset()) / det;
+				double d = gmtl::lengthSquared(gmtl::Vec3d(candidate - target));
+				if(d < best)
+				{
+					goal = candidate;
+					found = true;
+				}
+			}
+		}
+		return found;
+	}
+
+	void FalconHapticMesh::render(const std::array<double, 3>& position, const std::array<double, 3>& velocity, std::array<double, 3>& force)
+	{
+		force.fill(0.0);
+		gmtl::Point3d target(position[0], position[1], position[2]);
+		m_meshes.update();
+		const std::shared_ptr<const FalconMeshBVH>& mesh = m_meshes.getReadBuffer();
+		m_constraintCount = 0;
+		if(!m_hasProxy || mesh == nullptr || mesh->isEmpty())
+		{
+			m_proxy = target;
+			m_hasProxy = true;
+			return;
+		}
+
+		//Walk the proxy towards the end effector. Every triangle the path runs into becomes a
+		//constraint plane, and the rest of the path is redirected to the closest point the
+		//constraints allow.
+		gmtl::Point3d goal = target;
+		for(unsigned int i = 0; i < MAX_ITERATIONS; ++i)
+		{
+			gmtl::Vec3d step(goal - m_proxy);
+			if(gmtl::lengthSquared(step) < 1e-18)
+			{
+				break;
+			}
+			double t;
+			unsigned int triangle;
+			if(!mesh->intersect(gmtl::LineSeg<double>(m_proxy, step), t, triangle))
+			{
+				m_proxy = goal;
+				break;
+			}
+			//Stop short of the surface along the path, which is known to be clear. Backing off along
+			//the normal instead could put the proxy behind a neighbouring triangle in a concave corner.
+			const gmtl::Vec3d& normal = mesh->getNormal(triangle);
+			gmtl::Point3d contact(m_proxy + step * t);
+			double approach = -gmtl::dot(step, normal);
+			m_proxy += step * std::max(t - m_surfaceOffset / approach, 0.0);
+
+			gmtl::Planed plane(normal, gmtl::dot(normal, gmtl::Vec3d(contact)) + m_surfaceOffset);
+			bool known = false;
+			for(unsigned int j = 0; j < m_constraintCount; ++j)
+			{
+				if(gmtl::dot(plane.getNormal(), m_constraints[j].getNormal()) > 1.0 - PLANE_EPSILON &&
+				   std::fabs(plane.getOffset() - m_constraints[j].getOffset()) < m_surfaceOffset)
+				{
+					known = true;
+				}
+			}
+			if(known || m_constraintCount == MAX_CONSTRAINTS)
+			{
+				break;
+			}
+			m_constraints[m_constraintCount++] = plane;
+			if(!solveGoal(target, goal))
+			{
+				break;
+			}
+		}
+
+		gmtl::Vec3d spring(m_proxy - target);
+		double penetration = gmtl::length(spring);
+		if(m_constraintCount == 0 || penetration < 1e-12)
+		{
+			return;
+		}
+		spring /= penetration;
+		double vn = spring[0] * velocity[0] + spring[1] * velocity[1] + spring[2] * velocity[2];
+		double magnitude = std::max(m_stiffness * penetration - m_damping * vn, 0.0);
+		if(m_maxForce > 0.0)
+		{
+			magnitude = std::min(magnitude, m_maxForce);
+		}
+		force[0] = spring[0] * magnitude;
+		force[1] = spring[1] * magnitude;
+		force[2] = spring[2] * magnitude;
+	}
+}
@@ -0,0 +1,318 @@
+/***
+ * @file FalconHapticPointCloud.cpp
+ * @brief Proxy renderer for point clouds, with indexing on a worker thread
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#include "falcon/haptic/FalconHapticPointCloud.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace libnifalcon
+{
+	const unsigned int FalconHapticPointCloud::MAX_NEIGHBORS;
+	const unsigned int FalconHapticPointCloud::MAX_ITERATIONS;
+
+	//Added points are merged into the main tree once there are more than this fraction of its size
+	static const double MERGE_FRACTION = 0.25;
+
+	static std::shared_ptr<const FalconPointCloud> buildTree(const std::vector<std::array<double, 3> >& points, unsigned int threads)
+	{
+		std::shared_ptr<FalconPointCloud> tree = std::make_shared<FalconPointCloud>();
+		if(!tree->build(points, threads))
+		{
+			return std::shared_ptr<const FalconPointCloud>();
+		}
+		return tree;
+	}
+
+	FalconHapticPointCloud::FalconHapticPointCloud() :
+		m_queuedReplace(false),
+		m_hasQueued(false),
+		m_isIndexing(false),
+		m_stopWorker(false),
+		m_buildThreads(0),
+		m_hasProxy(false),
+		m_inContact(false),
+		m_radius(0.002),
+		m_stiffness(1000.0),
+		m_damping(0.0),
+		m_maxForce(0.0)
+	{
+		m_proxy.fill(0.0);
+	}
+
+	FalconHapticPointCloud::~FalconHapticPointCloud()
+	{
+		if(!m_worker)
+		{
+			return;
+		}
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_stopWorker = true;
+		}
+		m_changed.notify_all();
+		m_worker->join();
+	}
+
+	void FalconHapticPointCloud::setPoints(const std::vector<std::array<double, 3> >& points)
+	{
+		queuePoints(points, true);
+	}
+
+	void FalconHapticPointCloud::addPoints(const std::vector<std::array<double, 3> >& points)
+	{
+		queuePoints(points, false);
+	}
+
+	void FalconHapticPointCloud::queuePoints(const std::vector<std::array<double, 3> >& points, bool replace)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			//Changes the worker hasn't picked up yet are folded together
+			if(replace || !m_hasQueued)
+			{
+				m_queued = points;
+				m_queuedReplace = replace;
+			}
+			else
+			{
+				m_queued.insert(m_queued.end(), points.begin(), points.end());
+			}
+			m_hasQueued = true;
+			if(!m_worker)
+			{
+				m_worker = std::unique_ptr<std::thread>(new std::thread(&FalconHapticPointCloud::runWorker, this));
+			}
+		}
+		m_changed.notify_all();
+	}
+
+	void FalconHapticPointCloud::waitForIndex()
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+		m_changed.wait(lock, [this]() { return !m_hasQueued && !m_isIndexing; });
+	}
+
+	void FalconHapticPointCloud::runWorker()
+	{
+		Index index;
+		//Raw points behind index.added, kept to rebuild it as more come in
+		std::vector<std::array<double, 3> > added;
+		while(true)
+		{
+			std::vector<std::array<double, 3> > points;
+			bool replace;
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_changed.wait(lock, [this]() { return m_hasQueued || m_stopWorker; });
+				if(m_stopWorker)
+				{
+					return;
+				}
+				points.swap(m_queued);
+				replace = m_queuedReplace;
+				m_hasQueued = false;
+				m_isIndexing = true;
+			}
+
+			if(replace)
+			{
+				added.clear();
+				index.added.reset();
+				index.base = buildTree(points, m_buildThreads);
+			}
+			else
+			{
+				added.insert(added.end(), points.begin(), points.end());
+				size_t base_count = index.base ? index.base->getPointCount() : 0;
+				if(added.size() > base_count * MERGE_FRACTION)
+				{
+					if(index.base)
+					{
+						added.insert(added.end(), index.base->getPoints().begin(), index.base->getPoints().end());
+					}
+					index.base = buildTree(added, m_buildThreads);
+					index.added.reset();
+					added.clear();
+				}
+				else
+				{
+					index.added = buildTree(added, m_buildThreads);
+				}
+			}
+
+			m_indices.getWriteBuffer() = index;
+			m_indices.publish();
+			//Whatever comes back is no longer visible to the I/O thread, so release it here
+			m_indices.getWriteBuffer() = Index();
+
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_isIndexing = false;
+			}
+			m_changed.notify_all();
+		}
+	}
+
+	void FalconHapticPointCloud::reset()
+	{
+		m_hasProxy = false;
+		m_inContact = false;
+	}
+
+	bool FalconHapticPointCloud::fitSurface(const Index& index, std::array<double, 3>& center, std::array<double, 3>& normal, double& nearest) const
+	{
+		const double search = 2.0 * m_radius;
+		const double inverse_search = 1.0 / (search * search);
+		unsigned int indices[MAX_NEIGHBORS];
+		double distances[MAX_NEIGHBORS];
+		double weight = 0.0;
+		center.fill(0.0);
+		nearest = search * search;
+		const FalconPointCloud* trees[2] = {index.base.get(), index.added.get()};
+		for(int t = 0; t < 2; ++t)
+		{
+			if(trees[t] == nullptr)
+			{
+				continue;
+			}
+			unsigned int found = trees[t]->findNearest(m_proxy, search, MAX_NEIGHBORS, indices, distances);
+			for(unsigned int i = 0; i < found; ++i)
+			{
+				//Smooth falloff, so points entering and leaving the neighbourhood don't make the plane jump
+				double w = 1.0 - distances[i] * inverse_search;
+				w *= w;
+				const std::array<double, 3>& p = trees[t]->getPoints()[indices[i]];
+				for(int j = 0; j < 3; ++j)
+				{
+					center[j] += p[j] * w;
+				}
+				weight += w;
+			}
+			if(found > 0)
+			{
+				nearest = std::min(nearest, distances[0]);
+			}
+		}
+		if(weight <= 0.0)
+		{
+			return false;
+		}
+		double length = 0.0;
+		for(int j = 0; j < 3; ++j)
+		{
+			center[j] /= weight;
+			normal[j] = m_proxy[j] - center[j];
+			length += normal[j] * normal[j];
+		}
+		length = std::sqrt(length);
+		//Proxy right on the center (buried in the cloud): no side to push it out to
+		if(length < 1e-9)
+		{
+			return false;
+		}
+		for(int j = 0; j < 3; ++j)
+		{
+			normal[j] /= length;
+		}
+		return true;
+	}
+
+	void FalconHapticPointCloud::render(const std::array<double, 3>& position, const std::array<double, 3>& velocity, std::array<double, 3>& force)
+	{
+		force.fill(0.0);
+		m_inContact = false;
+		m_indices.update();
+		const Index& index = m_indices.getReadBuffer();
+		if(!m_hasProxy || (!index.base && !index.added))
+		{
+			m_proxy = position;
+			m_hasProxy = true;
+			return;
+		}
+
+		for(unsigned int iteration = 0; iteration < MAX_ITERATIONS; ++iteration)
+		{
+			std::array<double, 3> goal = position;
+			std::array<double, 3> center;
+			std::array<double, 3> normal;
+			double nearest;
+			//Free space: nothing within twice the radius, so a step of one radius can't touch anything
+			double max_step = m_radius;
+			bool contact = false;
+			if(fitSurface(index, center, normal, nearest))
+			{
+				double height = 0.0;
+				for(int j = 0; j < 3; ++j)
+				{
+					height += normal[j] * (goal[j] - center[j]);
+				}
+				if(height < m_radius)
+				{
+					for(int j = 0; j < 3; ++j)
+					{
+						goal[j] += normal[j] * (m_radius - height);
+					}
+					contact = true;
+				}
+				//Keep clear of the nearest point, but always allow some sliding along the surface
+				max_step = std::max(std::sqrt(nearest) - m_radius, 0.5 * m_radius);
+			}
+			m_inContact = contact;
+
+			std::array<double, 3> move;
+			double length = 0.0;
+			for(int j = 0; j < 3; ++j)
+			{
+				move[j] = goal[j] - m_proxy[j];
+				length += move[j] * move[j];
+			}
+			length = std::sqrt(length);
+			double scale = length > max_step ? max_step / length : 1.0;
+			for(int j = 0; j < 3; ++j)
+			{
+				m_proxy[j] += move[j] * scale;
+			}
+			if(scale == 1.0)
+			{
+				break;
+			}
+		}
+
+		if(!m_inContact)
+		{
+			return;
+		}
+		std::array<double, 3> spring;
+		for(int j = 0; j < 3; ++j)
+		{
+			spring[j] = m_proxy[j] - position[j];
+		}
+		double penetration = std::sqrt(spring[0] * spring[0] + spring[1] * spring[1] + spring[2] * spring[2]);
+		if(penetration == 0.0)
+		{
+			return;
+		}
+		for(int j = 0; j < 3; ++j)
+		{
+			spring[j] /= penetration;
+		}
+		double vn = spring[0] * velocity[0] + spring[1] * velocity[1] + spring[2] * velocity[2];
+		double magnitude = std::max(m_stiffness * penetration - m_damping * vn, 0.0);
+		if(m_maxForce > 0.0)
+		{
+			magnitude = std::min(magnitude, m_maxForce);
+		}
+		force[0] = spring[0] * magnitude;
+		force[1] = spring[1] * magnitude;
+		force[2] = spring[2] * magnitude;
+	}
+}
@@ -0,0 +1,72 @@
+/***
+ * @file FalconHapticSDF.cpp
+ * @brief Penalty renderer for signed distance grids
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#include "falcon/haptic/FalconHapticSDF.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace libnifalcon
+{
+	FalconHapticSDF::FalconHapticSDF() :
+		m_stiffness(1000.0),
+		m_damping(0.0),
+		m_maxForce(0.0),
+		m_distance(0.0)
+	{
+	}
+
+	void FalconHapticSDF::setGrid(std::shared_ptr<const FalconSDFGrid> grid)
+	{
+		m_grids.getWriteBuffer() = grid;
+		m_grids.publish();
+		//Whatever comes back is no longer visible to the I/O thread, so release it here
+		m_grids.getWriteBuffer().reset();
+	}
+
+	void FalconHapticSDF::render(const std::array<double, 3>& position, const std::array<double, 3>& velocity, std::array<double, 3>& force)
+	{
+		force.fill(0.0);
+		m_distance = 0.0;
+		m_grids.update();
+		const std::shared_ptr<const FalconSDFGrid>& grid = m_grids.getReadBuffer();
+		if(!grid)
+		{
+			return;
+		}
+
+		std::array<double, 3> gradient;
+		if(!grid->sample(position, m_distance, gradient) || m_distance >= 0.0)
+		{
+			return;
+		}
+		double length = std::sqrt(gradient[0] * gradient[0] + gradient[1] * gradient[1] + gradient[2] * gradient[2]);
+		//Flat spots (the middle of a thick part) have no direction to push in
+		if(length < 1e-9)
+		{
+			return;
+		}
+		for(int i = 0; i < 3; ++i)
+		{
+			gradient[i] /= length;
+		}
+
+		double vn = gradient[0] * velocity[0] + gradient[1] * velocity[1] + gradient[2] * velocity[2];
+		double magnitude = std::max(-m_stiffness * m_distance - m_damping * vn, 0.0);
+		if(m_maxForce > 0.0)
+		{
+			magnitude = std::min(magnitude, m_maxForce);
+		}
+		force[0] = gradient[0] * magnitude;
+		force[1] = gradient[1] * magnitude;
+		force[2] = gradient[2] * magnitude;
+	}
+}
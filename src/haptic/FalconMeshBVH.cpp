@@ -0,0 +1,366 @@
+/***
+ * @file FalconMeshBVH.cpp
+ * @brief Bounding volume hierarchy over a triangle mesh, for segment and closest point queries
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#include "falcon/haptic/FalconMeshBVH.h"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+#include "falcon/gmtl/Containment.h"
+#include "falcon/gmtl/Intersection.h"
+#include "falcon/gmtl/TriOps.h"
+#include "falcon/gmtl/VecOps.h"
+
+namespace libnifalcon
+{
+	const unsigned int FalconMeshBVH::LEAF_SIZE;
+
+	//Subtrees smaller than this are built on the thread that gets to them
+	static const uint32_t MIN_THREADED_BUILD = 4096;
+
+	//Möller-Trumbore, front side only. gmtl's Tri/LineSeg test rejects determinants and segments under
+	//fixed epsilons meant for unit scale scenes, which a falcon's sub-millimeter steps never clear.
+	static bool intersectTriangle(const gmtl::Tri<double>& tri, const gmtl::Point3d& origin, const gmtl::Vec3d& dir, double& t)
+	{
+		gmtl::Vec3d e1(tri[1] - tri[0]);
+		gmtl::Vec3d e2(tri[2] - tri[0]);
+		gmtl::Vec3d p;
+		gmtl::cross(p, dir, e2);
+		double det = gmtl::dot(e1, p);
+		if(det <= 0.0)
+		{
+			return false;
+		}
+		gmtl::Vec3d s(origin - tri[0]);
+		double u = gmtl::dot(s, p);
+		if(u < 0.0 || u > det)
+		{
+			return false;
+		}
+		gmtl::Vec3d q;
+		gmtl::cross(q, s, e1);
+		double v = gmtl::dot(dir, q);
+		if(v < 0.0 || u + v > det)
+		{
+			return false;
+		}
+		double hit = gmtl::dot(e2, q);
+		if(hit < 0.0 || hit > det)
+		{
+			return false;
+		}
+		t = hit / det;
+		return true;
+	}
+
+	//Closest point on a triangle, from Ericson's Real-Time Collision Detection (5.1.5)
+	static gmtl::Point3d closestOnTriangle(const gmtl::Tri<double>& tri, const gmtl::Point3d& p)
+	{
+		const gmtl::Point3d& a = tri[0];
+		const gmtl::Point3d& b = tri[1];
+		const gmtl::Point3d& c = tri[2];
+		gmtl::Vec3d ab(b - a), ac(c - a), ap(p - a);
+		double d1 = gmtl::dot(ab, ap);
+		double d2 = gmtl::dot(ac, ap);
+		if(d1 <= 0.0 && d2 <= 0.0)
+		{
+			return a;
+		}
+		gmtl::Vec3d bp(p - b);
+		double d3 = gmtl::dot(ab, bp);
+		double d4 = gmtl::dot(ac, bp);
+		if(d3 >= 0.0 && d4 <= d3)
+		{
+			return b;
+		}
+		double vc = d1 * d4 - d3 * d2;
+		if(vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0)
+		{
+			return gmtl::Point3d(a + ab * (d1 / (d1 - d3)));
+		}
+		gmtl::Vec3d cp(p - c);
+		double d5 = gmtl::dot(ab, cp);
+		double d6 = gmtl::dot(ac, cp);
+		if(d6 >= 0.0 && d5 <= d6)
+		{
+			return c;
+		}
+		double vb = d5 * d2 - d1 * d6;
+		if(vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0)
+		{
+			return gmtl::Point3d(a + ac * (d2 / (d2 - d6)));
+		}
+		double va = d3 * d6 - d5 * d4;
+		if(va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0)
+		{
+			return gmtl::Point3d(b + gmtl::Vec3d(c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6))));
+		}
+		double denom = 1.0 / (va + vb + vc);
+		return gmtl::Point3d(a + ab * (vb * denom) + ac * (vc * denom));
+	}
+
+	static double boxDistanceSquared(const gmtl::AABox<double>& box, const gmtl::Point3d& p)
+	{
+		double d = 0.0;
+		for(int i = 0; i < 3; ++i)
+		{
+			double e = std::max(std::max(box.getMin()[i] - p[i], p[i] - box.getMax()[i]), 0.0);
+			d += e * e;
+		}
+		return d;
+	}
+
+	bool FalconMeshBVH::build(const std::vector<gmtl::Tri<double> >& triangles, unsigned int threads)
+	{
+		m_buildItems.clear();
+		m_buildItems.reserve(triangles.size());
+		for(uint32_t i = 0; i < triangles.size(); ++i)
+		{
+			const gmtl::Tri<double>& tri = triangles[i];
+			gmtl::Vec3d n;
+			gmtl::cross(n, gmtl::Vec3d(tri[1] - tri[0]), gmtl::Vec3d(tri[2] - tri[0]));
+			if(gmtl::lengthSquared(n) == 0.0)
+			{
+				continue;
+			}
+			BuildItem item;
+			gmtl::extendVolume(item.bounds, tri[0]);
+			gmtl::extendVolume(item.bounds, tri[1]);
+			gmtl::extendVolume(item.bounds, tri[2]);
+			item.center = (item.bounds.getMin() + item.bounds.getMax()) * 0.5;
+			item.triangle = i;
+			m_buildItems.push_back(item);
+		}
+		return buildFromItems(triangles, threads);
+	}
+
+	bool FalconMeshBVH::build(const std::vector<std::array<double, 3> >& vertices, const std::vector<unsigned int>& indices, unsigned int threads)
+	{
+		std::vector<gmtl::Tri<double> > triangles;
+		triangles.reserve(indices.size() / 3);
+		for(size_t i = 0; i + 2 < indices.size(); i += 3)
+		{
+			if(indices[i] >= vertices.size() || indices[i + 1] >= vertices.size() || indices[i + 2] >= vertices.size())
+			{
+				m_errorCode = FALCON_MESH_BAD_INDEX;
+				return false;
+			}
+			const std::array<double, 3>& a = vertices[indices[i]];
+			const std::array<double, 3>& b = vertices[indices[i + 1]];
+			const std::array<double, 3>& c = vertices[indices[i + 2]];
+			triangles.push_back(gmtl::Tri<double>(gmtl::Point3d(a[0], a[1], a[2]), gmtl::Point3d(b[0], b[1], b[2]), gmtl::Point3d(c[0], c[1], c[2])));
+		}
+		return build(triangles, threads);
+	}
+
+	bool FalconMeshBVH::buildFromItems(const std::vector<gmtl::Tri<double> >& triangles, unsigned int threads)
+	{
+		m_nodes.clear();
+		m_triangles.clear();
+		m_normals.clear();
+		if(m_buildItems.empty())
+		{
+			m_errorCode = FALCON_MESH_NO_TRIANGLES;
+			return false;
+		}
+		if(threads == 0)
+		{
+			threads = std::max(std::thread::hardware_concurrency(), 1u);
+		}
+		uint32_t count = (uint32_t)m_buildItems.size();
+		m_nodes.resize(subtreeSize(count));
+		buildNode(0, 0, count, threads);
+
+		m_triangles.reserve(count);
+		m_normals.reserve(count);
+		for(uint32_t i = 0; i < count; ++i)
+		{
+			const gmtl::Tri<double>& tri = triangles[m_buildItems[i].triangle];
+			m_triangles.push_back(tri);
+			m_normals.push_back(gmtl::normal(tri));
+		}
+		std::vector<BuildItem>().swap(m_buildItems);
+		return true;
+	}
+
+	uint32_t FalconMeshBVH::subtreeSize(uint32_t count)
+	{
+		if(count <= LEAF_SIZE)
+		{
+			return 1;
+		}
+		return 1 + subtreeSize(count / 2) + subtreeSize(count - count / 2);
+	}
+
+	void FalconMeshBVH::buildNode(uint32_t node, uint32_t begin, uint32_t end, unsigned int threads)
+	{
+		Node& n = m_nodes[node];
+		gmtl::AABox<double> centers;
+		n.bounds = gmtl::AABox<double>();
+		for(uint32_t i = begin; i < end; ++i)
+		{
+			gmtl::extendVolume(n.bounds, m_buildItems[i].bounds);
+			gmtl::extendVolume(centers, m_buildItems[i].center);
+		}
+		if(end - begin <= LEAF_SIZE)
+		{
+			n.index = begin;
+			n.count = end - begin;
+			return;
+		}
+
+		gmtl::Vec3d extent(centers.getMax() - centers.getMin());
+		int axis = 0;
+		if(extent[1] > extent[axis])
+		{
+			axis = 1;
+		}
+		if(extent[2] > extent[axis])
+		{
+			axis = 2;
+		}
+		uint32_t mid = begin + (end - begin) / 2;
+		std::nth_element(m_buildItems.begin() + begin, m_buildItems.begin() + mid, m_buildItems.begin() + end,
+						 [axis](const BuildItem& a, const BuildItem& b) { return a.center[axis] < b.center[axis]; });
+
+		//Depth first layout: the first child follows this node, the second follows the first's subtree
+		uint32_t first = node + 1;
+		uint32_t second = first + subtreeSize(mid - begin);
+		n.index = second;
+		n.count = 0;
+		if(threads > 1 && end - begin >= MIN_THREADED_BUILD)
+		{
+			std::thread worker(&FalconMeshBVH::buildNode, this, second, mid, end, threads - threads / 2);
+			buildNode(first, begin, mid, threads / 2);
+			worker.join();
+		}
+		else
+		{
+			buildNode(first, begin, mid, 1);
+			buildNode(second, mid, end, 1);
+		}
+	}
+
+	const gmtl::AABox<double>& FalconMeshBVH::getBounds() const
+	{
+		static const gmtl::AABox<double> empty;
+		if(m_nodes.empty())
+		{
+			return empty;
+		}
+		return m_nodes[0].bounds;
+	}
+
+	bool FalconMeshBVH::intersect(const gmtl::LineSeg<double>& segment, double& t, unsigned int& triangle) const
+	{
+		if(m_nodes.empty())
+		{
+			return false;
+		}
+		const gmtl::Point3d& origin = segment.getOrigin();
+		const gmtl::Vec3d& dir = segment.getDir();
+		double nearest = 1.0;
+		bool found = false;
+		//Median splits keep the tree balanced, so 64 entries covers any mesh that fits in memory
+		uint32_t stack[64];
+		unsigned int top = 0;
+		stack[top++] = 0;
+		while(top > 0)
+		{
+			const Node& node = m_nodes[stack[--top]];
+			double t_in, t_out;
+			if(!gmtl::intersectAABoxRay(node.bounds, segment, t_in, t_out) || t_in > nearest)
+			{
+				continue;
+			}
+			if(node.count == 0)
+			{
+				stack[top++] = node.index;
+				stack[top++] = (uint32_t)(&node - &m_nodes[0]) + 1;
+				continue;
+			}
+			for(uint32_t i = node.index; i < node.index + node.count; ++i)
+			{
+				double hit;
+				if(intersectTriangle(m_triangles[i], origin, dir, hit) && hit <= nearest)
+				{
+					nearest = hit;
+					triangle = i;
+					found = true;
+				}
+			}
+		}
+		if(found)
+		{
+			t = nearest;
+		}
+		return found;
+	}
+	bool FalconMeshBVH::findClosest(const gmtl::Point3d& point, double max_distance, gmtl::Point3d& closest, unsigned int& triangle) const
+	{
+		if(m_nodes.empty())
+		{
+			return false;
+		}
+		double nearest = max_distance * max_distance;
+		double facing = 0.0;
+		bool found = false;
+		uint32_t stack[64];
+		unsigned int top = 0;
+		stack[top++] = 0;
+		while(top > 0)
+		{
+			uint32_t index = stack[--top];
+			const Node& node = m_nodes[index];
+			//Allow for ties, which are resolved below
+			double slack = nearest * 1e-9;
+			if(boxDistanceSquared(node.bounds, point) > nearest + slack)
+			{
+				continue;
+			}
+			if(node.count == 0)
+			{
+				//Push the farther child first, so the nearer one is searched first and prunes more
+				uint32_t first = index + 1;
+				uint32_t second = node.index;
+				if(boxDistanceSquared(m_nodes[first].bounds, point) < boxDistanceSquared(m_nodes[second].bounds, point))
+				{
+					std::swap(first, second);
+				}
+				stack[top++] = first;
+				stack[top++] = second;
+				continue;
+			}
+			for(uint32_t i = node.index; i < node.index + node.count; ++i)
+			{
+				gmtl::Point3d candidate = closestOnTriangle(m_triangles[i], point);
+				gmtl::Vec3d offset(point - candidate);
+				double d = gmtl::lengthSquared(offset);
+				if(d > nearest + slack)
+				{
+					continue;
+				}
+				//How squarely the triangle's plane faces the point. 1 on the face, less on edges and vertices.
+				double f = (d > 0.0) ? std::fabs(gmtl::dot(offset, m_normals[i])) / std::sqrt(d) : 1.0;
+				if(!found || d < nearest - slack || f > facing)
+				{
+					nearest = std::min(nearest, d);
+					facing = f;
+					closest = candidate;
+					triangle = i;
+					found = true;
+				}
+			}
+		}
+		return found;
+	}
+}
@@ -0,0 +1,195 @@
+/***
+ * @file FalconPointCloud.cpp
+ * @brief k-d tree over a point cloud, for nearest neighbour queries
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#include "falcon/haptic/FalconPointCloud.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace libnifalcon
+{
+	const unsigned int FalconPointCloud::LEAF_SIZE;
+
+	//Ranges smaller than this are built on the thread that gets to them
+	static const uint32_t MIN_THREADED_BUILD = 16384;
+
+	static double boxDistanceSquared(const std::array<double, 3>& min, const std::array<double, 3>& max, const std::array<double, 3>& p)
+	{
+		double d = 0.0;
+		for(int i = 0; i < 3; ++i)
+		{
+			double e = std::max(std::max(min[i] - p[i], p[i] - max[i]), 0.0);
+			d += e * e;
+		}
+		return d;
+	}
+
+	bool FalconPointCloud::build(const std::vector<std::array<double, 3> >& points, unsigned int threads)
+	{
+		m_nodes.clear();
+		m_points = points;
+		if(m_points.empty())
+		{
+			m_errorCode = FALCON_POINT_CLOUD_NO_POINTS;
+			return false;
+		}
+		if(threads == 0)
+		{
+			threads = std::max(std::thread::hardware_concurrency(), 1u);
+		}
+		uint32_t count = (uint32_t)m_points.size();
+		m_nodes.resize(subtreeSize(count));
+		buildNode(0, 0, count, threads);
+		return true;
+	}
+
+	uint32_t FalconPointCloud::subtreeSize(uint32_t count)
+	{
+		if(count <= LEAF_SIZE)
+		{
+			return 1;
+		}
+		return 1 + subtreeSize(count / 2) + subtreeSize(count - count / 2);
+	}
+
+	void FalconPointCloud::buildNode(uint32_t node, uint32_t begin, uint32_t end, unsigned int threads)
+	{
+		Node& n = m_nodes[node];
+		n.min = m_points[begin];
+		n.max = m_points[begin];
+		for(uint32_t i = begin + 1; i < end; ++i)
+		{
+			for(int j = 0; j < 3; ++j)
+			{
+				n.min[j] = std::min(n.min[j], m_points[i][j]);
+				n.max[j] = std::max(n.max[j], m_points[i][j]);
+			}
+		}
+		if(end - begin <= LEAF_SIZE)
+		{
+			n.index = begin;
+			n.count = end - begin;
+			return;
+		}
+
+		int axis = 0;
+		if(n.max[1] - n.min[1] > n.max[axis] - n.min[axis])
+		{
+			axis = 1;
+		}
+		if(n.max[2] - n.min[2] > n.max[axis] - n.min[axis])
+		{
+			axis = 2;
+		}
+		uint32_t mid = begin + (end - begin) / 2;
+		std::nth_element(m_points.begin() + begin, m_points.begin() + mid, m_points.begin() + end,
+						 [axis](const std::array<double, 3>& a, const std::array<double, 3>& b) { return a[axis] < b[axis]; });
+
+		//Depth first layout: the first child follows this node, the second follows the first's subtree
+		uint32_t first = node + 1;
+		uint32_t second = first + subtreeSize(mid - begin);
+		n.index = second;
+		n.count = 0;
+		if(threads > 1 && end - begin >= MIN_THREADED_BUILD)
+		{
+			std::thread worker(&FalconPointCloud::buildNode, this, second, mid, end, threads - threads / 2);
+			buildNode(first, begin, mid, threads / 2);
+			worker.join();
+		}
+		else
+		{
+			buildNode(first, begin, mid, 1);
+			buildNode(second, mid, end, 1);
+		}
+	}
+
+	unsigned int FalconPointCloud::findNearest(const std::array<double, 3>& point, double radius, unsigned int count, unsigned int* indices, double* distances) const
+	{
+		if(m_nodes.empty() || count == 0)
+		{
+			return 0;
+		}
+		unsigned int found = 0;
+		//Search radius, shrinking to the farthest point kept once count points have been found
+		double limit = radius * radius;
+		//Median splits keep the tree balanced, so 64 entries covers any cloud that fits in memory. Nodes
+		//are stacked with their box distance, so ones made useless by a shrinking limit are skipped.
+		uint32_t stack[64];
+		double stack_distance[64];
+		unsigned int top = 0;
+		double root_distance = boxDistanceSquared(m_nodes[0].min, m_nodes[0].max, point);
+		if(root_distance > limit)
+		{
+			return 0;
+		}
+		stack[top] = 0;
+		stack_distance[top++] = root_distance;
+		while(top > 0)
+		{
+			--top;
+			if(stack_distance[top] > limit)
+			{
+				continue;
+			}
+			uint32_t index = stack[top];
+			const Node& node = m_nodes[index];
+			if(node.count == 0)
+			{
+				//Search the nearer child first, so it shrinks the limit for the other
+				uint32_t first = index + 1;
+				uint32_t second = node.index;
+				double d1 = boxDistanceSquared(m_nodes[first].min, m_nodes[first].max, point);
+				double d2 = boxDistanceSquared(m_nodes[second].min, m_nodes[second].max, point);
+				if(d1 > d2)
+				{
+					std::swap(first, second);
+					std::swap(d1, d2);
+				}
+				if(d2 <= limit)
+				{
+					stack[top] = second;
+					stack_distance[top++] = d2;
+				}
+				if(d1 <= limit)
+				{
+					stack[top] = first;
+					stack_distance[top++] = d1;
+				}
+				continue;
+			}
+			for(uint32_t i = node.index; i < node.index + node.count; ++i)
+			{
+				const std::array<double, 3>& p = m_points[i];
+				double dx = p[0] - point[0], dy = p[1] - point[1], dz = p[2] - point[2];
+				double d = dx * dx + dy * dy + dz * dz;
+				if(d > limit)
+				{
+					continue;
+				}
+				//Insertion into the sorted result list, dropping the farthest once full
+				unsigned int j = found < count ? found++ : count - 1;
+				while(j > 0 && distances[j - 1] > d)
+				{
+					distances[j] = distances[j - 1];
+					indices[j] = indices[j - 1];
+					--j;
+				}
+				distances[j] = d;
+				indices[j] = i;
+				if(found == count)
+				{
+					limit = distances[count - 1];
+				}
+			}
+		}
+		return found;
+	}
+}
@@ -0,0 +1,176 @@
+/***
+ * @file FalconSDFGrid.cpp
+ * @brief Memory mapped, bricked signed distance grid
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#include "falcon/haptic/FalconSDFGrid.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace libnifalcon
+{
+	const unsigned int FalconSDFGrid::BRICK_SIZE;
+	const unsigned int FalconSDFGrid::BRICK_SAMPLES;
+
+	static const char SDF_MAGIC[8] = {'N', 'I', 'F', 'S', 'D', 'F', '0', '1'};
+	static const uint32_t SDF_VERSION = 1;
+
+	static unsigned int brickCount(unsigned int cells)
+	{
+		return (cells + FalconSDFGrid::BRICK_SIZE - 1) / FalconSDFGrid::BRICK_SIZE;
+	}
+
+	FalconSDFGrid::FalconSDFGrid() :
+		m_header(nullptr),
+		m_samples(nullptr),
+		m_spacing(0.0),
+		m_inverseSpacing(0.0)
+	{
+		m_origin.fill(0.0);
+		m_cells.fill(0);
+		m_bricks.fill(0);
+	}
+
+	FalconSDFGrid::~FalconSDFGrid()
+	{
+		close();
+	}
+
+	bool FalconSDFGrid::open(const std::string& filename)
+	{
+		close();
+		if(!m_file.open(filename, true))
+		{
+			m_errorCode = FALCON_SDF_FILE_ERROR;
+			return false;
+		}
+		const FalconSDFHeader* header = static_cast<const FalconSDFHeader*>(m_file.getData());
+		if(m_file.getSize() < sizeof(FalconSDFHeader) ||
+		   memcmp(header->magic, SDF_MAGIC, sizeof(SDF_MAGIC)) != 0 ||
+		   header->version != SDF_VERSION ||
+		   header->brickSize != BRICK_SIZE ||
+		   header->cells[0] == 0 || header->cells[1] == 0 || header->cells[2] == 0 ||
+		   !(header->spacing > 0.0))
+		{
+			m_file.close();
+			m_errorCode = FALCON_SDF_INVALID_FILE;
+			return false;
+		}
+		uint64_t bricks = (uint64_t)brickCount(header->cells[0]) * brickCount(header->cells[1]) * brickCount(header->cells[2]);
+		if(m_file.getSize() < sizeof(FalconSDFHeader) + bricks * BRICK_SAMPLES * sizeof(float))
+		{
+			m_file.close();
+			m_errorCode = FALCON_SDF_INVALID_FILE;
+			return false;
+		}
+		m_header = static_cast<FalconSDFHeader*>(m_file.getData());
+		loadHeader();
+		return true;
+	}
+
+	bool FalconSDFGrid::create(const std::string& filename, const std::array<double, 3>& origin, double spacing, const std::array<unsigned int, 3>& cells)
+	{
+		close();
+		if(cells[0] == 0 || cells[1] == 0 || cells[2] == 0 || !(spacing > 0.0))
+		{
+			m_errorCode = FALCON_SDF_INVALID_SIZE;
+			return false;
+		}
+		uint64_t bricks = (uint64_t)brickCount(cells[0]) * brickCount(cells[1]) * brickCount(cells[2]);
+		if(!m_file.create(filename, sizeof(FalconSDFHeader) + bricks * BRICK_SAMPLES * sizeof(float), false))
+		{
+			m_errorCode = FALCON_SDF_FILE_ERROR;
+			return false;
+		}
+		m_header = static_cast<FalconSDFHeader*>(m_file.getData());
+		memset(m_header, 0, sizeof(FalconSDFHeader));
+		memcpy(m_header->magic, SDF_MAGIC, sizeof(SDF_MAGIC));
+		m_header->version = SDF_VERSION;
+		m_header->brickSize = BRICK_SIZE;
+		for(int i = 0; i < 3; ++i)
+		{
+			m_header->cells[i] = cells[i];
+			m_header->origin[i] = origin[i];
+		}
+		m_header->spacing = spacing;
+		loadHeader();
+		return true;
+	}
+
+	void FalconSDFGrid::loadHeader()
+	{
+		m_samples = reinterpret_cast<float*>(m_header + 1);
+		for(int i = 0; i < 3; ++i)
+		{
+			m_origin[i] = m_header->origin[i];
+			m_cells[i] = m_header->cells[i];
+			m_bricks[i] = brickCount(m_cells[i]);
+		}
+		m_spacing = m_header->spacing;
+		m_inverseSpacing = 1.0 / m_spacing;
+	}
+
+	void FalconSDFGrid::close()
+	{
+		if(m_header == nullptr)
+		{
+			return;
+		}
+		m_file.close();
+		m_header = nullptr;
+		m_samples = nullptr;
+		m_origin.fill(0.0);
+		m_cells.fill(0);
+		m_bricks.fill(0);
+		m_spacing = 0.0;
+		m_inverseSpacing = 0.0;
+	}
+
+	bool FalconSDFGrid::sample(const std::array<double, 3>& position, double& distance, std::array<double, 3>& gradient) const
+	{
+		if(m_header == nullptr)
+		{
+			return false;
+		}
+		unsigned int cell[3];
+		double f[3];
+		for(int i = 0; i < 3; ++i)
+		{
+			double g = (position[i] - m_origin[i]) * m_inverseSpacing;
+			//Written so NaN positions fail too
+			if(!(g >= 0.0 && g <= m_cells[i]))
+			{
+				return false;
+			}
+			cell[i] = std::min((unsigned int)g, m_cells[i] - 1);
+			f[i] = g - cell[i];
+		}
+
+		const unsigned int S = BRICK_SIZE + 1;
+		const float* brick = m_samples + ((size_t)(cell[2] / BRICK_SIZE * m_bricks[1] + cell[1] / BRICK_SIZE) * m_bricks[0] + cell[0] / BRICK_SIZE) * BRICK_SAMPLES;
+		const float* c = brick + ((cell[2] % BRICK_SIZE) * S + (cell[1] % BRICK_SIZE)) * S + (cell[0] % BRICK_SIZE);
+		double c000 = c[0], c100 = c[1], c010 = c[S], c110 = c[S + 1];
+		double c001 = c[S * S], c101 = c[S * S + 1], c011 = c[S * S + S], c111 = c[S * S + S + 1];
+
+		//Interpolate along x, then y, then z, keeping the partial derivatives along the way
+		double fx = f[0], fy = f[1], fz = f[2];
+		double x00 = c000 + (c100 - c000) * fx, x10 = c010 + (c110 - c010) * fx;
+		double x01 = c001 + (c101 - c001) * fx, x11 = c011 + (c111 - c011) * fx;
+		double y0 = x00 + (x10 - x00) * fy, y1 = x01 + (x11 - x01) * fy;
+		distance = y0 + (y1 - y0) * fz;
+
+		double dx0 = (c100 - c000) + ((c110 - c010) - (c100 - c000)) * fy;
+		double dx1 = (c101 - c001) + ((c111 - c011) - (c101 - c001)) * fy;
+		gradient[0] = (dx0 + (dx1 - dx0) * fz) * m_inverseSpacing;
+		gradient[1] = ((x10 - x00) + ((x11 - x01) - (x10 - x00)) * fz) * m_inverseSpacing;
+		gradient[2] = (y1 - y0) * m_inverseSpacing;
+		return true;
+	}
+}
@@ -0,0 +1,126 @@
+/***
+ * @file FalconVirtualCoupling.cpp
+ * @brief Couples a slow simulation to the I/O loop through a proxy and a local contact model
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#include "falcon/haptic/FalconVirtualCoupling.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "falcon/core/FalconClock.h"
+
+namespace libnifalcon
+{
+	FalconVirtualCoupling::FalconVirtualCoupling() :
+		m_writeIndex(0),
+		m_middle(1),
+		m_currentIndex(2),
+		m_previousIndex(3),
+		m_switchTime(0),
+		m_couplingStiffness(300.0),
+		m_couplingDamping(0.0),
+		m_blendTime(0.01),
+		m_maxExtrapolation(0.05),
+		m_maxForce(0.0)
+	{
+		m_publishedPosition.fill(0.0);
+		m_publishedVelocity.fill(0.0);
+		for(unsigned int i = 0; i < m_steps.size(); ++i)
+		{
+			m_steps[i].isValid = false;
+		}
+	}
+
+	void FalconVirtualCoupling::publish(const std::array<double, 3>& proxy_position, const std::array<double, 3>& proxy_velocity, const FalconForceField& local_model)
+	{
+		Step& step = m_steps[m_writeIndex];
+		step.proxyPosition = proxy_position;
+		step.proxyVelocity = proxy_velocity;
+		step.localModel = local_model;
+		step.timestamp = getFalconTimestamp();
+		step.isValid = true;
+		//Hand the step over, and take whatever slot was in transit to write the next one into
+		m_writeIndex = m_middle.exchange(m_writeIndex | STEP_DIRTY, std::memory_order_acq_rel) & STEP_INDEX_MASK;
+		m_publishedPosition = proxy_position;
+		m_publishedVelocity = proxy_velocity;
+	}
+
+	void FalconVirtualCoupling::getCouplingForce(const std::array<double, 3>& position, const std::array<double, 3>& velocity, std::array<double, 3>& force) const
+	{
+		for(int i = 0; i < 3; ++i)
+		{
+			force[i] = m_couplingStiffness * (position[i] - m_publishedPosition[i]) + m_couplingDamping * (velocity[i] - m_publishedVelocity[i]);
+		}
+	}
+
+	void FalconVirtualCoupling::reset()
+	{
+		//Nothing to fade from after a gap in the position stream
+		m_steps[m_previousIndex].isValid = false;
+	}
+
+	void FalconVirtualCoupling::evaluate(const Step& step, uint64_t now, const std::array<double, 3>& position, const std::array<double, 3>& velocity, std::array<double, 3>& force) const
+	{
+		step.localModel.evaluate(position, velocity, force);
+		double dt = now > step.timestamp ? (now - step.timestamp) / 1e9 : 0.0;
+		dt = std::min(dt, m_maxExtrapolation);
+		for(int i = 0; i < 3; ++i)
+		{
+			double proxy = step.proxyPosition[i] + step.proxyVelocity[i] * dt;
+			force[i] += m_couplingStiffness * (proxy - position[i]) + m_couplingDamping * (step.proxyVelocity[i] - velocity[i]);
+		}
+	}
+
+	void FalconVirtualCoupling::render(const std::array<double, 3>& position, const std::array<double, 3>& velocity, std::array<double, 3>& force)
+	{
+		uint64_t now = getFalconTimestamp();
+		if(m_middle.load(std::memory_order_relaxed) & STEP_DIRTY)
+		{
+			//Fade out from the step being rendered. A fade still going on is cut short, and its slot
+			//goes back to the publishing thread in exchange for the new step.
+			uint8_t released = m_previousIndex;
+			m_previousIndex = m_currentIndex;
+			m_currentIndex = m_middle.exchange(released, std::memory_order_acq_rel) & STEP_INDEX_MASK;
+			m_switchTime = now;
+		}
+		const Step& current = m_steps[m_currentIndex];
+		const Step& previous_step = m_steps[m_previousIndex];
+		if(!current.isValid)
+		{
+			force.fill(0.0);
+			return;
+		}
+		evaluate(current, now, position, velocity, force);
+
+		double elapsed = (now - m_switchTime) / 1e9;
+		if(previous_step.isValid && elapsed < m_blendTime)
+		{
+			std::array<double, 3> previous;
+			evaluate(previous_step, now, position, velocity, previous);
+			double alpha = elapsed / m_blendTime;
+			for(int i = 0; i < 3; ++i)
+			{
+				force[i] = previous[i] + (force[i] - previous[i]) * alpha;
+			}
+		}
+
+		if(m_maxForce > 0.0)
+		{
+			double magnitude = std::sqrt(force[0] * force[0] + force[1] * force[1] + force[2] * force[2]);
+			if(magnitude > m_maxForce)
+			{
+				for(int i = 0; i < 3; ++i)
+				{
+					force[i] *= m_maxForce / magnitude;
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,443 @@
+/***
+ * @file FalconGeometryCalibration.cpp
+ * @brief Fits the geometry of a falcon to recorded encoder values and position constraints
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#include "falcon/kinematic/FalconGeometryCalibration.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <thread>
+
+namespace libnifalcon
+{
+	using namespace StamperKinematicImpl;
+
+	//Samples are split so every thread gets at least this many
+	static const size_t MIN_THREADED_SAMPLES = 128;
+	//Steps for the central differences of inverse kinematics, in meters for positions
+	//and in meters or radians for parameters
+	static const double POSITION_STEP = 1e-7;
+	static const double PARAMETER_STEP = 1e-6;
+	//Leg angle error solvePosition stops at, in radians
+	static const double ANGLE_TOLERANCE = 1e-12;
+	static const int MAX_NEWTON_ITERATIONS = 20;
+	static const double DEGREES_TO_RADIANS = PI / 180.0;
+
+	FalconGeometryCalibration::FalconGeometryCalibration() :
+		m_parameterMask(DEFAULT_PARAMETER_MASK),
+		m_threadCount(0),
+		m_maxIterations(100),
+		m_iterationCount(0),
+		m_skippedCount(0)
+	{
+	}
+
+	void FalconGeometryCalibration::addPoint(const std::array<int, 3>& encoders, const std::array<double, 3>& position)
+	{
+		Sample sample;
+		sample.encoders = encoders;
+		sample.type = SAMPLE_POINT;
+		sample.target = position;
+		sample.offset = 0.0;
+		m_samples.push_back(sample);
+	}
+
+	void FalconGeometryCalibration::addPlane(const std::array<int, 3>& encoders, const std::array<double, 3>& normal, double offset)
+	{
+		double length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+		Sample sample;
+		sample.encoders = encoders;
+		sample.type = SAMPLE_PLANE;
+		for(int i = 0; i < 3; ++i)
+		{
+			sample.target[i] = normal[i] / length;
+		}
+		sample.offset = offset;
+		m_samples.push_back(sample);
+	}
+
+	double& FalconGeometryCalibration::getParameter(FalconGeometryParameters& geometry, Parameter parameter)
+	{
+		switch(parameter)
+		{
+		case PARAMETER_A: return geometry.a;
+		case PARAMETER_B: return geometry.b;
+		case PARAMETER_C: return geometry.c;
+		case PARAMETER_D: return geometry.d;
+		case PARAMETER_E: return geometry.e;
+		case PARAMETER_F: return geometry.f;
+		case PARAMETER_R: return geometry.r;
+		case PARAMETER_S: return geometry.s;
+		case PARAMETER_PHY_1:
+		case PARAMETER_PHY_2:
+		case PARAMETER_PHY_3:
+			return geometry.phy[parameter - PARAMETER_PHY_1];
+		default:
+			return geometry.theta_offset[parameter - PARAMETER_THETA_OFFSET_1];
+		}
+	}
+
+	bool FalconGeometryCalibration::solvePosition(FalconKinematicStamper& kinematic, const gmtl::Vec3d& theta, gmtl::Vec3d& position, gmtl::Matrix33d& jacobian)
+	{
+		Angle angles;
+		gmtl::Vec3d previous(position), step(0.0, 0.0, 0.0);
+		for(int i = 0; i < MAX_NEWTON_ITERATIONS; ++i)
+		{
+			kinematic.IK(angles, position);
+			gmtl::Vec3d error(theta[0] - angles.theta1[0], theta[1] - angles.theta1[1], theta[2] - angles.theta1[2]);
+			if(std::isnan(error[0]) || std::isnan(error[1]) || std::isnan(error[2]))
+			{
+				//Stepped out of the workspace, go back and take half the step
+				step *= 0.5;
+				position = previous + step;
+				continue;
+			}
+			//jacobian() is only an approximation in z, so differentiate IK instead
+			for(int j = 0; j < 3; ++j)
+			{
+				Angle plus, minus;
+				gmtl::Vec3d p(position), m(position);
+				p[j] += POSITION_STEP;
+				m[j] -= POSITION_STEP;
+				kinematic.IK(plus, p);
+				kinematic.IK(minus, m);
+				for(int k = 0; k < 3; ++k)
+				{
+					jacobian(k, j) = (plus.theta1[k] - minus.theta1[k]) / (2.0 * POSITION_STEP);
+				}
+			}
+			jacobian.setState(gmtl::Matrix33d::FULL);
+			gmtl::invert(jacobian);
+			if(jacobian.isError())
+			{
+				return false;
+			}
+			if(std::fabs(error[0]) + std::fabs(error[1]) + std::fabs(error[2]) < ANGLE_TOLERANCE)
+			{
+				return true;
+			}
+			previous = position;
+			step = gmtl::xformExpr(jacobian, error);
+			position = previous + step;
+		}
+		return false;
+	}
+
+	void FalconGeometryCalibration::evaluate(const Sample* samples, size_t count, const FalconGeometryParameters& geometry, const Parameter* parameters, unsigned int parameter_count, char* solvable, NormalEquations& equations)
+	{
+		std::fill(equations.jtj, equations.jtj + PARAMETER_COUNT * PARAMETER_COUNT, 0.0);
+		std::fill(equations.jtr, equations.jtr + PARAMETER_COUNT, 0.0);
+		equations.cost = 0.0;
+		equations.residuals = 0;
+		equations.solved = 0;
+
+		FalconKinematicStamper kinematic(false), perturbed(false);
+		kinematic.setGeometry(geometry);
+		std::array<double, 3> origin;
+		kinematic.getWorkspaceOrigin(origin);
+		gmtl::Vec3d start(origin[0], origin[1], origin[2]);
+		gmtl::Matrix33d J;
+		//Derivatives of the position with respect to each parameter, as columns
+		double derivatives[3][PARAMETER_COUNT];
+		for(size_t i = 0; i < count; ++i)
+		{
+			if(!solvable[i])
+			{
+				continue;
+			}
+			const Sample& sample = samples[i];
+			gmtl::Vec3d theta;
+			for(int j = 0; j < 3; ++j)
+			{
+				theta[j] = kinematic.getTheta(sample.encoders[j], j) * DEGREES_TO_RADIANS;
+			}
+			//Samples are usually recorded in sequence, so start from the last one's position
+			gmtl::Vec3d position(start);
+			if(!solvePosition(kinematic, theta, position, J))
+			{
+				position.set(origin[0], origin[1], origin[2]);
+				if(!solvePosition(kinematic, theta, position, J))
+				{
+					solvable[i] = 0;
+					continue;
+				}
+			}
+			start = position;
+			++equations.solved;
+
+			//The leg angles from IK at the solved position have to stay equal to the ones from the
+			//encoders, so dposition = J * (dtheta_encoders - dtheta_IK)
+			for(unsigned int k = 0; k < parameter_count; ++k)
+			{
+				gmtl::Vec3d dtheta(0.0, 0.0, 0.0);
+				if(parameters[k] >= PARAMETER_THETA_OFFSET_1)
+				{
+					dtheta[parameters[k] - PARAMETER_THETA_OFFSET_1] = DEGREES_TO_RADIANS;
+				}
+				else
+				{
+					FalconGeometryParameters g(geometry);
+					Angle plus, minus;
+					getParameter(g, parameters[k]) += PARAMETER_STEP;
+					perturbed.setGeometry(g);
+					perturbed.IK(plus, position);
+					getParameter(g, parameters[k]) -= 2.0 * PARAMETER_STEP;
+					perturbed.setGeometry(g);
+					perturbed.IK(minus, position);
+					for(int j = 0; j < 3; ++j)
+					{
+						dtheta[j] = -(plus.theta1[j] - minus.theta1[j]) / (2.0 * PARAMETER_STEP);
+					}
+				}
+				gmtl::Vec3d dposition = gmtl::xformExpr(J, dtheta);
+				for(int j = 0; j < 3; ++j)
+				{
+					derivatives[j][k] = dposition[j];
+				}
+			}
+
+			//Point samples give one residual per axis, plane samples one along the normal
+			int rows = (sample.type == SAMPLE_POINT) ? 3 : 1;
+			for(int row = 0; row < rows; ++row)
+			{
+				double residual;
+				double gradient[PARAMETER_COUNT];
+				if(sample.type == SAMPLE_POINT)
+				{
+					residual = position[row] - sample.target[row];
+					std::copy(derivatives[row], derivatives[row] + parameter_count, gradient);
+				}
+				else
+				{
+					residual = sample.target[0] * position[0] + sample.target[1] * position[1] + sample.target[2] * position[2] - sample.offset;
+					for(unsigned int k = 0; k < parameter_count; ++k)
+					{
+						gradient[k] = sample.target[0] * derivatives[0][k] + sample.target[1] * derivatives[1][k] + sample.target[2] * derivatives[2][k];
+					}
+				}
+				equations.cost += residual * residual;
+				++equations.residuals;
+				for(unsigned int k = 0; k < parameter_count; ++k)
+				{
+					equations.jtr[k] += gradient[k] * residual;
+					for(unsigned int l = k; l < parameter_count; ++l)
+					{
+						equations.jtj[k * PARAMETER_COUNT + l] += gradient[k] * gradient[l];
+					}
+				}
+			}
+		}
+		for(unsigned int k = 0; k < parameter_count; ++k)
+		{
+			for(unsigned int l = 0; l < k; ++l)
+			{
+				equations.jtj[k * PARAMETER_COUNT + l] = equations.jtj[l * PARAMETER_COUNT + k];
+			}
+		}
+	}
+
+	void FalconGeometryCalibration::evaluateAll(const FalconGeometryParameters& geometry, unsigned int parameter_count, std::vector<char>& solvable, NormalEquations& equations)
+	{
+		unsigned int threads = m_threadCount;
+		if(threads == 0)
+		{
+			threads = std::max(std::thread::hardware_concurrency(), 1u);
+		}
+		size_t chunks = std::min((size_t)threads, std::max(m_samples.size() / MIN_THREADED_SAMPLES, (size_t)1));
+		std::vector<NormalEquations> partial(chunks);
+		std::vector<std::thread> workers;
+		for(size_t i = 1; i < chunks; ++i)
+		{
+			size_t begin = m_samples.size() * i / chunks, end = m_samples.size() * (i + 1) / chunks;
+			workers.push_back(std::thread(&FalconGeometryCalibration::evaluate, &m_samples[begin], end - begin, std::cref(geometry), m_parameters, parameter_count, &solvable[begin], std::ref(partial[i])));
+		}
+		evaluate(&m_samples[0], m_samples.size() / chunks, geometry, m_parameters, parameter_count, &solvable[0], partial[0]);
+		for(size_t i = 0; i < workers.size(); ++i)
+		{
+			workers[i].join();
+		}
+		//Summed in order, so results only depend on the thread count
+		equations = partial[0];
+		for(size_t i = 1; i < chunks; ++i)
+		{
+			for(unsigned int k = 0; k < PARAMETER_COUNT * PARAMETER_COUNT; ++k)
+			{
+				equations.jtj[k] += partial[i].jtj[k];
+			}
+			for(unsigned int k = 0; k < PARAMETER_COUNT; ++k)
+			{
+				equations.jtr[k] += partial[i].jtr[k];
+			}
+			equations.cost += partial[i].cost;
+			equations.residuals += partial[i].residuals;
+			equations.solved += partial[i].solved;
+		}
+	}
+
+	size_t FalconGeometryCalibration::getError(const FalconGeometryParameters& geometry, double& rms)
+	{
+		rms = 0.0;
+		if(m_samples.empty())
+		{
+			return 0;
+		}
+		std::vector<char> solvable(m_samples.size(), 1);
+		NormalEquations equations;
+		evaluateAll(geometry, 0, solvable, equations);
+		if(equations.solved > 0)
+		{
+			rms = std::sqrt(equations.cost / equations.solved);
+		}
+		return equations.solved;
+	}
+
+	bool FalconGeometryCalibration::fit(const FalconGeometryParameters& initial, FalconGeometryParameters& fitted)
+	{
+		m_iterationCount = 0;
+		m_skippedCount = 0;
+		unsigned int n = 0;
+		for(int k = 0; k < PARAMETER_COUNT; ++k)
+		{
+			if(m_parameterMask & (1 << k))
+			{
+				m_parameters[n++] = (Parameter)k;
+			}
+		}
+		if(m_samples.empty())
+		{
+			m_errorCode = FALCON_GEOMETRY_CALIBRATION_TOO_FEW_SAMPLES;
+			return false;
+		}
+
+		//Samples the starting geometry can't solve are left out of the whole fit, so the cost
+		//of every iteration is over the same samples
+		FalconGeometryParameters current(initial);
+		NormalEquations equations, trial_equations;
+		m_solvable.assign(m_samples.size(), 1);
+		evaluateAll(current, n, m_solvable, equations);
+		m_skippedCount = m_samples.size() - equations.solved;
+		if(equations.solved == 0)
+		{
+			m_errorCode = FALCON_GEOMETRY_CALIBRATION_OUT_OF_RANGE;
+			return false;
+		}
+		if(equations.residuals < n)
+		{
+			m_errorCode = FALCON_GEOMETRY_CALIBRATION_TOO_FEW_SAMPLES;
+			return false;
+		}
+
+		double lambda = 1e-3;
+		double A[PARAMETER_COUNT * PARAMETER_COUNT];
+		double step[PARAMETER_COUNT];
+		while(m_iterationCount < m_maxIterations && lambda < 1e10)
+		{
+			++m_iterationCount;
+			//Marquardt's scaling makes steps independent of the units of each parameter. Parameters
+			//the samples don't constrain get a floor, so the system stays solvable.
+			double max_diagonal = 0.0;
+			for(unsigned int k = 0; k < n; ++k)
+			{
+				max_diagonal = std::max(max_diagonal, equations.jtj[k * PARAMETER_COUNT + k]);
+			}
+			for(unsigned int k = 0; k < n; ++k)
+			{
+				for(unsigned int l = 0; l < n; ++l)
+				{
+					A[k * n + l] = equations.jtj[k * PARAMETER_COUNT + l];
+				}
+				A[k * n + k] += lambda * std::max(equations.jtj[k * PARAMETER_COUNT + k], max_diagonal * 1e-12);
+				step[k] = -equations.jtr[k];
+			}
+			//Cholesky factorization of A, in place in its lower triangle
+			bool positive = true;
+			for(unsigned int k = 0; k < n && positive; ++k)
+			{
+				for(unsigned int l = 0; l <= k; ++l)
+				{
+					double sum = A[k * n + l];
+					for(unsigned int m = 0; m < l; ++m)
+					{
+						sum -= A[k * n + m] * A[l * n + m];
+					}
+					if(l < k)
+					{
+						A[k * n + l] = sum / A[l * n + l];
+					}
+					else if(sum > 0.0)
+					{
+						A[k * n + k] = std::sqrt(sum);
+					}
+					else
+					{
+						positive = false;
+					}
+				}
+			}
+			if(!positive)
+			{
+				lambda *= 10.0;
+				continue;
+			}
+			for(unsigned int k = 0; k < n; ++k)
+			{
+				for(unsigned int m = 0; m < k; ++m)
+				{
+					step[k] -= A[k * n + m] * step[m];
+				}
+				step[k] /= A[k * n + k];
+			}
+			for(unsigned int k = n; k-- > 0;)
+			{
+				for(unsigned int m = k + 1; m < n; ++m)
+				{
+					step[k] -= A[m * n + k] * step[m];
+				}
+				step[k] /= A[k * n + k];
+			}
+
+			//Stop once the linearized model says the step would take off less than the error in the
+			//derivatives, which come from differences and are good to about 1e-6
+			double predicted = 0.0;
+			for(unsigned int k = 0; k < n; ++k)
+			{
+				double product = 0.0;
+				for(unsigned int l = 0; l < n; ++l)
+				{
+					product += equations.jtj[k * PARAMETER_COUNT + l] * step[l];
+				}
+				predicted -= step[k] * (2.0 * equations.jtr[k] + product);
+			}
+			if(predicted <= 1e-6 * equations.cost)
+			{
+				break;
+			}
+
+			FalconGeometryParameters trial(current);
+			for(unsigned int k = 0; k < n; ++k)
+			{
+				getParameter(trial, m_parameters[k]) += step[k];
+			}
+			std::vector<char> solvable(m_solvable);
+			evaluateAll(trial, n, solvable, trial_equations);
+			if(trial_equations.solved < equations.solved || !(trial_equations.cost < equations.cost))
+			{
+				lambda *= 10.0;
+				continue;
+			}
+			current = trial;
+			equations = trial_equations;
+			lambda = std::max(lambda * 0.1, 1e-12);
+		}
+		fitted = current;
+		return true;
+	}
+}
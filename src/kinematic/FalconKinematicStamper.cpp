@@ -10,6 +10,7 @@
  */
 
 #include "falcon/kinematic/FalconKinematicStamper.h"
+#include <cmath>
 
 namespace libnifalcon
 {
@@ -17,7 +18,11 @@ namespace libnifalcon
 	FalconKinematicStamper::FalconKinematicStamper(bool init_now) :
 		//if the initial position is the origin, we won't be able to invert and everything
 		//explodes. So, shift out a bit.
-		pos_(0.0, 0.0, 0.08)
+		pos_(0.0, 0.0, 0.08),
+		m_fkStamp(0),
+		m_cacheStamp(0),
+		m_cacheHits(0),
+		m_cacheMisses(0)
 	{
 	}
 
@@ -25,53 +30,63 @@ namespace libnifalcon
 	{
 	}
 
+	void FalconKinematicStamper::setGeometry(const FalconGeometryParameters& geometry)
+	{
+		FalconKinematic::setGeometry(geometry);
+		clearCache();
+	}
+
 	void FalconKinematicStamper::IK(Angle& angles, const gmtl::Vec3d& worldPosition)
 	{
+		const double a = m_geometry.a, b = m_geometry.b, c = m_geometry.c, d = m_geometry.d;
+		const double e = m_geometry.e, f = m_geometry.f;
+		const std::array<double, 3>& phy = m_geometry.phy;
+
 		//First we need the offset vector from the origin of the XYZ coordinate frame to the
 		//UVW coordinate frame:
-		gmtl::Vec3d offset(-libnifalcon::r,-libnifalcon::s,0);
+		gmtl::Vec3d offset(-m_geometry.r,-m_geometry.s,0);
 	
 
 		//Next lets convert the current end effector position into the UVW coordinates
 		//of each leg:
 		gmtl::Matrix33d R;
-		R(0,0)=cos(libnifalcon::phy[0]);	R(0,1)=sin(libnifalcon::phy[0]);	R(0,2)=0;
-		R(1,0)=-sin(libnifalcon::phy[0]);	R(1,1)=cos(libnifalcon::phy[0]);	R(1,2)=0;
+		R(0,0)=cos(phy[0]);	R(0,1)=sin(phy[0]);	R(0,2)=0;
+		R(1,0)=-sin(phy[0]);	R(1,1)=cos(phy[0]);	R(1,2)=0;
 		R(2,0)=0;							R(2,1)=0;							R(2,2)=1;
 		gmtl::Vec3d P1 = R*worldPosition + offset;
 
-		R(0,0)=cos(libnifalcon::phy[1]);	R(0,1)=sin(libnifalcon::phy[1]);	R(0,2)=0;
-		R(1,0)=-sin(libnifalcon::phy[1]);	R(1,1)=cos(libnifalcon::phy[1]);	R(1,2)=0;
+		R(0,0)=cos(phy[1]);	R(0,1)=sin(phy[1]);	R(0,2)=0;
+		R(1,0)=-sin(phy[1]);	R(1,1)=cos(phy[1]);	R(1,2)=0;
 		R(2,0)=0;							R(2,1)=0;							R(2,2)=1;
 		gmtl::Vec3d P2 = R*worldPosition + offset;
 
-		R(0,0)=cos(libnifalcon::phy[2]);	R(0,1)=sin(libnifalcon::phy[2]);	R(0,2)=0;
-		R(1,0)=-sin(libnifalcon::phy[2]);	R(1,1)=cos(libnifalcon::phy[2]);	R(1,2)=0;
+		R(0,0)=cos(phy[2]);	R(0,1)=sin(phy[2]);	R(0,2)=0;
+		R(1,0)=-sin(phy[2]);	R(1,1)=cos(phy[2]);	R(1,2)=0;
 		R(2,0)=0;							R(2,1)=0;							R(2,2)=1;
 		gmtl::Vec3d P3 = R*worldPosition + offset;
 
 
 		//Do the theta3's first. This is +/- but fortunately in the Falcon's case
 		//only the + result is correct
-		angles.theta3[0] = acos( (P1[1]+libnifalcon::f)/libnifalcon::b);
-		angles.theta3[1] = acos( (P2[1]+libnifalcon::f)/libnifalcon::b);
-		angles.theta3[2] = acos( (P3[1]+libnifalcon::f)/libnifalcon::b);
+		angles.theta3[0] = acos( (P1[1]+f)/b);
+		angles.theta3[1] = acos( (P2[1]+f)/b);
+		angles.theta3[2] = acos( (P3[1]+f)/b);
 
 
 		//Next find the theta1's
 		//In certain cases could query the theta1 values directly and save a bit of processing
 		//Again we have a +/- situation but only + is relevent
-		double l01 = P1[2]*P1[2] + P1[0]*P1[0] + 2*libnifalcon::c*P1[0] - 2*libnifalcon::a*P1[0] + libnifalcon::a*libnifalcon::a + libnifalcon::c*libnifalcon::c - libnifalcon::d*libnifalcon::d - libnifalcon::e*libnifalcon::e - libnifalcon::b*libnifalcon::b*sin(angles.theta3[0])*sin(angles.theta3[0]) - 2*libnifalcon::b*libnifalcon::e*sin(angles.theta3[0]) - 2*libnifalcon::b*libnifalcon::d*sin(angles.theta3[0]) - 2*libnifalcon::d*libnifalcon::e - 2*libnifalcon::a*libnifalcon::c;
-		double l11 = -4*libnifalcon::a*P1[2];
-		double l21 = P1[2]*P1[2] + P1[0]*P1[0] + 2*libnifalcon::c*P1[0] + 2*libnifalcon::a*P1[0] + libnifalcon::a*libnifalcon::a + libnifalcon::c*libnifalcon::c - libnifalcon::d*libnifalcon::d - libnifalcon::e*libnifalcon::e - libnifalcon::b*libnifalcon::b*sin(angles.theta3[0])*sin(angles.theta3[0]) - 2*libnifalcon::b*libnifalcon::e*sin(angles.theta3[0]) - 2*libnifalcon::b*libnifalcon::d*sin(angles.theta3[0]) - 2*libnifalcon::d*libnifalcon::e + 2*libnifalcon::a*libnifalcon::c;
+		double l01 = P1[2]*P1[2] + P1[0]*P1[0] + 2*c*P1[0] - 2*a*P1[0] + a*a + c*c - d*d - e*e - b*b*sin(angles.theta3[0])*sin(angles.theta3[0]) - 2*b*e*sin(angles.theta3[0]) - 2*b*d*sin(angles.theta3[0]) - 2*d*e - 2*a*c;
+		double l11 = -4*a*P1[2];
+		double l21 = P1[2]*P1[2] + P1[0]*P1[0] + 2*c*P1[0] + 2*a*P1[0] + a*a + c*c - d*d - e*e - b*b*sin(angles.theta3[0])*sin(angles.theta3[0]) - 2*b*e*sin(angles.theta3[0]) - 2*b*d*sin(angles.theta3[0]) - 2*d*e + 2*a*c;
 
-		double l02 = P2[2]*P2[2] + P2[0]*P2[0] + 2*libnifalcon::c*P2[0] - 2*libnifalcon::a*P2[0] + libnifalcon::a*libnifalcon::a + libnifalcon::c*libnifalcon::c - libnifalcon::d*libnifalcon::d - libnifalcon::e*libnifalcon::e - libnifalcon::b*libnifalcon::b*sin(angles.theta3[1])*sin(angles.theta3[1]) - 2*libnifalcon::b*libnifalcon::e*sin(angles.theta3[1]) - 2*libnifalcon::b*libnifalcon::d*sin(angles.theta3[1]) - 2*libnifalcon::d*libnifalcon::e - 2*libnifalcon::a*libnifalcon::c;
-		double l12 = -4*libnifalcon::a*P2[2];
-		double l22 = P2[2]*P2[2] + P2[0]*P2[0] + 2*libnifalcon::c*P2[0] + 2*libnifalcon::a*P2[0] + libnifalcon::a*libnifalcon::a + libnifalcon::c*libnifalcon::c - libnifalcon::d*libnifalcon::d - libnifalcon::e*libnifalcon::e - libnifalcon::b*libnifalcon::b*sin(angles.theta3[1])*sin(angles.theta3[1]) - 2*libnifalcon::b*libnifalcon::e*sin(angles.theta3[1]) - 2*libnifalcon::b*libnifalcon::d*sin(angles.theta3[1]) - 2*libnifalcon::d*libnifalcon::e + 2*libnifalcon::a*libnifalcon::c;
+		double l02 = P2[2]*P2[2] + P2[0]*P2[0] + 2*c*P2[0] - 2*a*P2[0] + a*a + c*c - d*d - e*e - b*b*sin(angles.theta3[1])*sin(angles.theta3[1]) - 2*b*e*sin(angles.theta3[1]) - 2*b*d*sin(angles.theta3[1]) - 2*d*e - 2*a*c;
+		double l12 = -4*a*P2[2];
+		double l22 = P2[2]*P2[2] + P2[0]*P2[0] + 2*c*P2[0] + 2*a*P2[0] + a*a + c*c - d*d - e*e - b*b*sin(angles.theta3[1])*sin(angles.theta3[1]) - 2*b*e*sin(angles.theta3[1]) - 2*b*d*sin(angles.theta3[1]) - 2*d*e + 2*a*c;
 	
-		double l03 = P3[2]*P3[2] + P3[0]*P3[0] + 2*libnifalcon::c*P3[0] - 2*libnifalcon::a*P3[0] + libnifalcon::a*libnifalcon::a + libnifalcon::c*libnifalcon::c - libnifalcon::d*libnifalcon::d - libnifalcon::e*libnifalcon::e - libnifalcon::b*libnifalcon::b*sin(angles.theta3[2])*sin(angles.theta3[2]) - 2*libnifalcon::b*libnifalcon::e*sin(angles.theta3[2]) - 2*libnifalcon::b*libnifalcon::d*sin(angles.theta3[2]) - 2*libnifalcon::d*libnifalcon::e - 2*libnifalcon::a*libnifalcon::c;
-		double l13 = -4*libnifalcon::a*P3[2];
-		double l23 = P3[2]*P3[2] + P3[0]*P3[0] + 2*libnifalcon::c*P3[0] + 2*libnifalcon::a*P3[0] + libnifalcon::a*libnifalcon::a + libnifalcon::c*libnifalcon::c - libnifalcon::d*libnifalcon::d - libnifalcon::e*libnifalcon::e - libnifalcon::b*libnifalcon::b*sin(angles.theta3[2])*sin(angles.theta3[2]) - 2*libnifalcon::b*libnifalcon::e*sin(angles.theta3[2]) - 2*libnifalcon::b*libnifalcon::d*sin(angles.theta3[2]) - 2*libnifalcon::d*libnifalcon::e + 2*libnifalcon::a*libnifalcon::c;
+		double l03 = P3[2]*P3[2] + P3[0]*P3[0] + 2*c*P3[0] - 2*a*P3[0] + a*a + c*c - d*d - e*e - b*b*sin(angles.theta3[2])*sin(angles.theta3[2]) - 2*b*e*sin(angles.theta3[2]) - 2*b*d*sin(angles.theta3[2]) - 2*d*e - 2*a*c;
+		double l13 = -4*a*P3[2];
+		double l23 = P3[2]*P3[2] + P3[0]*P3[0] + 2*c*P3[0] + 2*a*P3[0] + a*a + c*c - d*d - e*e - b*b*sin(angles.theta3[2])*sin(angles.theta3[2]) - 2*b*e*sin(angles.theta3[2]) - 2*b*d*sin(angles.theta3[2]) - 2*d*e + 2*a*c;
 	
 
 		/*double T1a = (-l11 + sqrt( l11*l11 - 4* l01* l21) ) / (2*l21);
@@ -88,9 +103,9 @@ namespace libnifalcon
 	
 
 		//And finally calculate the theta2 values:
-		angles.theta2[0] = acos( (-P1[0] + libnifalcon::a*cos(angles.theta1[0]) - libnifalcon::c)/(-libnifalcon::d - libnifalcon::e - libnifalcon::b*sin(angles.theta3[0]) )  );
-		angles.theta2[1] = acos( (-P2[0] + libnifalcon::a*cos(angles.theta1[1]) - libnifalcon::c)/(-libnifalcon::d - libnifalcon::e - libnifalcon::b*sin(angles.theta3[1]) )  );
-		angles.theta2[2] = acos( (-P3[0] + libnifalcon::a*cos(angles.theta1[2]) - libnifalcon::c)/(-libnifalcon::d - libnifalcon::e - libnifalcon::b*sin(angles.theta3[2]) )  );
+		angles.theta2[0] = acos( (-P1[0] + a*cos(angles.theta1[0]) - c)/(-d - e - b*sin(angles.theta3[0]) )  );
+		angles.theta2[1] = acos( (-P2[0] + a*cos(angles.theta1[1]) - c)/(-d - e - b*sin(angles.theta3[1]) )  );
+		angles.theta2[2] = acos( (-P3[0] + a*cos(angles.theta1[2]) - c)/(-d - e - b*sin(angles.theta3[2]) )  );
 	}
 
 ////////////////////////////////////////////////////
@@ -103,24 +118,26 @@ namespace libnifalcon
 		//Naming scheme:
 		//Jx1 = rotational velocity of joint 1 due to linear velocity in x
 
+		const double a = m_geometry.a;
+		const std::array<double, 3>& phy = m_geometry.phy;
 		gmtl::Matrix33d J;
 	
 		//Arm1:
-		double den = -libnifalcon::a*sin(angles.theta3[0])*(sin(angles.theta1[0])*cos(angles.theta2[0])-sin(angles.theta2[0])*cos(angles.theta1[0]));
+		double den = -a*sin(angles.theta3[0])*(sin(angles.theta1[0])*cos(angles.theta2[0])-sin(angles.theta2[0])*cos(angles.theta1[0]));
 
 		double Jx0 = cos(phy[0])*cos(angles.theta2[0])*sin(angles.theta3[0])/den-sin(phy[0])*cos(angles.theta3[0])/den;
 		double Jy0 = sin(phy[0])*cos(angles.theta2[0])*sin(angles.theta3[0])/den+cos(phy[0])*cos(angles.theta3[0])/den;
 		double Jz0 = (sin(angles.theta2[0])* sin(angles.theta2[0]))/(den);
 
 		//Arm2:
-		den = -libnifalcon::a*sin(angles.theta3[1])*(sin(angles.theta1[1])*cos(angles.theta2[1])-sin(angles.theta2[1])*cos(angles.theta1[1]));
+		den = -a*sin(angles.theta3[1])*(sin(angles.theta1[1])*cos(angles.theta2[1])-sin(angles.theta2[1])*cos(angles.theta1[1]));
 
 		double Jx1 = cos(phy[1])*cos(angles.theta2[1])*sin(angles.theta3[1])/den-sin(phy[1])*cos(angles.theta3[1])/den;
 		double Jy1 = sin(phy[1])*cos(angles.theta2[1])*sin(angles.theta3[1])/den+cos(phy[1])*cos(angles.theta3[1])/den;
 		double Jz1 = (sin(angles.theta2[1])* sin(angles.theta2[1]))/(den);
 
 		//Arm3:
-		den = -libnifalcon::a*sin(angles.theta3[2])*(sin(angles.theta1[2])*cos(angles.theta2[2])-sin(angles.theta2[2])*cos(angles.theta1[2]));
+		den = -a*sin(angles.theta3[2])*(sin(angles.theta1[2])*cos(angles.theta2[2])-sin(angles.theta2[2])*cos(angles.theta1[2]));
 
 		double Jx2 = cos(phy[2])*cos(angles.theta2[2])*sin(angles.theta3[2])/den-sin(phy[2])*cos(angles.theta3[2])/den;
 		double Jy2 = sin(phy[2])*cos(angles.theta2[2])*sin(angles.theta3[2])/den+cos(phy[2])*cos(angles.theta3[2])/den;
@@ -205,6 +222,16 @@ namespace libnifalcon
 			{
 				//Error is low enough so return the current position estimate
 				pos = previousPos;
+				//Keep the jacobian of this iterate around for the force mapping. It was evaluated at the
+				//position before the last step, so it's one damped step stale at pos. That step corrects
+				//an angle error under targetError, close enough for mapping forces and velocities.
+				if(++m_fkStamp == 0)
+				{
+					m_fkStamp = 1;
+				}
+				m_cacheStamp = m_fkStamp;
+				m_cachePosition = pos;
+				m_cacheJacobian = J;
 				//cout << i << endl;
 				return;
 			}
@@ -221,7 +248,22 @@ namespace libnifalcon
 
 		//Failed to converge, leave last position as it was
 		//cout << "Failed to find the tool position in the max tries" << endl;
+		m_cacheStamp = 0;
+	}
 
+	void FalconKinematicStamper::getJacobianAt(const gmtl::Vec3d& position, gmtl::Matrix33d& J)
+	{
+		if(m_cacheStamp != 0 &&
+		   position[0] == m_cachePosition[0] && position[1] == m_cachePosition[1] && position[2] == m_cachePosition[2])
+		{
+			++m_cacheHits;
+			J = m_cacheJacobian;
+			return;
+		}
+		++m_cacheMisses;
+		Angle angles;
+		IK(angles, position);
+		J = jacobian(angles);
 	}
 
 	bool FalconKinematicStamper::getForces(const std::array<double, 3> (&position), const std::array<double, 3> (&cart_force), std::array<int, 3> (&enc_force))
@@ -230,19 +272,13 @@ namespace libnifalcon
 		gmtl::Vec3d pos(position[0], position[1], position[2]);
 		
 		/////////////////////////////////////////
-		//Inverse kinematics:
-		Angle angles;
-
-		IK(angles, pos);
-
-		////////////////////////////////////////
-		//Jacobian:
+		//Inverse kinematics and Jacobian, reused from FK if we can:
 		gmtl::Matrix33d J;
-		J = jacobian(angles);
+		getJacobianAt(pos, J);
 	   
-		//Convert force to motor torque values:
-		J.setTranspose(J.getData());
-		gmtl::Vec3d torque = J * force;
+		//Convert force to motor torque values, torque = J' * force. setTranspose can't transpose
+		//in place, so multiply by the transpose directly.
+		gmtl::Vec3d torque = gmtl::xformTransposeExpr(J, force);
 
 
 		//Now, we must scale the torques to avoid saturation of a motor
@@ -281,6 +317,28 @@ namespace libnifalcon
 		return true;
 	}
 
+	bool FalconKinematicStamper::getJacobian(const std::array<double, 3> (&position), std::array<double, 9> (&jacobian_matrix))
+	{
+		gmtl::Vec3d pos(position[0], position[1], position[2]);
+
+		//jacobian() is already inverted, so it maps joint rates to cartesian velocity
+		gmtl::Matrix33d J;
+		getJacobianAt(pos, J);
+		for(int i = 0; i < 3; ++i)
+		{
+			for(int j = 0; j < 3; ++j)
+			{
+				jacobian_matrix[(i*3)+j] = J(i,j);
+				if(std::isnan(jacobian_matrix[(i*3)+j]))
+				{
+					m_errorCode = FALCON_KINEMATIC_OUT_OF_RANGE;
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
 	bool FalconKinematicStamper::getAngles(std::array<double, 3> (&position), std::array<double, 3> (&angles))
 	{
 
@@ -301,9 +359,9 @@ namespace libnifalcon
 	{
 
 		gmtl::Vec3d encoderAngles;
-		encoderAngles[0] = getTheta(encoderPos[0]);
-		encoderAngles[1] = getTheta(encoderPos[1]);
-		encoderAngles[2] = getTheta(encoderPos[2]);
+		encoderAngles[0] = getTheta(encoderPos[0], 0);
+		encoderAngles[1] = getTheta(encoderPos[1], 1);
+		encoderAngles[2] = getTheta(encoderPos[2], 2);
 		encoderAngles *= 0.0174532925;	//Convert to radians
 
 		////////////////////////////////////
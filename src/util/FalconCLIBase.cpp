@@ -13,8 +13,7 @@
 
 #include "falcon/util/FalconCLIBase.h"
 #include "falcon/firmware/FalconFirmwareNovintSDK.h"
-#include "falcon/util/FalconFirmwareBinaryTest.h"
-#include "falcon/util/FalconFirmwareBinaryNvent.h"
+#include "falcon/firmware/FalconFirmwareImages.h"
 
 
 #ifdef ENABLE_LOGGING
@@ -55,6 +54,10 @@ namespace libnifalcon
 					.action("store_true");
 			m_parser.add_option("--device_index").help("Opens device of given index (starts at 0)")
 					.action("store").type("int");
+			m_parser.add_option("--device_list").help("Print the serial number and USB location of each connected device and return")
+					.action("store_true");
+			m_parser.add_option("--device_id").help("Opens device with given serial number or USB location (as printed by --device_list)")
+					.metavar("ID");
 		}
 
 		if(value & FIRMWARE_OPTIONS)
@@ -63,6 +66,13 @@ namespace libnifalcon
 					.action("store_true");
 			m_parser.add_option("--test_firmware").help("Use test firmware")
 					.action("store_true");
+			std::string image_names;
+			for(unsigned int i = 0; i < FalconFirmwareImages::getImageCount(); ++i)
+			{
+				image_names += (i > 0 ? ", " : "") + std::string(FalconFirmwareImages::getImage(i)->name);
+			}
+			m_parser.add_option("--firmware_image").help("Use a firmware image built into the library, by name (" + image_names + ")")
+					.metavar("NAME");
 			m_parser.add_option("--firmware_file").help("Specify external firmware file (instead of nvent or test)")
 					.metavar("FILE");
 			m_parser.add_option("--force_firmware").help("Force firmware download, even if already loaded")
@@ -112,6 +122,24 @@ namespace libnifalcon
 			std::cout << "Connected Device Count: " << count << std::endl;
 			return false;
 		}
+		else if(options.get("device_list"))
+		{
+			std::vector<FalconDeviceInfo> devices;
+			m_falconDevice->getDeviceInfo(devices);
+			for(std::vector<FalconDeviceInfo>::const_iterator i = devices.begin(); i != devices.end(); ++i)
+			{
+				std::cout << "Device " << i->index << " - Serial: " << (i->serial.empty() ? "unknown" : i->serial) << " Location: " << (i->location.empty() ? "unknown" : i->location) << std::endl;
+			}
+			return false;
+		}
+		else if(options.is_set("device_id"))
+		{
+			if(!m_falconDevice->open((std::string)options.get("device_id")))
+			{
+				std::cout << "Cannot open falcon device " << (std::string)options.get("device_id") << " - Lib Error Code: " << m_falconDevice->getErrorCode() << " Device Error Code: " << m_falconDevice->getFalconComm()->getDeviceErrorCode() << std::endl;
+				return false;
+			}
+		}
 		else if(options.is_set("device_index"))
 		{
 			if(!m_falconDevice->open((int)options.get("device_index")))
@@ -139,8 +167,6 @@ namespace libnifalcon
 		if(!firmware_loaded)
 		{
 			std::cout << "Loading firmware" << std::endl;
-			uint8_t* firmware_block;
-			long firmware_size;
 			//First, see if we're trying to load a custom firmware file
 			if(options.is_set("firmware_file"))
 			{
@@ -177,20 +203,24 @@ namespace libnifalcon
 			}
 			else
 			{
-				if(options.get("nvent_firmware"))
+				std::string firmware_image = FalconFirmwareImages::DEFAULT_IMAGE;
+				if(options.is_set("firmware_image"))
 				{
-					firmware_block = const_cast<uint8_t*>(NOVINT_FALCON_NVENT_FIRMWARE);
-					firmware_size = NOVINT_FALCON_NVENT_FIRMWARE_SIZE;
+					firmware_image = (std::string)options.get("firmware_image");
 				}
 				else if(options.get("test_firmware"))
 				{
-					firmware_block = const_cast<uint8_t*>(NOVINT_FALCON_TEST_FIRMWARE);
-					firmware_size = NOVINT_FALCON_TEST_FIRMWARE_SIZE;
+					firmware_image = "test";
 				}
 				for(int i = 0; i < 10; ++i)
 				{
-					if(!m_falconDevice->getFalconFirmware()->loadFirmware((bool)options.get("skip_checksum"), NOVINT_FALCON_NVENT_FIRMWARE_SIZE, const_cast<uint8_t*>(NOVINT_FALCON_NVENT_FIRMWARE)))
+					if(!m_falconDevice->loadFirmwareImage((bool)options.get("skip_checksum"), firmware_image))
 					{
+						if(m_falconDevice->getErrorCode() == FalconFirmware::FALCON_FIRMWARE_IMAGE_NOT_VALID)
+						{
+							std::cout << "Cannot find firmware image - " << firmware_image << std::endl;
+							return false;
+						}
 						LOG_ERROR("Firmware loading try failed");
 						//Completely close and reopen
 						m_falconDevice->close();
@@ -228,11 +258,13 @@ namespace libnifalcon
 
 	bool FalconCLIBase::calibrateDevice()
 	{
-		m_falconDevice->getFalconFirmware()->setHomingMode(true);
+		//Called every loop until homed, so skip the shared pointer copies
+		FalconFirmware& firmware = *m_falconDevice->getFalconFirmware();
+		firmware.setHomingMode(true);
 		m_falconDevice->runIOLoop();
-		if(!m_falconDevice->getFalconFirmware()->isHomed())
+		if(!firmware.isHomed())
 		{
-			m_falconDevice->getFalconFirmware()->setLEDStatus(libnifalcon::FalconFirmware::RED_LED);
+			firmware.setLEDStatus(libnifalcon::FalconFirmware::RED_LED);
 			if(m_displayCalibrationMessage)
 			{
 				std::cout << "Falcon not currently calibrated. Move control all the way out then push straight all the way in." << std::endl;
@@ -241,7 +273,7 @@ namespace libnifalcon
 			return false;
 		}
 		std::cout << "Falcon calibrated successfully." << std::endl;
-		m_falconDevice->getFalconFirmware()->setLEDStatus(libnifalcon::FalconFirmware::GREEN_LED);
+		firmware.setLEDStatus(libnifalcon::FalconFirmware::GREEN_LED);
 		return true;
 	}
 }
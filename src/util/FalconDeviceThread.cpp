@@ -46,7 +46,10 @@ namespace libnifalcon
 	{
 		while(m_runThreadLoop)
 		{
-			runIOLoop();
+			if(runIOLoop() && m_sessionRecorder != nullptr)
+			{
+				m_sessionRecorder->record(*this);
+			}
 		}
 	}
 
@@ -0,0 +1,207 @@
+/***
+ * @file FalconSessionRecorder.cpp
+ * @brief Memory-mapped, fixed record size session recording of device state at servo rate
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#include "falcon/util/FalconSessionRecorder.h"
+#include "falcon/core/FalconDevice.h"
+#include "falcon/core/FalconClock.h"
+#include <cstring>
+#include <atomic>
+
+namespace libnifalcon
+{
+	static const char SESSION_MAGIC[8] = {'N', 'I', 'F', 'S', 'E', 'S', 'S', '1'};
+	static const uint32_t SESSION_VERSION = 1;
+
+	FalconSessionRecorder::FalconSessionRecorder() :
+		m_header(nullptr),
+		m_records(nullptr),
+		INIT_LOGGER("FalconSessionRecorder")
+	{
+	}
+
+	FalconSessionRecorder::~FalconSessionRecorder()
+	{
+		close();
+	}
+
+	bool FalconSessionRecorder::open(const std::string& filename, uint64_t capacity)
+	{
+		close();
+		if(capacity == 0)
+		{
+			m_errorCode = FALCON_SESSION_FILE_ERROR;
+			return false;
+		}
+		//Fault the whole recording in now, so the I/O thread never takes a page fault on a fresh slot
+		if(!m_file.create(filename, sizeof(FalconSessionHeader) + capacity * sizeof(FalconSessionRecord), true))
+		{
+			LOG_ERROR("Cannot create session file " << filename);
+			m_errorCode = FALCON_SESSION_MAP_ERROR;
+			return false;
+		}
+		m_header = static_cast<FalconSessionHeader*>(m_file.getData());
+		m_records = reinterpret_cast<FalconSessionRecord*>(m_header + 1);
+
+		memset(m_header, 0, sizeof(FalconSessionHeader));
+		memcpy(m_header->magic, SESSION_MAGIC, sizeof(SESSION_MAGIC));
+		m_header->version = SESSION_VERSION;
+		m_header->recordSize = sizeof(FalconSessionRecord);
+		m_header->capacity = capacity;
+		m_header->recordsWritten = 0;
+		LOG_INFO("Recording session to " << filename << " (" << capacity << " records)");
+		return true;
+	}
+
+	void FalconSessionRecorder::close()
+	{
+		if(m_header == nullptr)
+		{
+			return;
+		}
+		m_file.close();
+		m_header = nullptr;
+		m_records = nullptr;
+	}
+
+	uint64_t FalconSessionRecorder::getRecordsWritten() const
+	{
+		if(m_header == nullptr)
+		{
+			return 0;
+		}
+		return m_header->recordsWritten;
+	}
+
+	void FalconSessionRecorder::record(const FalconSessionRecord& r)
+	{
+		if(m_header == nullptr)
+		{
+			m_errorCode = FALCON_SESSION_NOT_OPEN;
+			return;
+		}
+		uint64_t n = m_header->recordsWritten;
+		if(n == 0)
+		{
+			m_header->startTimestamp = r.timestamp;
+		}
+		m_records[n % m_header->capacity] = r;
+		//Make sure readers mapping the same file never see the count before the record
+		std::atomic_thread_fence(std::memory_order_release);
+		m_header->recordsWritten = n + 1;
+	}
+
+	void FalconSessionRecorder::record(FalconDevice& device)
+	{
+		FalconSessionRecord r;
+		std::array<double, 3> pos = device.getPosition();
+		std::array<double, 3> force = device.getForce();
+		for(int i = 0; i < 3; ++i)
+		{
+			r.position[i] = pos[i];
+			r.force[i] = force[i];
+		}
+		std::shared_ptr<FalconFirmware> firmware = device.getFalconFirmware();
+		if(firmware != nullptr)
+		{
+			std::array<int, 3> enc = firmware->getEncoderValues();
+			r.encoders[0] = enc[0];
+			r.encoders[1] = enc[1];
+			r.encoders[2] = enc[2];
+			r.loopCount = firmware->getLoopCount();
+			r.timestamp = firmware->getLastPacketTimestamp();
+		}
+		else
+		{
+			r.encoders[0] = r.encoders[1] = r.encoders[2] = 0;
+			r.loopCount = 0;
+			r.timestamp = 0;
+		}
+		//Comm cores that don't stamp their reads still get a usable timeline
+		if(r.timestamp == 0)
+		{
+			r.timestamp = getFalconTimestamp();
+		}
+		std::shared_ptr<FalconGrip> grip = device.getFalconGrip();
+		r.buttons = (grip != nullptr) ? grip->getDigitalInputs() : 0;
+		record(r);
+	}
+
+	FalconSessionReader::FalconSessionReader() :
+		m_header(nullptr),
+		m_records(nullptr)
+	{
+	}
+
+	FalconSessionReader::~FalconSessionReader()
+	{
+		close();
+	}
+
+	bool FalconSessionReader::open(const std::string& filename)
+	{
+		close();
+		if(!m_file.open(filename, false))
+		{
+			m_errorCode = FalconSessionRecorder::FALCON_SESSION_FILE_ERROR;
+			return false;
+		}
+		const FalconSessionHeader* header = static_cast<const FalconSessionHeader*>(m_file.getData());
+		if(m_file.getSize() < sizeof(FalconSessionHeader) ||
+		   memcmp(header->magic, SESSION_MAGIC, sizeof(SESSION_MAGIC)) != 0 ||
+		   header->recordSize != sizeof(FalconSessionRecord) ||
+		   m_file.getSize() < sizeof(FalconSessionHeader) + header->capacity * sizeof(FalconSessionRecord))
+		{
+			m_file.close();
+			m_errorCode = FalconSessionRecorder::FALCON_SESSION_INVALID_FILE;
+			return false;
+		}
+		m_header = header;
+		m_records = reinterpret_cast<const FalconSessionRecord*>(m_header + 1);
+		return true;
+	}
+
+	void FalconSessionReader::close()
+	{
+		if(m_header == nullptr)
+		{
+			return;
+		}
+		m_file.close();
+		m_header = nullptr;
+		m_records = nullptr;
+	}
+
+	uint64_t FalconSessionReader::getRecordCount() const
+	{
+		if(m_header == nullptr)
+		{
+			return 0;
+		}
+		uint64_t written = m_header->recordsWritten;
+		std::atomic_thread_fence(std::memory_order_acquire);
+		return (written < m_header->capacity) ? written : m_header->capacity;
+	}
+
+	uint64_t FalconSessionReader::getDroppedCount() const
+	{
+		if(m_header == nullptr)
+		{
+			return 0;
+		}
+		uint64_t written = m_header->recordsWritten;
+		return (written > m_header->capacity) ? written - m_header->capacity : 0;
+	}
+
+	const FalconSessionRecord& FalconSessionReader::getRecord(uint64_t index) const
+	{
+		return m_records[(getDroppedCount() + index) % m_header->capacity];
+	}
+}
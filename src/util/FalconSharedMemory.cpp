@@ -0,0 +1,357 @@
+/***
+ * @file FalconSharedMemory.cpp
+ * @brief POSIX shared memory publishing of device state, and command queues back to the device owner
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#include "falcon/util/FalconSharedMemory.h"
+#include "falcon/core/FalconDevice.h"
+#include "falcon/core/FalconClock.h"
+#include <cstring>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+//Atomics have to work across processes, which is only guaranteed for lock-free ones
+#if ATOMIC_LLONG_LOCK_FREE != 2 || ATOMIC_INT_LOCK_FREE != 2
+#error "FalconSharedMemory requires lock-free 32 and 64 bit atomics"
+#endif
+
+namespace libnifalcon
+{
+	static const char SHARED_MAGIC[8] = {'N', 'I', 'F', 'S', 'H', 'M', '0', '1'};
+	static const uint32_t SHARED_VERSION = 1;
+	static const uint64_t QUEUE_MASK = FALCON_SHARED_QUEUE_SIZE - 1;
+	static const unsigned int STATE_READ_RETRIES = 100000;
+
+	FalconSharedMemoryServer::FalconSharedMemoryServer() :
+		m_region(nullptr),
+		INIT_LOGGER("FalconSharedMemoryServer")
+	{
+	}
+
+	FalconSharedMemoryServer::~FalconSharedMemoryServer()
+	{
+		destroy();
+	}
+
+	bool FalconSharedMemoryServer::create(const std::string& name, unsigned int device_count, unsigned int mode)
+	{
+		destroy();
+		if(device_count > FALCON_SHARED_MAX_DEVICES)
+		{
+			m_errorCode = FALCON_SHARED_DEVICE_OUT_OF_RANGE;
+			return false;
+		}
+		//Clear out anything left behind by a server that didn't shut down cleanly
+		shm_unlink(name.c_str());
+		int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, (mode_t)mode);
+		if(fd < 0)
+		{
+			LOG_ERROR("Cannot create shared memory object " << name);
+			m_errorCode = FALCON_SHARED_OPEN_ERROR;
+			return false;
+		}
+		//shm_open masks the mode with the umask, which would drop group write from 0660
+		if(fchmod(fd, (mode_t)mode) != 0 || ftruncate(fd, sizeof(FalconSharedRegion)) != 0)
+		{
+			::close(fd);
+			shm_unlink(name.c_str());
+			m_errorCode = FALCON_SHARED_OPEN_ERROR;
+			return false;
+		}
+		void* addr = mmap(NULL, sizeof(FalconSharedRegion), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		::close(fd);
+		if(addr == MAP_FAILED)
+		{
+			shm_unlink(name.c_str());
+			m_errorCode = FALCON_SHARED_MAP_ERROR;
+			return false;
+		}
+		m_region = static_cast<FalconSharedRegion*>(addr);
+		m_name = name;
+
+		//Fresh objects are zero filled, so only non-zero fields need setting up
+		m_region->version = SHARED_VERSION;
+		m_region->deviceCount = device_count;
+		m_region->nextClientId.store(1, std::memory_order_relaxed);
+		for(unsigned int i = 0; i < FALCON_SHARED_MAX_DEVICES; ++i)
+		{
+			FalconSharedQueue& q = m_region->devices[i].commands;
+			for(uint64_t j = 0; j < FALCON_SHARED_QUEUE_SIZE; ++j)
+			{
+				q.cells[j].sequence.store(j, std::memory_order_relaxed);
+			}
+		}
+		//Magic goes in last, so clients never attach to a half-built region
+		std::atomic_thread_fence(std::memory_order_release);
+		memcpy(m_region->magic, SHARED_MAGIC, sizeof(SHARED_MAGIC));
+		LOG_INFO("Created shared memory region " << name << " for " << device_count << " devices");
+		return true;
+	}
+
+	void FalconSharedMemoryServer::destroy()
+	{
+		if(m_region == nullptr)
+		{
+			return;
+		}
+		munmap(m_region, sizeof(FalconSharedRegion));
+		shm_unlink(m_name.c_str());
+		m_region = nullptr;
+		m_name.clear();
+	}
+
+	void FalconSharedMemoryServer::publish(unsigned int index, const FalconSharedState& state)
+	{
+		if(m_region == nullptr || index >= m_region->deviceCount)
+		{
+			m_errorCode = (m_region == nullptr) ? FALCON_SHARED_NOT_OPEN : FALCON_SHARED_DEVICE_OUT_OF_RANGE;
+			return;
+		}
+		FalconSharedDeviceSlot& slot = m_region->devices[index];
+		uint32_t seq = slot.sequence.load(std::memory_order_relaxed);
+		slot.sequence.store(seq + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		slot.state = state;
+		slot.sequence.store(seq + 2, std::memory_order_release);
+	}
+
+	void FalconSharedMemoryServer::publish(unsigned int index, FalconDevice& device)
+	{
+		FalconSharedState s;
+		std::array<double, 3> pos = device.getPosition();
+		std::array<double, 3> force = device.getForce();
+		for(int i = 0; i < 3; ++i)
+		{
+			s.position[i] = pos[i];
+			s.force[i] = force[i];
+			s.encoders[i] = 0;
+		}
+		s.loopCount = 0;
+		s.timestamp = 0;
+		s.homingStatus = 0;
+		std::shared_ptr<FalconFirmware> firmware = device.getFalconFirmware();
+		if(firmware != nullptr)
+		{
+			std::array<int, 3> enc = firmware->getEncoderValues();
+			for(int i = 0; i < 3; ++i)
+			{
+				s.encoders[i] = enc[i];
+			}
+			s.loopCount = firmware->getLoopCount();
+			s.timestamp = firmware->getLastPacketTimestamp();
+			s.homingStatus = firmware->getHomingModeStatus();
+		}
+		if(s.timestamp == 0)
+		{
+			s.timestamp = getFalconTimestamp();
+		}
+		std::shared_ptr<FalconGrip> grip = device.getFalconGrip();
+		s.buttons = (grip != nullptr) ? grip->getDigitalInputs() : 0;
+		s.errorCount = device.getErrorCount();
+		publish(index, s);
+	}
+
+	bool FalconSharedMemoryServer::popCommand(unsigned int index, FalconSharedCommand& command)
+	{
+		if(m_region == nullptr || index >= m_region->deviceCount)
+		{
+			m_errorCode = (m_region == nullptr) ? FALCON_SHARED_NOT_OPEN : FALCON_SHARED_DEVICE_OUT_OF_RANGE;
+			return false;
+		}
+		FalconSharedQueue& q = m_region->devices[index].commands;
+		uint64_t pos = q.dequeuePos.load(std::memory_order_relaxed);
+		FalconSharedQueueCell& cell = q.cells[pos & QUEUE_MASK];
+		uint64_t seq = cell.sequence.load(std::memory_order_acquire);
+		if((int64_t)(seq - (pos + 1)) < 0)
+		{
+			return false;
+		}
+		command = cell.command;
+		q.dequeuePos.store(pos + 1, std::memory_order_relaxed);
+		//Hand the slot back to producers for the next lap around the ring
+		cell.sequence.store(pos + FALCON_SHARED_QUEUE_SIZE, std::memory_order_release);
+		return true;
+	}
+
+	void FalconSharedMemoryServer::heartbeat()
+	{
+		if(m_region != nullptr)
+		{
+			m_region->heartbeat.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	FalconSharedMemoryClient::FalconSharedMemoryClient() :
+		m_region(nullptr),
+		m_clientId(0)
+	{
+	}
+
+	FalconSharedMemoryClient::~FalconSharedMemoryClient()
+	{
+		close();
+	}
+
+	bool FalconSharedMemoryClient::open(const std::string& name)
+	{
+		close();
+		int fd = shm_open(name.c_str(), O_RDWR, 0);
+		if(fd < 0)
+		{
+			m_errorCode = FalconSharedMemoryServer::FALCON_SHARED_OPEN_ERROR;
+			return false;
+		}
+		struct stat st;
+		if(fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(FalconSharedRegion))
+		{
+			::close(fd);
+			m_errorCode = FalconSharedMemoryServer::FALCON_SHARED_INVALID_REGION;
+			return false;
+		}
+		void* addr = mmap(NULL, sizeof(FalconSharedRegion), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		::close(fd);
+		if(addr == MAP_FAILED)
+		{
+			m_errorCode = FalconSharedMemoryServer::FALCON_SHARED_MAP_ERROR;
+			return false;
+		}
+		FalconSharedRegion* region = static_cast<FalconSharedRegion*>(addr);
+		if(memcmp(region->magic, SHARED_MAGIC, sizeof(SHARED_MAGIC)) != 0 || region->version != SHARED_VERSION)
+		{
+			munmap(addr, sizeof(FalconSharedRegion));
+			m_errorCode = FalconSharedMemoryServer::FALCON_SHARED_INVALID_REGION;
+			return false;
+		}
+		std::atomic_thread_fence(std::memory_order_acquire);
+		m_region = region;
+		m_clientId = m_region->nextClientId.fetch_add(1, std::memory_order_relaxed);
+		return true;
+	}
+
+	void FalconSharedMemoryClient::close()
+	{
+		if(m_region == nullptr)
+		{
+			return;
+		}
+		munmap(m_region, sizeof(FalconSharedRegion));
+		m_region = nullptr;
+		m_clientId = 0;
+	}
+
+	unsigned int FalconSharedMemoryClient::getDeviceCount() const
+	{
+		return (m_region != nullptr) ? m_region->deviceCount : 0;
+	}
+
+	uint64_t FalconSharedMemoryClient::getHeartbeat() const
+	{
+		return (m_region != nullptr) ? m_region->heartbeat.load(std::memory_order_relaxed) : 0;
+	}
+
+	bool FalconSharedMemoryClient::getState(unsigned int index, FalconSharedState& state)
+	{
+		if(m_region == nullptr || index >= m_region->deviceCount)
+		{
+			m_errorCode = (m_region == nullptr) ? FalconSharedMemoryServer::FALCON_SHARED_NOT_OPEN : FalconSharedMemoryServer::FALCON_SHARED_DEVICE_OUT_OF_RANGE;
+			return false;
+		}
+		const FalconSharedDeviceSlot& slot = m_region->devices[index];
+		for(unsigned int i = 0; i < STATE_READ_RETRIES; ++i)
+		{
+			uint32_t before = slot.sequence.load(std::memory_order_acquire);
+			if(before & 1)
+			{
+				continue;
+			}
+			state = slot.state;
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if(slot.sequence.load(std::memory_order_relaxed) == before)
+			{
+				return true;
+			}
+		}
+		m_errorCode = FalconSharedMemoryServer::FALCON_SHARED_STATE_BUSY;
+		return false;
+	}
+
+	bool FalconSharedMemoryClient::sendCommand(unsigned int index, const FalconSharedCommand& command)
+	{
+		if(m_region == nullptr || index >= m_region->deviceCount)
+		{
+			m_errorCode = (m_region == nullptr) ? FalconSharedMemoryServer::FALCON_SHARED_NOT_OPEN : FalconSharedMemoryServer::FALCON_SHARED_DEVICE_OUT_OF_RANGE;
+			return false;
+		}
+		FalconSharedQueue& q = m_region->devices[index].commands;
+		FalconSharedQueueCell* cell;
+		uint64_t pos = q.enqueuePos.load(std::memory_order_relaxed);
+		while(true)
+		{
+			cell = &q.cells[pos & QUEUE_MASK];
+			uint64_t seq = cell->sequence.load(std::memory_order_acquire);
+			int64_t diff = (int64_t)(seq - pos);
+			if(diff == 0)
+			{
+				if(q.enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				{
+					break;
+				}
+			}
+			else if(diff < 0)
+			{
+				m_errorCode = FalconSharedMemoryServer::FALCON_SHARED_QUEUE_FULL;
+				return false;
+			}
+			else
+			{
+				pos = q.enqueuePos.load(std::memory_order_relaxed);
+			}
+		}
+		cell->command = command;
+		cell->command.clientId = m_clientId;
+		cell->sequence.store(pos + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool FalconSharedMemoryClient::setForce(unsigned int index, const std::array<double, 3>& force)
+	{
+		FalconSharedCommand c;
+		memset(&c, 0, sizeof(c));
+		c.type = FALCON_SHARED_SET_FORCE;
+		for(int i = 0; i < 3; ++i)
+		{
+			c.values[i] = force[i];
+		}
+		return sendCommand(index, c);
+	}
+
+	bool FalconSharedMemoryClient::setSpring(unsigned int index, const std::array<double, 3>& anchor, double stiffness, double damping)
+	{
+		FalconSharedCommand c;
+		memset(&c, 0, sizeof(c));
+		c.type = FALCON_SHARED_SET_SPRING;
+		for(int i = 0; i < 3; ++i)
+		{
+			c.values[i] = anchor[i];
+		}
+		c.values[3] = stiffness;
+		c.values[4] = damping;
+		return sendCommand(index, c);
+	}
+
+	bool FalconSharedMemoryClient::clearSpring(unsigned int index)
+	{
+		FalconSharedCommand c;
+		memset(&c, 0, sizeof(c));
+		c.type = FALCON_SHARED_CLEAR_SPRING;
+		return sendCommand(index, c);
+	}
+}
@@ -0,0 +1,480 @@
+/***
+ * @file FalconTeleop.cpp
+ * @brief UDP teleoperation transport with jitter buffering, prediction and passive force coupling
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#include "falcon/util/FalconTeleop.h"
+#include "falcon/core/FalconDevice.h"
+#include "falcon/core/FalconClock.h"
+#include <cstring>
+#include <cmath>
+#include <cstdio>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netdb.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace libnifalcon
+{
+	static_assert(sizeof(FalconTeleopPacket) == 72, "FalconTeleopPacket wire format changed");
+
+	//Cutoff for the local velocity low pass filter, in Hz
+	static const double VELOCITY_CUTOFF = 40.0;
+	//Largest damping the passivity controller will add, in Ns/m
+	static const double MAX_PASSIVITY_DAMPING = 40.0;
+	//Rate the slave pulls itself back onto the master position in wave mode, in 1/s
+	static const double WAVE_DRIFT_CORRECTION = 2.0;
+
+	FalconTeleopJitterBuffer::FalconTeleopJitterBuffer()
+	{
+		clear();
+	}
+
+	void FalconTeleopJitterBuffer::clear()
+	{
+		memset(m_packets, 0, sizeof(m_packets));
+		memset(m_times, 0, sizeof(m_times));
+		memset(m_valid, 0, sizeof(m_valid));
+		m_newest = 0;
+		m_played = 0;
+		m_hasPackets = false;
+		m_lostCount = 0;
+		m_lateCount = 0;
+	}
+
+	bool FalconTeleopJitterBuffer::insert(const FalconTeleopPacket& packet, uint64_t local_time)
+	{
+		uint32_t seq = packet.sequence;
+		unsigned int slot = seq % BUFFER_SIZE;
+		if(!m_hasPackets)
+		{
+			m_newest = m_played = seq;
+			m_hasPackets = true;
+		}
+		else if((int32_t)(seq - m_newest) > 0)
+		{
+			//Anything we jumped over is now a hole that may still fill in.
+			//A jump longer than the buffer means everything in it is useless.
+			if(seq - m_newest >= BUFFER_SIZE)
+			{
+				m_lostCount += seq - m_newest - 1;
+				memset(m_valid, 0, sizeof(m_valid));
+				m_played = seq;
+			}
+			else
+			{
+				for(uint32_t s = m_newest + 1; s != seq; ++s)
+				{
+					m_valid[s % BUFFER_SIZE] = false;
+				}
+				//Slots about to be overwritten that playout never reached are gone for good
+				while((int32_t)(seq - m_played) >= (int32_t)BUFFER_SIZE)
+				{
+					if(!m_valid[m_played % BUFFER_SIZE])
+					{
+						++m_lostCount;
+					}
+					++m_played;
+				}
+			}
+			m_newest = seq;
+		}
+		else
+		{
+			if((int32_t)(seq - m_played) < 0)
+			{
+				++m_lateCount;
+				return false;
+			}
+			if(m_valid[slot] && m_packets[slot].sequence == seq)
+			{
+				return false;
+			}
+		}
+		m_packets[slot] = packet;
+		m_times[slot] = local_time;
+		m_valid[slot] = true;
+		return true;
+	}
+
+	int FalconTeleopJitterBuffer::sample(uint64_t time, uint64_t max_prediction, std::array<double, 3>& position, std::array<double, 3>& velocity, std::array<double, 3>& wave)
+	{
+		if(!m_hasPackets)
+		{
+			return SAMPLE_EMPTY;
+		}
+		//Walk back from the newest packet to find the packets bracketing time
+		int after = -1;
+		int before = -1;
+		uint32_t before_seq = m_played;
+		for(uint32_t s = m_newest; (int32_t)(s - m_played) >= 0; --s)
+		{
+			unsigned int slot = s % BUFFER_SIZE;
+			if(!m_valid[slot] || m_packets[slot].sequence != s)
+			{
+				continue;
+			}
+			if(m_times[slot] <= time)
+			{
+				before = slot;
+				before_seq = s;
+				break;
+			}
+			after = slot;
+		}
+		if(before == -1)
+		{
+			//Everything we have is in the future. Hold the oldest packet.
+			if(after == -1)
+			{
+				return SAMPLE_EMPTY;
+			}
+			for(int i = 0; i < 3; ++i)
+			{
+				position[i] = m_packets[after].position[i];
+				velocity[i] = m_packets[after].velocity[i];
+				wave[i] = m_packets[after].wave[i];
+			}
+			return SAMPLE_INTERPOLATED;
+		}
+		//Packets before the one we're playing are no longer needed
+		for(; m_played != before_seq; ++m_played)
+		{
+			if(!m_valid[m_played % BUFFER_SIZE] || m_packets[m_played % BUFFER_SIZE].sequence != m_played)
+			{
+				++m_lostCount;
+			}
+		}
+		const FalconTeleopPacket& a = m_packets[before];
+		if(after != -1)
+		{
+			const FalconTeleopPacket& b = m_packets[after];
+			double span = (double)(m_times[after] - m_times[before]);
+			double t = (span > 0) ? (double)(time - m_times[before]) / span : 0.0;
+			for(int i = 0; i < 3; ++i)
+			{
+				position[i] = a.position[i] + (b.position[i] - a.position[i]) * t;
+				velocity[i] = a.velocity[i] + (b.velocity[i] - a.velocity[i]) * t;
+				wave[i] = a.wave[i] + (b.wave[i] - a.wave[i]) * t;
+			}
+			return SAMPLE_INTERPOLATED;
+		}
+		uint64_t ahead = time - m_times[before];
+		int result = SAMPLE_PREDICTED;
+		if(ahead > max_prediction)
+		{
+			ahead = max_prediction;
+			result = SAMPLE_STALE;
+		}
+		double dt = (double)ahead / 1e9;
+		for(int i = 0; i < 3; ++i)
+		{
+			position[i] = a.position[i] + a.velocity[i] * dt;
+			velocity[i] = (result == SAMPLE_PREDICTED) ? a.velocity[i] : 0.0;
+			wave[i] = (ahead == 0) ? a.wave[i] : 0.0;
+		}
+		return result;
+	}
+
+	FalconTeleop::FalconTeleop() :
+		m_role(FALCON_TELEOP_MASTER),
+		m_mode(FALCON_TELEOP_COUPLING),
+		m_socket(-1),
+		m_remoteAddressSize(0),
+		m_stiffness(500.0),
+		m_damping(4.0),
+		m_slaveGain(50.0),
+		m_waveImpedance(5.0),
+		m_playoutDelay(5000000),
+		m_maxPrediction(50000000),
+		m_maxForce(8.0),
+		m_sequence(0),
+		m_packetsSent(0),
+		m_packetsReceived(0),
+		m_echoTimestamp(0),
+		m_echoReceived(0),
+		m_roundTripTime(0),
+		m_clockOffset(0),
+		m_hasClockOffset(false),
+		m_lastTime(0),
+		m_energy(0.0),
+		INIT_LOGGER("FalconTeleop")
+	{
+		for(int i = 0; i < 3; ++i)
+		{
+			m_lastPosition[i] = m_velocity[i] = 0.0;
+			m_remotePosition[i] = m_remoteVelocity[i] = m_remoteWave[i] = m_outgoingWave[i] = 0.0;
+		}
+	}
+
+	FalconTeleop::~FalconTeleop()
+	{
+		close();
+	}
+
+	bool FalconTeleop::open(FalconTeleopRole role, unsigned short local_port, const std::string& remote_host, unsigned short remote_port)
+	{
+		close();
+		m_role = role;
+
+		struct addrinfo hints;
+		struct addrinfo* result = nullptr;
+		memset(&hints, 0, sizeof(hints));
+		hints.ai_family = AF_INET;
+		hints.ai_socktype = SOCK_DGRAM;
+		char port[8];
+		snprintf(port, sizeof(port), "%u", remote_port);
+		if(getaddrinfo(remote_host.c_str(), port, &hints, &result) != 0 || result == nullptr || result->ai_addrlen > sizeof(m_remoteAddress))
+		{
+			LOG_ERROR("Cannot resolve " << remote_host);
+			if(result != nullptr)
+			{
+				freeaddrinfo(result);
+			}
+			m_errorCode = FALCON_TELEOP_ADDRESS_ERROR;
+			return false;
+		}
+		memcpy(m_remoteAddress, result->ai_addr, result->ai_addrlen);
+		m_remoteAddressSize = result->ai_addrlen;
+		freeaddrinfo(result);
+
+		m_socket = socket(AF_INET, SOCK_DGRAM, 0);
+		if(m_socket < 0)
+		{
+			m_errorCode = FALCON_TELEOP_SOCKET_ERROR;
+			return false;
+		}
+		struct sockaddr_in local;
+		memset(&local, 0, sizeof(local));
+		local.sin_family = AF_INET;
+		local.sin_addr.s_addr = htonl(INADDR_ANY);
+		local.sin_port = htons(local_port);
+		if(bind(m_socket, (struct sockaddr*)&local, sizeof(local)) != 0 ||
+		   fcntl(m_socket, F_SETFL, fcntl(m_socket, F_GETFL, 0) | O_NONBLOCK) != 0)
+		{
+			LOG_ERROR("Cannot bind to port " << local_port);
+			::close(m_socket);
+			m_socket = -1;
+			m_errorCode = FALCON_TELEOP_SOCKET_ERROR;
+			return false;
+		}
+
+		m_jitterBuffer.clear();
+		m_sequence = 0;
+		m_packetsSent = m_packetsReceived = 0;
+		m_echoTimestamp = m_echoReceived = 0;
+		m_roundTripTime = 0;
+		m_hasClockOffset = false;
+		m_lastTime = 0;
+		m_energy = 0.0;
+		LOG_INFO("Teleoperation link open on port " << local_port << " to " << remote_host << ":" << remote_port);
+		return true;
+	}
+
+	void FalconTeleop::close()
+	{
+		if(m_socket >= 0)
+		{
+			::close(m_socket);
+			m_socket = -1;
+		}
+	}
+
+	void FalconTeleop::receivePackets(uint64_t now)
+	{
+		FalconTeleopPacket packet;
+		while(true)
+		{
+			ssize_t size = recv(m_socket, &packet, sizeof(packet), 0);
+			if(size < 0)
+			{
+				//EAGAIN/EWOULDBLOCK: drained. Anything else (e.g. ECONNREFUSED from a peer that
+				//isn't up yet) we just try again next loop.
+				break;
+			}
+			if(size != sizeof(packet) || packet.magic != FALCON_TELEOP_MAGIC)
+			{
+				continue;
+			}
+			++m_packetsReceived;
+			if(packet.echoTimestamp != 0 && now > packet.echoTimestamp + packet.echoDelay)
+			{
+				uint64_t rtt = now - packet.echoTimestamp - packet.echoDelay;
+				m_roundTripTime = (m_roundTripTime == 0) ? rtt : (m_roundTripTime * 7 + rtt) / 8;
+			}
+			//Jitter only ever makes packets later, so the smallest offset seen is the best
+			//estimate. Creep upward slowly to follow clock drift.
+			int64_t offset = (int64_t)(now - packet.timestamp) - (int64_t)(m_roundTripTime / 2);
+			if(!m_hasClockOffset || offset < m_clockOffset)
+			{
+				m_clockOffset = offset;
+				m_hasClockOffset = true;
+			}
+			else
+			{
+				m_clockOffset += (offset - m_clockOffset) / 1024;
+			}
+			if(packet.timestamp > m_echoTimestamp)
+			{
+				m_echoTimestamp = packet.timestamp;
+				m_echoReceived = now;
+			}
+			m_jitterBuffer.insert(packet, packet.timestamp + m_clockOffset);
+		}
+	}
+
+	void FalconTeleop::computeCouplingForce(const std::array<double, 3>& pos, const std::array<double, 3>& vel, double dt, std::array<double, 3>& force)
+	{
+		double power = 0.0;
+		double speed_sq = 0.0;
+		for(int i = 0; i < 3; ++i)
+		{
+			force[i] = m_stiffness * (m_remotePosition[i] - pos[i]) + m_damping * (m_remoteVelocity[i] - vel[i]);
+			power += force[i] * vel[i];
+			speed_sq += vel[i] * vel[i];
+		}
+		//Passivity observer: energy the coupling has absorbed from the local port. If it goes
+		//negative, the coupling (thanks to delay) is generating energy, so burn it off with damping.
+		m_energy -= power * dt;
+		if(m_energy < 0.0 && speed_sq > 1e-9 && dt > 0.0)
+		{
+			double alpha = -m_energy / (dt * speed_sq);
+			if(alpha > MAX_PASSIVITY_DAMPING)
+			{
+				alpha = MAX_PASSIVITY_DAMPING;
+			}
+			for(int i = 0; i < 3; ++i)
+			{
+				force[i] -= alpha * vel[i];
+			}
+			m_energy += alpha * speed_sq * dt;
+		}
+	}
+
+	void FalconTeleop::computeWaveForce(const std::array<double, 3>& pos, const std::array<double, 3>& vel, std::array<double, 3>& force)
+	{
+		const double b = m_waveImpedance;
+		const double s = std::sqrt(2.0 * b);
+		for(int i = 0; i < 3; ++i)
+		{
+			if(m_role == FALCON_TELEOP_MASTER)
+			{
+				//Master: velocity out, force back. Incoming wave is v from the slave.
+				double f = b * vel[i] - s * m_remoteWave[i];
+				force[i] = -f;
+				m_outgoingWave[i] = s * vel[i] - m_remoteWave[i];
+			}
+			else
+			{
+				//Slave: velocity controller tracking the velocity the incoming u asks for.
+				//Solved together with F = B(xd' - x'), so the wave relation holds exactly.
+				double desired = (s * m_remoteWave[i] + m_slaveGain * vel[i]) / (b + m_slaveGain);
+				desired += WAVE_DRIFT_CORRECTION * (m_remotePosition[i] - pos[i]);
+				double f = m_slaveGain * (desired - vel[i]);
+				force[i] = f;
+				m_outgoingWave[i] = m_remoteWave[i] - (2.0 / s) * f;
+			}
+		}
+	}
+
+	bool FalconTeleop::update(FalconDevice& device)
+	{
+		if(m_socket < 0)
+		{
+			m_errorCode = FALCON_TELEOP_NOT_OPEN;
+			return false;
+		}
+		uint64_t now = getFalconTimestamp();
+		receivePackets(now);
+
+		//Stamp local state with the time the firmware packet it came from arrived
+		uint64_t sampled = 0;
+		std::shared_ptr<FalconFirmware> firmware = device.getFalconFirmware();
+		if(firmware != nullptr)
+		{
+			sampled = firmware->getLastPacketTimestamp();
+		}
+		if(sampled == 0 || sampled > now)
+		{
+			sampled = now;
+		}
+
+		std::array<double, 3> pos = device.getPosition();
+		double dt = (m_lastTime != 0 && sampled > m_lastTime) ? (double)(sampled - m_lastTime) / 1e9 : 0.0;
+		if(dt > 0.0)
+		{
+			double alpha = dt / (dt + 1.0 / (2.0 * 3.14159265 * VELOCITY_CUTOFF));
+			for(int i = 0; i < 3; ++i)
+			{
+				m_velocity[i] += alpha * ((pos[i] - m_lastPosition[i]) / dt - m_velocity[i]);
+			}
+		}
+		if(m_lastTime == 0 || dt > 0.0)
+		{
+			m_lastPosition = pos;
+			m_lastTime = sampled;
+		}
+
+		std::array<double, 3> force = {{0.0, 0.0, 0.0}};
+		if(m_hasClockOffset)
+		{
+			//Coupling wants the best guess of where the remote is right now. Waves need a
+			//constant delay, so they are played out behind the newest packet.
+			uint64_t target = (m_mode == FALCON_TELEOP_WAVE) ? now - m_playoutDelay : now;
+			int sample = m_jitterBuffer.sample(target, m_maxPrediction, m_remotePosition, m_remoteVelocity, m_remoteWave);
+			if(sample != FalconTeleopJitterBuffer::SAMPLE_EMPTY)
+			{
+				if(m_mode == FALCON_TELEOP_WAVE)
+				{
+					computeWaveForce(pos, m_velocity, force);
+				}
+				else
+				{
+					computeCouplingForce(pos, m_velocity, dt, force);
+				}
+			}
+		}
+		if(m_mode == FALCON_TELEOP_WAVE && !m_hasClockOffset)
+		{
+			//Nothing received yet, still have to send our half of the wave
+			computeWaveForce(pos, m_velocity, force);
+			force[0] = force[1] = force[2] = 0.0;
+		}
+		for(int i = 0; i < 3; ++i)
+		{
+			if(force[i] > m_maxForce) force[i] = m_maxForce;
+			if(force[i] < -m_maxForce) force[i] = -m_maxForce;
+		}
+		device.setForce(force);
+
+		FalconTeleopPacket packet;
+		packet.magic = FALCON_TELEOP_MAGIC;
+		packet.sequence = m_sequence++;
+		packet.timestamp = sampled;
+		packet.echoTimestamp = m_echoTimestamp;
+		packet.echoDelay = (m_echoTimestamp != 0) ? now - m_echoReceived : 0;
+		std::shared_ptr<FalconGrip> grip = device.getFalconGrip();
+		packet.buttons = (grip != nullptr) ? grip->getDigitalInputs() : 0;
+		for(int i = 0; i < 3; ++i)
+		{
+			packet.position[i] = (float)pos[i];
+			packet.velocity[i] = (float)m_velocity[i];
+			packet.wave[i] = (float)m_outgoingWave[i];
+		}
+		if(sendto(m_socket, &packet, sizeof(packet), 0, (struct sockaddr*)m_remoteAddress, m_remoteAddressSize) != sizeof(packet))
+		{
+			m_errorCode = FALCON_TELEOP_SEND_ERROR;
+			return false;
+		}
+		++m_packetsSent;
+		return true;
+	}
+}
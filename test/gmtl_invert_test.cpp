@@ -0,0 +1,93 @@
+/***
+ * @file gmtl_invert_test.cpp
+ * @brief Checks the 3x3 invertFull overloads at small and large matrix scales
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#include <iostream>
+#include <algorithm>
+#include "falcon/gmtl/gmtl.h"
+
+static int failures = 0;
+
+template <typename T>
+void check(bool ok, const char* what)
+{
+	std::cout << (ok ? "pass " : "FAIL ") << (sizeof(T) == sizeof(float) ? "float  " : "double ") << what << std::endl;
+	if(!ok) ++failures;
+}
+
+/** Builds scale * m from row major values */
+template <typename T>
+gmtl::Matrix<T, 3, 3> scaled(T scale, T a, T b, T c, T d, T e, T f, T g, T h, T i)
+{
+	gmtl::Matrix<T, 3, 3> m;
+	m.set(scale * a, scale * b, scale * c,
+		  scale * d, scale * e, scale * f,
+		  scale * g, scale * h, scale * i);
+	return m;
+}
+
+/** Largest entry of |m - n|, relative to the largest entry of |n| */
+template <typename T>
+T relativeError(const gmtl::Matrix<T, 3, 3>& m, const gmtl::Matrix<T, 3, 3>& n)
+{
+	T err = 0, size = 0;
+	for(int i = 0; i < 9; ++i)
+	{
+		err = std::max(err, gmtl::Math::abs(m.mData[i] - n.mData[i]));
+		size = std::max(size, gmtl::Math::abs(n.mData[i]));
+	}
+	return err / size;
+}
+
+template <typename T>
+void testInvert(T tolerance)
+{
+	gmtl::Matrix<T, 3, 3> identity, result, reference;
+
+	//diag(1e-4) has a determinant of 1e-12, which an absolute threshold calls singular
+	gmtl::Matrix<T, 3, 3> small = scaled<T>(T(1e-4), 1, 0, 0, 0, 1, 0, 0, 0, 1);
+	gmtl::invertFull(result, small);
+	check<T>(!result.isError(), "diag(1e-4) inverts");
+	check<T>(relativeError(result, scaled<T>(T(1e4), 1, 0, 0, 0, 1, 0, 0, 0, 1)) < tolerance, "diag(1e-4) inverse is 1e4 * I");
+
+	//A well conditioned, non symmetric matrix, at the same scale and at a large one
+	const T scales[] = { T(1e-4), T(1), T(1e4) };
+	for(int s = 0; s < 3; ++s)
+	{
+		gmtl::Matrix<T, 3, 3> m = scaled<T>(scales[s], 4, 1, T(0.5), T(0.2), 3, 1, T(0.3), T(0.7), 5);
+		result = gmtl::Matrix<T, 3, 3>();
+		gmtl::invertFull(result, m);
+		check<T>(!result.isError(), "well conditioned matrix inverts");
+		check<T>(relativeError(m * result, identity) < tolerance, "m * inverse(m) is I");
+		gmtl::invertFull_orig(reference, m);
+		check<T>(relativeError(result, reference) < tolerance, "matches the generic Gauss-Jordan inverse");
+	}
+
+	//Rank 2 (third row is the sum of the first two), which must fail at any scale
+	for(int s = 0; s < 3; ++s)
+	{
+		gmtl::Matrix<T, 3, 3> m = scaled<T>(scales[s], 1, 2, 3, 4, 5, 6, 5, 7, 9);
+		result = gmtl::Matrix<T, 3, 3>();
+		gmtl::invertFull(result, m);
+		check<T>(result.isError(), "singular matrix is flagged");
+	}
+}
+
+int main()
+{
+	testInvert<float>(1e-5f);
+	testInvert<double>(1e-12);
+	if(failures)
+	{
+		std::cout << failures << " failures" << std::endl;
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,104 @@
+/***
+ * @file kinematic_forces_test.cpp
+ * @brief Checks that FalconKinematicStamper maps cartesian forces to motor torques through J'
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include <array>
+#include <algorithm>
+#include "falcon/kinematic/FalconKinematicStamper.h"
+#include "falcon/gmtl/gmtl.h"
+
+using namespace libnifalcon;
+
+static int failures = 0;
+
+void check(bool ok, const char* what)
+{
+	std::cout << (ok ? "pass " : "FAIL ") << what << std::endl;
+	if(!ok) ++failures;
+}
+
+/**
+ * Checks getForces() at a position against torque = J' * force, worked out by hand from getJacobian().
+ * getForces() scales the torques by 10000 and negates them, truncating to int, so allow one count.
+ */
+void checkForces(FalconKinematicStamper& kinematic, const std::array<double, 3>& position, const std::array<double, 3>& force, const char* what)
+{
+	std::array<double, 3> p = position;
+	std::array<double, 9> J;
+	std::array<int, 3> enc_force;
+	if(!kinematic.getJacobian(p, J) || !kinematic.getForces(p, force, enc_force))
+	{
+		check(false, what);
+		return;
+	}
+
+	bool ok = true;
+	double asymmetry = 0.0;
+	for(int i = 0; i < 3; ++i)
+	{
+		//J is row major, so column i of J is row i of J'
+		const double torque = J[0 * 3 + i] * force[0] + J[1 * 3 + i] * force[1] + J[2 * 3 + i] * force[2];
+		const int expected = (int)(-10000.0 * torque);
+		if(std::abs(enc_force[i] - expected) > 1)
+		{
+			std::cout << "  axis " << i << ": got " << enc_force[i] << ", expected " << expected << std::endl;
+			ok = false;
+		}
+		//The old code used a symmetrized J. Make sure this position would have told the two apart.
+		const double untransposed = J[i * 3 + 0] * force[0] + J[i * 3 + 1] * force[1] + J[i * 3 + 2] * force[2];
+		asymmetry = std::max(asymmetry, std::fabs(10000.0 * (torque - untransposed)));
+	}
+	check(ok, what);
+	check(asymmetry > 10.0, "  J is asymmetric enough there to catch J * force");
+}
+
+int main()
+{
+	FalconKinematicStamper kinematic;
+	const std::array<double, 3> force = {{2.0, -3.0, 5.0}};
+
+	//Positions that weren't just returned by forward kinematics, so the jacobian comes from inverse kinematics
+	const std::array<double, 3> positions[] = {
+		{{0.0, 0.0, 0.11}},
+		{{0.02, -0.01, 0.12}},
+		{{-0.03, 0.02, 0.10}}
+	};
+	for(int i = 0; i < 3; ++i)
+	{
+		checkForces(kinematic, positions[i], force, "getForces is J' * force, jacobian from inverse kinematics");
+	}
+
+	//A position just returned by getPosition(), so the jacobian comes from the forward kinematics cache
+	std::array<int, 3> encoders = {{-300, 200, 100}};
+	std::array<double, 3> position;
+	kinematic.getPosition(encoders, position);
+	checkForces(kinematic, position, force, "getForces is J' * force, jacobian from the forward kinematics cache");
+
+	//barrow_mechanics makes the same product straight from a gmtl matrix
+	gmtl::Matrix33d m;
+	m.set(1.0, 2.0, 3.0,
+		  -4.0, 5.0, 6.0,
+		  7.0, -8.0, 9.0);
+	gmtl::Vec3d v(2.0, -3.0, 5.0);
+	gmtl::Vec3d r = gmtl::xformTransposeExpr(m, v);
+	check(r[0] == 1.0 * 2.0 + 4.0 * 3.0 + 7.0 * 5.0 &&
+		  r[1] == 2.0 * 2.0 - 5.0 * 3.0 - 8.0 * 5.0 &&
+		  r[2] == 3.0 * 2.0 - 6.0 * 3.0 + 9.0 * 5.0, "xformTransposeExpr is transpose(m) * v");
+
+	if(failures)
+	{
+		std::cout << failures << " failures" << std::endl;
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,114 @@
+/***
+ * @file point_fit_test.cpp
+ * @brief Checks that FalconPointFit gives the same fit on any number of threads
+ * @author Kyle Machulis (kyle@nonpolynomial.com)
+ * @copyright (c) 2007-2009 Nonpolynomial Labs/Kyle Machulis
+ * @license BSD License
+ *
+ * Project info at http://libnifalcon.nonpolynomial.com/
+ *
+ */
+
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include <array>
+#include <vector>
+#include <algorithm>
+#include "falcon/core/FalconPointFit.h"
+
+using namespace libnifalcon;
+
+static int failures = 0;
+
+void check(bool ok, const char* what, unsigned int threads)
+{
+	std::cout << (ok ? "pass " : "FAIL ") << threads << " threads: " << what << std::endl;
+	if(!ok) ++failures;
+}
+
+int main()
+{
+	//A probed 50 x 30mm patch of a tilted plane, 0.1mm of noise. Enough points that batches split 8 ways.
+	const double normal[3] = {0.2 / 0.9695, 0.3 / 0.9695, 0.9 / 0.9695};
+	const double u[3] = {0.9 / 0.922, 0.0, -0.2 / 0.922};
+	const double v[3] = {normal[1] * u[2] - normal[2] * u[1], normal[2] * u[0] - normal[0] * u[2], normal[0] * u[1] - normal[1] * u[0]};
+	std::vector<std::array<double, 3> > points(1 << 19);
+	srand(7);
+	for(size_t k = 0; k < points.size(); ++k)
+	{
+		double a = 0.05 * ((double)rand() / RAND_MAX - 0.5), b = 0.03 * ((double)rand() / RAND_MAX - 0.5), c = 0.0001 * ((double)rand() / RAND_MAX - 0.5);
+		for(int i = 0; i < 3; ++i)
+		{
+			points[k][i] = (i == 2 ? 0.11 : 0.0) + a * u[i] + b * v[i] + c * normal[i];
+		}
+	}
+
+	//Two pass reference in long double
+	long double mean[3] = {0, 0, 0}, scatter[3][3] = {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}};
+	for(size_t k = 0; k < points.size(); ++k)
+	{
+		for(int i = 0; i < 3; ++i)
+		{
+			mean[i] += points[k][i];
+		}
+	}
+	for(int i = 0; i < 3; ++i)
+	{
+		mean[i] /= points.size();
+	}
+	for(size_t k = 0; k < points.size(); ++k)
+	{
+		for(int i = 0; i < 3; ++i)
+		{
+			for(int j = 0; j < 3; ++j)
+			{
+				scatter[i][j] += (points[k][i] - mean[i]) * (points[k][j] - mean[j]);
+			}
+		}
+	}
+
+	std::array<double, 3> single_normal = {{0.0, 0.0, 0.0}};
+	const unsigned int thread_counts[] = {1, 2, 3, 8};
+	for(unsigned int t = 0; t < 4; ++t)
+	{
+		const unsigned int threads = thread_counts[t];
+		FalconPointFit fit;
+		fit.addPoints(points, threads);
+		check(fit.getCount() == points.size(), "every point counted", threads);
+
+		std::array<double, 3> center;
+		gmtl::Matrix33d covariance;
+		fit.getCenter(center);
+		fit.getCovariance(covariance);
+		double center_error = 0.0, covariance_error = 0.0, covariance_size = 0.0;
+		for(int i = 0; i < 3; ++i)
+		{
+			center_error = std::max(center_error, (double)std::fabs(center[i] - mean[i]));
+			for(int j = 0; j < 3; ++j)
+			{
+				covariance_error = std::max(covariance_error, (double)std::fabs(covariance(i, j) - scatter[i][j] / points.size()));
+				covariance_size = std::max(covariance_size, (double)std::fabs(scatter[i][j] / points.size()));
+			}
+		}
+		check(center_error < 1e-15, "center matches the two pass mean", threads);
+		check(covariance_error < 1e-12 * covariance_size, "covariance matches the two pass covariance", threads);
+
+		std::array<double, 3> plane_center, plane_normal;
+		double rms;
+		check(fit.fitPlane(plane_center, plane_normal, rms), "plane fitted", threads);
+		if(t == 0)
+		{
+			single_normal = plane_normal;
+		}
+		const double cosine = std::fabs(plane_normal[0] * single_normal[0] + plane_normal[1] * single_normal[1] + plane_normal[2] * single_normal[2]);
+		check(cosine > 1.0 - 1e-14, "plane normal matches the single thread fit", threads);
+	}
+
+	if(failures)
+	{
+		std::cout << failures << " failures" << std::endl;
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+#
+# Packs the firmware images in firmware/*.bin into src/firmware/FalconFirmwareImageData.cpp,
+# LZSS compressed, for the FalconFirmwareImages registry.
+#
+# Usage: firmware2cpp.py [firmware directory] [output file]
+#
+# Defaults to the paths in the source tree when run from the repository root. Rerun this
+# whenever a .bin file is added or changed, and commit the output.
+#
+# Stream format (decoded by FalconFirmwareImages::decode):
+#  - A flag byte, then up to 8 items. Bit n of the flag byte (LSB first) describes item n.
+#  - Flag set: item is one literal byte.
+#  - Flag clear: item is a 2 byte back reference, big endian. High 12 bits are the distance
+#    back into the output minus 1, low 4 bits are the copy length minus 3.
+
+import glob
+import os
+import sys
+import zlib
+
+WINDOW = 4096
+MIN_MATCH = 3
+MAX_MATCH = 18
+
+# Registry name and description for each known image. Anything else gets its file name.
+# nvent goes first, as it's the default image.
+KNOWN_IMAGES = [
+    ("nvent_firmware.bin", "nvent", "Firmware from the latest nVent software release (recommended)"),
+    ("test_firmware.bin", "test", "Novint test firmware"),
+    ("novint_T0.bin", "novint_T0", "Firmware from the Novint SDK, T0 revision"),
+    ("novint_T2.bin", "novint_T2", "Firmware from the Novint SDK, T2 revision"),
+]
+
+
+def compress(data):
+    out = bytearray()
+    heads = {}
+    i = 0
+    n = len(data)
+    while i < n:
+        flag_pos = len(out)
+        out.append(0)
+        flags = 0
+        for bit in range(8):
+            if i >= n:
+                break
+            best_length = 0
+            best_distance = 0
+            # Newest candidates first, so ties go to the shortest distance
+            for j in reversed(heads.get(data[i:i + MIN_MATCH], [])):
+                if i - j > WINDOW:
+                    break
+                length = 0
+                while length < MAX_MATCH and i + length < n and data[j + length] == data[i + length]:
+                    length += 1
+                if length > best_length:
+                    best_length = length
+                    best_distance = i - j
+                    if length == MAX_MATCH:
+                        break
+            if best_length >= MIN_MATCH:
+                value = ((best_distance - 1) << 4) | (best_length - MIN_MATCH)
+                out.append(value >> 8)
+                out.append(value & 0xff)
+                step = best_length
+            else:
+                flags |= 1 << bit
+                out.append(data[i])
+                step = 1
+            for k in range(i, i + step):
+                heads.setdefault(data[k:k + MIN_MATCH], []).append(k)
+            i += step
+        out[flag_pos] = flags
+    return bytes(out)
+
+
+def decompress(data, size):
+    out = bytearray()
+    pos = 0
+    while len(out) < size:
+        flags = data[pos]
+        pos += 1
+        for bit in range(8):
+            if len(out) >= size:
+                break
+            if flags & (1 << bit):
+                out.append(data[pos])
+                pos += 1
+            else:
+                value = (data[pos] << 8) | data[pos + 1]
+                pos += 2
+                distance = (value >> 4) + 1
+                for _ in range((value & 0xf) + MIN_MATCH):
+                    out.append(out[-distance])
+    return bytes(out)
+
+
+def main():
+    root = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+    firmware_dir = sys.argv[1] if len(sys.argv) > 1 else os.path.join(root, "firmware")
+    out_path = sys.argv[2] if len(sys.argv) > 2 else os.path.join(root, "src", "firmware", "FalconFirmwareImageData.cpp")
+
+    files = sorted(os.path.basename(f) for f in glob.glob(os.path.join(firmware_dir, "*.bin")))
+    known = [k for k in KNOWN_IMAGES if k[0] in files]
+    known_files = [k[0] for k in known]
+    images = known + [(f, f[:-4], f[:-4]) for f in files if f not in known_files]
+    if not images:
+        print("No firmware images found in %s" % firmware_dir)
+        return 1
+
+    out = []
+    out.append("/***")
+    out.append(" * @file FalconFirmwareImageData.cpp")
+    out.append(" * @brief Compressed firmware images for FalconFirmwareImages")
+    out.append(" *")
+    out.append(" * Generated by util/firmware2cpp.py from the .bin files in firmware/. Do not edit, rerun the script instead.")
+    out.append(" *")
+    out.append(" * Project info at http://libnifalcon.nonpolynomial.com/")
+    out.append(" *")
+    out.append(" */")
+    out.append("")
+    out.append('#include "falcon/firmware/FalconFirmwareImages.h"')
+    out.append("")
+    out.append("namespace libnifalcon")
+    out.append("{")
+    entries = []
+    for index, (filename, name, description) in enumerate(images):
+        data = open(os.path.join(firmware_dir, filename), "rb").read()
+        packed = compress(data)
+        if decompress(packed, len(data)) != data:
+            print("Round trip failed for %s" % filename)
+            return 1
+        symbol = "IMAGE_DATA_%d" % index
+        out.append("\t//%s, %d bytes packed to %d" % (filename, len(data), len(packed)))
+        out.append("\tstatic const uint8_t %s[] = {" % symbol)
+        for row in range(0, len(packed), 16):
+            out.append("\t\t" + ",".join("0x%02x" % b for b in packed[row:row + 16]) + ",")
+        out.append("\t};")
+        out.append("")
+        entries.append('\t\t{"%s", "%s", %d, %d, 0x%08xu, %s}' % (name, description, len(data), len(packed), zlib.crc32(data) & 0xffffffff, symbol))
+        print("%s: %d -> %d bytes" % (filename, len(data), len(packed)))
+    out.append("\tconst FalconFirmwareImage FalconFirmwareImages::IMAGES[] = {")
+    out.append(",\n".join(entries))
+    out.append("\t};")
+    out.append("")
+    out.append("\tconst unsigned int FalconFirmwareImages::IMAGE_COUNT = %d;" % len(images))
+    out.append("}")
+    out.append("")
+
+    with open(out_path, "w") as f:
+        f.write("\n".join(out))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())